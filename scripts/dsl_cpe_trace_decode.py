@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+#                          Copyright (c) 2007-2015
+#                     Lantiq Beteiligungs-GmbH & Co. KG
+#
+#  For licensing information, see the file 'LICENSE' in the root folder of
+#  this software module.
+#
+###############################################################################
+#
+# Decoder for the DSL CPE API binary trace captures.
+#
+# A tracepoint capture is the plain concatenation of the DSL_DBG_TraceEntry_t
+# entries read with the DSL_FIO_DBG_TRACE_GET ioctl, a message capture the
+# concatenation of the DSL_DBG_MsgTraceEntry_t entries read with the
+# DSL_FIO_DBG_MSG_TRACE_GET ioctl (refer to the examples in
+# drv_dsl_cpe_api_ioctl.h). Both use the same monotonic time base, so the
+# captures can be decoded together into
+#  - a timeline in the Chrome trace event format (chrome://tracing, Perfetto),
+#    the device messages are shown as instant events
+#  - folded stacks for flamegraph.pl (lineN;autoboot state;operation usec),
+#    tracepoints only
+#  - plain text, the device messages in the format of the
+#    DSL_DBG_MESSAGE_DUMP text output
+#
+# Usage:
+#  dsl_cpe_trace_decode.py [-b|-l] [-f timeline|folded|text] [-r]
+#                          [-t capture] [-m capture] [output]
+#
+###############################################################################
+
+import argparse
+import json
+import struct
+import sys
+
+# DSL_DBG_TraceEntry_t: nSeq, nTimeSec, nTimeNSec, nLine, nPoint, nReserved,
+# nResult, nArg[4]
+ENTRY_FORMAT = "IIIBBHiIIII"
+
+# DSL_DBG_MsgTraceEntry_t: nSeq, nTimeSec, nTimeNSec, nLine, nDir, nClass,
+# nMsgId, nSize, nData[DSL_DBG_MSG_TRACE_DATA_MAX]
+MSG_TRACE_DATA_MAX = 128
+MSG_ENTRY_FORMAT = "IIIBBHHH%ds" % MSG_TRACE_DATA_MAX
+
+# Same order as DSL_DBG_MsgTraceDir_t
+MSG_DIRECTIONS = ["tx", "rx", "ev"]
+
+# VDSL2_MBX_MSG_ID_IFX_MASK, messages with 32 bit payload words
+MSG_ID_IFX_MASK = 0x0010
+
+TRACE_MSG_SEND_ENTRY = 0
+TRACE_MSG_SEND_EXIT = 1
+TRACE_AUTOBOOT_STATE = 2
+TRACE_EVENT_QUEUE = 3
+TRACE_PM_UPDATE_ENTRY = 4
+TRACE_PM_UPDATE_EXIT = 5
+
+# Same order as DSL_Autoboot_State_t
+AUTOBOOT_STATES = [
+   "Unknown", "FirmwareRequest", "FirmwareWait", "FirmwareReady", "L3",
+   "Init", "Train", "Showtime", "Exception", "Diagnostic", "Restart",
+   "ConfigWriteWait", "LinkActivateWait", "RestartWait", "ShutDownRequest",
+   "ShutDownWait", "ShutDownReached", "Disabled"
+]
+
+DIRECTIONS = ["NE", "FE"]
+
+
+def state_name(nState):
+   if nState < len(AUTOBOOT_STATES):
+      return AUTOBOOT_STATES[nState]
+   return "State%d" % nState
+
+
+def read_entries(fileName, fmt):
+   size = struct.calcsize(fmt)
+
+   with open(fileName, "rb") as f:
+      data = f.read()
+
+   for offset in range(0, len(data) - size + 1, size):
+      yield struct.unpack_from(fmt, data, offset)
+
+
+def read_capture(fileName, byteOrder):
+   entries = []
+
+   for (seq, sec, nsec, line, point, _, result,
+        a0, a1, a2, a3) in read_entries(fileName, byteOrder + ENTRY_FORMAT):
+      entries.append({
+         "seq": seq, "ns": sec * 1000000000 + nsec, "line": line,
+         "point": point, "result": result, "arg": (a0, a1, a2, a3)})
+
+   entries.sort(key=lambda e: (e["ns"], e["seq"]))
+   return entries
+
+
+def read_msg_capture(fileName, byteOrder):
+   msgs = []
+
+   for (seq, sec, nsec, line, direction, msgClass, msgId, msgSize,
+        payload) in read_entries(fileName, byteOrder + MSG_ENTRY_FORMAT):
+      msgs.append({
+         "seq": seq, "ns": sec * 1000000000 + nsec, "line": line,
+         "dir": direction, "class": msgClass, "id": msgId, "size": msgSize,
+         "data": payload[:min(msgSize, MSG_TRACE_DATA_MAX)]})
+
+   msgs.sort(key=lambda m: (m["ns"], m["line"], m["seq"]))
+   return msgs
+
+
+def msg_direction(m):
+   if m["dir"] < len(MSG_DIRECTIONS):
+      return MSG_DIRECTIONS[m["dir"]]
+   return "d%d" % m["dir"]
+
+
+def msg_dump(m, byteOrder, raw):
+   """Formats a device message like the DSL_DBG_MESSAGE_DUMP output."""
+   if len(m["data"]) < 4:
+      return "line %d: short entry (%d bytes)" % (m["line"], m["size"])
+
+   header = struct.unpack_from(byteOrder + "HH", m["data"], 0)
+   text = "DSL[%02d/%s]: 0x%04x 0x%04x 0x%04x" % (
+      m["line"], msg_direction(m), m["id"], header[0], header[1])
+
+   data = m["data"][4:]
+   if raw:
+      text += " " + data.hex()
+      truncated = m["size"] > MSG_TRACE_DATA_MAX
+   else:
+      # Payload in 16 or 32 bit words as done by the message dump
+      if m["id"] & MSG_ID_IFX_MASK:
+         width, code, digits = 4, "I", 8
+      else:
+         width, code, digits = 2, "H", 4
+      count = len(data) // width
+      for w in struct.unpack_from(byteOrder + code * count, data, 0):
+         text += " %0*X" % (digits, w)
+      truncated = (m["size"] - 4) // width > count
+
+   if truncated:
+      text += " ... (%d bytes)" % m["size"]
+   return text
+
+
+def build_spans(entries):
+   """Pairs the entry/exit tracepoints and splits the time of each line into
+      autoboot state spans. Returns (spans, instants), times in ns."""
+   spans = []
+   instants = []
+   openMsg = {}
+   openPm = {}
+   lineState = {}
+
+   for e in entries:
+      line, point, arg, ns = e["line"], e["point"], e["arg"], e["ns"]
+
+      if point == TRACE_MSG_SEND_ENTRY:
+         openMsg[line] = e
+      elif point == TRACE_MSG_SEND_EXIT:
+         start = openMsg.pop(line, None)
+         if start is None:
+            continue
+         spans.append({
+            "line": line, "cat": "msg", "start": start["ns"], "end": ns,
+            "name": "MsgSend 0x%04X" % arg[0],
+            "args": {"retries": arg[1], "lockWaitNs": arg[2],
+                     "roundTripNs": arg[3], "result": e["result"]}})
+      elif point == TRACE_PM_UPDATE_ENTRY:
+         openPm[(line, arg[0])] = e
+      elif point == TRACE_PM_UPDATE_EXIT:
+         start = openPm.pop((line, arg[0]), None)
+         if start is None:
+            continue
+         spans.append({
+            "line": line, "cat": "pm", "start": start["ns"], "end": ns,
+            "name": "PmUpdate %s" % DIRECTIONS[arg[0] & 1],
+            "args": {"flags": start["arg"][1], "result": e["result"]}})
+      elif point == TRACE_AUTOBOOT_STATE:
+         prev = lineState.get(line)
+         if prev is not None:
+            spans.append({
+               "line": line, "cat": "autoboot", "start": prev[1], "end": ns,
+               "name": state_name(prev[0]), "args": {}})
+         lineState[line] = (arg[1], ns)
+      elif point == TRACE_EVENT_QUEUE:
+         instants.append({
+            "line": line, "ns": ns, "name": "Event %d" % arg[0],
+            "args": {"size": arg[1], "result": e["result"]}})
+
+   # Close the last autoboot state of each line at the end of the capture
+   if entries:
+      endNs = entries[-1]["ns"]
+      for line, (state, ns) in lineState.items():
+         spans.append({
+            "line": line, "cat": "autoboot", "start": ns, "end": endNs,
+            "name": state_name(state), "args": {}})
+
+   return spans, instants
+
+
+def write_timeline(spans, instants, msgs, out, baseNs, byteOrder):
+   events = []
+   for s in spans:
+      events.append({
+         "name": s["name"], "cat": s["cat"], "ph": "X",
+         "pid": s["line"], "tid": s["cat"],
+         "ts": (s["start"] - baseNs) / 1000.0,
+         "dur": (s["end"] - s["start"]) / 1000.0, "args": s["args"]})
+   for i in instants:
+      events.append({
+         "name": i["name"], "cat": "event", "ph": "i", "s": "t",
+         "pid": i["line"], "tid": "event",
+         "ts": (i["ns"] - baseNs) / 1000.0, "args": i["args"]})
+   for m in msgs:
+      events.append({
+         "name": "%s 0x%04X" % (msg_direction(m), m["id"]), "cat": "message",
+         "ph": "i", "s": "t", "pid": m["line"], "tid": "message",
+         "ts": (m["ns"] - baseNs) / 1000.0,
+         "args": {"dump": msg_dump(m, byteOrder, False)}})
+   json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, out)
+   out.write("\n")
+
+
+def write_folded(spans, out):
+   states = [s for s in spans if s["cat"] == "autoboot"]
+   ops = [s for s in spans if s["cat"] != "autoboot"]
+   folded = {}
+
+   for st in states:
+      childNs = 0
+      for op in ops:
+         if op["line"] == st["line"] and \
+            st["start"] <= op["start"] < st["end"]:
+            key = "line%d;%s;%s" % (st["line"], st["name"], op["name"])
+            folded[key] = folded.get(key, 0) + (op["end"] - op["start"])
+            childNs += op["end"] - op["start"]
+      key = "line%d;%s" % (st["line"], st["name"])
+      selfNs = max(st["end"] - st["start"] - childNs, 0)
+      folded[key] = folded.get(key, 0) + selfNs
+
+   for key in sorted(folded):
+      usec = folded[key] // 1000
+      if usec > 0:
+         out.write("%s %d\n" % (key, usec))
+
+
+def write_text(entries, msgs, out, baseNs, byteOrder, raw):
+   names = ["MSG_SEND_ENTRY", "MSG_SEND_EXIT", "AUTOBOOT_STATE",
+            "EVENT_QUEUE", "PM_UPDATE_ENTRY", "PM_UPDATE_EXIT"]
+   lines = []
+   for e in entries:
+      name = names[e["point"]] if e["point"] < len(names) else \
+         "POINT%d" % e["point"]
+      lines.append((e["ns"], "%10u %14.3f us line %d %-16s res %d "
+         "args 0x%X 0x%X 0x%X 0x%X" % (e["seq"], (e["ns"] - baseNs) / 1000.0,
+         e["line"], name, e["result"], e["arg"][0], e["arg"][1], e["arg"][2],
+         e["arg"][3])))
+   for m in msgs:
+      lines.append((m["ns"], "%10u %14.3f us %s" % (m["seq"],
+         (m["ns"] - baseNs) / 1000.0, msg_dump(m, byteOrder, raw))))
+
+   # Stable sort, tracepoints stay before messages of the same time stamp
+   lines.sort(key=lambda l: l[0])
+   for _, text in lines:
+      out.write(text + "\n")
+
+
+def main():
+   parser = argparse.ArgumentParser(
+      description="Decode DSL CPE API tracepoint and message trace captures")
+   order = parser.add_mutually_exclusive_group()
+   order.add_argument("-b", "--big-endian", action="store_const",
+      dest="order", const=">", help="captures taken on a big endian target")
+   order.add_argument("-l", "--little-endian", action="store_const",
+      dest="order", const="<", help="captures taken on a little endian target")
+   parser.add_argument("-f", "--format", default="timeline",
+      choices=["timeline", "folded", "text"], help="output format")
+   parser.add_argument("-r", "--raw", action="store_true",
+      help="print the message payload as raw bytes instead of message words")
+   parser.add_argument("-t", "--trace", metavar="capture",
+      help="binary tracepoint capture file")
+   parser.add_argument("-m", "--messages", metavar="capture",
+      help="binary message trace capture file")
+   parser.add_argument("output", nargs="?", help="output file (default stdout)")
+   args = parser.parse_args()
+
+   if args.trace is None and args.messages is None:
+      parser.error("at least one of -t and -m is required")
+
+   byteOrder = args.order or "="
+   entries = read_capture(args.trace, byteOrder) if args.trace else []
+   msgs = read_msg_capture(args.messages, byteOrder) if args.messages else []
+   times = [x["ns"] for x in entries[:1] + msgs[:1]]
+   baseNs = min(times) if times else 0
+   out = open(args.output, "w") if args.output else sys.stdout
+
+   if args.format == "text":
+      write_text(entries, msgs, out, baseNs, byteOrder, args.raw)
+   else:
+      spans, instants = build_spans(entries)
+      if args.format == "timeline":
+         write_timeline(spans, instants, msgs, out, baseNs, byteOrder)
+      else:
+         write_folded(spans, out)
+
+   if out is not sys.stdout:
+      out.close()
+   return 0
+
+
+if __name__ == "__main__":
+   sys.exit(main())
@@ -29,6 +29,13 @@ static DSL_Error_t DSL_CEOC_CallbackHandle(
    DSL_CEOC_Message_t *pMsg);
 #endif
 
+static DSL_void_t DSL_CEOC_TxQueueDrain(
+   DSL_Context_t *pContext);
+
+static DSL_void_t DSL_CEOC_TxQueueFlush(
+   DSL_Context_t *pContext,
+   DSL_Error_t nResult);
+
 /** \addtogroup DRV_DSL_CPE_COMMON
  @{ */
 
@@ -78,9 +85,14 @@ static DSL_int_t DSL_CEOC_Thread(DSL_DRV_ThreadParams_t *param)
       if ((nCurrentState != DSL_LINESTATE_SHOWTIME_TC_SYNC) &&
           (nCurrentState != DSL_LINESTATE_SHOWTIME_NO_SYNC))
       {
+         /* Queued messages can not be sent anymore*/
+         DSL_CEOC_TxQueueFlush(pContext, DSL_ERR_ONLY_AVAILABLE_IN_SHOWTIME);
          continue;
       }
 
+      /* Send the queued messages*/
+      DSL_CEOC_TxQueueDrain(pContext);
+
       /* Clear message length*/
       ceocMsg.length = 0x0;
       if( DSL_CEOC_DEV_MessageReceive(pContext, &protIdent, &ceocMsg) < DSL_SUCCESS )
@@ -187,6 +199,15 @@ DSL_Error_t DSL_CEOC_Start(DSL_Context_t *pContext)
    DSL_DRV_MUTEX_INIT(DSL_CEOC_CONTEXT(pContext)->ceocInternMutex);
 #endif /* #ifdef INCLUDE_DSL_CEOC_INTERNAL_API*/
 
+   /* init CEOC Tx queue */
+   DSL_DRV_MUTEX_INIT(DSL_CEOC_CONTEXT(pContext)->txMutex);
+   DSL_Fifo_Init(
+      &(DSL_CEOC_CONTEXT(pContext)->txFifo),
+      (DSL_uint8_t*)&(DSL_CEOC_CONTEXT(pContext)->txFifoBuf[0]),
+      (DSL_uint8_t*)&(DSL_CEOC_CONTEXT(pContext)->txFifoBuf[DSL_CEOC_TX_QUEUE_SIZE - 1]),
+      sizeof(DSL_CEOC_TxEntry_t));
+   DSL_CEOC_CONTEXT(pContext)->txStatus.nQueueSize = DSL_CEOC_TX_QUEUE_SIZE;
+
    /* Initialize CEOC module device specific parameters*/
    if( DSL_CEOC_DEV_Start(pContext) != DSL_SUCCESS )
    {
@@ -208,7 +229,7 @@ DSL_Error_t DSL_CEOC_Start(DSL_Context_t *pContext)
 
    /* Start CEOC module thread*/
    nErrCode = (DSL_Error_t)DSL_DRV_THREAD(&DSL_CEOC_CONTEXT(pContext)->ceocThread.Control,
-                              "ceocex_ne", DSL_CEOC_Thread, (DSL_uint32_t)pContext);
+                              "ceocex_ne", DSL_CEOC_Thread, (DSL_ulong_t)pContext);
 
    if( nErrCode != DSL_SUCCESS )
    {
@@ -274,6 +295,9 @@ DSL_Error_t DSL_CEOC_Stop(DSL_Context_t *pContext)
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
    }
 
+   /* Complete the messages which are still queued*/
+   DSL_CEOC_TxQueueFlush(pContext, DSL_ERR_CEOC_TX_ERR);
+
    /* Call device specific CEOC de-initialization stuff*/
    nErrCode = DSL_CEOC_DEV_Stop(pContext);
    if( nErrCode != DSL_SUCCESS )
@@ -318,7 +342,7 @@ DSL_Error_t DSL_CEOC_Restart(DSL_Context_t *pContext)
 
       /* Start CEOC module thread*/
       nErrCode = (DSL_Error_t)DSL_DRV_THREAD(&DSL_CEOC_CONTEXT(pContext)->ceocThread.Control,
-                                 "ceocex_ne", DSL_CEOC_Thread, (DSL_uint32_t)pContext);
+                                 "ceocex_ne", DSL_CEOC_Thread, (DSL_ulong_t)pContext);
 
       if( nErrCode != DSL_SUCCESS )
       {
@@ -443,13 +467,437 @@ DSL_Error_t DSL_CEOC_MessageSend(
    return nErrCode;
 }
 
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_ceoc.h'
+*/
+DSL_Error_t DSL_CEOC_MessageQueue(
+   DSL_Context_t *pContext,
+   DSL_uint16_t protIdent,
+   DSL_CEOC_Message_t *pMsg,
+   DSL_uint32_t *pSeqNum)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_LineStateValue_t nCurrentState = DSL_LINESTATE_UNKNOWN;
+   DSL_CEOC_Context_t *pCeocCtx;
+   DSL_CEOC_TxEntry_t *pEntry;
+   DSL_uint32_t nLevel;
+
+   DSL_CHECK_POINTER(pContext, pMsg);
+   DSL_CHECK_ERR_CODE();
+   DSL_CHECK_POINTER(pContext, pSeqNum);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_CEOC_MessageQueue"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
+
+   pCeocCtx = DSL_CEOC_CONTEXT(pContext);
+
+   if( (pCeocCtx == DSL_NULL) || !pCeocCtx->bInit )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - CEOC module not initialized!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERROR;
+   }
+
+   /* Check message length*/
+   if( pMsg->length > DSL_G997_SNMP_MESSAGE_LENGTH || pMsg->length == 0 )
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (pContext,
+         SYS_DBG_ERR"DSL[%02d]: ERROR - EOC message length should "
+         "be in range [1...%d]!" DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
+         DSL_G997_SNMP_MESSAGE_LENGTH));
+
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   /* Only accept messages if the specified line is in SHOWTIME state*/
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, nLineState, nCurrentState);
+
+   if ((nCurrentState != DSL_LINESTATE_SHOWTIME_TC_SYNC) &&
+       (nCurrentState != DSL_LINESTATE_SHOWTIME_NO_SYNC))
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+        (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - function only available in the SHOWTIME!"
+        DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_ONLY_AVAILABLE_IN_SHOWTIME;
+   }
+
+   if( DSL_DRV_MUTEX_LOCK( pCeocCtx->txMutex ) )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - EOC Tx queue mutex lock failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   if (DSL_Fifo_isFull(&(pCeocCtx->txFifo)))
+   {
+      pCeocCtx->txStatus.nTxRejected++;
+      nErrCode = DSL_ERR_CEOC_TX_QUEUE_FULL;
+   }
+   else if ((pEntry = (DSL_CEOC_TxEntry_t*)DSL_Fifo_writeElement(&(pCeocCtx->txFifo))) == DSL_NULL)
+   {
+      nErrCode = DSL_ERR_INTERNAL;
+   }
+   else
+   {
+      pCeocCtx->nTxSeqNum++;
+
+      pEntry->protIdent  = protIdent;
+      pEntry->nSeqNum    = pCeocCtx->nTxSeqNum;
+      pEntry->nQueueTime = DSL_DRV_TimeMSecGet();
+      memcpy(&(pEntry->msg), pMsg, sizeof(DSL_CEOC_Message_t));
+
+      nLevel = DSL_Fifo_getCount(&(pCeocCtx->txFifo));
+      if (nLevel > pCeocCtx->txStatus.nQueueLevelMax)
+      {
+         pCeocCtx->txStatus.nQueueLevelMax = nLevel;
+      }
+      pCeocCtx->txStatus.nLastQueuedSeqNum = pEntry->nSeqNum;
+
+      *pSeqNum = pEntry->nSeqNum;
+   }
+
+   DSL_DRV_MUTEX_UNLOCK( pCeocCtx->txMutex );
+
+   if (nErrCode == DSL_SUCCESS)
+   {
+      /* Let the CEOC thread send the message*/
+      DSL_DRV_WAKEUP_EVENT(pCeocCtx->ceocThread.waitEvent);
+   }
+   else
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: WARNING - EOC message not queued, "
+         "retCode=%d!" DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_CEOC_MessageQueue, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_ceoc.h'
+*/
+DSL_Error_t DSL_CEOC_TxStatusGet(
+   DSL_Context_t *pContext,
+   DSL_G997_SnmpTxStatusData_t *pData)
+{
+   DSL_CEOC_Context_t *pCeocCtx;
+
+   pCeocCtx = DSL_CEOC_CONTEXT(pContext);
+
+   if( (pCeocCtx == DSL_NULL) || !pCeocCtx->bInit )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - CEOC module not initialized!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERROR;
+   }
+
+   if( DSL_DRV_MUTEX_LOCK( pCeocCtx->txMutex ) )
+   {
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   *pData = pCeocCtx->txStatus;
+   pData->nQueueLevel = DSL_Fifo_getCount(&(pCeocCtx->txFifo));
+
+   DSL_DRV_MUTEX_UNLOCK( pCeocCtx->txMutex );
+
+   return DSL_SUCCESS;
+}
+
+/*
+   Updates the Tx statistics for a completed message and fills its completion
+   data. The caller has to hold the Tx queue mutex.
+*/
+static DSL_void_t DSL_CEOC_TxCompletionSet(
+   DSL_CEOC_Context_t *pCeocCtx,
+   DSL_CEOC_TxEntry_t *pEntry,
+   DSL_Error_t nResult,
+   DSL_G997_SnmpTxCompletionData_t *pCompletion)
+{
+   DSL_G997_SnmpTxStatusData_t *pStatus = &(pCeocCtx->txStatus);
+   DSL_uint32_t nLatency;
+
+   nLatency = DSL_DRV_TimeMSecGet() - pEntry->nQueueTime;
+
+   if ((pStatus->nTxMessages + pStatus->nTxFailed) == 0)
+   {
+      pStatus->nLatencyMin = nLatency;
+      pStatus->nLatencyMax = nLatency;
+      pStatus->nLatencyAvg = nLatency;
+   }
+   else
+   {
+      if (nLatency < pStatus->nLatencyMin)
+      {
+         pStatus->nLatencyMin = nLatency;
+      }
+      if (nLatency > pStatus->nLatencyMax)
+      {
+         pStatus->nLatencyMax = nLatency;
+      }
+      pStatus->nLatencyAvg = (7 * pStatus->nLatencyAvg + nLatency) >> 3;
+   }
+
+   if (nResult == DSL_SUCCESS)
+   {
+      pStatus->nTxMessages++;
+   }
+   else
+   {
+      pStatus->nTxFailed++;
+   }
+
+   pCompletion->nSeqNum  = pEntry->nSeqNum;
+   pCompletion->nResult  = nResult;
+   pCompletion->nLatency = nLatency;
+
+   pStatus->lastCompletion = *pCompletion;
+}
+
+/*
+   Generates DSL_EVENT_S_SNMP_MESSAGE_SENT for completed messages.
+*/
+static DSL_void_t DSL_CEOC_TxCompletionSignal(
+   DSL_Context_t *pContext,
+   DSL_G997_SnmpTxCompletionData_t *pCompletion,
+   DSL_uint32_t nCount)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < nCount; i++)
+   {
+      if (DSL_DRV_EventGenerate(
+             pContext, 0, DSL_ACCESSDIR_NA, DSL_XTUDIR_NA,
+             DSL_EVENT_S_SNMP_MESSAGE_SENT,
+             (DSL_EventData_Union_t*)&(pCompletion[i]),
+             sizeof(DSL_G997_SnmpTxCompletionData_t)) != DSL_SUCCESS)
+      {
+         DSL_DEBUG(DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - DSL_EVENT_S_SNMP_MESSAGE_SENT "
+            "event generation failed!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      }
+   }
+}
+
+/*
+   Sends the queued messages back to back. The CEOC common mutex and the
+   device (bspMutex) are locked once for the whole batch so that no other
+   message is interleaved, the Tx queue mutex is only held to take a message
+   from the queue so that new messages can be queued while the batch is sent.
+*/
+static DSL_void_t DSL_CEOC_TxQueueDrain(
+   DSL_Context_t *pContext)
+{
+   DSL_CEOC_Context_t *pCeocCtx = DSL_CEOC_CONTEXT(pContext);
+   DSL_G997_SnmpTxCompletionData_t completion[DSL_CEOC_TX_QUEUE_SIZE];
+   DSL_CEOC_TxEntry_t txEntry;
+   DSL_CEOC_TxEntry_t *pEntry;
+   DSL_Error_t nResult;
+   DSL_uint32_t nCount = 0;
+
+   if (DSL_Fifo_isEmpty(&(pCeocCtx->txFifo)))
+   {
+      return;
+   }
+
+   /* Lock CEOC common mutex*/
+   if( DSL_DRV_MUTEX_LOCK( pCeocCtx->ceocMutex ) )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - EOC common mutex lock failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return;
+   }
+
+   /* Lock the device for the whole batch*/
+   if (DSL_DRV_MUTEX_LOCK(pContext->bspMutex))
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Getting mei driver semaphore failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      DSL_DRV_MUTEX_UNLOCK( pCeocCtx->ceocMutex );
+
+      return;
+   }
+
+   /* One batch sends at most one queue filling, messages queued meanwhile
+      are sent with the next batch*/
+   while (nCount < DSL_CEOC_TX_QUEUE_SIZE)
+   {
+      if( DSL_DRV_MUTEX_LOCK( pCeocCtx->txMutex ) )
+      {
+         break;
+      }
+
+      pEntry = DSL_NULL;
+      if (!DSL_Fifo_isEmpty(&(pCeocCtx->txFifo)))
+      {
+         pEntry = (DSL_CEOC_TxEntry_t*)DSL_Fifo_readElement(&(pCeocCtx->txFifo));
+         if (pEntry != DSL_NULL)
+         {
+            memcpy(&txEntry, pEntry, sizeof(DSL_CEOC_TxEntry_t));
+         }
+      }
+
+      DSL_DRV_MUTEX_UNLOCK( pCeocCtx->txMutex );
+
+      if (pEntry == DSL_NULL)
+      {
+         break;
+      }
+
+      nResult = DSL_CEOC_DEV_MessageSendLocked(
+                   pContext, txEntry.protIdent, &(txEntry.msg));
+      if (nResult != DSL_SUCCESS)
+      {
+         DSL_DEBUG(DSL_DBG_ERR,
+           (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - EOC message (%u) send failed!"
+           DSL_DRV_CRLF, DSL_DEV_NUM(pContext), txEntry.nSeqNum));
+      }
+
+      if( DSL_DRV_MUTEX_LOCK( pCeocCtx->txMutex ) == 0 )
+      {
+         DSL_CEOC_TxCompletionSet(pCeocCtx, &txEntry, nResult, &(completion[nCount]));
+         if (nCount + 1 > pCeocCtx->txStatus.nBatchMax)
+         {
+            pCeocCtx->txStatus.nBatchMax = nCount + 1;
+         }
+
+         DSL_DRV_MUTEX_UNLOCK( pCeocCtx->txMutex );
+      }
+      else
+      {
+         /* The Tx status can not be updated without the Tx queue mutex,
+            but the message was sent and its completion has to be signaled
+            anyhow*/
+         completion[nCount].nSeqNum  = txEntry.nSeqNum;
+         completion[nCount].nResult  = nResult;
+         completion[nCount].nLatency =
+            DSL_DRV_TimeMSecGet() - txEntry.nQueueTime;
+      }
+
+      nCount++;
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+
+   /* Unlock CEOC common mutex*/
+   DSL_DRV_MUTEX_UNLOCK( pCeocCtx->ceocMutex );
+
+   DSL_CEOC_TxCompletionSignal(pContext, completion, nCount);
+}
+
+/*
+   Completes all queued messages with the given result without sending them.
+*/
+static DSL_void_t DSL_CEOC_TxQueueFlush(
+   DSL_Context_t *pContext,
+   DSL_Error_t nResult)
+{
+   DSL_CEOC_Context_t *pCeocCtx = DSL_CEOC_CONTEXT(pContext);
+   DSL_G997_SnmpTxCompletionData_t completion[DSL_CEOC_TX_QUEUE_SIZE];
+   DSL_CEOC_TxEntry_t *pEntry;
+   DSL_uint32_t nCount = 0;
+
+   if (DSL_Fifo_isEmpty(&(pCeocCtx->txFifo)))
+   {
+      return;
+   }
+
+   if( DSL_DRV_MUTEX_LOCK( pCeocCtx->txMutex ) )
+   {
+      return;
+   }
+
+   while ((nCount < DSL_CEOC_TX_QUEUE_SIZE) &&
+          !DSL_Fifo_isEmpty(&(pCeocCtx->txFifo)))
+   {
+      pEntry = (DSL_CEOC_TxEntry_t*)DSL_Fifo_readElement(&(pCeocCtx->txFifo));
+      if (pEntry == DSL_NULL)
+      {
+         break;
+      }
+
+      DSL_CEOC_TxCompletionSet(pCeocCtx, pEntry, nResult, &(completion[nCount]));
+      nCount++;
+   }
+
+   DSL_DRV_MUTEX_UNLOCK( pCeocCtx->txMutex );
+
+   DSL_DEBUG(DSL_DBG_WRN,
+      (pContext, SYS_DBG_WRN"DSL[%02d]: WARNING - %u queued EOC messages discarded, "
+      "result=%d!" DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nCount, nResult));
+
+   DSL_CEOC_TxCompletionSignal(pContext, completion, nCount);
+}
+
+/*
+   Drops one reference to a received SNMP message and frees the message buffer
+   when the last FIFO slot referencing it has been released. The reference
+   count is changed atomically, so dropping a reference can not fail.
+*/
+static DSL_void_t DSL_CEOC_SnmpMsgBufRelease(
+   DSL_Context_t *pContext,
+   DSL_CEOC_SnmpMsgBuf_t *pBuf)
+{
+   if (DSL_DRV_ATOMIC_FETCH_ADD(&(pBuf->nRefCount), (DSL_uint32_t)-1) == 1)
+   {
+      DSL_DRV_MemFree(pBuf);
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_ceoc.h'
+*/
+DSL_void_t DSL_CEOC_FifoSnmpFlush(
+   DSL_OpenContext_t *pOpenCtx,
+   DSL_Context_t *pContext)
+{
+   DSL_CEOC_SnmpMsgBuf_t **ppElmnt;
+
+   if ((pOpenCtx->rxSnmpFifo == DSL_NULL) || (pOpenCtx->rxSnmpFifoBuf == DSL_NULL))
+   {
+      return;
+   }
+
+   while (!DSL_Fifo_isEmpty(pOpenCtx->rxSnmpFifo))
+   {
+      ppElmnt = (DSL_CEOC_SnmpMsgBuf_t**)DSL_Fifo_readElement(pOpenCtx->rxSnmpFifo);
+      if (ppElmnt == DSL_NULL)
+      {
+         break;
+      }
+
+      DSL_CEOC_SnmpMsgBufRelease(pContext, *ppElmnt);
+   }
+}
+
 static DSL_Error_t DSL_CEOC_FifoSnmpMessageRead(
    DSL_OpenContext_t *pOpenCtx,
    DSL_Context_t *pContext,
    DSL_CEOC_Message_t *pMsg)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint8_t *pElmnt = DSL_NULL;
+   DSL_CEOC_SnmpMsgBuf_t **ppElmnt = DSL_NULL;
+   DSL_CEOC_SnmpMsgBuf_t *pBuf = DSL_NULL;
 
    DSL_CHECK_POINTER(pContext, pMsg);
    DSL_CHECK_ERR_CODE();
@@ -481,9 +929,9 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageRead(
       }
       else
       {
-         pElmnt = DSL_Fifo_readElement(pOpenCtx->rxSnmpFifo);
+         ppElmnt = (DSL_CEOC_SnmpMsgBuf_t**)DSL_Fifo_readElement(pOpenCtx->rxSnmpFifo);
 
-         if( pElmnt == DSL_NULL )
+         if( ppElmnt == DSL_NULL )
          {
             DSL_DEBUG( DSL_DBG_ERR,
                (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - received NULL pointer to the CEOC SNMP fifo!"
@@ -493,8 +941,9 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageRead(
          }
          else
          {
-            /* copy an element */
-            memcpy(pMsg, pElmnt, sizeof(DSL_G997_SnmpData_t));
+            /* copy the shared message, the slot reference is dropped below */
+            pBuf = *ppElmnt;
+            memcpy(pMsg, &(pBuf->msg), sizeof(DSL_CEOC_Message_t));
          }
       }
    }
@@ -505,6 +954,11 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageRead(
 
    DSL_DRV_MUTEX_UNLOCK(pOpenCtx->rxSnmpFifoMutex);
 
+   if (pBuf != DSL_NULL)
+   {
+      DSL_CEOC_SnmpMsgBufRelease(pContext, pBuf);
+   }
+
    DSL_DEBUG(DSL_DBG_MSG, (pContext,
       SYS_DBG_MSG"DSL[%02d]: OUT - DSL_CEOC_FifoSnmpMessageRead, retCode=%d"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
@@ -517,8 +971,11 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageWrite(
    DSL_CEOC_Message_t *pMsg)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint8_t *pElmnt = DSL_NULL;
+   DSL_CEOC_SnmpMsgBuf_t **ppElmnt = DSL_NULL;
+   DSL_CEOC_SnmpMsgBuf_t *pBuf = DSL_NULL;
    DSL_OpenContext_t *pCurr;
+   DSL_EventStatusData_t evData;
+   DSL_boolean_t bQueued = DSL_FALSE;
 
    DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
    DSL_CHECK_ERR_CODE();
@@ -529,6 +986,16 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageWrite(
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_CEOC_FifoSnmpMessageWrite"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
+   /* The message is copied once into a buffer which is shared by all
+      instances, the instance FIFOs only hold references to it*/
+   pBuf = (DSL_CEOC_SnmpMsgBuf_t*)DSL_DRV_Malloc(sizeof(DSL_CEOC_SnmpMsgBuf_t));
+
+   DSL_DRV_MemSet(&evData, 0, sizeof(DSL_EventStatusData_t));
+   evData.nEventType = DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE;
+   evData.nXtuDir    = DSL_XTUDIR_NA;
+   evData.nAccessDir = DSL_ACCESSDIR_NA;
+   evData.pData      = DSL_NULL;
+
    /* Lock Open Context list*/
    if (DSL_DRV_MUTEX_LOCK(pContext->pDevCtx->openContextListMutex))
    {
@@ -536,11 +1003,45 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageWrite(
          (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock Context List mutex!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
+      if (pBuf != DSL_NULL)
+      {
+         DSL_DRV_MemFree(pBuf);
+      }
+
       return DSL_ERR_SEMAPHORE_GET;
    }
 
+   pContext->snmpStats.nRxMessages++;
+
+   if (pBuf == DSL_NULL)
+   {
+      pContext->snmpStats.nRxNoMemory++;
+
+      /* Unlock Open Context list*/
+      DSL_DRV_MUTEX_UNLOCK(pContext->pDevCtx->openContextListMutex);
+
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - no memory for the SNMP message!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_MEMORY;
+   }
+
+   /*  DSL_G997_SnmpData_t and DSL_CEOC_Message_t structures are identical,
+        we can use any*/
+   memcpy(&(pBuf->msg), pMsg, sizeof(DSL_CEOC_Message_t));
+   /* Hold a reference while the slots are filled so that a concurrent reader
+      can not free the buffer*/
+   pBuf->nRefCount = 1;
+
    for (pCurr = pOpenContextList; pCurr != DSL_NULL; pCurr = pCurr->pNext)
    {
+      /* Queue the message only for a specified device*/
+      if (pContext->pDevCtx->nNum != pCurr->pDevCtx->nNum)
+      {
+         continue;
+      }
+
       if (DSL_DRV_MUTEX_LOCK(pCurr->rxSnmpFifoMutex))
       {
          DSL_DEBUG( DSL_DBG_ERR,
@@ -552,6 +1053,8 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageWrite(
          break;
       }
 
+      bQueued = DSL_FALSE;
+
       if ((pCurr->rxSnmpFifo != DSL_NULL) &&
           (pCurr->rxSnmpFifoBuf != DSL_NULL) &&
           ((pCurr->nResourceActivationMask & DSL_RESOURCE_ACTIVATION_SNMP) == DSL_RESOURCE_ACTIVATION_CLEANED))
@@ -559,13 +1062,17 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageWrite(
          /* Check if there is a free space in the SNMP FIFO*/
          if ( DSL_Fifo_isFull(pCurr->rxSnmpFifo) )
          {
+            pCurr->nRxSnmpDropped++;
+            pContext->snmpStats.nRxDroppedTotal++;
+
             DSL_DEBUG( DSL_DBG_WRN,
               (pContext, SYS_DBG_WRN"DSL[%02d]: WARNING - CEOC Rx SNMP fifo is full!"
               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
          }
          else
          {
-            if ((pElmnt = DSL_Fifo_writeElement(pCurr->rxSnmpFifo)) == DSL_NULL)
+            ppElmnt = (DSL_CEOC_SnmpMsgBuf_t**)DSL_Fifo_writeElement(pCurr->rxSnmpFifo);
+            if (ppElmnt == DSL_NULL)
             {
                DSL_DEBUG( DSL_DBG_ERR,
                   (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - received NULL pointer to the CEOC SNMP fifo!"
@@ -575,35 +1082,30 @@ static DSL_Error_t DSL_CEOC_FifoSnmpMessageWrite(
             }
             else
             {
-               /* copy an element */
-               /*  DSL_G997_SnmpData_t and DSL_CEOC_Message_t structures are identical,
-                    we can use any*/
-               memcpy(pElmnt, pMsg, sizeof(DSL_G997_SnmpData_t));
+               DSL_DRV_ATOMIC_FETCH_ADD(&(pBuf->nRefCount), 1);
+
+               *ppElmnt = pBuf;
+               bQueued = DSL_TRUE;
             }
           }
       }
 
       DSL_DRV_MUTEX_UNLOCK(pCurr->rxSnmpFifoMutex);
+
+      if (bQueued == DSL_TRUE)
+      {
+         /* Signal DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE to this instance, the
+            event has no data so nothing is allocated for it*/
+         DSL_DRV_OpenContextEventQueue(pCurr, &evData, 0);
+      }
    }
 
    /* Unlock Open Context list*/
    DSL_DRV_MUTEX_UNLOCK(pContext->pDevCtx->openContextListMutex);
 
-   if (nErrCode == DSL_SUCCESS)
-   {
-      /* Generate DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE event*/
-      nErrCode = DSL_DRV_EventGenerate(
-                    pContext, 0, DSL_ACCESSDIR_NA, DSL_XTUDIR_NA,
-                    DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE, DSL_NULL, 0);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE "
-            "event generation failed!"DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext)));
-      }
-   }
+   /* Drop the reference of the writer, frees the buffer if no instance took
+      the message*/
+   DSL_CEOC_SnmpMsgBufRelease(pContext, pBuf);
 
    DSL_DEBUG(DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_CEOC_FifoSnmpMessageWrite, rerCode=%d"
@@ -140,6 +140,29 @@ DSL_Error_t DSL_CEOC_DEV_MessageSend(
    DSL_CEOC_Message_t *pMsg)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   if (DSL_DRV_MUTEX_LOCK(pContext->bspMutex))
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Getting mei driver semaphore failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERROR;
+   }
+
+   nErrCode = DSL_CEOC_DEV_MessageSendLocked(pContext, protIdent, pMsg);
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_CEOC_DEV_MessageSendLocked(
+   DSL_Context_t *pContext,
+   DSL_uint16_t protIdent,
+   DSL_CEOC_Message_t *pMsg)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_DEV_Handle_t dev;
    IOCTL_VRX_CEOC_frame_t vrxCeocFrame;
 
@@ -147,7 +170,7 @@ DSL_Error_t DSL_CEOC_DEV_MessageSend(
    DSL_CHECK_ERR_CODE();
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_CEOC_DEV_MessageSend"DSL_DRV_CRLF,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_CEOC_DEV_MessageSendLocked"DSL_DRV_CRLF,
       DSL_DEV_NUM(pContext)));
 
    if( DSL_DRV_VRX_FirmwareXdslModeCheck(pContext, DSL_VRX_FW_VDSL2) )
@@ -187,7 +210,7 @@ DSL_Error_t DSL_CEOC_DEV_MessageSend(
    }
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_CEOC_DEV_MessageSend, retCode=%d"
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_CEOC_DEV_MessageSendLocked, retCode=%d"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
 
    return nErrCode;
@@ -189,1213 +189,1270 @@ DSL_Error_t DSL_DRV_OnTimeoutEvent(
 }
 #endif /* INCLUDE_DSL_TIMEOUT*/
 
-#ifndef INCLUDE_FW_REQUEST_SUPPORT
-static DSL_Error_t DSL_DRV_FwCopy(
-   DSL_Context_t *pContext,
+#ifndef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+/*
+   Returns a chunk of a firmware image which is accessible from the kernel.
+   Images from the user space are copied into the bounce buffer, images
+   which are already in the kernel space are used directly.
+
+   \param bIsInKernel   whether the image is already in the kernel space, [I]
+   \param pImage        firmware image, [I]
+   \param nOffset       offset of the chunk, [I]
+   \param nLen          length of the chunk, at most
+                        DSL_DRV_FW_CACHE_CHUNK_SIZE bytes, [I]
+   \param pBounce       bounce buffer of DSL_DRV_FW_CACHE_CHUNK_SIZE bytes, [I]
+
+   \return chunk of the image
+*/
+static const DSL_uint8_t* DSL_DRV_FwCacheChunkGet(
    DSL_boolean_t bIsInKernel,
-   const DSL_uint8_t *pFirmware,
-   const DSL_uint32_t nFirmwareSize,
-   DSL_uint8_t **ppFirmware,
-   DSL_uint32_t *pFirmwareSize)
+   const DSL_uint8_t *pImage,
+   DSL_uint32_t nOffset,
+   DSL_uint32_t nLen,
+   DSL_uint8_t *pBounce)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS;
+   if (bIsInKernel)
+   {
+      return pImage + nOffset;
+   }
 
-   DSL_CHECK_POINTER(pContext, ppFirmware);
-   DSL_CHECK_POINTER(pContext, pFirmwareSize);
-   DSL_CHECK_ERR_CODE();
+   DSL_IoctlMemCpyFrom(bIsInKernel, pBounce,
+      (DSL_void_t*)(pImage + nOffset), nLen);
 
-#ifdef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
-   /* Statically linked FW supported only under the RTEMS OS build*/
-   *ppFirmware    = pFirmware;
-   *pFirmwareSize = nFirmwareSize;
-#else
-   if ( (pFirmware != DSL_NULL) && (nFirmwareSize != 0) )
+   return pBounce;
+}
+
+/*
+   Calculates the FNV-1a hash of a firmware image. The image is read chunk by
+   chunk through the bounce buffer, no copy of the whole image is needed.
+
+   \param bIsInKernel   whether the image is already in the kernel space, [I]
+   \param pImage        firmware image, [I]
+   \param nSize         size of the firmware image, [I]
+   \param pBounce       bounce buffer of DSL_DRV_FW_CACHE_CHUNK_SIZE bytes, [I]
+
+   \return hash of the image
+*/
+static DSL_uint32_t DSL_DRV_FwCacheHash(
+   DSL_boolean_t bIsInKernel,
+   const DSL_uint8_t *pImage,
+   DSL_uint32_t nSize,
+   DSL_uint8_t *pBounce)
+{
+   DSL_uint32_t nHash = 0x811C9DC5, nOffset, nLen, i;
+   const DSL_uint8_t *pChunk;
+
+   for (nOffset = 0; nOffset < nSize; nOffset += nLen)
    {
-      if (*ppFirmware != DSL_NULL)
+      nLen = nSize - nOffset;
+      if (nLen > DSL_DRV_FW_CACHE_CHUNK_SIZE)
       {
-         DSL_DRV_VFree(*ppFirmware);
+         nLen = DSL_DRV_FW_CACHE_CHUNK_SIZE;
       }
 
-      *ppFirmware = (DSL_uint8_t*)DSL_DRV_VMalloc(nFirmwareSize);
-      if (*ppFirmware != DSL_NULL)
-      {
-         *pFirmwareSize = nFirmwareSize;
-         /* Copy FW binary*/
-         DSL_IoctlMemCpyFrom(bIsInKernel, *ppFirmware, (DSL_void_t*)pFirmware,
-            nFirmwareSize);
-      }
-      else
+      pChunk = DSL_DRV_FwCacheChunkGet(bIsInKernel, pImage, nOffset, nLen,
+                  pBounce);
+
+      for (i = 0; i < nLen; i++)
       {
-         *pFirmwareSize = 0;
-         nErrCode = DSL_ERROR;
-         DSL_DEBUG( DSL_DBG_ERR, (pContext,
-            SYS_DBG_ERR"DSL[%02d]: Memory allocation for firmware binary failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         nHash = (nHash ^ pChunk[i]) * 0x01000193;
       }
    }
-#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
 
-   return (nErrCode);
+   return nHash;
 }
 
 /*
-   This function stores the FW binaries in the DSL CPE API internal memory
+   Compares a firmware image with a cached copy chunk by chunk through the
+   bounce buffer.
 
-   \param pContext      Pointer to dsl library context structure, [I]
-   \param pFirmware1    1st firmware pointer, [I]
-   \param nSize1        Size of 1st firmware, [I]
-   \param pFirmware2    2nd firmware pointer, [I]
-   \param nSize2        Size of 2nd firmware, [I]
+   \param bIsInKernel   whether the image is already in the kernel space, [I]
+   \param pImage        firmware image, [I]
+   \param nSize         size of the firmware image, [I]
+   \param pData         cached copy of nSize bytes, [I]
+   \param pBounce       bounce buffer of DSL_DRV_FW_CACHE_CHUNK_SIZE bytes, [I]
 
-   \return  Return values are defined within the \ref DSL_Error_t definition
-    - DSL_SUCCESS in case of success
-    - DSL_ERROR if operation failed
-    - or any other defined specific error code
+   \return DSL_TRUE if the image equals the cached copy
 */
-static DSL_Error_t DSL_DRV_FwStore(
-   DSL_Context_t *pContext,
+static DSL_boolean_t DSL_DRV_FwCacheCompare(
    DSL_boolean_t bIsInKernel,
-   const DSL_char_t *pFirmware1,
-   DSL_uint32_t nSize1,
-   const DSL_char_t *pFirmware2,
-   DSL_uint32_t nSize2)
+   const DSL_uint8_t *pImage,
+   DSL_uint32_t nSize,
+   const DSL_uint8_t *pData,
+   DSL_uint8_t *pBounce)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS;
-
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_FwStore"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+   DSL_uint32_t nOffset, nLen;
+   const DSL_uint8_t *pChunk;
 
-   /* Proceed 1'st FW binary*/
-   if (DSL_DRV_FwCopy(pContext, bIsInKernel, (DSL_uint8_t*)pFirmware1, nSize1,
-      &pContext->pFirmware, &pContext->nFirmwareSize) != DSL_SUCCESS)
+   for (nOffset = 0; nOffset < nSize; nOffset += nLen)
    {
-      return DSL_ERROR;
-   }
+      nLen = nSize - nOffset;
+      if (nLen > DSL_DRV_FW_CACHE_CHUNK_SIZE)
+      {
+         nLen = DSL_DRV_FW_CACHE_CHUNK_SIZE;
+      }
 
-#ifdef INCLUDE_DSL_2ND_FIRMWARE_SUPPORT
-   /* Proceed 2'nd FW binary*/
-   if( DSL_DRV_FwCopy(pContext, bIsInKernel, (DSL_uint8_t*)pFirmware2, nSize2,
-          &pContext->pFirmware2, &pContext->nFirmwareSize2) != DSL_SUCCESS)
-   {
-      return DSL_ERROR;
-   }
-#endif /* #ifdef INCLUDE_DSL_2ND_FIRMWARE_SUPPORT*/
+      pChunk = DSL_DRV_FwCacheChunkGet(bIsInKernel, pImage, nOffset, nLen,
+                  pBounce);
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_FwStore"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+      if (memcmp(pChunk, pData + nOffset, nLen) != 0)
+      {
+         return DSL_FALSE;
+      }
+   }
 
-   return nErrCode;
+   return DSL_TRUE;
 }
-#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
 
-static DSL_Error_t DSL_DRV_InstanceStatusGet(
-   DSL_OpenContext_t *pOpenCtx,
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_InstanceStatus_t *pData)
-{
-   DSL_Error_t nErrCode = DSL_SUCCESS;
+/* Firmware image cache shared by all lines*/
+static DSL_DRV_FwCacheEntry_t *pFwCacheList = DSL_NULL;
+/* Protects the firmware image cache list and the reference counters*/
+static DSL_DRV_Mutex_t fwCacheMutex;
+/* ID of the last inserted cache entry*/
+static DSL_uint32_t nFwCacheLastId = 0;
 
-   DSL_CHECK_CTX_POINTER(pContext);
-   DSL_CHECK_ERR_CODE();
+/*
+   Looks up a firmware image in the cache, the cache lock has to be held.
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_InstanceStatusGet"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+   \param bIsInKernel   whether the image is already in the kernel space, [I]
+   \param pImage        firmware image, [I]
+   \param nSize         size of the firmware image, [I]
+   \param nHash         hash of the firmware image, [I]
+   \param pBounce       bounce buffer of DSL_DRV_FW_CACHE_CHUNK_SIZE bytes, [I]
 
-   if(DSL_DRV_MUTEX_LOCK(pOpenCtx->eventMutex))
+   \return cache entry of the image, DSL_NULL if it is not cached
+*/
+static DSL_DRV_FwCacheEntry_t* DSL_DRV_FwCacheLookup(
+   DSL_boolean_t bIsInKernel,
+   const DSL_uint8_t *pImage,
+   DSL_uint32_t nSize,
+   DSL_uint32_t nHash,
+   DSL_uint8_t *pBounce)
+{
+   DSL_DRV_FwCacheEntry_t *pEntry;
+
+   for (pEntry = pFwCacheList; pEntry != DSL_NULL; pEntry = pEntry->pNext)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]:Couldn't lock event mutex"DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
-      return DSL_ERROR;
+      if ((pEntry->nHash == nHash) && (pEntry->nSize == nSize) &&
+          DSL_DRV_FwCacheCompare(bIsInKernel, pImage, nSize, pEntry->pData,
+             pBounce))
+      {
+         break;
+      }
    }
 
-   /* Get status data from the instance specific context*/
-   pData->data.bEventActivation        = pOpenCtx->bEventActivation;
-   pData->data.nResourceActivationMask = pOpenCtx->nResourceActivationMask;
+   return pEntry;
+}
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
 
-   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
+/* Reference time of the bring-up time stamps*/
+static DSL_uint32_t nBringUpStartTime = 0;
 
-   /* Expected to check flag only from current Context */
-   pData->data.bFwEventActivation      = pContext->bFwEventActivation;
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_void_t DSL_DRV_BringUpInit(DSL_void_t)
+{
+   nBringUpStartTime = DSL_DRV_TimeMSecGet();
+}
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_InstanceStatusGet, retCode=%d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_uint32_t DSL_DRV_BringUpTimeGet(DSL_void_t)
+{
+   DSL_uint32_t nTime = DSL_DRV_TimeMSecGet() - nBringUpStartTime;
 
-   return(nErrCode);
+   return (nTime != 0) ? nTime : 1;
 }
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_Error_t DSL_DRV_HandleInit(
-   DSL_IN     DSL_int_t nNum,
-   DSL_IN_OUT DSL_OpenContext_t **pRefOpenContext)
+DSL_void_t DSL_DRV_FwCacheInit(DSL_void_t)
 {
-   if (nNum >= DSL_DRV_ENTITIES || pRefOpenContext == DSL_NULL)
-   {
-      return DSL_ERR_INVALID_PARAMETER;
-   }
+#ifndef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+   pFwCacheList = DSL_NULL;
 
-   /* the global context is NULL, initialize it */
-   if (ifxDevices[nNum].pContext == DSL_NULL)
+   DSL_DRV_MUTEX_INIT(fwCacheMutex);
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_FwCacheGet(
+   DSL_Context_t *pContext,
+   DSL_boolean_t bIsInKernel,
+   const DSL_uint8_t *pImage,
+   DSL_uint32_t nSize,
+   DSL_uint8_t **ppData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+#ifndef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+   DSL_DRV_FwCacheEntry_t *pEntry = DSL_NULL, *pNew = DSL_NULL;
+   DSL_uint8_t pBounce[DSL_DRV_FW_CACHE_CHUNK_SIZE];
+   DSL_uint32_t nHash;
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
+
+   DSL_CHECK_POINTER(pContext, ppData);
+   DSL_CHECK_ERR_CODE();
+
+   *ppData = DSL_NULL;
+
+   if ((pImage == DSL_NULL) || (nSize == 0))
    {
-      ifxDevices[nNum].pContext = DSL_DRV_VMalloc(sizeof(DSL_Context_t));
-      if (ifxDevices[nNum].pContext == DSL_NULL)
-      {
-         return DSL_ERR_MEMORY;
-      }
+      return DSL_SUCCESS;
+   }
 
-      DSL_DRV_MemSet(ifxDevices[nNum].pContext, 0, sizeof(DSL_Context_t));
+#ifdef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+   /* Statically linked FW supported only under the RTEMS OS build,
+      the image itself is used*/
+   *ppData = (DSL_uint8_t*)pImage;
+#else
+   /* Hash the image through the bounce buffer, a reload of a cached image
+      needs no allocation and no copy of the whole image*/
+   nHash = DSL_DRV_FwCacheHash(bIsInKernel, pImage, nSize, pBounce);
 
-      memcpy(&ifxDevices[nNum].pContext->lineInventoryNe.G994VendorID, g_G994VendorID,
-         sizeof(DSL_uint8_t) * DSL_G997_LI_MAXLEN_VENDOR_ID);
-      memcpy(&ifxDevices[nNum].pContext->lineInventoryNe.SystemVendorID, g_G994VendorID,
-         sizeof(DSL_uint8_t) * DSL_G997_LI_MAXLEN_VENDOR_ID);
+   if (DSL_DRV_MUTEX_LOCK(fwCacheMutex))
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (pContext,
+         SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock firmware cache mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      if (ifxDevices[nNum].nUsageCount != 0)
-      {
-         DSL_DEBUG(DSL_DBG_ERR,
-            (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
-            "CPE API. Uninitialized device context has non-null "
-            "usage count."DSL_DRV_CRLF, nNum));
-         return DSL_ERR_INTERNAL;
-      }
+      return DSL_ERROR;
+   }
 
-      ifxDevices[nNum].pContext->pDevCtx = &ifxDevices[nNum];
-      ifxDevices[nNum].pContext->pXDev = ifxDevices;
+   pEntry = DSL_DRV_FwCacheLookup(bIsInKernel, pImage, nSize, nHash, pBounce);
+   if (pEntry != DSL_NULL)
+   {
+      pEntry->nRefCount++;
+      *ppData = pEntry->pData;
 
-      /* Set device number*/
-      ifxDevices[nNum].nNum = nNum;
-      /* init device mutex */
-      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->bspMutex);
+      DSL_DEBUG(DSL_DBG_MSG, (pContext,
+         SYS_DBG_MSG"DSL[%02d]: Reusing cached firmware image (%d bytes, "
+         "hash 0x%08X, %d users)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
+         nSize, pEntry->nHash, pEntry->nRefCount));
 
-      /* init data mutex */
-      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->dataMutex);
+      DSL_DRV_MUTEX_UNLOCK(fwCacheMutex);
 
-      /* init initialization mutex */
-      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->initMutex);
+      return DSL_SUCCESS;
+   }
 
-      /* init Open Context List mutex */
-      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].openContextListMutex);
+   DSL_DRV_MUTEX_UNLOCK(fwCacheMutex);
 
-#if defined(INCLUDE_DSL_CPE_API_DANUBE)
-      /* init HDLC mutex */
-      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->hdlcMutex);
-#endif /* defined(INCLUDE_DSL_CPE_API_DANUBE)*/
-#ifdef INCLUDE_DSL_TIMEOUT
-      if (DSL_DRV_Timeout_Init(ifxDevices[nNum].pContext, DSL_MAX_TIMEOUT_NUM,
-         DSL_FALSE) != DSL_SUCCESS)
+   /* Cache miss, copy the image into a new entry without holding the cache
+      lock during the (user space) copy*/
+   pNew = (DSL_DRV_FwCacheEntry_t*)DSL_DRV_PMalloc(
+      sizeof(DSL_DRV_FwCacheEntry_t));
+   if (pNew != DSL_NULL)
+   {
+      pNew->pData = (DSL_uint8_t*)DSL_DRV_VMalloc(nSize);
+      if (pNew->pData == DSL_NULL)
       {
-         DSL_DEBUG(DSL_DBG_ERR,
-            (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
-            "CPE API. Could not prepare timeout context."DSL_DRV_CRLF, nNum));
-         return DSL_ERR_INTERNAL;
+         DSL_DRV_PFree(pNew);
+         pNew = DSL_NULL;
       }
-#endif /* INCLUDE_DSL_TIMEOUT*/
    }
 
-   if (ifxDevices[nNum].nUsageCount > 0 && ifxDevices[nNum].pContext == DSL_NULL)
+   if (pNew == DSL_NULL)
    {
-      DSL_DEBUG(DSL_DBG_ERR,
-         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
-         "CPE API. Used device context has null pointer "
-         "to DSL Context."DSL_DRV_CRLF, nNum));
-      return DSL_ERR_INTERNAL;
+      DSL_DEBUG( DSL_DBG_ERR, (pContext,
+         SYS_DBG_ERR"DSL[%02d]: Memory allocation for firmware binary failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERROR;
    }
 
-   /* Lock Open Context List*/
-   if (DSL_DRV_MUTEX_LOCK(ifxDevices[nNum].openContextListMutex))
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock Context List mutex!"
-         DSL_DRV_CRLF, nNum));
+   DSL_IoctlMemCpyFrom(bIsInKernel, pNew->pData, (DSL_void_t*)pImage, nSize);
 
-      return DSL_ERR_SEMAPHORE_GET;
-   }
+   /* The hash is taken from the kernel copy, a user space image which
+      changed meanwhile is cached with the content actually copied*/
+   pNew->nHash     = DSL_DRV_FwCacheHash(DSL_TRUE, pNew->pData, nSize,
+                        pBounce);
+   pNew->nSize     = nSize;
+   pNew->nRefCount = 1;
 
-   *pRefOpenContext = DSL_DRV_VMalloc(sizeof(DSL_OpenContext_t));
-   if (*pRefOpenContext == DSL_NULL)
+   if (DSL_DRV_MUTEX_LOCK(fwCacheMutex))
    {
-      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Open failed, "
-         "could not allocate memory..."DSL_DRV_CRLF, nNum));
+      DSL_DEBUG(DSL_DBG_ERR, (pContext,
+         SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock firmware cache mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      /* Unlock Open Context List*/
-      DSL_DRV_MUTEX_UNLOCK(ifxDevices[nNum].openContextListMutex);
+      DSL_DRV_VFree(pNew->pData);
+      DSL_DRV_PFree(pNew);
 
-      return DSL_ERR_MEMORY;
+      return DSL_ERROR;
+   }
+
+   /* The same image may have been inserted by a concurrent load meanwhile*/
+   pEntry = DSL_DRV_FwCacheLookup(DSL_TRUE, pNew->pData, nSize, pNew->nHash,
+               pBounce);
+   if (pEntry != DSL_NULL)
+   {
+      pEntry->nRefCount++;
    }
    else
    {
-      DSL_DRV_MemSet(*pRefOpenContext, 0, sizeof(DSL_OpenContext_t));
-
-      /* init event queue */
-      DSL_DRV_INIT_WAKELIST("evntque", (*pRefOpenContext)->eventWaitQueue);
+      /* Skip 0 which marks an uncached image*/
+      if (++nFwCacheLastId == 0)
+      {
+         nFwCacheLastId = 1;
+      }
+      pNew->nId    = nFwCacheLastId;
+      pNew->pNext  = pFwCacheList;
+      pFwCacheList = pNew;
+      pEntry       = pNew;
+      pNew         = DSL_NULL;
+   }
 
-      /* init event mutex */
-      DSL_DRV_MUTEX_INIT((*pRefOpenContext)->eventMutex);
+   *ppData = pEntry->pData;
 
-      #ifdef INCLUDE_DSL_CEOC
-      /* init Rx SNMP FIFO mutex*/
-      DSL_DRV_MUTEX_INIT((*pRefOpenContext)->rxSnmpFifoMutex);
-      #endif /* #ifdef INCLUDE_DSL_CEOC*/
+   DSL_DRV_MUTEX_UNLOCK(fwCacheMutex);
 
-      /* Disable event handling*/
-      (*pRefOpenContext)->bEventActivation = DSL_FALSE;
-      /* Mask (disable) all events*/
-      (*pRefOpenContext)->nEventMask       = 0xFFFFFFFF;
-      /* KAv: Unmask all indication threshold crossing events by default.
-         It not completely defined how to handle these events for instance specific
-         processing.*/
-      (*pRefOpenContext)->nEventMask &=
-         ~(DSL_EVENT2MASK(DSL_EVENT_I_LINE_THRESHOLD_CROSSING) |
-           DSL_EVENT2MASK(DSL_EVENT_I_CHANNEL_THRESHOLD_CROSSING) |
-           DSL_EVENT2MASK(DSL_EVENT_I_DATA_PATH_THRESHOLD_CROSSING) |
-           DSL_EVENT2MASK(DSL_EVENT_I_RETX_THRESHOLD_CROSSING) |
-           DSL_EVENT2MASK(DSL_EVENT_I_CHANNEL_DATARATE_SHIFT_THRESHOLD_CROSSING));
+   if (pNew != DSL_NULL)
+   {
+      DSL_DRV_VFree(pNew->pData);
+      DSL_DRV_PFree(pNew);
+   }
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
 
-      (*pRefOpenContext)->nResourceActivationMask = (DSL_BF_ResourceActivationType_t)0xFFFFFFFF;
+   return nErrCode;
+}
 
-      /* add to list */
-      if (pOpenContextList == DSL_NULL)
-      {
-         /* first element */
-         pOpenContextList = *pRefOpenContext;
-      }
-      else
-      {
-         /* add to head */
-         (*pRefOpenContext)->pNext = pOpenContextList;
-         pOpenContextList = *pRefOpenContext;
-      }
-
-      (*pRefOpenContext)->pDevCtx = &ifxDevices[nNum];
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_FwCacheRefGet(
+   const DSL_uint8_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+#ifndef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+   DSL_DRV_FwCacheEntry_t *pEntry;
 
-      ifxDevices[nNum].nUsageCount++;
+   if (pData == DSL_NULL)
+   {
+      return DSL_ERR_POINTER;
    }
 
-   /* Unlock Open Context List*/
-   DSL_DRV_MUTEX_UNLOCK(ifxDevices[nNum].openContextListMutex);
+   if (DSL_DRV_MUTEX_LOCK(fwCacheMutex))
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL,
+         SYS_DBG_ERR"DSL: ERROR - Couldn't lock firmware cache mutex!"
+         DSL_DRV_CRLF));
+      return DSL_ERROR;
+   }
 
-   if (DSL_DRV_BONDING_ENABLED && DSL_DRV_LINES_PER_DEVICE == 1)
+   for (pEntry = pFwCacheList; pEntry != DSL_NULL; pEntry = pEntry->pNext)
    {
-      DSL_DRV_MUTEX_INIT(bndLineLockMutex);
+      if (pEntry->pData == pData)
+      {
+         pEntry->nRefCount++;
+         break;
+      }
    }
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: Open: Use count: %d"DSL_DRV_CRLF,
-      nNum, ifxDevices[nNum].nUsageCount));
+   DSL_DRV_MUTEX_UNLOCK(fwCacheMutex);
 
-   DSL_DRV_OS_ModUseCountIncrement();
+   if (pEntry == DSL_NULL)
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL,
+         SYS_DBG_ERR"DSL: ERROR - Firmware image %p is not cached!"
+         DSL_DRV_CRLF, pData));
+      nErrCode = DSL_ERROR;
+   }
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
 
-   return DSL_SUCCESS;
+   return nErrCode;
 }
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_Error_t DSL_DRV_HandleCleanup(
-   DSL_IN DSL_devCtx_t *pDevContext,
-   DSL_IN DSL_boolean_t bForce)
+DSL_void_t DSL_DRV_FwCacheRelease(
+   const DSL_uint8_t *pData)
 {
-   if (pDevContext == DSL_NULL)
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (DSL_NULL, SYS_DBG_ERR"DSL: DSL_DRV_HandleCleanup: "
-         "Device context is NULL"DSL_DRV_CRLF));
-      return DSL_ERROR;
-   }
+#ifndef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+   DSL_DRV_FwCacheEntry_t *pEntry, **ppPrev;
 
-   if (pDevContext->nUsageCount > 1 && bForce == DSL_FALSE)
+   if (pData == DSL_NULL)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: DSL_DRV_HandleCleanup: "
-         "device is still used by another process"DSL_DRV_CRLF,
-         pDevContext->nNum));
-      return DSL_ERROR;
+      return;
    }
 
-   if (pDevContext->nUsageCount > 1 && bForce == DSL_TRUE)
+   if (DSL_DRV_MUTEX_LOCK(fwCacheMutex))
    {
-      DSL_DEBUG( DSL_DBG_MSG,
-         (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: DSL_DRV_HandleCleanup: "
-         "clean up is forced"DSL_DRV_CRLF, pDevContext->nNum));
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL,
+         SYS_DBG_ERR"DSL: ERROR - Couldn't lock firmware cache mutex!"
+         DSL_DRV_CRLF));
+      return;
    }
 
-   if (pDevContext->nUsageCount > 1 || bForce == DSL_TRUE)
+   for (ppPrev = &pFwCacheList; *ppPrev != DSL_NULL;
+        ppPrev = &((*ppPrev)->pNext))
    {
-
-      while (pDevContext->nUsageCount-- > 1)
+      pEntry = *ppPrev;
+      if (pEntry->pData != pData)
       {
-         DSL_DRV_OS_ModUseCountDecrement();
+         continue;
       }
 
-      if (pDevContext->pContext != DSL_NULL)
+      if (--pEntry->nRefCount == 0)
       {
-         DSL_DEBUG( DSL_DBG_MSG,
-            (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: DSL_DRV_HandleCleanup: "
-            "Autoboot thread stopping..."DSL_DRV_CRLF,
-            pDevContext->nNum));
-
-         DSL_DRV_AutobootThreadStop(pDevContext->pContext);
-
-         DSL_DEBUG( DSL_DBG_MSG,
-            (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: DSL_DRV_HandleCleanup: "
-            "Autoboot thread has been stopped..."DSL_DRV_CRLF,
-            pDevContext->nNum));
-
-         DSL_DRV_Free(pDevContext->pContext);
-         DSL_DRV_VFree(pDevContext->pContext);
-         pDevContext->pContext = DSL_NULL;
+         *ppPrev = pEntry->pNext;
+         DSL_DRV_VFree(pEntry->pData);
+         DSL_DRV_PFree(pEntry);
       }
+      break;
    }
 
-   return DSL_SUCCESS;
+   DSL_DRV_MUTEX_UNLOCK(fwCacheMutex);
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
 }
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_Error_t DSL_DRV_HandleDelete(
-   DSL_IN DSL_OpenContext_t *pOpenContext)
+DSL_uint32_t DSL_DRV_FwCacheIdGet(
+   const DSL_uint8_t *pData)
 {
-   DSL_devCtx_t *pDevContext;
-   DSL_EventStatusData_t event;
-   DSL_OpenContext_t *pPrev, *pCurr;
-   DSL_void_t *pPtr;
-   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t nId = 0;
+#ifndef INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE
+   DSL_DRV_FwCacheEntry_t *pEntry;
 
-   if (pOpenContext == DSL_NULL)
+   if (pData == DSL_NULL)
    {
-      return DSL_ERR_INVALID_PARAMETER;
+      return 0;
    }
-   else
+
+   if (DSL_DRV_MUTEX_LOCK(fwCacheMutex))
    {
-      pDevContext = pOpenContext->pDevCtx;
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL,
+         SYS_DBG_ERR"DSL: ERROR - Couldn't lock firmware cache mutex!"
+         DSL_DRV_CRLF));
+      return 0;
+   }
 
-      if (pDevContext == DSL_NULL)
+   for (pEntry = pFwCacheList; pEntry != DSL_NULL; pEntry = pEntry->pNext)
+   {
+      if (pEntry->pData == pData)
       {
-         return DSL_ERROR;
+         nId = pEntry->nId;
+         break;
       }
-      else
-      {
-         if (pDevContext->nUsageCount > 0)
-         {
-            pDevContext->nUsageCount--;
-         }
+   }
 
-         /* Lock Open Context list mutex*/
-         if (DSL_DRV_MUTEX_LOCK(pDevContext->openContextListMutex))
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock Context List mutex!"
-               DSL_DRV_CRLF, pDevContext->nNum));
+   DSL_DRV_MUTEX_UNLOCK(fwCacheMutex);
+#endif /* INCLUDE_DSL_DRV_STATIC_LINKED_FIRMWARE*/
 
-            return DSL_ERR_SEMAPHORE_GET;
-         }
+   return nId;
+}
 
-         if ((pOpenContext->nEventMask & DSL_EVENT2MASK(DSL_EVENT_S_FIRMWARE_REQUEST)) == 0
-            && pOpenContext->pDevCtx != DSL_NULL
-            && pOpenContext->pDevCtx->pContext != DSL_NULL)
-         {
-            DSL_CTX_WRITE_SCALAR(pOpenContext->pDevCtx->pContext,
-               nErrCode, bFirmwareEventAssigned, DSL_FALSE);
-         }
+#ifndef INCLUDE_FW_REQUEST_SUPPORT
+/*
+   This function stores a FW binary in the DSL CPE API context.
+   The context takes its own reference of the cached firmware image and
+   releases the previously stored one.
+
+   \param pFirmware     cached firmware image, [I]
+   \param nFirmwareSize size of the firmware image, [I]
+   \param ppFirmware    stored firmware image of the context, [I/O]
+   \param pFirmwareSize size of the stored firmware image, [I/O]
+*/
+static DSL_void_t DSL_DRV_FwCopy(
+   const DSL_uint8_t *pFirmware,
+   const DSL_uint32_t nFirmwareSize,
+   DSL_uint8_t **ppFirmware,
+   DSL_uint32_t *pFirmwareSize)
+{
+   if ( (pFirmware != DSL_NULL) && (nFirmwareSize != 0) )
+   {
+      /* Take the new reference first, an unchanged image is kept this way.
+         An image which is not cached can not be shared, the stored image is
+         kept then*/
+      if (DSL_DRV_FwCacheRefGet(pFirmware) != DSL_SUCCESS)
+      {
+         return;
+      }
+      DSL_DRV_FwCacheRelease(*ppFirmware);
 
-         if (pOpenContext->eventFifo != DSL_NULL
-            && pOpenContext->eventFifoBuf != DSL_NULL)
-         {
-            while (!DSL_Fifo_isEmpty(pOpenContext->eventFifo))
-            {
-               if (DSL_DRV_EventUnqueue(pOpenContext, &event)
-                  >= DSL_SUCCESS)
-               {
-                  if (event.pData != DSL_NULL)
-                  {
-                     DSL_DRV_VFree(event.pData);
-                  }
-               }
-            }
-         }
+      *ppFirmware    = (DSL_uint8_t*)pFirmware;
+      *pFirmwareSize = nFirmwareSize;
+   }
+}
 
-         /* release event structures */
-         if (pOpenContext->eventFifo != DSL_NULL)
-         {
-            pPtr = pOpenContext->eventFifo;
-            pOpenContext->eventFifo = DSL_NULL;
+/*
+   This function stores the FW binaries in the DSL CPE API internal memory
 
-            DSL_DRV_VFree(pPtr);
-         }
+   \param pContext      Pointer to dsl library context structure, [I]
+   \param pFirmware1    1st cached firmware image, [I]
+   \param nSize1        Size of 1st firmware, [I]
+   \param pFirmware2    2nd cached firmware image, [I]
+   \param nSize2        Size of 2nd firmware, [I]
+*/
+static DSL_void_t DSL_DRV_FwStore(
+   DSL_Context_t *pContext,
+   const DSL_uint8_t *pFirmware1,
+   DSL_uint32_t nSize1,
+   const DSL_uint8_t *pFirmware2,
+   DSL_uint32_t nSize2)
+{
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_FwStore"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
 
-         /* release event structures */
-         if (pOpenContext->eventFifoBuf != DSL_NULL)
-         {
-            pPtr = pOpenContext->eventFifoBuf;
-            pOpenContext->eventFifoBuf = DSL_NULL;
-            DSL_DRV_VFree(pPtr);
-         }
+   /* Proceed 1'st FW binary*/
+   DSL_DRV_FwCopy(pFirmware1, nSize1,
+      &pContext->pFirmware, &pContext->nFirmwareSize);
 
-         /* remove from list */
-         if (pOpenContextList != DSL_NULL)
-         {
-            if (pOpenContext == pOpenContextList)
-            {
-               /* it is a head */
-               pOpenContextList = pOpenContext->pNext;
-            }
-            else
-            {
-               for ( pPrev = pOpenContextList,
-                     pCurr = pOpenContextList->pNext;
-                     pCurr != pOpenContext && pCurr != DSL_NULL;
-                     pPrev = pCurr,
-                     pCurr = pCurr->pNext) ;
+#ifdef INCLUDE_DSL_2ND_FIRMWARE_SUPPORT
+   /* Proceed 2'nd FW binary*/
+   DSL_DRV_FwCopy(pFirmware2, nSize2,
+      &pContext->pFirmware2, &pContext->nFirmwareSize2);
+#endif /* #ifdef INCLUDE_DSL_2ND_FIRMWARE_SUPPORT*/
 
-               if (pCurr != DSL_NULL)
-               {
-                  pPrev->pNext = pCurr->pNext;
-               }
-            }
-         }
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_FwStore"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
+}
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
 
-         DSL_DRV_VFree(pOpenContext);
+static DSL_Error_t DSL_DRV_InstanceStatusGet(
+   DSL_OpenContext_t *pOpenCtx,
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_InstanceStatus_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-         /* Unlock Open Context list mutex*/
-         DSL_DRV_MUTEX_UNLOCK(pDevContext->openContextListMutex);
-      }
+   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_InstanceStatusGet"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
+
+   if(DSL_DRV_MUTEX_LOCK(pOpenCtx->eventMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]:Couldn't lock event mutex"DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
+      return DSL_ERROR;
    }
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: Close: Use count: %d, retCode=%d"
-      DSL_DRV_CRLF, pDevContext->nNum, pDevContext->nUsageCount, nErrCode));
+   /* Get status data from the instance specific context*/
+   pData->data.bEventActivation        = pOpenCtx->bEventActivation;
+   pData->data.nResourceActivationMask = pOpenCtx->nResourceActivationMask;
 
-   DSL_DRV_OS_ModUseCountDecrement();
+   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
 
-   return nErrCode;
+   /* Expected to check flag only from current Context */
+   pData->data.bFwEventActivation      = pContext->bFwEventActivation;
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_InstanceStatusGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return(nErrCode);
 }
 
-DSL_void_t DSL_DRV_Cleanup(DSL_void_t)
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_HandleInit(
+   DSL_IN     DSL_int_t nNum,
+   DSL_IN_OUT DSL_OpenContext_t **pRefOpenContext)
 {
-   DSL_int_t i;
+   if (nNum >= DSL_DRV_ENTITIES || pRefOpenContext == DSL_NULL)
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
 
-   for (i = 0; i < DSL_DRV_ENTITIES; i++)
+   /* the global context is NULL, initialize it */
+   if (ifxDevices[nNum].pContext == DSL_NULL)
    {
-      DSL_DRV_HandleCleanup(&ifxDevices[i], DSL_TRUE);
+      ifxDevices[nNum].pContext = DSL_DRV_VMalloc(sizeof(DSL_Context_t));
+      if (ifxDevices[nNum].pContext == DSL_NULL)
+      {
+         return DSL_ERR_MEMORY;
+      }
 
-      DSL_DRV_DEV_DriverHandleDelete(ifxDevices[i].lowHandle);
+      DSL_DRV_MemSet(ifxDevices[nNum].pContext, 0, sizeof(DSL_Context_t));
 
-#ifdef INCLUDE_DSL_NFC_HANDLE
-      DSL_DRV_DEV_DriverHandleDelete(ifxDevices[i].nfc_lowHandle);
-#endif /* INCLUDE_DSL_NFC_HANDLE*/
+      memcpy(&ifxDevices[nNum].pContext->lineInventoryNe.G994VendorID, g_G994VendorID,
+         sizeof(DSL_uint8_t) * DSL_G997_LI_MAXLEN_VENDOR_ID);
+      memcpy(&ifxDevices[nNum].pContext->lineInventoryNe.SystemVendorID, g_G994VendorID,
+         sizeof(DSL_uint8_t) * DSL_G997_LI_MAXLEN_VENDOR_ID);
 
-      /* this is redundant code but in case of some our
-         threads leave active it will prevent momentary fault */
-      ifxDevices[i].lowHandle = DSL_NULL;
-#ifdef INCLUDE_DSL_NFC_HANDLE
-      ifxDevices[i].nfc_lowHandle = DSL_NULL;
-#endif /* INCLUDE_DSL_NFC_HANDLE*/
-      ifxDevices[i].nUsageCount = 0;
+      if (ifxDevices[nNum].nUsageCount != 0)
+      {
+         DSL_DEBUG(DSL_DBG_ERR,
+            (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
+            "CPE API. Uninitialized device context has non-null "
+            "usage count."DSL_DRV_CRLF, nNum));
+         return DSL_ERR_INTERNAL;
+      }
+
+      ifxDevices[nNum].pContext->pDevCtx = &ifxDevices[nNum];
+      ifxDevices[nNum].pContext->pXDev = ifxDevices;
+
+      /* Set device number*/
+      ifxDevices[nNum].nNum = nNum;
+      /* init device mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->bspMutex);
+
+      /* init data mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->dataMutex);
+
+      /* init initialization mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->initMutex);
+
+#if defined(INCLUDE_DSL_ADSL_MIB) && defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)
+      /* init MIB row cache mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->MibAdslCtx.rowCacheMutex);
+#endif /* defined(INCLUDE_DSL_ADSL_MIB) && defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)*/
+
+      /* init Open Context List mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].openContextListMutex);
+
+      /* start the device message statistics interval */
+      ifxDevices[nNum].pContext->msgStats.nResetTime = DSL_DRV_TimeMSecGet();
+
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+      /* init bring-up event */
+      DSL_DRV_INIT_EVENT("brngupev", ifxDevices[nNum].pContext->bringUpEvent);
+      /* init bring-up mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->bringUpMutex);
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
+
+#if defined(INCLUDE_DSL_CPE_API_DANUBE)
+      /* init HDLC mutex */
+      DSL_DRV_MUTEX_INIT(ifxDevices[nNum].pContext->hdlcMutex);
+#endif /* defined(INCLUDE_DSL_CPE_API_DANUBE)*/
+#ifdef INCLUDE_DSL_TIMEOUT
+      if (DSL_DRV_Timeout_Init(ifxDevices[nNum].pContext, DSL_MAX_TIMEOUT_NUM,
+         DSL_FALSE) != DSL_SUCCESS)
+      {
+         DSL_DEBUG(DSL_DBG_ERR,
+            (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
+            "CPE API. Could not prepare timeout context."DSL_DRV_CRLF, nNum));
+         return DSL_ERR_INTERNAL;
+      }
+#endif /* INCLUDE_DSL_TIMEOUT*/
    }
 
-   while (pOpenContextList != DSL_NULL)
+   if (ifxDevices[nNum].nUsageCount > 0 && ifxDevices[nNum].pContext == DSL_NULL)
    {
-      DSL_DRV_HandleDelete(pOpenContextList);
+      DSL_DEBUG(DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
+         "CPE API. Used device context has null pointer "
+         "to DSL Context."DSL_DRV_CRLF, nNum));
+      return DSL_ERR_INTERNAL;
    }
-}
 
-/*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
-*/
-DSL_Error_t DSL_DRV_LinkReset(
-   DSL_IN DSL_Context_t *pContext)
-{
-   DSL_Error_t nErrCode = DSL_SUCCESS;
+   /* Lock Open Context List*/
+   if (DSL_DRV_MUTEX_LOCK(ifxDevices[nNum].openContextListMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock Context List mutex!"
+         DSL_DRV_CRLF, nNum));
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_LinkReset"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+      return DSL_ERR_SEMAPHORE_GET;
+   }
 
-   nErrCode = DSL_DRV_DEV_LinkReset(pContext);
-   if (nErrCode != DSL_SUCCESS)
+   *pRefOpenContext = DSL_DRV_VMalloc(sizeof(DSL_OpenContext_t));
+   if (*pRefOpenContext == DSL_NULL)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: Modem couldn't be reset"DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Open failed, "
+         "could not allocate memory..."DSL_DRV_CRLF, nNum));
+
+      /* Unlock Open Context List*/
+      DSL_DRV_MUTEX_UNLOCK(ifxDevices[nNum].openContextListMutex);
+
+      return DSL_ERR_MEMORY;
    }
    else
    {
-      DSL_DEBUG( DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: Modem was reseted..."DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
+      DSL_DRV_MemSet(*pRefOpenContext, 0, sizeof(DSL_OpenContext_t));
 
-      nErrCode = DSL_SUCCESS;
-   }
+      /* init event queue */
+      DSL_DRV_INIT_WAKELIST("evntque", (*pRefOpenContext)->eventWaitQueue);
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_LinkReset"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+      /* init event mutex */
+      DSL_DRV_MUTEX_INIT((*pRefOpenContext)->eventMutex);
 
-   return nErrCode;
-}
+      #ifdef INCLUDE_DSL_CEOC
+      /* init Rx SNMP FIFO mutex*/
+      DSL_DRV_MUTEX_INIT((*pRefOpenContext)->rxSnmpFifoMutex);
+      #endif /* #ifdef INCLUDE_DSL_CEOC*/
 
-/*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
-*/
-DSL_Error_t DSL_DRV_LinkTerminate(
-   DSL_IN DSL_Context_t *pContext)
-{
-   DSL_Error_t nErrCode = DSL_SUCCESS;
+      /* Disable event handling*/
+      (*pRefOpenContext)->bEventActivation = DSL_FALSE;
+      /* Mask (disable) all events*/
+      (*pRefOpenContext)->nEventMask       = 0xFFFFFFFF;
+      /* KAv: Unmask all indication threshold crossing events by default.
+         It not completely defined how to handle these events for instance specific
+         processing.*/
+      (*pRefOpenContext)->nEventMask &=
+         ~(DSL_EVENT2MASK(DSL_EVENT_I_LINE_THRESHOLD_CROSSING) |
+           DSL_EVENT2MASK(DSL_EVENT_I_CHANNEL_THRESHOLD_CROSSING) |
+           DSL_EVENT2MASK(DSL_EVENT_I_DATA_PATH_THRESHOLD_CROSSING) |
+           DSL_EVENT2MASK(DSL_EVENT_I_RETX_THRESHOLD_CROSSING) |
+           DSL_EVENT2MASK(DSL_EVENT_I_CHANNEL_DATARATE_SHIFT_THRESHOLD_CROSSING));
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_LinkTerminate"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+      (*pRefOpenContext)->nResourceActivationMask = (DSL_BF_ResourceActivationType_t)0xFFFFFFFF;
 
-   nErrCode = DSL_DRV_DEV_LinkTerminate(pContext);
-   if (nErrCode != DSL_SUCCESS)
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: Modem couldn't be terminated"DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
+      /* add to list */
+      if (pOpenContextList == DSL_NULL)
+      {
+         /* first element */
+         pOpenContextList = *pRefOpenContext;
+      }
+      else
+      {
+         /* add to head */
+         (*pRefOpenContext)->pNext = pOpenContextList;
+         pOpenContextList = *pRefOpenContext;
+      }
+
+      (*pRefOpenContext)->pDevCtx = &ifxDevices[nNum];
+
+      ifxDevices[nNum].nUsageCount++;
    }
-   else
-   {
-      DSL_DEBUG( DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: Modem was terminated..."DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
 
-      nErrCode = DSL_SUCCESS;
+   /* Unlock Open Context List*/
+   DSL_DRV_MUTEX_UNLOCK(ifxDevices[nNum].openContextListMutex);
+
+   if (DSL_DRV_BONDING_ENABLED && DSL_DRV_LINES_PER_DEVICE == 1)
+   {
+      DSL_DRV_MUTEX_INIT(bndLineLockMutex);
    }
 
    DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_LinkTerminate"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+      (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: Open: Use count: %d"DSL_DRV_CRLF,
+      nNum, ifxDevices[nNum].nUsageCount));
 
-   return nErrCode;
+   DSL_DRV_OS_ModUseCountIncrement();
+
+   return DSL_SUCCESS;
 }
 
-DSL_Error_t DSL_DRV_ModulesInit(
-   DSL_IN DSL_Context_t *pContext)
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_HandleCleanup(
+   DSL_IN DSL_devCtx_t *pDevContext,
+   DSL_IN DSL_boolean_t bForce)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_boolean_t bFirmwareReady = DSL_FALSE;
-
-   DSL_CHECK_CTX_POINTER(pContext);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_ModulesInit"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
-
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, bFirmwareReady);
-
-   /* Check FW availability*/
-   if( !bFirmwareReady )
+   if (pDevContext == DSL_NULL)
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW not loaded yet!"DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
-
+         (DSL_NULL, SYS_DBG_ERR"DSL: DSL_DRV_HandleCleanup: "
+         "Device context is NULL"DSL_DRV_CRLF));
       return DSL_ERROR;
    }
 
-   /* Lock DSL CPE API data mutex*/
-   if(DSL_DRV_MUTEX_LOCK(pContext->initMutex))
+   if (pDevContext->nUsageCount > 1 && bForce == DSL_FALSE)
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: Couldn't lock data mutex"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
+         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: DSL_DRV_HandleCleanup: "
+         "device is still used by another process"DSL_DRV_CRLF,
+         pDevContext->nNum));
       return DSL_ERROR;
    }
 
-#if defined(INCLUDE_DSL_ADSL_MIB)
-   if ( DSL_DRV_MIB_ModuleInit(pContext) != DSL_SUCCESS )
+   if (pDevContext->nUsageCount > 1 && bForce == DSL_TRUE)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - MIB module initialization failed"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      nErrCode = DSL_ERROR;
-   }
-#endif /* defined(INCLUDE_DSL_ADSL_MIB)*/
+      DSL_DEBUG( DSL_DBG_MSG,
+         (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: DSL_DRV_HandleCleanup: "
+         "clean up is forced"DSL_DRV_CRLF, pDevContext->nNum));
+   }
 
-#if defined(INCLUDE_DSL_CEOC)
-   if ( DSL_CEOC_Start(pContext) != DSL_SUCCESS )
+   if (pDevContext->nUsageCount > 1 || bForce == DSL_TRUE)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - CEOC module initialization failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      nErrCode = DSL_ERROR;
-   }
-#endif /* defined(INCLUDE_DSL_CEOC)*/
+      while (pDevContext->nUsageCount-- > 1)
+      {
+         DSL_DRV_OS_ModUseCountDecrement();
+      }
 
-#if defined(INCLUDE_DSL_PM)
-   if ( DSL_DRV_PM_Start(pContext) != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM module initialization failed"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      if (pDevContext->pContext != DSL_NULL)
+      {
+         DSL_DEBUG( DSL_DBG_MSG,
+            (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: DSL_DRV_HandleCleanup: "
+            "Autoboot thread stopping..."DSL_DRV_CRLF,
+            pDevContext->nNum));
 
-      nErrCode = DSL_ERROR;
-   }
-#endif /* defined(INCLUDE_DSL_PM)*/
+         DSL_DRV_AutobootThreadStop(pDevContext->pContext);
 
-   /* Unock DSL CPE API data mutex*/
-   DSL_DRV_MUTEX_UNLOCK(pContext->initMutex);
+         DSL_DEBUG( DSL_DBG_MSG,
+            (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: DSL_DRV_HandleCleanup: "
+            "Autoboot thread has been stopped..."DSL_DRV_CRLF,
+            pDevContext->nNum));
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_ModulesInit"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+         DSL_DRV_Free(pDevContext->pContext);
+         DSL_DRV_VFree(pDevContext->pContext);
+         pDevContext->pContext = DSL_NULL;
+      }
+   }
 
-   return nErrCode;
+   return DSL_SUCCESS;
 }
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_boolean_t DSL_DRV_BondingEnableCheck(
-   DSL_Context_t *pContext)
+DSL_Error_t DSL_DRV_HandleDelete(
+   DSL_IN DSL_OpenContext_t *pOpenContext)
 {
-   DSL_boolean_t bPafEnable = DSL_FALSE;
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-   DSL_DslModeSelection_t nDslMode = DSL_MODE_NA;
+   DSL_devCtx_t *pDevContext;
+   DSL_EventStatusData_t event;
+   DSL_OpenContext_t *pPrev, *pCurr;
+   DSL_void_t *pPtr;
    DSL_Error_t nErrCode = DSL_SUCCESS;
 
-   if (DSL_DRV_BONDING_ENABLED)
+   if (pOpenContext == DSL_NULL)
    {
-      nDslMode = DSL_DRV_VRX_DslModeIndexGet(pContext);
-
-      DSL_CHECK_DSLMODE(nDslMode);
-      DSL_CHECK_ERR_CODE();
-
-      /* Bonding is always enabled for both lines/devices together so using the
-         configuration from the current line/device is ok. */
-      DSL_CTX_READ_SCALAR( pContext, nErrCode, BndConfig[nDslMode].bPafEnable, bPafEnable);
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+   else
+   {
+      pDevContext = pOpenContext->pDevCtx;
 
-      if (nErrCode != DSL_SUCCESS)
+      if (pDevContext == DSL_NULL)
       {
-         DSL_DEBUG(DSL_DBG_ERR,
-                   (pContext, SYS_DBG_ERR "DSL[%02d]: ERROR - bPafEnable get failed!"
-                    DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         return DSL_ERROR;
       }
-   }
-#endif
-   return bPafEnable;
-}
+      else
+      {
+         if (pDevContext->nUsageCount > 0)
+         {
+            pDevContext->nUsageCount--;
+         }
 
-/*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
-*/
-DSL_Error_t DSL_DRV_XtseSettingsCheck(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN DSL_uint8_t *pXTSE)
-{
-   DSL_Error_t nErrCode = DSL_SUCCESS, nRet = DSL_SUCCESS;
-   DSL_int32_t i = 0, emptyXseCnt = 0;
-   DSL_uint8_t xtsePoss = 0;
-   DSL_boolean_t bXtseChanged = DSL_FALSE, bXtseUnsupported = DSL_FALSE;
+         /* Lock Open Context list mutex*/
+         if (DSL_DRV_MUTEX_LOCK(pDevContext->openContextListMutex))
+         {
+            DSL_DEBUG( DSL_DBG_ERR,
+               (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock Context List mutex!"
+               DSL_DRV_CRLF, pDevContext->nNum));
 
-   DSL_CHECK_POINTER(pContext, pXTSE);
-   DSL_CHECK_ERR_CODE();
+            return DSL_ERR_SEMAPHORE_GET;
+         }
 
-   /* Validation checks for configuration data */
-   for (i = 0; i < DSL_G997_NUM_XTSE_OCTETS; i++)
-   {
-      DSL_CTX_READ(pContext, nErrCode, xtsePoss[i], xtsePoss);
+         if ((pOpenContext->nEventMask & DSL_EVENT2MASK(DSL_EVENT_S_FIRMWARE_REQUEST)) == 0
+            && pOpenContext->pDevCtx != DSL_NULL
+            && pOpenContext->pDevCtx->pContext != DSL_NULL)
+         {
+            DSL_CTX_WRITE_SCALAR(pOpenContext->pDevCtx->pContext,
+               nErrCode, bFirmwareEventAssigned, DSL_FALSE);
+         }
 
-      /* Check for unsupported bits*/
-      if ( (~(xtsePoss) & pXTSE[i]) > 0)
-      {
-         /* Check if there is at least one valid bit*/
-         if ((pXTSE[i] & xtsePoss) > 0)
+         if (pOpenContext->eventFifo != DSL_NULL
+            && pOpenContext->eventFifoBuf != DSL_NULL)
          {
-            /* Change specified configuration*/
-            pXTSE[i] &= xtsePoss;
+            while (!DSL_Fifo_isEmpty(pOpenContext->eventFifo))
+            {
+               if (DSL_DRV_EventUnqueue(pOpenContext, &event)
+                  >= DSL_SUCCESS)
+               {
+                  if (event.pData != DSL_NULL)
+                  {
+                     DSL_DRV_VFree(event.pData);
+                  }
+               }
+            }
+         }
 
-            bXtseChanged = DSL_TRUE;
+#ifdef INCLUDE_DSL_CEOC
+         /* release Rx SNMP FIFO together with the queued message references */
+         if (DSL_DRV_MUTEX_LOCK(pOpenContext->rxSnmpFifoMutex) == 0)
+         {
+            DSL_CEOC_FifoSnmpFlush(pOpenContext, pDevContext->pContext);
+
+            if (pOpenContext->rxSnmpFifo != DSL_NULL)
+            {
+               DSL_DRV_VFree(pOpenContext->rxSnmpFifo);
+               pOpenContext->rxSnmpFifo = DSL_NULL;
+            }
+
+            if (pOpenContext->rxSnmpFifoBuf != DSL_NULL)
+            {
+               DSL_DRV_VFree(pOpenContext->rxSnmpFifoBuf);
+               pOpenContext->rxSnmpFifoBuf = DSL_NULL;
+            }
+
+            DSL_DRV_MUTEX_UNLOCK(pOpenContext->rxSnmpFifoMutex);
          }
-         else
+#endif /* INCLUDE_DSL_CEOC*/
+
+         /* release event structures */
+         if (pOpenContext->eventFifo != DSL_NULL)
          {
-            /* No valid bits found at all*/
-            bXtseUnsupported = DSL_TRUE;
+            pPtr = pOpenContext->eventFifo;
+            pOpenContext->eventFifo = DSL_NULL;
+
+            DSL_DRV_VFree(pPtr);
          }
-      }
 
-      if (!pXTSE[i])
-      {
-         emptyXseCnt++;
-      }
-   }
+         /* release event structures */
+         if (pOpenContext->eventFifoBuf != DSL_NULL)
+         {
+            pPtr = pOpenContext->eventFifoBuf;
+            pOpenContext->eventFifoBuf = DSL_NULL;
+            DSL_DRV_VFree(pPtr);
+         }
 
-   /* Check if no valid bits specified at all*/
-   if (emptyXseCnt >= DSL_G997_NUM_XTSE_OCTETS)
-   {
-      DSL_DEBUG(DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Empty XTSE settings, emptyXseCnt=%d!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), emptyXseCnt));
+         /* remove from list */
+         if (pOpenContextList != DSL_NULL)
+         {
+            if (pOpenContext == pOpenContextList)
+            {
+               /* it is a head */
+               pOpenContextList = pOpenContext->pNext;
+            }
+            else
+            {
+               for ( pPrev = pOpenContextList,
+                     pCurr = pOpenContextList->pNext;
+                     pCurr != pOpenContext && pCurr != DSL_NULL;
+                     pPrev = pCurr,
+                     pCurr = pCurr->pNext) ;
 
-      nErrCode = DSL_ERROR;
-   }
-   else
-   {
-      if (bXtseUnsupported && !bXtseChanged)
-      {
-         /* There are bits set within the configuration that are not supported
-            by G.997.1 or at least by this version of the DSL library */
-         DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - No valid XTSE settings!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+               if (pCurr != DSL_NULL)
+               {
+                  pPrev->pNext = pCurr->pNext;
+               }
+            }
+         }
 
-         nErrCode = DSL_ERROR;
-      }
-      else if (bXtseChanged)
-      {
-         DSL_DEBUG(DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: WARNING - Unsupported bits removed from the current XTSE settings!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         DSL_DRV_VFree(pOpenContext);
 
-         nErrCode = DSL_WRN_INCONSISTENT_XTSE_CONFIGURATION;
+         /* Unlock Open Context list mutex*/
+         DSL_DRV_MUTEX_UNLOCK(pDevContext->openContextListMutex);
       }
    }
 
-   if (nErrCode >= DSL_SUCCESS)
-   {
-      /* Check device specific XTSE settings*/
-      nRet = DSL_DRV_DEV_XtseSettingsCheck(pContext, pXTSE);
-      if (nRet != DSL_SUCCESS)
-      {
-         nErrCode = nRet;
-      }
-   }
+   DSL_DEBUG( DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"DSL[%02d]: Close: Use count: %d, retCode=%d"
+      DSL_DRV_CRLF, pDevContext->nNum, pDevContext->nUsageCount, nErrCode));
+
+   DSL_DRV_OS_ModUseCountDecrement();
 
    return nErrCode;
 }
 
-/*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
-*/
-DSL_Error_t DSL_DRV_Init(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_Init_t *pData)
+DSL_void_t DSL_DRV_Cleanup(DSL_void_t)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_int32_t nLoff = 0, nCurrOffset = 0;
-   DSL_boolean_t bFirmwareReady = DSL_FALSE;
-#ifdef INCLUDE_FW_REQUEST_SUPPORT
-   DSL_FirmwareRequestData_t fwReqData = { DSL_FW_REQUEST_NA };
-   DSL_boolean_t bFwRequest = DSL_FALSE;
-#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
-   DSL_FirmwareRequestType_t nFwType = DSL_FW_REQUEST_NA;
-#ifndef DSL_DEBUG_DISABLE
-   #if defined(INCLUDE_DSL_CPE_API_VRX)
-      DSL_DBG_ModuleLevel_t dbgModLev;
-   #endif /* #ifndef DSL_DEBUG_DISABLE*/
-#endif /* INCLUDE_DSL_CPE_API_VRX */
-#if (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)
-   DSL_PortMode_t nPortMode;
-#endif /* (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)*/
+   DSL_int_t i;
 
-   DSL_CHECK_CTX_POINTER(pContext);
-   DSL_CHECK_ERR_CODE();
+   for (i = 0; i < DSL_DRV_ENTITIES; i++)
+   {
+      DSL_DRV_HandleCleanup(&ifxDevices[i], DSL_TRUE);
 
-   DSL_CHECK_POINTER(pContext, pData);
-   DSL_CHECK_ERR_CODE();
+      DSL_DRV_DEV_DriverHandleDelete(ifxDevices[i].lowHandle);
 
-   DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
-   DSL_CHECK_ERR_CODE();
+#ifdef INCLUDE_DSL_NFC_HANDLE
+      DSL_DRV_DEV_DriverHandleDelete(ifxDevices[i].nfc_lowHandle);
+#endif /* INCLUDE_DSL_NFC_HANDLE*/
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_Init"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext)));
+      /* this is redundant code but in case of some our
+         threads leave active it will prevent momentary fault */
+      ifxDevices[i].lowHandle = DSL_NULL;
+#ifdef INCLUDE_DSL_NFC_HANDLE
+      ifxDevices[i].nfc_lowHandle = DSL_NULL;
+#endif /* INCLUDE_DSL_NFC_HANDLE*/
+      ifxDevices[i].nUsageCount = 0;
+   }
 
-   if (pContext->bInitComplete == DSL_TRUE)
+   while (pOpenContextList != DSL_NULL)
    {
-      DSL_DEBUG( DSL_DBG_WRN,
-         (pContext, SYS_DBG_WRN"DSL[%02d]: DSL CPE API is already initialized!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return DSL_WRN_ALREADY_INITIALIZED;
+      DSL_DRV_HandleDelete(pOpenContextList);
    }
 
-#ifndef DSL_DEBUG_DISABLE
-   #if defined(INCLUDE_DSL_CPE_API_VRX)
-      /* Take care that initial value for low level (MEI) driver are configured */
-      dbgModLev.data.nDbgModule = DSL_DBG_LOW_LEVEL_DRIVER;
-      dbgModLev.data.nDbgLevel = DSL_g_dbgLvl[DSL_DBG_LOW_LEVEL_DRIVER].nDbgLvl;
-      DSL_DRV_DBG_ModuleLevelSet(pContext, &dbgModLev);
-
-      dbgModLev.data.nDbgModule = DSL_DBG_MESSAGE_DUMP;
-      dbgModLev.data.nDbgLevel = DSL_g_dbgLvl[DSL_DBG_MESSAGE_DUMP].nDbgLvl;
-      DSL_DRV_DBG_ModuleLevelSet(pContext, &dbgModLev);
-
-      dbgModLev.data.nDbgModule = DSL_DBG_NOTIFICATIONS;
-      dbgModLev.data.nDbgLevel = DSL_g_dbgLvl[DSL_DBG_NOTIFICATIONS].nDbgLvl;
-      DSL_DRV_DBG_ModuleLevelSet(pContext, &dbgModLev);
-   #endif /* #ifndef DSL_DEBUG_DISABLE*/
-#endif /* INCLUDE_DSL_CPE_API_VRX */
-
-
 #ifdef INCLUDE_DSL_DELT
-#ifdef DSL_CPE_STATIC_DELT_DATA
-   DSL_DRV_MemSet(&deltData, 0, sizeof(DSL_G997_DeltData_t));
-   pContext->DELT = &deltData;
-   #ifdef INCLUDE_DSL_DELT_SHOWTIME
-   DSL_DRV_MemSet(&deltShowtimeData, 0, sizeof(DSL_G997_DeltShowtimeData_t));
-   pContext->DELT_SHOWTIME = &deltShowtimeData;
-   #endif /* INCLUDE_DSL_DELT_SHOWTIME*/
-#else
-   pContext->DELT = DSL_NULL;
-   #ifdef INCLUDE_DSL_DELT_SHOWTIME
-   pContext->DELT_SHOWTIME = DSL_NULL;
-   #endif /* INCLUDE_DSL_DELT_SHOWTIME*/
-#endif
-#endif /* #ifdef INCLUDE_DSL_DELT*/
+   DSL_DRV_G997_DeltPoolCleanup();
+#endif /* INCLUDE_DSL_DELT*/
+}
 
-#if defined (INCLUDE_DSL_CPE_API_DANUBE)
-   /* Set platform ID */
-   pContext->pDevCtx->data.version.fwVersion.nMajorVersion =
-        pData->data.nFirmwareFeatures.nPlatformId;
-   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
-      "DSL[%02d]: Initial platform ID (FW major version): %d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
-      pContext->pDevCtx->data.version.fwVersion.nMajorVersion));
-#endif
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_LinkReset(
+   DSL_IN DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-   /* Initialize possible XTSE configurations*/
-   memcpy(pContext->xtsePoss, g_XTSEposs, DSL_G997_NUM_XTSE_OCTETS);
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_LinkReset"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
 
-   /* Initialize SystemVendorId */
-   if (pData->data.pInventory != DSL_NULL)
+   nErrCode = DSL_DRV_DEV_LinkReset(pContext);
+   if (nErrCode != DSL_SUCCESS)
    {
-      memcpy(pContext->lineInventoryNe.SystemVendorID, &pData->data.pInventory->SystemVendorID,
-         sizeof(DSL_uint8_t) * DSL_G997_LI_MAXLEN_VENDOR_ID);
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: Modem couldn't be reset"DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
    }
-
-   /* Check XTSE setings*/
-   nErrCode = DSL_DRV_XtseSettingsCheck(pContext, pData->data.nXtseCfg.XTSE);
-   if (nErrCode < DSL_SUCCESS)
+   else
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Wrong XTSE settings!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      DSL_DEBUG( DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: Modem was reseted..."DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
 
-      DSL_DRV_MemSet(pData->data.nXtseCfg.XTSE, 0x0, sizeof(pData->data.nXtseCfg.XTSE));
+      nErrCode = DSL_SUCCESS;
    }
 
-   if(DSL_DRV_MUTEX_LOCK(pContext->dataMutex))
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_LinkReset"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_LinkTerminate(
+   DSL_IN DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_LinkTerminate"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
+
+   nErrCode = DSL_DRV_DEV_LinkTerminate(pContext);
+   if (nErrCode != DSL_SUCCESS)
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: Couldn't lock data mutex"DSL_DRV_CRLF,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: Modem couldn't be terminated"DSL_DRV_CRLF,
          DSL_DEV_NUM(pContext)));
-      return DSL_ERROR;
    }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: Modem was terminated..."DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
 
-   /* Set XTSE configuration*/
-   memcpy( pContext->xtseCfg, pData->data.nXtseCfg.XTSE, sizeof(pContext->xtseCfg) );
-
-   /* Get Test Mode Control options and copy them to the DSL CPE context*/
-   memcpy(&(pContext->nTestModeControl),
-          &(pData->data.nTestModeControl), sizeof(DSL_TestModeControlSet_t));
+      nErrCode = DSL_SUCCESS;
+   }
 
-   /* Get Line Activate Control options and copy them to the DSL CPE context*/
-   memcpy(&(pContext->lineActivateConfig),
-          &(pData->data.nLineActivateConfig), sizeof(DSL_G997_LineActivateData_t));
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_LinkTerminate"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
 
-   /* Set SerialNumber*/
-   memcpy(
-      pContext->lineInventoryNe.SerialNumber,
-      pData->data.pInventory->SerialNumber,
-      DSL_G997_LI_MAXLEN_SERIAL);
+   return nErrCode;
+}
 
-   /* Set VersionNumber*/
-   memcpy(
-      pContext->lineInventoryNe.VersionNumber,
-      pData->data.pInventory->VersionNumber,
-      DSL_G997_LI_MAXLEN_VERSION);
-#if (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)
-   /* Set VersionNumber*/
-   memcpy(
-      &pContext->auxInventoryNe,
-      &(pData->data.pInventory->Auxiliary),
-      sizeof(DSL_AuxInventoryNe_t));
-#endif
+DSL_Error_t DSL_DRV_ModulesInit(
+   DSL_IN DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_boolean_t bFirmwareReady = DSL_FALSE;
 
-   /* Set Autoboot configuration options*/
-   pContext->nAutobootStartupMode = pData->data.nAutobootStartupMode;
-   memcpy(
-      &(pContext->nAutobootConfig),
-      &(pData->data.nAutobootConfig),
-      sizeof(DSL_AutobootConfigData_t));
+   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_ERR_CODE();
 
-   /* *********************************************************************** */
-   /*              Initiliatize API default configurations                    */
-   /* *********************************************************************** */
-   /* Note: Values with default value zero/false does not need to be set
-            necessarily because the complete pContext structure is initialized
-            with zero at the beginning. */
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_UPSTREAM].bTrellisEnable = DSL_TRUE;
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].bTrellisEnable = DSL_TRUE;
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_ModulesInit"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
 
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_UPSTREAM].bBitswapEnable = DSL_TRUE;
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].bBitswapEnable = DSL_TRUE;
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, bFirmwareReady);
 
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_UPSTREAM].b20BitSupport = DSL_FEATURE_NA;
+   /* Check FW availability*/
+   if( !bFirmwareReady )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW not loaded yet!"DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
 
-#ifdef INCLUDE_DSL_CPE_API_DANUBE
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].b20BitSupport = DSL_FEATURE_DISABLED;
-#else
-   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].b20BitSupport = DSL_FEATURE_NA;
-#endif /* INCLUDE_DSL_CPE_API_DANUBE */
+      return DSL_ERROR;
+   }
 
-#ifdef INCLUDE_DSL_CPE_API_VRX
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bTrellisEnable = DSL_TRUE;
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bTrellisEnable = DSL_TRUE;
+   /* Lock DSL CPE API data mutex*/
+   if(DSL_DRV_MUTEX_LOCK(pContext->initMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: Couldn't lock data mutex"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bBitswapEnable = DSL_TRUE;
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bBitswapEnable = DSL_TRUE;
+      return DSL_ERROR;
+   }
 
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bReTxEnable = DSL_TRUE;
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bReTxEnable = DSL_TRUE;
+#if defined(INCLUDE_DSL_ADSL_MIB)
+   if ( DSL_DRV_MIB_ModuleInit(pContext) != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - MIB module initialization failed"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].b20BitSupport = DSL_FEATURE_NA;
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].b20BitSupport = DSL_FEATURE_NA;
+      nErrCode = DSL_ERROR;
+   }
+#endif /* defined(INCLUDE_DSL_ADSL_MIB)*/
 
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bVirtualNoiseSupport = DSL_TRUE;
-   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bVirtualNoiseSupport = DSL_TRUE;
-#endif /* INCLUDE_DSL_CPE_API_VRX*/
-
-   pContext->powerMgmtStatus.nPowerManagementStatus = DSL_G997_PMS_L3;
-
-   pContext->RebootCriteriaNeConfigData[DSL_MODE_ADSL] =
-      DSL_REBOOT_CRITERIA_ESE | DSL_REBOOT_CRITERIA_LOM | DSL_REBOOT_CRITERIA_LOF |
-      DSL_REBOOT_CRITERIA_LOS;
-#if defined(INCLUDE_DSL_CPE_API_DANUBE)
-   pContext->RebootCriteriaNeConfigData[DSL_MODE_ADSL] |=
-                                          DSL_REBOOT_CRITERIA_NEGATIVE_MARGIN;
-#endif
-
-#ifdef INCLUDE_DSL_CPE_API_VRX
-   pContext->RebootCriteriaNeConfigData[DSL_MODE_VDSL] =
-      DSL_REBOOT_CRITERIA_ESE | DSL_REBOOT_CRITERIA_LOM | DSL_REBOOT_CRITERIA_LOF |
-      DSL_REBOOT_CRITERIA_LOS;
-#endif /* INCLUDE_DSL_CPE_API_VRX*/
-
-   /* Enhanced upstream framing shall be enabled by default */
-   pContext->lineOptionsConfig[DSL_ENHANCED_FRAMING_US] = (DSL_int32_t)DSL_TRUE;
-
-#ifdef INCLUDE_DSL_CPE_API_VRX
-   /* Set initialization default power mode*/
-   pContext->PMMode = DSL_G997_PMMODE_BIT_L3_STATE;
-#endif /* INCLUDE_DSL_CPE_API_VRX*/
-
-   /* Set default rate adaptation mode settings */
-#ifdef INCLUDE_DSL_CPE_API_VRX
-   /* SRA disabled by default for VRX in ADSL mode */
-   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_UPSTREAM] = DSL_G997_RA_MODE_AT_INIT;
-   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_DOWNSTREAM] = DSL_G997_RA_MODE_AT_INIT;
-   /* SRA enabled by default for VRX in VDSL mode */
-   pContext->rateAdaptationMode[DSL_MODE_VDSL][DSL_UPSTREAM] = DSL_G997_RA_MODE_DYNAMIC;
-   pContext->rateAdaptationMode[DSL_MODE_VDSL][DSL_DOWNSTREAM] = DSL_G997_RA_MODE_DYNAMIC;
-#else
-   /* SRA disabled by default for ARX */
-   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_UPSTREAM] = DSL_G997_RA_MODE_AT_INIT;
-   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_DOWNSTREAM] = DSL_G997_RA_MODE_AT_INIT;
-#endif /* INCLUDE_DSL_CPE_API_VRX*/
-
-   /* *********************************************************************** */
-
-   DSL_DRV_MUTEX_UNLOCK(pContext->dataMutex);
-
-   /* Initialize device specific parameters*/
-   nErrCode = DSL_DRV_DEV_DeviceInit(pContext, pData);
-   if( nErrCode != DSL_SUCCESS )
+#if defined(INCLUDE_DSL_CEOC)
+   if ( DSL_CEOC_Start(pContext) != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Device Init failed!"DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - CEOC module initialization failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      return nErrCode;
+      nErrCode = DSL_ERROR;
    }
+#endif /* defined(INCLUDE_DSL_CEOC)*/
 
-#if (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)
-   /* Set default Vdsl profile*/
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.nPortMode, nPortMode);
-   if (nPortMode == DSL_PORT_MODE_DUAL)
-   {
-      pContext->VdslProfileConfigData =
-         DSL_BF_PROFILE_8A  | DSL_BF_PROFILE_8B  | DSL_BF_PROFILE_8C  | DSL_BF_PROFILE_8D;
-   }
-   else
+#if defined(INCLUDE_DSL_PM)
+   if ( DSL_DRV_PM_Start(pContext) != DSL_SUCCESS )
    {
-      pContext->VdslProfileConfigData =
-         DSL_BF_PROFILE_8A  | DSL_BF_PROFILE_8B  | DSL_BF_PROFILE_8C  | DSL_BF_PROFILE_8D |
-         DSL_BF_PROFILE_12A | DSL_BF_PROFILE_12B | DSL_BF_PROFILE_17A | DSL_BF_PROFILE_30A |
-         DSL_BF_PROFILE_35B;
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM module initialization failed"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      nErrCode = DSL_ERROR;
    }
-#endif /* (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)*/
+#endif /* defined(INCLUDE_DSL_PM)*/
 
-   memcpy(&(pContext->nFwFeatures), &(pData->data.nFirmwareFeatures),
-      sizeof(DSL_FirmwareFeatures_t));
+   /* Unock DSL CPE API data mutex*/
+   DSL_DRV_MUTEX_UNLOCK(pContext->initMutex);
 
-   if (DSL_DRV_BONDING_ENABLED && DSL_DRV_LINES_PER_DEVICE == 2)
-   {
-      memcpy(&(pContext->nFwFeatures2), &(pData->data.nFirmwareFeatures2),
-         sizeof(DSL_FirmwareFeatures_t));
-   }
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_ModulesInit"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
 
-   /* Download FW if available and Start Autoboot handling.
-       If no FW specified, do it later with appropriate IOCTLs*/
-   if( pData->data.pFirmware != DSL_NULL || pData->data.pFirmware2 != DSL_NULL )
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_boolean_t DSL_DRV_BondingEnableCheck(
+   DSL_Context_t *pContext)
+{
+   DSL_boolean_t bPafEnable = DSL_FALSE;
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+   DSL_DslModeSelection_t nDslMode = DSL_MODE_NA;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   if (DSL_DRV_BONDING_ENABLED)
    {
-      /* Load FW if available*/
-      nErrCode = DSL_DRV_FwDownload(
-                    pContext,
-                    (DSL_char_t*)pData->data.pFirmware,
-                    pData->data.nFirmwareSize,
-                    (DSL_char_t*)pData->data.pFirmware2,
-                    pData->data.nFirmwareSize2,
-                    &nLoff, &nCurrOffset,
-                    DSL_TRUE, DSL_TRUE);
+      nDslMode = DSL_DRV_VRX_DslModeIndexGet(pContext);
 
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW Download failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         return nErrCode;
-      }
+      DSL_CHECK_DSLMODE(nDslMode);
+      DSL_CHECK_ERR_CODE();
 
-      /* Get FW ready flag*/
-      DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, bFirmwareReady);
+      /* Bonding is always enabled for both lines/devices together so using the
+         configuration from the current line/device is ok. */
+      DSL_CTX_READ_SCALAR( pContext, nErrCode, BndConfig[nDslMode].bPafEnable, bPafEnable);
 
-      /* Here the complete FW binary should be downloaded to the device, no chunks allowed*/
-      if(!bFirmwareReady)
+      if (nErrCode != DSL_SUCCESS)
       {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Expecting complete FW binary!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         return DSL_ERROR;
+         DSL_DEBUG(DSL_DBG_ERR,
+                   (pContext, SYS_DBG_ERR "DSL[%02d]: ERROR - bPafEnable get failed!"
+                    DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
       }
+   }
+#endif
+   return bPafEnable;
+}
 
-      nErrCode = DSL_DRV_DEV_G994VendorIdFirmwareUpdate(pContext);
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - could not initialize G994 Vendor ID!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_XtseSettingsCheck(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_uint8_t *pXTSE)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS, nRet = DSL_SUCCESS;
+   DSL_int32_t i = 0, emptyXseCnt = 0;
+   DSL_uint8_t xtsePoss = 0;
+   DSL_boolean_t bXtseChanged = DSL_FALSE, bXtseUnsupported = DSL_FALSE;
 
-         return nErrCode;
-      }
+   DSL_CHECK_POINTER(pContext, pXTSE);
+   DSL_CHECK_ERR_CODE();
 
-      /* Start Autoboot handling if allowed*/
-      if( pData->data.nAutobootStartupMode != DSL_AUTOBOOT_CTRL_STOP )
+   /* Validation checks for configuration data */
+   for (i = 0; i < DSL_G997_NUM_XTSE_OCTETS; i++)
+   {
+      DSL_CTX_READ(pContext, nErrCode, xtsePoss[i], xtsePoss);
+
+      /* Check for unsupported bits*/
+      if ( (~(xtsePoss) & pXTSE[i]) > 0)
       {
-         if( DSL_DRV_AutobootThreadStart(pContext) != DSL_SUCCESS )
+         /* Check if there is at least one valid bit*/
+         if ((pXTSE[i] & xtsePoss) > 0)
          {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot thread start failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+            /* Change specified configuration*/
+            pXTSE[i] &= xtsePoss;
 
-            return DSL_ERROR;
+            bXtseChanged = DSL_TRUE;
+         }
+         else
+         {
+            /* No valid bits found at all*/
+            bXtseUnsupported = DSL_TRUE;
          }
       }
 
-      /* Initialize additional modules PM, CEOC,...*/
-      nErrCode = DSL_DRV_ModulesInit(pContext);
-      if( nErrCode != DSL_SUCCESS )
+      if (!pXTSE[i])
       {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - additional modules init failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         return nErrCode;
+         emptyXseCnt++;
       }
    }
+
+   /* Check if no valid bits specified at all*/
+   if (emptyXseCnt >= DSL_G997_NUM_XTSE_OCTETS)
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Empty XTSE settings, emptyXseCnt=%d!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), emptyXseCnt));
+
+      nErrCode = DSL_ERROR;
+   }
    else
    {
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-      nFwType = DSL_FW_REQUEST_XDSL;
-#else
-      nFwType = DSL_FW_REQUEST_ADSL;
-#endif /* defined(INCLUDE_DSL_CPE_API_VRX) */
-#ifdef INCLUDE_FW_REQUEST_SUPPORT
-      bFwRequest = DSL_TRUE;
-#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
-      /* Set pending flag to start automatically Autoboot handling if allowed*/
-      if( pData->data.nAutobootStartupMode != DSL_AUTOBOOT_CTRL_STOP )
+      if (bXtseUnsupported && !bXtseChanged)
       {
-         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootStartPending, DSL_TRUE);
-      }
+         /* There are bits set within the configuration that are not supported
+            by G.997.1 or at least by this version of the DSL library */
+         DSL_DEBUG(DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - No valid XTSE settings!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      /* Set Autoboot Status*/
-      nErrCode = DSL_DRV_AutobootStatusSet(pContext, DSL_AUTOBOOT_STATUS_FW_WAIT, nFwType);
-      if( nErrCode != DSL_SUCCESS )
+         nErrCode = DSL_ERROR;
+      }
+      else if (bXtseChanged)
       {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Status set failed!"
+         DSL_DEBUG(DSL_DBG_WRN,
+            (pContext, SYS_DBG_WRN"DSL[%02d]: WARNING - Unsupported bits removed from the current XTSE settings!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         return nErrCode;
+         nErrCode = DSL_WRN_INCONSISTENT_XTSE_CONFIGURATION;
       }
    }
 
-   /* Set LINIT value to LINIT_UNKNOWN*/
-   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, lineInitStatus.nLineInitStatus, LINIT_UNKNOWN);
-
-#if defined(DSL_VRX_DEVICE_VR11)
-   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bFwEventActivation, DSL_TRUE);
-#endif
-
-   pContext->bInitComplete = DSL_TRUE;
-
-   /* Generate DSL_EVENT_S_INIT_READY event*/
-   DSL_DRV_EventGenerate(pContext, 0, DSL_ACCESSDIR_NA, DSL_XTUDIR_NA,
-      DSL_EVENT_S_INIT_READY, DSL_NULL, 0);
-
-#ifdef INCLUDE_FW_REQUEST_SUPPORT
-   if (bFwRequest)
-   {
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-      DSL_PortMode_t nPortMode;
-
-      /* get port mode type*/
-      DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.nPortMode, nPortMode);
-      fwReqData.nPortMode = nPortMode;
-#endif
-
-      fwReqData.nFirmwareRequestType = nFwType;
-
-      /* Generate DSL_EVENT_S_FIRMWARE_REQUEST event*/
-      DSL_DRV_EventGenerate( pContext, 0, DSL_ACCESSDIR_NA,
-         DSL_XTUDIR_NA, DSL_EVENT_S_FIRMWARE_REQUEST,
-         (DSL_EventData_Union_t*)&fwReqData, sizeof(DSL_FirmwareRequestData_t));
-   }
-#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
-
-   nErrCode = DSL_DRV_HybridContextReset(pContext);
-   if (nErrCode != DSL_SUCCESS)
-   {
-      DSL_DEBUG(DSL_DBG_ERR, (pContext, "DSL[%02d]: ERROR - HybridContextReset "
-         "init failed!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      /* Continue with activation sequence anyhow */
-   }
-
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_Init, retCode=%d"DSL_DRV_CRLF,
-      DSL_DEV_NUM(pContext) ,nErrCode));
+   if (nErrCode >= DSL_SUCCESS)
+   {
+      /* Check device specific XTSE settings*/
+      nRet = DSL_DRV_DEV_XtseSettingsCheck(pContext, pXTSE);
+      if (nRet != DSL_SUCCESS)
+      {
+         nErrCode = nRet;
+      }
+   }
 
    return nErrCode;
 }
@@ -1404,338 +1461,417 @@ DSL_Error_t DSL_DRV_Init(
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_void_t DSL_DRV_Free(
-   DSL_IN DSL_Context_t *pContext)
+DSL_Error_t DSL_DRV_Init(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_Init_t *pData)
 {
-   if (pContext == DSL_NULL)
-   {
-      DSL_DEBUG(DSL_DBG_ERR, (pContext, SYS_DBG_ERR"Invalid context pointer!"DSL_DRV_CRLF));
-      return;
-   }
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_int32_t nLoff = 0, nCurrOffset = 0;
+   DSL_boolean_t bFirmwareReady = DSL_FALSE;
+#ifdef INCLUDE_FW_REQUEST_SUPPORT
+   DSL_FirmwareRequestData_t fwReqData = { DSL_FW_REQUEST_NA };
+   DSL_boolean_t bFwRequest = DSL_FALSE;
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
+   DSL_FirmwareRequestType_t nFwType = DSL_FW_REQUEST_NA;
+#ifndef DSL_DEBUG_DISABLE
+   #if defined(INCLUDE_DSL_CPE_API_VRX)
+      DSL_DBG_ModuleLevel_t dbgModLev;
+   #endif /* #ifndef DSL_DEBUG_DISABLE*/
+#endif /* INCLUDE_DSL_CPE_API_VRX */
+#if (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)
+   DSL_PortMode_t nPortMode;
+#endif /* (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)*/
 
-   if (pContext->pFirmware != DSL_NULL)
-   {
-      DSL_DRV_VFree(pContext->pFirmware);
-      pContext->pFirmware = DSL_NULL;
-   }
+   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_ERR_CODE();
 
-   if (pContext->pFirmware2 != DSL_NULL)
-   {
-      DSL_DRV_VFree(pContext->pFirmware2);
-      pContext->pFirmware2 = DSL_NULL;
-   }
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
 
-   pContext->bInitComplete = DSL_FALSE;
+   DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
+   DSL_CHECK_ERR_CODE();
 
-#ifdef INCLUDE_DSL_TIMEOUT
-   DSL_DRV_Timeout_Shutdown(pContext);
-#endif /* INCLUDE_DSL_TIMEOUT*/
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_Init"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext)));
 
-#ifdef INCLUDE_DSL_PM
-   /* Stop PM module processing*/
-   if( DSL_DRV_PM_Stop(pContext) != DSL_SUCCESS )
+   if (pContext->bInitComplete == DSL_TRUE)
    {
-      DSL_DEBUG(DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: PM Module deinitialization failed"
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: DSL CPE API is already initialized!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-   }
-#endif /* #ifdef INCLUDE_DSL_PM*/
 
-#ifdef INCLUDE_DSL_CEOC
-   /* Stop CEOC module processing*/
-   if( DSL_CEOC_Stop(pContext) != DSL_SUCCESS )
-   {
-      DSL_DEBUG(DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: CEOC Module deinitialization failed"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_WRN_ALREADY_INITIALIZED;
    }
-#endif /* #ifdef INCLUDE_DSL_CEOC*/
+
+#ifndef DSL_DEBUG_DISABLE
+   #if defined(INCLUDE_DSL_CPE_API_VRX)
+      /* Take care that initial value for low level (MEI) driver are configured */
+      dbgModLev.data.nDbgModule = DSL_DBG_LOW_LEVEL_DRIVER;
+      dbgModLev.data.nDbgLevel = DSL_g_dbgLvl[DSL_DBG_LOW_LEVEL_DRIVER].nDbgLvl;
+      DSL_DRV_DBG_ModuleLevelSet(pContext, &dbgModLev);
+
+      dbgModLev.data.nDbgModule = DSL_DBG_MESSAGE_DUMP;
+      dbgModLev.data.nDbgLevel = DSL_g_dbgLvl[DSL_DBG_MESSAGE_DUMP].nDbgLvl;
+      DSL_DRV_DBG_ModuleLevelSet(pContext, &dbgModLev);
+
+      dbgModLev.data.nDbgModule = DSL_DBG_NOTIFICATIONS;
+      dbgModLev.data.nDbgLevel = DSL_g_dbgLvl[DSL_DBG_NOTIFICATIONS].nDbgLvl;
+      DSL_DRV_DBG_ModuleLevelSet(pContext, &dbgModLev);
+   #endif /* #ifndef DSL_DEBUG_DISABLE*/
+#endif /* INCLUDE_DSL_CPE_API_VRX */
+
 
 #ifdef INCLUDE_DSL_DELT
-#ifndef DSL_CPE_STATIC_DELT_DATA
-   /* Release DELT memory */
-   if (pContext->DELT != DSL_NULL)
-   {
-      DSL_DRV_MemFree(pContext->DELT);
-   }
+#ifdef DSL_CPE_STATIC_DELT_DATA
+   DSL_DRV_MemSet(&deltData, 0, sizeof(DSL_G997_DeltData_t));
+   pContext->DELT = &deltData;
    #ifdef INCLUDE_DSL_DELT_SHOWTIME
-   if (pContext->DELT_SHOWTIME != DSL_NULL)
-   {
-      DSL_DRV_MemFree(pContext->DELT_SHOWTIME);
-   }
+   DSL_DRV_MemSet(&deltShowtimeData, 0, sizeof(DSL_G997_DeltShowtimeData_t));
+   pContext->DELT_SHOWTIME = &deltShowtimeData;
    #endif /* INCLUDE_DSL_DELT_SHOWTIME*/
-#endif /* DSL_CPE_STATIC_DELT_DATA*/
-#endif /* INCLUDE_DSL_DELT*/
-}
-
-/*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
-*/
-DSL_Error_t DSL_DRV_AutobootLoadFirmware(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_AutobootLoadFirmware_t *pData)
-{
-   DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_int32_t nOffset = 0;
-   DSL_boolean_t bFirmwareReady = DSL_FALSE;
-   DSL_boolean_t bAutobootThreadStarted = DSL_FALSE,
-                 bAutobootFwLoadPending = DSL_FALSE,
-                 bAutobootStartPending  = DSL_FALSE;
-   DSL_AutobootControl_t AutobootCtrl;
-   DSL_int32_t nWaitCount = 0;
-   DSL_Autoboot_State_t nState = DSL_AUTOBOOTSTATE_UNKNOWN;
-   DSL_uint8_t *pFirmware = DSL_NULL, *pFirmware2 = DSL_NULL;
+#else
+   pContext->DELT = DSL_NULL;
+   #ifdef INCLUDE_DSL_DELT_SHOWTIME
+   pContext->DELT_SHOWTIME = DSL_NULL;
+   #endif /* INCLUDE_DSL_DELT_SHOWTIME*/
+#endif
+#endif /* #ifdef INCLUDE_DSL_DELT*/
 
-   DSL_CHECK_POINTER(pContext, pData);
-   DSL_CHECK_ERR_CODE();
+#if defined (INCLUDE_DSL_CPE_API_DANUBE)
+   /* Set platform ID */
+   pContext->pDevCtx->data.version.fwVersion.nMajorVersion =
+        pData->data.nFirmwareFeatures.nPlatformId;
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+      "DSL[%02d]: Initial platform ID (FW major version): %d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
+      pContext->pDevCtx->data.version.fwVersion.nMajorVersion));
+#endif
 
-   DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
-   DSL_CHECK_ERR_CODE();
+   /* Initialize possible XTSE configurations*/
+   memcpy(pContext->xtsePoss, g_XTSEposs, DSL_G997_NUM_XTSE_OCTETS);
 
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, bAutobootThreadStarted, bAutobootThreadStarted);
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, bAutobootFwLoadPending);
+   /* Initialize SystemVendorId */
+   if (pData->data.pInventory != DSL_NULL)
+   {
+      memcpy(pContext->lineInventoryNe.SystemVendorID, &pData->data.pInventory->SystemVendorID,
+         sizeof(DSL_uint8_t) * DSL_G997_LI_MAXLEN_VENDOR_ID);
+   }
 
-   if( (pData->data.pFirmware  != DSL_NULL && pData->data.nFirmwareSize) ||
-       (pData->data.pFirmware2 != DSL_NULL && pData->data.nFirmwareSize2) )
+   /* Check XTSE setings*/
+   nErrCode = DSL_DRV_XtseSettingsCheck(pContext, pData->data.nXtseCfg.XTSE);
+   if (nErrCode < DSL_SUCCESS)
    {
-      DSL_DEBUG(DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: Preparing to download FW..."
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Wrong XTSE settings!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      DSL_CTX_WRITE(pContext, nErrCode, nFwFeatures, pData->data.firmwareFeatures);
-
-      if (DSL_DRV_BONDING_ENABLED && DSL_DRV_LINES_PER_DEVICE == 2)
-      {
-         DSL_CTX_WRITE(pContext, nErrCode, nFwFeatures2, pData->data.firmwareFeatures2);
-      }
+      DSL_DRV_MemSet(pData->data.nXtseCfg.XTSE, 0x0, sizeof(pData->data.nXtseCfg.XTSE));
    }
-   else
+
+   if(DSL_DRV_MUTEX_LOCK(pContext->dataMutex))
    {
-      DSL_DEBUG(DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - No FW specified!"DSL_DRV_CRLF,
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: Couldn't lock data mutex"DSL_DRV_CRLF,
          DSL_DEV_NUM(pContext)));
-
       return DSL_ERROR;
    }
 
-   if( bAutobootThreadStarted && !bAutobootFwLoadPending)
-   {
-      DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_TRUE);
-
-      /* Get Autoboot State*/
-      DSL_CTX_READ_SCALAR(pContext, nErrCode, nAutobootState, nState);
+   /* Set XTSE configuration*/
+   memcpy( pContext->xtseCfg, pData->data.nXtseCfg.XTSE, sizeof(pContext->xtseCfg) );
 
-      if( nState != DSL_AUTOBOOTSTATE_FIRMWARE_WAIT )
-      {
-         /* Restart Autoboot*/
-         AutobootCtrl.data.nCommand = DSL_AUTOBOOT_CTRL_RESTART;
-         nErrCode = DSL_DRV_AutobootControlSet(pContext,&AutobootCtrl);
-         if( nErrCode != DSL_SUCCESS )
-         {
-            /* Clear bAutobootFwLoadPending flag*/
-            DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
+   /* Get Test Mode Control options and copy them to the DSL CPE context*/
+   memcpy(&(pContext->nTestModeControl),
+          &(pData->data.nTestModeControl), sizeof(DSL_TestModeControlSet_t));
 
-            DSL_DEBUG(DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Control set failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-            return nErrCode;
-         }
-      }
+   /* Get Line Activate Control options and copy them to the DSL CPE context*/
+   memcpy(&(pContext->lineActivateConfig),
+          &(pData->data.nLineActivateConfig), sizeof(DSL_G997_LineActivateData_t));
 
-      /* wait for "DSL_AUTOBOOTSTATE_FIRMWARE_WAIT" max 4 sec */
-      for (nWaitCount = 0; nWaitCount < 40; nWaitCount++)
-      {
-         /* Get Autoboot State*/
-         DSL_CTX_READ_SCALAR(pContext, nErrCode, nAutobootState, nState);
-         if( nErrCode != DSL_SUCCESS )
-         {
-            /* Clear bAutobootFwLoadPending flag*/
-            DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
+   /* Set SerialNumber*/
+   memcpy(
+      pContext->lineInventoryNe.SerialNumber,
+      pData->data.pInventory->SerialNumber,
+      DSL_G997_LI_MAXLEN_SERIAL);
 
-            DSL_DEBUG(DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot State get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-            return nErrCode;
-         }
+   /* Set VersionNumber*/
+   memcpy(
+      pContext->lineInventoryNe.VersionNumber,
+      pData->data.pInventory->VersionNumber,
+      DSL_G997_LI_MAXLEN_VERSION);
+#if (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)
+   /* Set VersionNumber*/
+   memcpy(
+      &pContext->auxInventoryNe,
+      &(pData->data.pInventory->Auxiliary),
+      sizeof(DSL_AuxInventoryNe_t));
+#endif
 
-         if( nState == DSL_AUTOBOOTSTATE_FIRMWARE_WAIT )
-         {
-            break;
-         }
+   /* Set Autoboot configuration options*/
+   pContext->nAutobootStartupMode = pData->data.nAutobootStartupMode;
+   memcpy(
+      &(pContext->nAutobootConfig),
+      &(pData->data.nAutobootConfig),
+      sizeof(DSL_AutobootConfigData_t));
 
-         DSL_DRV_MSecSleep(100);
-      }
+   /* *********************************************************************** */
+   /*              Initiliatize API default configurations                    */
+   /* *********************************************************************** */
+   /* Note: Values with default value zero/false does not need to be set
+            necessarily because the complete pContext structure is initialized
+            with zero at the beginning. */
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_UPSTREAM].bTrellisEnable = DSL_TRUE;
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].bTrellisEnable = DSL_TRUE;
 
-      if( nState != DSL_AUTOBOOTSTATE_FIRMWARE_WAIT )
-      {
-         /* Clear bAutobootFwLoadPending flag*/
-         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
-         DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Timeout while waiting the "
-            "DSL_AUTOBOOTSTATE_FIRMWARE_WAIT state!"DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext)));
-         return DSL_ERROR;
-      }
-   }
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_UPSTREAM].bBitswapEnable = DSL_TRUE;
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].bBitswapEnable = DSL_TRUE;
 
-   /* Deactivate Autoboot timeout for the Firmware Wait state*/
-   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nAutobootTimeoutLimit, 1800);
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_UPSTREAM].b20BitSupport = DSL_FEATURE_NA;
 
-   /* Copy FW binary to the kernel space*/
-   if (pData->data.pFirmware != DSL_NULL)
-   {
-      pFirmware = (DSL_uint8_t*)DSL_DRV_VMalloc(pData->data.nFirmwareSize);
+#ifdef INCLUDE_DSL_CPE_API_DANUBE
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].b20BitSupport = DSL_FEATURE_DISABLED;
+#else
+   pContext->lineFeatureDataCfg[DSL_MODE_ADSL][DSL_DOWNSTREAM].b20BitSupport = DSL_FEATURE_NA;
+#endif /* INCLUDE_DSL_CPE_API_DANUBE */
 
-      if (pFirmware != DSL_NULL)
-      {
-         DSL_IoctlMemCpyFrom(
-            DSL_FALSE, pFirmware, pData->data.pFirmware, pData->data.nFirmwareSize);
-      }
-      else
-      {
-         pFirmware = DSL_NULL;
-         nErrCode = DSL_ERROR;
-         DSL_DEBUG( DSL_DBG_ERR, (pContext,
-            SYS_DBG_ERR"DSL[%02d]: ERROR - Memory allocation for firmware binary 1 failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      }
-   }
+#ifdef INCLUDE_DSL_CPE_API_VRX
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bTrellisEnable = DSL_TRUE;
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bTrellisEnable = DSL_TRUE;
+
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bBitswapEnable = DSL_TRUE;
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bBitswapEnable = DSL_TRUE;
+
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bReTxEnable = DSL_TRUE;
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bReTxEnable = DSL_TRUE;
+
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].b20BitSupport = DSL_FEATURE_NA;
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].b20BitSupport = DSL_FEATURE_NA;
+
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_UPSTREAM].bVirtualNoiseSupport = DSL_TRUE;
+   pContext->lineFeatureDataCfg[DSL_MODE_VDSL][DSL_DOWNSTREAM].bVirtualNoiseSupport = DSL_TRUE;
+#endif /* INCLUDE_DSL_CPE_API_VRX*/
+
+   pContext->powerMgmtStatus.nPowerManagementStatus = DSL_G997_PMS_L3;
+
+   pContext->RebootCriteriaNeConfigData[DSL_MODE_ADSL] =
+      DSL_REBOOT_CRITERIA_ESE | DSL_REBOOT_CRITERIA_LOM | DSL_REBOOT_CRITERIA_LOF |
+      DSL_REBOOT_CRITERIA_LOS;
+#if defined(INCLUDE_DSL_CPE_API_DANUBE)
+   pContext->RebootCriteriaNeConfigData[DSL_MODE_ADSL] |=
+                                          DSL_REBOOT_CRITERIA_NEGATIVE_MARGIN;
+#endif
+
+#ifdef INCLUDE_DSL_CPE_API_VRX
+   pContext->RebootCriteriaNeConfigData[DSL_MODE_VDSL] =
+      DSL_REBOOT_CRITERIA_ESE | DSL_REBOOT_CRITERIA_LOM | DSL_REBOOT_CRITERIA_LOF |
+      DSL_REBOOT_CRITERIA_LOS;
+#endif /* INCLUDE_DSL_CPE_API_VRX*/
+
+   /* Enhanced upstream framing shall be enabled by default */
+   pContext->lineOptionsConfig[DSL_ENHANCED_FRAMING_US] = (DSL_int32_t)DSL_TRUE;
+
+#ifdef INCLUDE_DSL_CPE_API_VRX
+   /* Set initialization default power mode*/
+   pContext->PMMode = DSL_G997_PMMODE_BIT_L3_STATE;
+#endif /* INCLUDE_DSL_CPE_API_VRX*/
+
+   /* Set default rate adaptation mode settings */
+#ifdef INCLUDE_DSL_CPE_API_VRX
+   /* SRA disabled by default for VRX in ADSL mode */
+   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_UPSTREAM] = DSL_G997_RA_MODE_AT_INIT;
+   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_DOWNSTREAM] = DSL_G997_RA_MODE_AT_INIT;
+   /* SRA enabled by default for VRX in VDSL mode */
+   pContext->rateAdaptationMode[DSL_MODE_VDSL][DSL_UPSTREAM] = DSL_G997_RA_MODE_DYNAMIC;
+   pContext->rateAdaptationMode[DSL_MODE_VDSL][DSL_DOWNSTREAM] = DSL_G997_RA_MODE_DYNAMIC;
+#else
+   /* SRA disabled by default for ARX */
+   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_UPSTREAM] = DSL_G997_RA_MODE_AT_INIT;
+   pContext->rateAdaptationMode[DSL_MODE_ADSL][DSL_DOWNSTREAM] = DSL_G997_RA_MODE_AT_INIT;
+#endif /* INCLUDE_DSL_CPE_API_VRX*/
+
+   /* *********************************************************************** */
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->dataMutex);
 
-   /* Copy FW binary 2 to the kernel space*/
-   if ((pData->data.pFirmware2 != DSL_NULL) && (nErrCode == DSL_SUCCESS))
+   /* Initialize device specific parameters*/
+   nErrCode = DSL_DRV_DEV_DeviceInit(pContext, pData);
+   if( nErrCode != DSL_SUCCESS )
    {
-      pFirmware2 = (DSL_uint8_t*)DSL_DRV_VMalloc(pData->data.nFirmwareSize2);
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Device Init failed!"DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
 
-      if (pFirmware2 != DSL_NULL)
-      {
-         DSL_IoctlMemCpyFrom(
-            DSL_FALSE, pFirmware2, pData->data.pFirmware2, pData->data.nFirmwareSize2);
-      }
-      else
-      {
-         pFirmware2 = DSL_NULL;
-         nErrCode = DSL_ERROR;
-         DSL_DEBUG( DSL_DBG_ERR, (pContext,
-            SYS_DBG_ERR"DSL[%02d]: ERROR - Memory allocation for firmware binary 2 failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      }
+      return nErrCode;
    }
 
-   if (nErrCode == DSL_SUCCESS)
+#if (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)
+   /* Set default Vdsl profile*/
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.nPortMode, nPortMode);
+   if (nPortMode == DSL_PORT_MODE_DUAL)
    {
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-      /* Download FW*/
-      nErrCode = DSL_DRV_FwDownload(
-                    pContext,
-                    (DSL_char_t*)pFirmware, pData->data.nFirmwareSize,
-                    (DSL_char_t*)pFirmware2, pData->data.nFirmwareSize2,
-                    (DSL_int32_t*)&pData->data.nFirmwareOffset, &nOffset,
-                    pData->data.bLastChunk, pData->data.bForceDownload);
-#else
-      /*
-      KAv: If FW binary data is in kernel space, the Amazon-Se driver FW
-           sequence crashes. This issue needs further clarification.
-      */
-      /* Download FW*/
-      nErrCode = DSL_DRV_FwDownload(
-                    pContext,
-                    (DSL_char_t*)pData->data.pFirmware, pData->data.nFirmwareSize,
-                    (DSL_char_t*)pData->data.pFirmware2, pData->data.nFirmwareSize2,
-                    (DSL_int32_t*)&pData->data.nFirmwareOffset, &nOffset,
-                    pData->data.bLastChunk, pData->data.bForceDownload);
-#endif
+      pContext->VdslProfileConfigData =
+         DSL_BF_PROFILE_8A  | DSL_BF_PROFILE_8B  | DSL_BF_PROFILE_8C  | DSL_BF_PROFILE_8D;
    }
-
-   if (pFirmware != DSL_NULL)
+   else
    {
-      /* Free allocated FW binary 1 resources*/
-      DSL_DRV_VFree(pFirmware);
+      pContext->VdslProfileConfigData =
+         DSL_BF_PROFILE_8A  | DSL_BF_PROFILE_8B  | DSL_BF_PROFILE_8C  | DSL_BF_PROFILE_8D |
+         DSL_BF_PROFILE_12A | DSL_BF_PROFILE_12B | DSL_BF_PROFILE_17A | DSL_BF_PROFILE_30A |
+         DSL_BF_PROFILE_35B;
    }
+#endif /* (INCLUDE_DSL_CPE_API_VDSL_SUPPORT == 1)*/
+
+   memcpy(&(pContext->nFwFeatures), &(pData->data.nFirmwareFeatures),
+      sizeof(DSL_FirmwareFeatures_t));
 
-   if (pFirmware2 != DSL_NULL)
+   if (DSL_DRV_BONDING_ENABLED && DSL_DRV_LINES_PER_DEVICE == 2)
    {
-      /* Free allocated FW binary 2 resources*/
-      DSL_DRV_VFree(pFirmware2);
+      memcpy(&(pContext->nFwFeatures2), &(pData->data.nFirmwareFeatures2),
+         sizeof(DSL_FirmwareFeatures_t));
    }
 
-   if( nErrCode >= DSL_SUCCESS )
+   /* Download FW if available and Start Autoboot handling.
+       If no FW specified, do it later with appropriate IOCTLs*/
+   if( pData->data.pFirmware != DSL_NULL || pData->data.pFirmware2 != DSL_NULL )
    {
-      /* Get bFirmwareReady flag*/
+      /* Load FW if available*/
+      nErrCode = DSL_DRV_FwDownload(
+                    pContext,
+                    (DSL_char_t*)pData->data.pFirmware,
+                    pData->data.nFirmwareSize,
+                    (DSL_char_t*)pData->data.pFirmware2,
+                    pData->data.nFirmwareSize2,
+                    &nLoff, &nCurrOffset,
+                    DSL_TRUE, DSL_TRUE);
+
+      if( nErrCode != DSL_SUCCESS )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW Download failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         return nErrCode;
+      }
+
+      /* Get FW ready flag*/
       DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, bFirmwareReady);
-      if( bFirmwareReady )
+
+      /* Here the complete FW binary should be downloaded to the device, no chunks allowed*/
+      if(!bFirmwareReady)
       {
-         nErrCode = DSL_DRV_DEV_G994VendorIdFirmwareUpdate(pContext);
-         if( nErrCode != DSL_SUCCESS )
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Expecting complete FW binary!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         return DSL_ERROR;
+      }
+
+      nErrCode = DSL_DRV_DEV_G994VendorIdFirmwareUpdate(pContext);
+      if( nErrCode != DSL_SUCCESS )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - could not initialize G994 Vendor ID!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         return nErrCode;
+      }
+
+      /* Start Autoboot handling if allowed*/
+      if( pData->data.nAutobootStartupMode != DSL_AUTOBOOT_CTRL_STOP )
+      {
+         if( DSL_DRV_AutobootThreadStart(pContext) != DSL_SUCCESS )
          {
             DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - could not initialize G994 Vendor ID!"
+               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot thread start failed!"
                DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-            return nErrCode;
+            return DSL_ERROR;
          }
+      }
 
-         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
-         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bFwRequestHandled, DSL_TRUE);
-
-#ifndef INCLUDE_FW_REQUEST_SUPPORT
-         /* Check if the Chunk download is disabled*/
-         if (!(pData->data.bChunkDonwloadEnabled))
-         {
-            /* Store FW binaries*/
-            nErrCode = DSL_DRV_FwStore(
-                       pContext, DSL_FALSE,
-                       (DSL_char_t*)pData->data.pFirmware,  pData->data.nFirmwareSize,
-                       (DSL_char_t*)pData->data.pFirmware2, pData->data.nFirmwareSize2);
-            if (nErrCode != DSL_SUCCESS)
-            {
-               DSL_DEBUG(DSL_DBG_ERR,
-                 (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW store failed!"
-                 DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-            }
-         }
-#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
+      /* Initialize additional modules PM, CEOC,...*/
+      nErrCode = DSL_DRV_ModulesInit(pContext);
+      if( nErrCode != DSL_SUCCESS )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - additional modules init failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         /* Get Autoboot pending start flag*/
-         DSL_CTX_READ(pContext, nErrCode, bAutobootStartPending, bAutobootStartPending);
+         return nErrCode;
+      }
+   }
+   else
+   {
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+      nFwType = DSL_FW_REQUEST_XDSL;
+#else
+      nFwType = DSL_FW_REQUEST_ADSL;
+#endif /* defined(INCLUDE_DSL_CPE_API_VRX) */
+#ifdef INCLUDE_FW_REQUEST_SUPPORT
+      bFwRequest = DSL_TRUE;
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
+      /* Set pending flag to start automatically Autoboot handling if allowed*/
+      if( pData->data.nAutobootStartupMode != DSL_AUTOBOOT_CTRL_STOP )
+      {
+         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootStartPending, DSL_TRUE);
+      }
 
-         /* Check if there is a pending Autoboot start*/
-         if (bAutobootStartPending)
-         {
-            /* Reset Autoboot pending start flag*/
-            DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootStartPending, DSL_FALSE);
+      /* Set Autoboot Status*/
+      nErrCode = DSL_DRV_AutobootStatusSet(pContext, DSL_AUTOBOOT_STATUS_FW_WAIT, nFwType);
+      if( nErrCode != DSL_SUCCESS )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Status set failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-            nErrCode = DSL_DRV_AutobootThreadStart(pContext);
-            if (nErrCode != DSL_SUCCESS)
-            {
-               DSL_DEBUG(DSL_DBG_ERR,
-                 (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Thread pending start failed!"
-                 DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         return nErrCode;
+      }
+   }
 
-               return nErrCode;
-            }
+   /* Set LINIT value to LINIT_UNKNOWN*/
+   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, lineInitStatus.nLineInitStatus, LINIT_UNKNOWN);
 
-            /* Initialize additional modules PM, CEOC,...*/
-            nErrCode = DSL_DRV_ModulesInit(pContext);
-            if (nErrCode != DSL_SUCCESS)
-            {
-               DSL_DEBUG( DSL_DBG_ERR,
-                  (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - additional modules init failed!"
-                  DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+#if defined(DSL_VRX_DEVICE_VR11)
+   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bFwEventActivation, DSL_TRUE);
+#endif
 
-               return nErrCode;
-            }
-         }
-      }
+   pContext->bInitComplete = DSL_TRUE;
+
+   /* Generate DSL_EVENT_S_INIT_READY event*/
+   DSL_DRV_EventGenerate(pContext, 0, DSL_ACCESSDIR_NA, DSL_XTUDIR_NA,
+      DSL_EVENT_S_INIT_READY, DSL_NULL, 0);
+
+#ifdef INCLUDE_FW_REQUEST_SUPPORT
+   if (bFwRequest)
+   {
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+      DSL_PortMode_t nPortMode;
+
+      /* get port mode type*/
+      DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.nPortMode, nPortMode);
+      fwReqData.nPortMode = nPortMode;
+#endif
+
+      fwReqData.nFirmwareRequestType = nFwType;
+
+      /* Generate DSL_EVENT_S_FIRMWARE_REQUEST event*/
+      DSL_DRV_EventGenerate( pContext, 0, DSL_ACCESSDIR_NA,
+         DSL_XTUDIR_NA, DSL_EVENT_S_FIRMWARE_REQUEST,
+         (DSL_EventData_Union_t*)&fwReqData, sizeof(DSL_FirmwareRequestData_t));
    }
-   else
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
+
+   nErrCode = DSL_DRV_HybridContextReset(pContext);
+   if (nErrCode != DSL_SUCCESS)
    {
-      DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW download failed, "
-            "Autoboot will stay in the DSL_AUTOBOOTSTATE_FIRMWARE_WAIT state!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      DSL_DEBUG(DSL_DBG_ERR, (pContext, "DSL[%02d]: ERROR - HybridContextReset "
+         "init failed!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      /* Continue with activation sequence anyhow */
    }
 
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_Init, retCode=%d"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext) ,nErrCode));
+
    return nErrCode;
 }
 
@@ -1743,57 +1879,482 @@ DSL_Error_t DSL_DRV_AutobootLoadFirmware(
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_Error_t DSL_DRV_AutobootControlSet(
+DSL_void_t DSL_DRV_Free(
+   DSL_IN DSL_Context_t *pContext)
+{
+   if (pContext == DSL_NULL)
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (pContext, SYS_DBG_ERR"Invalid context pointer!"DSL_DRV_CRLF));
+      return;
+   }
+
+   if (pContext->pFirmware != DSL_NULL)
+   {
+      DSL_DRV_FwCacheRelease(pContext->pFirmware);
+      pContext->pFirmware = DSL_NULL;
+   }
+
+   if (pContext->pFirmware2 != DSL_NULL)
+   {
+      DSL_DRV_FwCacheRelease(pContext->pFirmware2);
+      pContext->pFirmware2 = DSL_NULL;
+   }
+
+   pContext->bInitComplete = DSL_FALSE;
+
+#ifdef INCLUDE_DSL_TIMEOUT
+   DSL_DRV_Timeout_Shutdown(pContext);
+#endif /* INCLUDE_DSL_TIMEOUT*/
+
+#ifdef INCLUDE_DSL_PM
+   /* Stop PM module processing*/
+   if( DSL_DRV_PM_Stop(pContext) != DSL_SUCCESS )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: PM Module deinitialization failed"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+#endif /* #ifdef INCLUDE_DSL_PM*/
+
+#ifdef INCLUDE_DSL_CEOC
+   /* Stop CEOC module processing*/
+   if( DSL_CEOC_Stop(pContext) != DSL_SUCCESS )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: CEOC Module deinitialization failed"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+#endif /* #ifdef INCLUDE_DSL_CEOC*/
+
+#ifdef INCLUDE_DSL_DELT
+#ifndef DSL_CPE_STATIC_DELT_DATA
+   /* Return DELT memory to the pool */
+   if (pContext->DELT != DSL_NULL)
+   {
+      DSL_DRV_G997_DeltBufferRelease(DSL_G997_DELT_POOL_DIAG, pContext->DELT);
+      pContext->DELT = DSL_NULL;
+   }
+   #if defined(INCLUDE_DSL_CPE_API_VRX)
+   if (pContext->DELT_SHOWTIME != DSL_NULL)
+   {
+      DSL_DRV_G997_DeltBufferRelease(DSL_G997_DELT_POOL_SHOWTIME,
+         pContext->DELT_SHOWTIME);
+      pContext->DELT_SHOWTIME = DSL_NULL;
+   }
+   #endif /* INCLUDE_DSL_CPE_API_VRX*/
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+#endif /* INCLUDE_DSL_DELT*/
+
+#ifdef INCLUDE_DSL_ADSL_MIB
+   DSL_DRV_MIB_ModuleCleanup(pContext);
+#endif /* INCLUDE_DSL_ADSL_MIB*/
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_AutobootLoadFirmware(
    DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_AutobootControl_t *pData)
+   DSL_IN_OUT DSL_AutobootLoadFirmware_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-#if defined(INCLUDE_DSL_DELT) || defined(INCLUDE_DSL_FILTER_DETECTION)
-   DSL_G997_LDSF_t nLoopMode = DSL_G997_INHIBIT_LDSF;
-#endif /* defined(INCLUDE_DSL_DELT) || defined(INCLUDE_DSL_FILTER_DETECTION) */
-   DSL_boolean_t bFirmwareReady = DSL_FALSE, bInitComplete = DSL_FALSE, bAutobootDisable = DSL_FALSE;
+   DSL_int32_t nOffset = 0;
+   DSL_boolean_t bFirmwareReady = DSL_FALSE;
+   DSL_boolean_t bAutobootThreadStarted = DSL_FALSE,
+                 bAutobootFwLoadPending = DSL_FALSE,
+                 bAutobootStartPending  = DSL_FALSE;
+   DSL_AutobootControl_t AutobootCtrl;
+   DSL_int32_t nWaitCount = 0;
    DSL_Autoboot_State_t nState = DSL_AUTOBOOTSTATE_UNKNOWN;
-   DSL_PortMode_t nPortMode;
-   DSL_uint32_t nOppositeLine;
-   DSL_uint32_t nRemotePafAvailable = 0;
+   DSL_uint8_t *pFirmware = DSL_NULL, *pFirmware2 = DSL_NULL;
+   DSL_void_t *pFwMap = DSL_NULL, *pFwMap2 = DSL_NULL;
+   DSL_Error_t nStoreErrCode = DSL_SUCCESS;
+#ifndef INCLUDE_FW_REQUEST_SUPPORT
+   DSL_uint8_t *pCached = DSL_NULL, *pCached2 = DSL_NULL;
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_AutobootControlSet(%d)"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pData->data.nCommand));
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
 
-   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
    DSL_CHECK_ERR_CODE();
 
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, bInitComplete, bInitComplete);
-   if (bInitComplete == DSL_FALSE)
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, bAutobootThreadStarted, bAutobootThreadStarted);
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, bAutobootFwLoadPending);
+
+   if( (pData->data.pFirmware  != DSL_NULL && pData->data.nFirmwareSize) ||
+       (pData->data.pFirmware2 != DSL_NULL && pData->data.nFirmwareSize2) )
    {
-      nErrCode = DSL_ERR_NOT_INITIALIZED;
+      DSL_DEBUG(DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: Preparing to download FW..."
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      DSL_CTX_WRITE(pContext, nErrCode, nFwFeatures, pData->data.firmwareFeatures);
+
+      if (DSL_DRV_BONDING_ENABLED && DSL_DRV_LINES_PER_DEVICE == 2)
+      {
+         DSL_CTX_WRITE(pContext, nErrCode, nFwFeatures2, pData->data.firmwareFeatures2);
+      }
    }
+   else
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - No FW specified!"DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
 
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady,
-      bFirmwareReady);
+      return DSL_ERROR;
+   }
 
-   if (nErrCode == DSL_SUCCESS)
+   if( bAutobootThreadStarted && !bAutobootFwLoadPending)
    {
-      DSL_CTX_READ(pContext, nErrCode, bAutobootDisable, bAutobootDisable);
-      /** TODO: Check why only not on chip bonding **/
-      /* Ignore for locked line */
-      if (DSL_DRV_BONDING_ENABLED && (DSL_DRV_LINES_PER_DEVICE == 1)
-          && nLineLocked == DSL_DEV_NUM(pContext)
-          && pData->data.nCommand != DSL_AUTOBOOT_CTRL_STOP_PD)
+      DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_TRUE);
+
+      /* Get Autoboot State*/
+      DSL_CTX_READ_SCALAR(pContext, nErrCode, nAutobootState, nState);
+
+      if( nState != DSL_AUTOBOOTSTATE_FIRMWARE_WAIT )
       {
-         DSL_DEBUG(DSL_DBG_WRN, (pContext,
-            SYS_DBG_WRN"DSL[%02d]: WARNING - PAF not available, line disabled!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         /* Restart Autoboot*/
+         AutobootCtrl.data.nCommand = DSL_AUTOBOOT_CTRL_RESTART;
+         nErrCode = DSL_DRV_AutobootControlSet(pContext,&AutobootCtrl);
+         if( nErrCode != DSL_SUCCESS )
+         {
+            /* Clear bAutobootFwLoadPending flag*/
+            DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
 
-         nErrCode = DSL_ERR_BND_REMOTE_PAF_DISABLED;
+            DSL_DEBUG(DSL_DBG_ERR,
+               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Control set failed!"
+               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+            return nErrCode;
+         }
       }
-      else
+
+      /* wait for "DSL_AUTOBOOTSTATE_FIRMWARE_WAIT" max 4 sec */
+      for (nWaitCount = 0; nWaitCount < 40; nWaitCount++)
       {
-         switch (pData->data.nCommand)
+         /* Get Autoboot State*/
+         DSL_CTX_READ_SCALAR(pContext, nErrCode, nAutobootState, nState);
+         if( nErrCode != DSL_SUCCESS )
          {
-            case DSL_AUTOBOOT_CTRL_START:
-               if (bFirmwareReady == DSL_FALSE)
+            /* Clear bAutobootFwLoadPending flag*/
+            DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
+
+            DSL_DEBUG(DSL_DBG_ERR,
+               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot State get failed!"
+               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+            return nErrCode;
+         }
+
+         if( nState == DSL_AUTOBOOTSTATE_FIRMWARE_WAIT )
+         {
+            break;
+         }
+
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+         /* Woken up by the autoboot thread on the state change*/
+         DSL_DRV_WAIT_EVENT_TIMEOUT(pContext->bringUpEvent, 100);
+#else
+         DSL_DRV_MSecSleep(100);
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
+      }
+
+      if( nState != DSL_AUTOBOOTSTATE_FIRMWARE_WAIT )
+      {
+         /* Clear bAutobootFwLoadPending flag*/
+         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
+         DSL_DEBUG(DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Timeout while waiting the "
+            "DSL_AUTOBOOTSTATE_FIRMWARE_WAIT state!"DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext)));
+         return DSL_ERROR;
+      }
+   }
+
+   /* Deactivate Autoboot timeout for the Firmware Wait state*/
+   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nAutobootTimeoutLimit, 1800);
+
+   if (pData->data.bMappedBuffer)
+   {
+      /* Pin the FW binaries. The device layer writes them chunk by chunk from
+         the pinned pages, no kernel copy or mapping of the whole image is
+         made. The user addresses only select the binary, they are never
+         accessed directly*/
+      if ((pData->data.pFirmware != DSL_NULL) && pData->data.nFirmwareSize)
+      {
+         pFwMap = DSL_DRV_UserBufferMap(DSL_FALSE, pData->data.pFirmware,
+                     pData->data.nFirmwareSize);
+         if (pFwMap == DSL_NULL)
+         {
+            nErrCode = DSL_ERROR;
+            DSL_DEBUG( DSL_DBG_ERR, (pContext,
+               SYS_DBG_ERR"DSL[%02d]: ERROR - Mapping of firmware binary 1 failed!"
+               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         }
+         pFirmware = pData->data.pFirmware;
+      }
+
+      if ((pData->data.pFirmware2 != DSL_NULL) && pData->data.nFirmwareSize2 &&
+          (nErrCode == DSL_SUCCESS))
+      {
+         pFwMap2 = DSL_DRV_UserBufferMap(DSL_FALSE, pData->data.pFirmware2,
+                      pData->data.nFirmwareSize2);
+         if (pFwMap2 == DSL_NULL)
+         {
+            nErrCode = DSL_ERROR;
+            DSL_DEBUG( DSL_DBG_ERR, (pContext,
+               SYS_DBG_ERR"DSL[%02d]: ERROR - Mapping of firmware binary 2 failed!"
+               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         }
+         pFirmware2 = pData->data.pFirmware2;
+      }
+   }
+   else
+   {
+      /* Get the kernel copy of the FW binary from the firmware image cache*/
+      nErrCode = DSL_DRV_FwCacheGet(pContext, DSL_FALSE, pData->data.pFirmware,
+                    pData->data.nFirmwareSize, &pFirmware);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         DSL_DEBUG( DSL_DBG_ERR, (pContext,
+            SYS_DBG_ERR"DSL[%02d]: ERROR - Caching of firmware binary 1 failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      }
+
+      /* Get the kernel copy of the FW binary 2 from the firmware image cache*/
+      if (nErrCode == DSL_SUCCESS)
+      {
+         nErrCode = DSL_DRV_FwCacheGet(pContext, DSL_FALSE,
+                       pData->data.pFirmware2, pData->data.nFirmwareSize2,
+                       &pFirmware2);
+         if (nErrCode != DSL_SUCCESS)
+         {
+            DSL_DEBUG( DSL_DBG_ERR, (pContext,
+               SYS_DBG_ERR"DSL[%02d]: ERROR - Caching of firmware binary 2 failed!"
+               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         }
+      }
+   }
+
+   if (nErrCode == DSL_SUCCESS)
+   {
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+      /* The device layer streams mapped binaries from their pages*/
+      pContext->pFwMap  = pFwMap;
+      pContext->pFwMap2 = pFwMap2;
+
+      /* Download FW*/
+      nErrCode = DSL_DRV_FwDownload(
+                    pContext,
+                    (DSL_char_t*)pFirmware, pData->data.nFirmwareSize,
+                    (DSL_char_t*)pFirmware2, pData->data.nFirmwareSize2,
+                    (DSL_int32_t*)&pData->data.nFirmwareOffset, &nOffset,
+                    pData->data.bLastChunk, pData->data.bForceDownload);
+
+      pContext->pFwMap  = DSL_NULL;
+      pContext->pFwMap2 = DSL_NULL;
+#else
+      /*
+      KAv: If FW binary data is in kernel space, the Amazon-Se driver FW
+           sequence crashes. This issue needs further clarification.
+      */
+      /* Download FW*/
+      nErrCode = DSL_DRV_FwDownload(
+                    pContext,
+                    (DSL_char_t*)pData->data.pFirmware, pData->data.nFirmwareSize,
+                    (DSL_char_t*)pData->data.pFirmware2, pData->data.nFirmwareSize2,
+                    (DSL_int32_t*)&pData->data.nFirmwareOffset, &nOffset,
+                    pData->data.bLastChunk, pData->data.bForceDownload);
+#endif
+   }
+
+   if( nErrCode >= DSL_SUCCESS )
+   {
+      /* Get bFirmwareReady flag*/
+      DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, bFirmwareReady);
+   }
+
+#ifndef INCLUDE_FW_REQUEST_SUPPORT
+   /* Store FW binaries if the Chunk download is disabled. The context shares
+      the cached images, this has to be done before the local references are
+      released*/
+   if( (nErrCode >= DSL_SUCCESS) && bFirmwareReady &&
+       !(pData->data.bChunkDonwloadEnabled) )
+   {
+      if (pData->data.bMappedBuffer)
+      {
+         /* The line needs a kernel copy for later reloads, the cache reads
+            the user buffers chunk wise*/
+         nStoreErrCode = DSL_DRV_FwCacheGet(pContext, DSL_FALSE,
+                            pData->data.pFirmware, pData->data.nFirmwareSize,
+                            &pCached);
+         if (nStoreErrCode == DSL_SUCCESS)
+         {
+            nStoreErrCode = DSL_DRV_FwCacheGet(pContext, DSL_FALSE,
+                               pData->data.pFirmware2,
+                               pData->data.nFirmwareSize2, &pCached2);
+         }
+      }
+      else
+      {
+         pCached  = pFirmware;
+         pCached2 = pFirmware2;
+      }
+
+      if (nStoreErrCode == DSL_SUCCESS)
+      {
+         DSL_DRV_FwStore(pContext,
+            pCached,  pData->data.nFirmwareSize,
+            pCached2, pData->data.nFirmwareSize2);
+      }
+      else
+      {
+         DSL_DEBUG(DSL_DBG_ERR,
+           (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW store failed!"
+           DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      }
+
+      if (pData->data.bMappedBuffer)
+      {
+         DSL_DRV_FwCacheRelease(pCached);
+         DSL_DRV_FwCacheRelease(pCached2);
+      }
+   }
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
+
+   if (pData->data.bMappedBuffer)
+   {
+      /* Unpin the FW binaries*/
+      DSL_DRV_UserBufferUnmap(pFwMap);
+      DSL_DRV_UserBufferUnmap(pFwMap2);
+   }
+   else
+   {
+      /* Release the local references of the cached FW binaries*/
+      DSL_DRV_FwCacheRelease(pFirmware);
+      DSL_DRV_FwCacheRelease(pFirmware2);
+   }
+
+   if( nErrCode >= DSL_SUCCESS )
+   {
+      if( bFirmwareReady )
+      {
+         nErrCode = DSL_DRV_DEV_G994VendorIdFirmwareUpdate(pContext);
+         if( nErrCode != DSL_SUCCESS )
+         {
+            DSL_DEBUG( DSL_DBG_ERR,
+               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - could not initialize G994 Vendor ID!"
+               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+            return nErrCode;
+         }
+
+         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, DSL_FALSE);
+         DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bFwRequestHandled, DSL_TRUE);
+
+         if (nStoreErrCode != DSL_SUCCESS)
+         {
+            nErrCode = nStoreErrCode;
+         }
+
+         /* Get Autoboot pending start flag*/
+         DSL_CTX_READ(pContext, nErrCode, bAutobootStartPending, bAutobootStartPending);
+
+         /* Check if there is a pending Autoboot start*/
+         if (bAutobootStartPending)
+         {
+            /* Reset Autoboot pending start flag*/
+            DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bAutobootStartPending, DSL_FALSE);
+
+            nErrCode = DSL_DRV_AutobootThreadStart(pContext);
+            if (nErrCode != DSL_SUCCESS)
+            {
+               DSL_DEBUG(DSL_DBG_ERR,
+                 (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Thread pending start failed!"
+                 DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+               return nErrCode;
+            }
+
+            /* Initialize additional modules PM, CEOC,...*/
+            nErrCode = DSL_DRV_ModulesInit(pContext);
+            if (nErrCode != DSL_SUCCESS)
+            {
+               DSL_DEBUG( DSL_DBG_ERR,
+                  (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - additional modules init failed!"
+                  DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+               return nErrCode;
+            }
+         }
+      }
+   }
+   else
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - FW download failed, "
+            "Autoboot will stay in the DSL_AUTOBOOTSTATE_FIRMWARE_WAIT state!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_AutobootControlSet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_AutobootControl_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+#if defined(INCLUDE_DSL_DELT) || defined(INCLUDE_DSL_FILTER_DETECTION)
+   DSL_G997_LDSF_t nLoopMode = DSL_G997_INHIBIT_LDSF;
+#endif /* defined(INCLUDE_DSL_DELT) || defined(INCLUDE_DSL_FILTER_DETECTION) */
+   DSL_boolean_t bFirmwareReady = DSL_FALSE, bInitComplete = DSL_FALSE, bAutobootDisable = DSL_FALSE;
+   DSL_Autoboot_State_t nState = DSL_AUTOBOOTSTATE_UNKNOWN;
+   DSL_PortMode_t nPortMode;
+   DSL_uint32_t nOppositeLine;
+   DSL_uint32_t nRemotePafAvailable = 0;
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_AutobootControlSet(%d)"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pData->data.nCommand));
+
+   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, bInitComplete, bInitComplete);
+   if (bInitComplete == DSL_FALSE)
+   {
+      nErrCode = DSL_ERR_NOT_INITIALIZED;
+   }
+
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady,
+      bFirmwareReady);
+
+   if (nErrCode == DSL_SUCCESS)
+   {
+      DSL_CTX_READ(pContext, nErrCode, bAutobootDisable, bAutobootDisable);
+      /** TODO: Check why only not on chip bonding **/
+      /* Ignore for locked line */
+      if (DSL_DRV_BONDING_ENABLED && (DSL_DRV_LINES_PER_DEVICE == 1)
+          && nLineLocked == DSL_DEV_NUM(pContext)
+          && pData->data.nCommand != DSL_AUTOBOOT_CTRL_STOP_PD)
+      {
+         DSL_DEBUG(DSL_DBG_WRN, (pContext,
+            SYS_DBG_WRN"DSL[%02d]: WARNING - PAF not available, line disabled!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         nErrCode = DSL_ERR_BND_REMOTE_PAF_DISABLED;
+      }
+      else
+      {
+         switch (pData->data.nCommand)
+         {
+            case DSL_AUTOBOOT_CTRL_START:
+               if (bFirmwareReady == DSL_FALSE)
                {
                   DSL_DEBUG(DSL_DBG_ERR,
                      (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot Start failed, no FW loaded!"
@@ -1945,6 +2506,10 @@ DSL_Error_t DSL_DRV_AutobootControlSet(
                if (pData->data.nCommand == DSL_AUTOBOOT_CTRL_RESTART_FULL)
                {
                   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, pDevCtx->bUseFWOptimizedDownload, DSL_FALSE);
+#if defined(INCLUDE_DSL_CPE_API_VRX) && defined(INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE)
+                  /* The full restart writes the complete configuration*/
+                  DSL_DRV_VRX_ConfigWriteInvalidate(pContext);
+#endif /* defined(INCLUDE_DSL_CPE_API_VRX) && defined(INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE)*/
                }
 
                if (bAutobootDisable && pData->data.nCommand == DSL_AUTOBOOT_CTRL_RESTART)
@@ -2283,6 +2848,10 @@ DSL_Error_t DSL_DRV_ResourceUsageStatisticsGet(
 #endif /* INCLUDE_DSL_CEOC*/
    DSL_OpenContext_t *pOpenContext = DSL_NULL;
    DSL_ResourceUsageStatisticsData_t devResourceUsageStatisticsData;
+#if defined(INCLUDE_DSL_DELT) && !defined(DSL_CPE_STATIC_DELT_DATA)
+   DSL_G997_DeltPoolStatistics_t deltPoolStats;
+   DSL_int_t i = 0;
+#endif /* defined(INCLUDE_DSL_DELT) && !defined(DSL_CPE_STATIC_DELT_DATA)*/
 
    DSL_CHECK_POINTER(pContext, pData);
    DSL_CHECK_ERR_CODE();
@@ -2330,7 +2899,7 @@ DSL_Error_t DSL_DRV_ResourceUsageStatisticsGet(
 #ifdef INCLUDE_DSL_TIMEOUT
    DSL_DEBUG( DSL_DBG_PRN, (pContext,
       SYS_DBG_PRN"DSL:   timeout event lists          : %10d bytes" DSL_DRV_CRLF,
-      pContext->TimeoutListsContext.nNrOfElements * sizeof(DSL_TimeoutElement_t) * DSL_MAX_TIMEOUT_NUM));
+      (int)(pContext->TimeoutListsContext.nNrOfElements * sizeof(DSL_TimeoutElement_t) * DSL_MAX_TIMEOUT_NUM)));
    staticMemUsageTotal += pContext->TimeoutListsContext.nNrOfElements * sizeof(DSL_TimeoutElement_t) * DSL_MAX_TIMEOUT_NUM;
 #endif /* INCLUDE_DSL_TIMEOUT*/
 #ifdef INCLUDE_DSL_DELT
@@ -2392,7 +2961,7 @@ DSL_Error_t DSL_DRV_ResourceUsageStatisticsGet(
    DSL_DEBUG( DSL_DBG_PRN, (pContext,
       SYS_DBG_PRN"DSL:   DELT diagnostic data         : %10d bytes" DSL_DRV_CRLF,
       pContext->DELT ? (int)sizeof(DSL_G997_DeltData_t) : 0));
-   #ifdef INCLUDE_DSL_DELT_SHOWTIME
+   #if defined(INCLUDE_DSL_CPE_API_VRX)
    if (pContext->DELT_SHOWTIME)
    {
       dynamicMemUsageTotal += sizeof(DSL_G997_DeltShowtimeData_t);
@@ -2400,7 +2969,23 @@ DSL_Error_t DSL_DRV_ResourceUsageStatisticsGet(
    DSL_DEBUG( DSL_DBG_PRN, (pContext,
       SYS_DBG_PRN"DSL:   DELT showtime data           : %10d bytes" DSL_DRV_CRLF,
       pContext->DELT_SHOWTIME ? (int)sizeof(DSL_G997_DeltShowtimeData_t) : 0));
-   #endif /* INCLUDE_DSL_DELT_SHOWTIME*/
+   #endif /* INCLUDE_DSL_CPE_API_VRX*/
+
+   /* Free buffers of the DELT pool are kept for all lines, the used ones are
+      counted above*/
+   for (i = 0; i < DSL_G997_DELT_POOL_LAST; i++)
+   {
+      DSL_DRV_G997_DeltPoolStatisticsGet((DSL_G997_DeltPoolType_t)i,
+         &deltPoolStats);
+      dynamicMemUsageTotal +=
+         (deltPoolStats.nSlabs - deltPoolStats.nInUse) * deltPoolStats.nSlabSize;
+      DSL_DEBUG( DSL_DBG_PRN, (pContext,
+         SYS_DBG_PRN"DSL:   DELT pool %d free buffers     : %10d bytes "
+         "(%u used, %u max used, %u total)" DSL_DRV_CRLF, i,
+         (int)((deltPoolStats.nSlabs - deltPoolStats.nInUse) *
+            deltPoolStats.nSlabSize),
+         deltPoolStats.nInUse, deltPoolStats.nInUseMax, deltPoolStats.nSlabs));
+   }
 #endif /* DSL_CPE_STATIC_DELT_DATA*/
 #endif /* INCLUDE_DSL_DELT*/
 
@@ -2482,7 +3067,7 @@ DSL_Error_t DSL_DRV_ResourceUsageStatisticsGet(
 #ifdef INCLUDE_DSL_CEOC
          snmpFifoTotal     += (pOpenContext->rxSnmpFifo ? sizeof(DSL_FIFO) : 0);
          snmpFifoBuffTotal += (pOpenContext->rxSnmpFifoBuf ?
-                              DSL_CEOC_RX_FIFO_ELEMENT_COUNT * sizeof(DSL_G997_SnmpData_t) : 0);
+                              DSL_CEOC_RX_FIFO_ELEMENT_COUNT * sizeof(DSL_CEOC_SnmpMsgBuf_t*) : 0);
 #endif /* INCLUDE_DSL_CEOC*/
          pOpenContext = (DSL_OpenContext_t*)pOpenContext->pNext;
       }
@@ -2504,10 +3089,13 @@ DSL_Error_t DSL_DRV_ResourceUsageStatisticsGet(
    dynamicMemUsageTotal += snmpFifoBuffTotal;
    DSL_DEBUG( DSL_DBG_PRN, (pContext,
       SYS_DBG_PRN"DSL:   SNMP FIFO                    : %10d bytes" DSL_DRV_CRLF,
-      (int)(eventFifoTotal)));
+      (int)(snmpFifoTotal)));
    DSL_DEBUG( DSL_DBG_PRN, (pContext,
       SYS_DBG_PRN"DSL:   SNMP FIFO buffer             : %10d bytes" DSL_DRV_CRLF,
-      (int)(eventFifoBuffTotal)));
+      (int)(snmpFifoBuffTotal)));
+   DSL_DEBUG( DSL_DBG_PRN, (pContext,
+      SYS_DBG_PRN"DSL:   SNMP messages rx/dropped     : %10u/%u" DSL_DRV_CRLF,
+      pContext->snmpStats.nRxMessages, pContext->snmpStats.nRxDroppedTotal));
 #endif /* INCLUDE_DSL_CEOC*/
    DSL_DEBUG( DSL_DBG_PRN, (pContext,
       SYS_DBG_PRN"DSL:                                 --------------" DSL_DRV_CRLF ));
@@ -3758,6 +4346,7 @@ DSL_Error_t DSL_DRV_EventStatusMaskConfigSet(
       case DSL_EVENT_S_AUTOBOOT_STATUS:
       case DSL_EVENT_S_RTT_STATUS:
       case DSL_EVENT_S_FE_TESTPARAMS_AVAILABLE:
+      case DSL_EVENT_S_SNMP_MESSAGE_SENT:
          if (pData->data.bMask)
          {
             nEventMask |= DSL_EVENT2MASK(pData->data.nEventType);
@@ -3776,251 +4365,873 @@ DSL_Error_t DSL_DRV_EventStatusMaskConfigSet(
          break;
       }
 
-      if (nErrCode != DSL_ERROR)
+      if (nErrCode != DSL_ERROR)
+      {
+         /* Update event mask*/
+         pOpenCtx->nEventMask = nEventMask;
+      }
+   }
+   else
+   {
+      nErrCode = DSL_ERR_EVENTS_NOT_ACTIVE;
+   }
+
+   if (nErrCode == DSL_SUCCESS)
+   {
+      nErrCode = nRet;
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_EventStatusMaskConfigSet, "
+      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_EVENT_STATUS_MASK_CONFIG_GET
+*/
+#ifdef INCLUDE_DSL_CONFIG_GET
+DSL_Error_t DSL_DRV_EventStatusMaskConfigGet(
+   DSL_OpenContext_t *pOpenCtx,
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_EventStatusMask_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t nEventMask;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_EventStatusMaskConfigGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   if(DSL_DRV_MUTEX_LOCK(pOpenCtx->eventMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: Couldn't lock event mutex"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERROR;
+   }
+
+   /* Check if the event handling is activated for this instance*/
+   if (pOpenCtx->bEventActivation)
+   {
+      /* Get current event mask*/
+      nEventMask = pOpenCtx->nEventMask;
+
+      switch(pData->data.nEventType)
+      {
+         case DSL_EVENT_S_FIRMWARE_REQUEST:
+         case DSL_EVENT_S_LINIT_FAILURE:
+         case DSL_EVENT_S_LINE_STATE:
+         case DSL_EVENT_S_LINE_POWERMANAGEMENT_STATE:
+         case DSL_EVENT_S_CHANNEL_DATARATE:
+         case DSL_EVENT_S_FIRMWARE_ERROR:
+         case DSL_EVENT_S_INIT_READY:
+         case DSL_EVENT_S_FE_INVENTORY_AVAILABLE:
+         case DSL_EVENT_S_SYSTEM_STATUS:
+         case DSL_EVENT_S_PM_SYNC:
+         case DSL_EVENT_S_LINE_TRANSMISSION_STATUS:
+         case DSL_EVENT_S_SHOWTIME_LOGGING:
+         case DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE:
+         case DSL_EVENT_S_SYSTEM_INTERFACE_STATUS:
+         case DSL_EVENT_S_FIRMWARE_DOWNLOAD_STATUS:
+         case DSL_EVENT_S_AUTOBOOT_STATUS:
+         case DSL_EVENT_S_RTT_STATUS:
+         case DSL_EVENT_S_FE_TESTPARAMS_AVAILABLE:
+         case DSL_EVENT_S_SNMP_MESSAGE_SENT:
+            pData->data.bMask = nEventMask & DSL_EVENT2MASK(pData->data.nEventType) ?
+                                DSL_TRUE : DSL_FALSE;
+            break;
+      default:
+         DSL_DEBUG(DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - unknown status event(0x%x)"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pData->data.nEventType));
+         nErrCode = DSL_ERROR;
+         break;
+      }
+   }
+   else
+   {
+      nErrCode = DSL_ERR_EVENTS_NOT_ACTIVE;
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_EventStatusMaskConfigSet, "
+      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_CONFIG_GET*/
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+#ifdef INCLUDE_DSL_FRAMING_PARAMETERS
+DSL_Error_t DSL_DRV_FramingParameterStatusGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_FramingParameterStatus_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_FramingParameterStatusGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Call device specific stuff*/
+   nErrCode = DSL_DRV_DEV_FramingParameterStatusGet(pContext, pData);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_FramingParameterStatusGet, "
+      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_FRAMING_PARAMETERS*/
+
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+#ifdef INCLUDE_PILOT_TONES_STATUS
+DSL_Error_t DSL_DRV_PilotTonesStatusGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_PilotTonesStatus_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_LineStateValue_t nCurrentState = DSL_LINESTATE_UNKNOWN;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PilotTonesStatusGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Get current line state*/
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, nLineState, nCurrentState);
+
+   if ( (nCurrentState == DSL_LINESTATE_SHOWTIME_TC_SYNC) ||
+        (nCurrentState == DSL_LINESTATE_SHOWTIME_NO_SYNC) )
+   {
+      nErrCode = DSL_DRV_DEV_PilotTonesStatusGet(pContext, pData);
+
+      if ((nErrCode >= DSL_SUCCESS) && (pData->data.nNumData == 0))
+      {
+         nErrCode = DSL_ERR_NOT_SUPPORTED_BY_FIRMWARE;
+      }
+   }
+   else
+   {
+      nErrCode = DSL_ERR_ONLY_AVAILABLE_IN_SHOWTIME;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PilotTonesStatusGet, "
+      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+#endif /* #ifdef INCLUDE_PILOT_TONES_STATUS*/
+
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_RebootCriteriaConfigSet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_RebootCriteriaConfig_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS, nRet = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_DSLMODE(pData->nDslMode);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_RebootCriteriaConfigSet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+   /* Negative margine not supported for VRX */
+   if (pData->data.nRebootCriteria & DSL_REBOOT_CRITERIA_NEGATIVE_MARGIN)
+   {
+      pData->data.nRebootCriteria &= ~DSL_REBOOT_CRITERIA_NEGATIVE_MARGIN;
+      nRet = DSL_WRN_CONFIG_PARAM_IGNORED;
+   }
+#endif /* defined(INCLUDE_DSL_CPE_API_VRX) */
+
+   DSL_CTX_WRITE(pContext, nErrCode, RebootCriteriaNeConfigData[pData->nDslMode],
+                                                    pData->data.nRebootCriteria);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_RebootCriteriaConfigSet, "
+      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nRet;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_RebootCriteriaConfigGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_RebootCriteriaConfig_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_DSLMODE(pData->nDslMode);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_RebootCriteriaConfigGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   DSL_CTX_READ(pContext, nErrCode, RebootCriteriaNeConfigData[pData->nDslMode],
+                                                   pData->data.nRebootCriteria);
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_RebootCriteriaConfigGet, "
+      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+#ifndef DSL_DEBUG_DISABLE
+DSL_Error_t DSL_DRV_DBG_ModuleLevelSet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_DBG_ModuleLevel_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_int_t i = 0, j = 0;
+   DSL_boolean_t bModOk = DSL_FALSE, bLvlOk = DSL_FALSE;
+   DSL_debugLevelEntry_t *pDbgEntry = DSL_NULL;
+   DSL_debugLevelEntry_t *pDbgLvlNames = DSL_NULL;
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+   DSL_DEV_Handle_t dev;
+   IOCTL_MEI_dbgLevel_t fioVrxDrvDbgLevelSet;
+#endif /* INCLUDE_DSL_CPE_API_VRX */
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   /* Check if debug module number is valid */
+   pDbgEntry = &DSL_g_dbgLvl[1];
+   if ( (pData->data.nDbgModule >= DSL_DBG_LAST_BLOCK) ||
+        (pData->data.nDbgModule < DSL_DBG_NO_BLOCK) )
+   {
+      bModOk = DSL_FALSE;
+      DSL_DEBUG_SET_ERROR(DSL_ERROR);
+      DSL_DEBUG( DSL_DBG_ERR, (pContext,
+         SYS_DBG_ERR"DSL[%02d]: DSL_DRV_DBG_ModuleLevelSet - invalid debug module number specified:"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      DSL_DEBUG( DSL_DBG_PRN, (pContext,
+         SYS_DBG_PRN"   nDbgModules:" DSL_DRV_CRLF ) );
+
+      for (i = 1; i < (DSL_int_t)DSL_DBG_LAST_BLOCK; i++, pDbgEntry++)
+      {
+         DSL_DEBUG( DSL_DBG_PRN,
+            (pContext, SYS_DBG_PRN"      %d: %s" DSL_DRV_CRLF , i, pDbgEntry->pcName) );
+      }
+   }
+   else
+   {
+      bModOk = DSL_TRUE;
+   }
+
+   /* Check if debug level is valid */
+   pDbgLvlNames = &DSL_g_dbgLvlNames[0];
+   for (i = 0; i < DSL_g_dbgLvlNumber; i++, pDbgLvlNames++)
+   {
+      if (pDbgLvlNames->nDbgLvl == pData->data.nDbgLevel)
+      {
+         /* debug level found  */
+         bLvlOk = DSL_TRUE;
+         break;
+      }
+   }
+   if ( (bLvlOk == DSL_FALSE) && (i == DSL_g_dbgLvlNumber) )
+   {
+      /* debug level NOT valid  */
+      DSL_DEBUG_SET_ERROR(DSL_ERROR);
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: DSL_DRV_DBG_ModuleLevelSet - invalid debug level specified:"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      DSL_DEBUG( DSL_DBG_PRN,
+         (pContext, SYS_DBG_PRN"   nDbgLevels:" DSL_DRV_CRLF ) );
+      pDbgLvlNames = &DSL_g_dbgLvlNames[0];
+      for (i = 0; i < DSL_g_dbgLvlNumber; i++, pDbgLvlNames++)
+      {
+         DSL_DEBUG( DSL_DBG_PRN,
+            (pContext, SYS_DBG_PRN"      0x%02X: %s" DSL_DRV_CRLF ,
+            pDbgLvlNames->nDbgLvl, pDbgLvlNames->pcName) );
+      }
+   }
+
+   if ( (bModOk == DSL_TRUE) && (bLvlOk == DSL_TRUE) )
+   {
+      if (pData->data.nDbgModule == DSL_DBG_NO_BLOCK)
+      {
+         i = 1;
+         j = (DSL_int_t)DSL_DBG_LAST_BLOCK;
+      }
+      else
+      {
+         i = (DSL_int_t)(pData->data.nDbgModule);
+         j = i + 1;
+      }
+
+      for ( ; i < j; i++, pDbgEntry++)
+      {
+         /* Set new debug level for specified module(s) */
+         DSL_g_dbgLvl[i].nDbgLvl = pData->data.nDbgLevel;
+         DSL_DEBUG( DSL_DBG_LOCAL,
+            (pContext, SYS_DBG_LOCAL"DSL[%02d]: new debug level: %s = %s - 0x%02X" DSL_DRV_CRLF ,
+                 DSL_DEV_NUM(pContext), DSL_g_dbgLvl[i].pcName,
+                 pDbgLvlNames->pcName,
+                 pData->data.nDbgLevel) );
+      }
+
+#ifdef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS
+      /* Patch the debug branches according to the new level(s)*/
+      DSL_DRV_DBG_StaticKeysUpdate();
+#endif /* INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS*/
+
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+      if (pData->data.nDbgModule == DSL_DBG_MESSAGE_DUMP)
+      {
+         dev = DSL_DEVICE_LOWHANDLE(pContext);
+         fioVrxDrvDbgLevelSet.eDbgModule = e_MEI_DBGMOD_MEI_MSG_DUMP_API;
+         switch (pData->data.nDbgLevel)
+         {
+            case DSL_DBG_NONE:
+            case DSL_DBG_PRN:
+            default:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_OFF;
+               break;
+
+            case DSL_DBG_ERR:
+            case DSL_DBG_WRN:
+            case DSL_DBG_MSG:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_NORMAL;
+               break;
+
+            case DSL_DBG_LOCAL:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_LOW;
+               break;
+         }
+         if (DSL_DRV_VRX_InternalDebugLevelSet((MEI_DYN_CNTRL_T*)dev, &fioVrxDrvDbgLevelSet) < 0)
+         {
+            DSL_DEBUG( DSL_DBG_ERR, (pContext,
+               SYS_DBG_ERR"DSL[%02d]: MEI debug level set failed, error %d" DSL_DRV_CRLF,
+               DSL_DEV_NUM(pContext), fioVrxDrvDbgLevelSet.ictl.retCode));
+
+            return DSL_ERROR;
+         }
+      }
+      if (pData->data.nDbgModule == DSL_DBG_LOW_LEVEL_DRIVER)
+      {
+         dev = DSL_DEVICE_LOWHANDLE(pContext);
+         fioVrxDrvDbgLevelSet.eDbgModule = e_MEI_DBGMOD_MEI_DRV;
+         switch (pData->data.nDbgLevel)
+         {
+            case DSL_DBG_NONE:
+            case DSL_DBG_PRN:
+            default:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_OFF;
+               break;
+
+            case DSL_DBG_ERR:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_HIGH;
+               break;
+
+            case DSL_DBG_WRN:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_NORMAL;
+               break;
+
+            case DSL_DBG_MSG:
+            case DSL_DBG_LOCAL:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_LOW;
+               break;
+         }
+         if (DSL_DRV_VRX_InternalDebugLevelSet((MEI_DYN_CNTRL_T*)dev, &fioVrxDrvDbgLevelSet) < 0)
+         {
+            DSL_DEBUG( DSL_DBG_ERR, (pContext,
+               SYS_DBG_ERR"DSL[%02d]: MEI debug level set failed, error %d" DSL_DRV_CRLF,
+               DSL_DEV_NUM(pContext), fioVrxDrvDbgLevelSet.ictl.retCode));
+
+            return DSL_ERROR;
+         }
+      }
+
+      if (pData->data.nDbgModule == DSL_DBG_NOTIFICATIONS)
+      {
+         dev = DSL_DEVICE_LOWHANDLE(pContext);
+         fioVrxDrvDbgLevelSet.eDbgModule = e_MEI_DBGMOD_MEI_NOTIFICATIONS;
+         switch (pData->data.nDbgLevel)
+         {
+            case DSL_DBG_NONE:
+            case DSL_DBG_PRN:
+            default:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_OFF;
+               break;
+
+            case DSL_DBG_ERR:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_HIGH;
+               break;
+
+            case DSL_DBG_WRN:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_NORMAL;
+               break;
+
+            case DSL_DBG_MSG:
+            case DSL_DBG_LOCAL:
+               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_LOW;
+               break;
+         }
+         if (DSL_DRV_VRX_InternalDebugLevelSet((MEI_DYN_CNTRL_T*)dev, &fioVrxDrvDbgLevelSet) < 0)
+         {
+            DSL_DEBUG( DSL_DBG_ERR, (pContext,
+               SYS_DBG_ERR"DSL[%02d]: MEI debug level set failed, error %d" DSL_DRV_CRLF,
+               DSL_DEV_NUM(pContext), fioVrxDrvDbgLevelSet.ictl.retCode));
+
+            return DSL_ERROR;
+         }
+      }
+#endif /* INCLUDE_DSL_CPE_API_VRX */
+   }
+   else
+   {
+      nErrCode = DSL_ERROR;
+   }
+
+   return nErrCode;
+}
+#endif /* DSL_DEBUG_DISABLE */
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+#ifndef DSL_DEBUG_DISABLE
+DSL_Error_t DSL_DRV_DBG_ModuleLevelGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_ModuleLevel_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_boolean_t bLvlOk = DSL_FALSE;
+   DSL_debugLevelEntry_t *pDbgEntry = DSL_NULL;
+   DSL_debugLevelEntry_t *pDbgLvlNames = DSL_NULL;
+   DSL_int_t i = 0;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   /* Check if debug module number is valid */
+   pDbgEntry = &DSL_g_dbgLvl[1];
+   if ( (pData->data.nDbgModule >= DSL_DBG_LAST_BLOCK) ||
+        (pData->data.nDbgModule == DSL_DBG_NO_BLOCK) )
+   {
+      nErrCode = DSL_ERROR;
+      DSL_DEBUG_SET_ERROR(nErrCode);
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: DSL_DRV_DBG_ModuleLevelGet - "
+         "invalid debug module number specified:" DSL_DRV_CRLF,
+         DSL_DEV_NUM(pContext)));
+      DSL_DEBUG( DSL_DBG_PRN,
+         (pContext, SYS_DBG_PRN"   nDbgModules:" DSL_DRV_CRLF ) );
+      for (i = 1; i < (DSL_int_t)DSL_DBG_LAST_BLOCK; i++, pDbgEntry++)
       {
-         /* Update event mask*/
-         pOpenCtx->nEventMask = nEventMask;
+         DSL_DEBUG( DSL_DBG_PRN,
+            (pContext, SYS_DBG_PRN"      %d: %s" DSL_DRV_CRLF , i, pDbgEntry->pcName) );
       }
    }
    else
    {
-      nErrCode = DSL_ERR_EVENTS_NOT_ACTIVE;
-   }
+      pData->data.nDbgLevel = DSL_g_dbgLvl[pData->data.nDbgModule].nDbgLvl;
 
-   if (nErrCode == DSL_SUCCESS)
-   {
-      nErrCode = nRet;
+      pDbgLvlNames = &DSL_g_dbgLvlNames[0];
+      for (i = 0; i < DSL_g_dbgLvlNumber; i++, pDbgLvlNames++)
+      {
+         if (pDbgLvlNames->nDbgLvl == pData->data.nDbgLevel)
+         {
+            /* debug level found  */
+            bLvlOk = DSL_TRUE;
+            DSL_DEBUG( DSL_DBG_LOCAL,
+               (pContext, SYS_DBG_LOCAL"DSL[%02d]: actual debug level: %s = %s - 0x%02X" DSL_DRV_CRLF,
+                    DSL_DEV_NUM(pContext), DSL_g_dbgLvl[pData->data.nDbgModule].pcName,
+                    pDbgLvlNames->pcName,
+                    pData->data.nDbgLevel) );
+            break;
+         }
+      }
+
+      if (bLvlOk == DSL_FALSE)
+      {
+         DSL_DEBUG( DSL_DBG_LOCAL,
+            (pContext, SYS_DBG_LOCAL"DSL[%02d]: actual debug level: %s = 0x%02X" DSL_DRV_CRLF,
+                 DSL_DEV_NUM(pContext), DSL_g_dbgLvl[pData->data.nDbgModule].pcName,
+                 pData->data.nDbgLevel) );
+      }
    }
 
-   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
+   return nErrCode;
+}
+#endif /* DSL_DEBUG_DISABLE*/
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_EventStatusMaskConfigSet, "
-      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+/** Sequence number field at the start of each trace ring entry */
+#define DSL_DBG_RING_ENTRY_SEQ(pEntry)   (*(volatile DSL_uint32_t*)(pEntry))
 
-   return nErrCode;
+/*
+   Reserves the next entry of a trace ring and invalidates it for the readers.
+   The sequence number is taken with an atomic fetch-add, so concurrent
+   writers (also from the message receive path) never block each other.
+   The entry has to be published with DSL_DRV_DBG_RingPublish after it has
+   been written.
+
+   \param pCtrl      Ring control data, [I]
+   \param pEntries   First ring entry, each entry has to start with its
+                     sequence number, [I]
+   \param nEntrySize Size of one entry [bytes], [I]
+   \param nRingSize  Number of ring entries, a power of two, [I]
+   \param pSeq       Reserved sequence number, [O]
+
+   \return
+   Reserved entry
+*/
+static DSL_void_t* DSL_DRV_DBG_RingReserve(
+   DSL_DBG_RingCtrl_t *pCtrl,
+   DSL_uint8_t *pEntries,
+   const DSL_uint32_t nEntrySize,
+   const DSL_uint32_t nRingSize,
+   DSL_uint32_t *pSeq)
+{
+   DSL_uint8_t *pEntry;
+   DSL_uint32_t nSeq;
+
+   nSeq = DSL_DRV_ATOMIC_FETCH_ADD(&(pCtrl->nWrSeq), 1);
+   pEntry = pEntries + (nSeq & (nRingSize - 1)) * nEntrySize;
+   /* Invalidate the entry for the readers while it is written*/
+   DSL_DBG_RING_ENTRY_SEQ(pEntry) = 0;
+   DSL_DRV_SMP_WMB();
+
+   *pSeq = nSeq;
+
+   return (DSL_void_t*)pEntry;
 }
 
 /*
-   For a detailed description please refer to the equivalent ioctl
-   \ref DSL_FIO_EVENT_STATUS_MASK_CONFIG_GET
+   Publishes a trace ring entry reserved by DSL_DRV_DBG_RingReserve.
+
+   \param pEntry Reserved entry, [I]
+   \param nSeq   Reserved sequence number, [I]
 */
-#ifdef INCLUDE_DSL_CONFIG_GET
-DSL_Error_t DSL_DRV_EventStatusMaskConfigGet(
-   DSL_OpenContext_t *pOpenCtx,
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_EventStatusMask_t *pData)
+static DSL_void_t DSL_DRV_DBG_RingPublish(
+   DSL_void_t *pEntry,
+   const DSL_uint32_t nSeq)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t nEventMask;
+   /* Publish the entry after its data is visible*/
+   DSL_DRV_SMP_WMB();
+   DSL_DBG_RING_ENTRY_SEQ(pEntry) = nSeq + 1;
+}
 
-   DSL_CHECK_POINTER(pContext, pData);
-   DSL_CHECK_ERR_CODE();
+/*
+   Reads a block of trace ring entries without blocking the writers. Entries
+   which were overwritten before or while they were read are counted as lost.
+
+   \param pCtrl      Ring control data, [I]
+   \param pEntries   First ring entry, [I]
+   \param nEntrySize Size of one entry [bytes], [I]
+   \param nRingSize  Number of ring entries, a power of two, [I]
+   \param nStartSeq  Sequence number of the first entry to read, [I]
+   \param pOut       Buffer for the read entries, [O]
+   \param nReadMax   Maximum number of entries to read, [I]
+   \param pNextSeq   Sequence number for the next read, [O]
+   \param pLost      Number of lost entries, [O]
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_EventStatusMaskConfigGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   \return
+   Number of entries read
+*/
+static DSL_uint32_t DSL_DRV_DBG_RingRead(
+   DSL_DBG_RingCtrl_t *pCtrl,
+   const DSL_uint8_t *pEntries,
+   const DSL_uint32_t nEntrySize,
+   const DSL_uint32_t nRingSize,
+   const DSL_uint32_t nStartSeq,
+   DSL_uint8_t *pOut,
+   const DSL_uint32_t nReadMax,
+   DSL_uint32_t *pNextSeq,
+   DSL_uint32_t *pLost)
+{
+   const DSL_uint8_t *pEntry;
+   DSL_uint32_t nSeq = nStartSeq, nWrSeq, nEntries = 0;
 
-   if(DSL_DRV_MUTEX_LOCK(pOpenCtx->eventMutex))
+   nWrSeq = pCtrl->nWrSeq;
+   *pLost = 0;
+
+   /* Skip the entries which were already overwritten*/
+   if ((nWrSeq - nSeq) > nRingSize)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: Couldn't lock event mutex"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      return DSL_ERROR;
+      *pLost = nWrSeq - nSeq - nRingSize;
+      nSeq = nWrSeq - nRingSize;
    }
 
-   /* Check if the event handling is activated for this instance*/
-   if (pOpenCtx->bEventActivation)
+   while ((nSeq != nWrSeq) && (nEntries < nReadMax))
    {
-      /* Get current event mask*/
-      nEventMask = pOpenCtx->nEventMask;
+      pEntry = pEntries + (nSeq & (nRingSize - 1)) * nEntrySize;
 
-      switch(pData->data.nEventType)
+      if (DSL_DBG_RING_ENTRY_SEQ(pEntry) != nSeq + 1)
       {
-         case DSL_EVENT_S_FIRMWARE_REQUEST:
-         case DSL_EVENT_S_LINIT_FAILURE:
-         case DSL_EVENT_S_LINE_STATE:
-         case DSL_EVENT_S_LINE_POWERMANAGEMENT_STATE:
-         case DSL_EVENT_S_CHANNEL_DATARATE:
-         case DSL_EVENT_S_FIRMWARE_ERROR:
-         case DSL_EVENT_S_INIT_READY:
-         case DSL_EVENT_S_FE_INVENTORY_AVAILABLE:
-         case DSL_EVENT_S_SYSTEM_STATUS:
-         case DSL_EVENT_S_PM_SYNC:
-         case DSL_EVENT_S_LINE_TRANSMISSION_STATUS:
-         case DSL_EVENT_S_SHOWTIME_LOGGING:
-         case DSL_EVENT_S_SNMP_MESSAGE_AVAILABLE:
-         case DSL_EVENT_S_SYSTEM_INTERFACE_STATUS:
-         case DSL_EVENT_S_FIRMWARE_DOWNLOAD_STATUS:
-         case DSL_EVENT_S_AUTOBOOT_STATUS:
-         case DSL_EVENT_S_RTT_STATUS:
-         case DSL_EVENT_S_FE_TESTPARAMS_AVAILABLE:
-            pData->data.bMask = nEventMask & DSL_EVENT2MASK(pData->data.nEventType) ?
-                                DSL_TRUE : DSL_FALSE;
-            break;
-      default:
-         DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - unknown status event(0x%x)"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pData->data.nEventType));
-         nErrCode = DSL_ERROR;
+         /* Entry is still written, continue with the next call*/
          break;
       }
-   }
-   else
-   {
-      nErrCode = DSL_ERR_EVENTS_NOT_ACTIVE;
-   }
 
-   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
+      /* Read the data only after the sequence number and check the sequence
+         number again only after the data*/
+      DSL_DRV_SMP_RMB();
+      memcpy(pOut + nEntries * nEntrySize, pEntry, nEntrySize);
+      DSL_DRV_SMP_RMB();
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_EventStatusMaskConfigSet, "
-      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+      if (DSL_DBG_RING_ENTRY_SEQ(pEntry) != nSeq + 1)
+      {
+         /* Entry was overwritten while it was copied*/
+         (*pLost)++;
+      }
+      else
+      {
+         *(DSL_uint32_t*)(pOut + nEntries * nEntrySize) = nSeq;
+         nEntries++;
+      }
+      nSeq++;
+   }
 
-   return nErrCode;
+   *pNextSeq = nSeq;
+
+   return nEntries;
 }
-#endif /* INCLUDE_DSL_CONFIG_GET*/
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-#ifdef INCLUDE_DSL_FRAMING_PARAMETERS
-DSL_Error_t DSL_DRV_FramingParameterStatusGet(
+DSL_Error_t DSL_DRV_DBG_MsgTraceConfigSet(
    DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_FramingParameterStatus_t *pData)
+   DSL_IN DSL_DBG_MsgTraceConfig_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
 
    DSL_CHECK_POINTER(pContext, pData);
    DSL_CHECK_ERR_CODE();
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_FramingParameterStatusGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Call device specific stuff*/
-   nErrCode = DSL_DRV_DEV_FramingParameterStatusGet(pContext, pData);
+   pContext->msgTrace.ctrl.bEnable = pData->data.bEnable ? DSL_TRUE : DSL_FALSE;
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_FramingParameterStatusGet, "
-      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   DSL_DEBUG( DSL_DBG_LOCAL,
+      (pContext, SYS_DBG_LOCAL"DSL[%02d]: message trace %s" DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext),
+      pContext->msgTrace.ctrl.bEnable == DSL_TRUE ? "enabled" : "disabled"));
 
    return nErrCode;
 }
-#endif /* INCLUDE_DSL_FRAMING_PARAMETERS*/
-
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-#ifdef INCLUDE_PILOT_TONES_STATUS
-DSL_Error_t DSL_DRV_PilotTonesStatusGet(
+DSL_Error_t DSL_DRV_DBG_MsgTraceConfigGet(
    DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_PilotTonesStatus_t *pData)
+   DSL_IN_OUT DSL_DBG_MsgTraceConfig_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_LineStateValue_t nCurrentState = DSL_LINESTATE_UNKNOWN;
 
    DSL_CHECK_POINTER(pContext, pData);
    DSL_CHECK_ERR_CODE();
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PilotTonesStatusGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   pData->data.bEnable = pContext->msgTrace.ctrl.bEnable;
 
-   /* Get current line state*/
-   DSL_CTX_READ_SCALAR(pContext, nErrCode, nLineState, nCurrentState);
+   return nErrCode;
+}
 
-   if ( (nCurrentState == DSL_LINESTATE_SHOWTIME_TC_SYNC) ||
-        (nCurrentState == DSL_LINESTATE_SHOWTIME_NO_SYNC) )
-   {
-      nErrCode = DSL_DRV_DEV_PilotTonesStatusGet(pContext, pData);
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_void_t DSL_DRV_DBG_MsgTraceRecord(
+   DSL_Context_t *pContext,
+   const DSL_DBG_MsgTraceDir_t nDir,
+   const DSL_uint16_t nClass,
+   const DSL_uint16_t nMsgId,
+   const DSL_uint8_t *pData,
+   const DSL_uint16_t nSize)
+{
+   DSL_DBG_MsgTraceRing_t *pRing = &(pContext->msgTrace);
+   DSL_DBG_MsgTraceEntry_t *pEntry;
+   DSL_uint32_t nSeq, nSec, nNSec;
+
+   DSL_DRV_TimeNSecGet(&nSec, &nNSec);
+
+   pEntry = (DSL_DBG_MsgTraceEntry_t*)DSL_DRV_DBG_RingReserve(&(pRing->ctrl),
+      (DSL_uint8_t*)pRing->entry, sizeof(DSL_DBG_MsgTraceEntry_t),
+      DSL_DBG_MSG_TRACE_RING_SIZE, &nSeq);
+
+   pEntry->nTimeSec   = nSec;
+   pEntry->nTimeNSec  = nNSec;
+   pEntry->nLine      = (DSL_uint8_t)DSL_DEV_NUM(pContext);
+   pEntry->nDir       = (DSL_uint8_t)nDir;
+   pEntry->nClass     = nClass;
+   pEntry->nMsgId     = nMsgId;
+   pEntry->nSize      = nSize;
+   memcpy(pEntry->nData, pData,
+      nSize < DSL_DBG_MSG_TRACE_DATA_MAX ? nSize : DSL_DBG_MSG_TRACE_DATA_MAX);
+
+   DSL_DRV_DBG_RingPublish(pEntry, nSeq);
+}
 
-      if ((nErrCode >= DSL_SUCCESS) && (pData->data.nNumData == 0))
-      {
-         nErrCode = DSL_ERR_NOT_SUPPORTED_BY_FIRMWARE;
-      }
-   }
-   else
-   {
-      nErrCode = DSL_ERR_ONLY_AVAILABLE_IN_SHOWTIME;
-   }
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_DBG_MsgTraceGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_MsgTrace_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_DBG_MsgTraceRing_t *pRing;
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PilotTonesStatusGet, "
-      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   pRing = &(pContext->msgTrace);
+
+   pData->data.nEntries = DSL_DRV_DBG_RingRead(&(pRing->ctrl),
+      (const DSL_uint8_t*)pRing->entry, sizeof(DSL_DBG_MsgTraceEntry_t),
+      DSL_DBG_MSG_TRACE_RING_SIZE, pData->data.nStartSeq,
+      (DSL_uint8_t*)pData->data.entry, DSL_DBG_MSG_TRACE_READ_MAX,
+      &(pData->data.nNextSeq), &(pData->data.nLost));
 
    return nErrCode;
 }
-#endif /* #ifdef INCLUDE_PILOT_TONES_STATUS*/
-
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_Error_t DSL_DRV_RebootCriteriaConfigSet(
+DSL_Error_t DSL_DRV_DBG_TraceConfigSet(
    DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_RebootCriteriaConfig_t *pData)
+   DSL_IN DSL_DBG_TraceConfig_t *pData)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS, nRet = DSL_SUCCESS;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
    DSL_CHECK_POINTER(pContext, pData);
    DSL_CHECK_ERR_CODE();
 
-   DSL_CHECK_DSLMODE(pData->nDslMode);
-   DSL_CHECK_ERR_CODE();
+   pContext->trace.ctrl.bEnable = pData->data.bEnable ? DSL_TRUE : DSL_FALSE;
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_RebootCriteriaConfigSet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_DEBUG( DSL_DBG_LOCAL,
+      (pContext, SYS_DBG_LOCAL"DSL[%02d]: tracepoints %s" DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext),
+      pContext->trace.ctrl.bEnable == DSL_TRUE ? "enabled" : "disabled"));
 
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-   /* Negative margine not supported for VRX */
-   if (pData->data.nRebootCriteria & DSL_REBOOT_CRITERIA_NEGATIVE_MARGIN)
-   {
-      pData->data.nRebootCriteria &= ~DSL_REBOOT_CRITERIA_NEGATIVE_MARGIN;
-      nRet = DSL_WRN_CONFIG_PARAM_IGNORED;
-   }
-#endif /* defined(INCLUDE_DSL_CPE_API_VRX) */
+   return nErrCode;
+}
 
-   DSL_CTX_WRITE(pContext, nErrCode, RebootCriteriaNeConfigData[pData->nDslMode],
-                                                    pData->data.nRebootCriteria);
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_DBG_TraceConfigGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_TraceConfig_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_RebootCriteriaConfigSet, "
-      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
 
-   return nRet;
+   pData->data.bEnable = pContext->trace.ctrl.bEnable;
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_void_t DSL_DRV_DBG_TraceRecord(
+   DSL_Context_t *pContext,
+   const DSL_DBG_TracePoint_t nPoint,
+   const DSL_int32_t nResult,
+   const DSL_uint32_t nArg0,
+   const DSL_uint32_t nArg1,
+   const DSL_uint32_t nArg2,
+   const DSL_uint32_t nArg3)
+{
+   DSL_DBG_TraceRing_t *pRing = &(pContext->trace);
+   DSL_DBG_TraceEntry_t *pEntry;
+   DSL_uint32_t nSeq, nSec, nNSec;
+
+   DSL_DRV_TimeNSecGet(&nSec, &nNSec);
+
+   pEntry = (DSL_DBG_TraceEntry_t*)DSL_DRV_DBG_RingReserve(&(pRing->ctrl),
+      (DSL_uint8_t*)pRing->entry, sizeof(DSL_DBG_TraceEntry_t),
+      DSL_DBG_TRACE_RING_SIZE, &nSeq);
+
+   pEntry->nTimeSec  = nSec;
+   pEntry->nTimeNSec = nNSec;
+   pEntry->nLine     = (DSL_uint8_t)DSL_DEV_NUM(pContext);
+   pEntry->nPoint    = (DSL_uint8_t)nPoint;
+   pEntry->nReserved = 0;
+   pEntry->nResult   = nResult;
+   pEntry->nArg[0]   = nArg0;
+   pEntry->nArg[1]   = nArg1;
+   pEntry->nArg[2]   = nArg2;
+   pEntry->nArg[3]   = nArg3;
+
+   DSL_DRV_DBG_RingPublish(pEntry, nSeq);
 }
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-DSL_Error_t DSL_DRV_RebootCriteriaConfigGet(
+DSL_Error_t DSL_DRV_DBG_TraceGet(
    DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_RebootCriteriaConfig_t *pData)
+   DSL_IN_OUT DSL_DBG_Trace_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_DBG_TraceRing_t *pRing;
 
    DSL_CHECK_POINTER(pContext, pData);
    DSL_CHECK_ERR_CODE();
 
-   DSL_CHECK_DSLMODE(pData->nDslMode);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_RebootCriteriaConfigGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   pRing = &(pContext->trace);
 
-   DSL_CTX_READ(pContext, nErrCode, RebootCriteriaNeConfigData[pData->nDslMode],
-                                                   pData->data.nRebootCriteria);
-   DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_RebootCriteriaConfigGet, "
-      "retCode(%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   pData->data.nEntries = DSL_DRV_DBG_RingRead(&(pRing->ctrl),
+      (const DSL_uint8_t*)pRing->entry, sizeof(DSL_DBG_TraceEntry_t),
+      DSL_DBG_TRACE_RING_SIZE, pData->data.nStartSeq,
+      (DSL_uint8_t*)pData->data.entry, DSL_DBG_TRACE_READ_MAX,
+      &(pData->data.nNextSeq), &(pData->data.nLost));
 
    return nErrCode;
 }
@@ -4029,282 +5240,138 @@ DSL_Error_t DSL_DRV_RebootCriteriaConfigGet(
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-#ifndef DSL_DEBUG_DISABLE
-DSL_Error_t DSL_DRV_DBG_ModuleLevelSet(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN DSL_DBG_ModuleLevel_t *pData)
+DSL_uint32_t DSL_DRV_ElapsedTimeNSecGet(
+   const DSL_uint32_t nSec,
+   const DSL_uint32_t nNSec)
 {
-   DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_int_t i = 0, j = 0;
-   DSL_boolean_t bModOk = DSL_FALSE, bLvlOk = DSL_FALSE;
-   DSL_debugLevelEntry_t *pDbgEntry = DSL_NULL;
-   DSL_debugLevelEntry_t *pDbgLvlNames = DSL_NULL;
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-   DSL_DEV_Handle_t dev;
-   IOCTL_MEI_dbgLevel_t fioVrxDrvDbgLevelSet;
-#endif /* INCLUDE_DSL_CPE_API_VRX */
-
-   DSL_CHECK_POINTER(pContext, pData);
-   DSL_CHECK_ERR_CODE();
+   DSL_uint32_t nNowSec, nNowNSec, nDiffSec;
 
-   /* Check if debug module number is valid */
-   pDbgEntry = &DSL_g_dbgLvl[1];
-   if ( (pData->data.nDbgModule >= DSL_DBG_LAST_BLOCK) ||
-        (pData->data.nDbgModule < DSL_DBG_NO_BLOCK) )
-   {
-      bModOk = DSL_FALSE;
-      DSL_DEBUG_SET_ERROR(DSL_ERROR);
-      DSL_DEBUG( DSL_DBG_ERR, (pContext,
-         SYS_DBG_ERR"DSL[%02d]: DSL_DRV_DBG_ModuleLevelSet - invalid debug module number specified:"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      DSL_DEBUG( DSL_DBG_PRN, (pContext,
-         SYS_DBG_PRN"   nDbgModules:" DSL_DRV_CRLF ) );
+   DSL_DRV_TimeNSecGet(&nNowSec, &nNowNSec);
 
-      for (i = 1; i < (DSL_int_t)DSL_DBG_LAST_BLOCK; i++, pDbgEntry++)
-      {
-         DSL_DEBUG( DSL_DBG_PRN,
-            (pContext, SYS_DBG_PRN"      %d: %s" DSL_DRV_CRLF , i, pDbgEntry->pcName) );
-      }
-   }
-   else
+   nDiffSec = nNowSec - nSec;
+   if (nNowNSec < nNSec)
    {
-      bModOk = DSL_TRUE;
+      nDiffSec--;
+      nNowNSec += 1000000000;
    }
 
-   /* Check if debug level is valid */
-   pDbgLvlNames = &DSL_g_dbgLvlNames[0];
-   for (i = 0; i < DSL_g_dbgLvlNumber; i++, pDbgLvlNames++)
+   /* Saturate at the 32 bit range (4.29 s)*/
+   if (nDiffSec > 4)
    {
-      if (pDbgLvlNames->nDbgLvl == pData->data.nDbgLevel)
-      {
-         /* debug level found  */
-         bLvlOk = DSL_TRUE;
-         break;
-      }
+      return 0xFFFFFFFF;
    }
-   if ( (bLvlOk == DSL_FALSE) && (i == DSL_g_dbgLvlNumber) )
+   if ((nDiffSec == 4) && ((nNowNSec - nNSec) > 294967295))
    {
-      /* debug level NOT valid  */
-      DSL_DEBUG_SET_ERROR(DSL_ERROR);
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: DSL_DRV_DBG_ModuleLevelSet - invalid debug level specified:"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      DSL_DEBUG( DSL_DBG_PRN,
-         (pContext, SYS_DBG_PRN"   nDbgLevels:" DSL_DRV_CRLF ) );
-      pDbgLvlNames = &DSL_g_dbgLvlNames[0];
-      for (i = 0; i < DSL_g_dbgLvlNumber; i++, pDbgLvlNames++)
-      {
-         DSL_DEBUG( DSL_DBG_PRN,
-            (pContext, SYS_DBG_PRN"      0x%02X: %s" DSL_DRV_CRLF ,
-            pDbgLvlNames->nDbgLvl, pDbgLvlNames->pcName) );
-      }
+      return 0xFFFFFFFF;
    }
 
-   if ( (bModOk == DSL_TRUE) && (bLvlOk == DSL_TRUE) )
-   {
-      if (pData->data.nDbgModule == DSL_DBG_NO_BLOCK)
-      {
-         i = 1;
-         j = (DSL_int_t)DSL_DBG_LAST_BLOCK;
-      }
-      else
-      {
-         i = (DSL_int_t)(pData->data.nDbgModule);
-         j = i + 1;
-      }
+   return nDiffSec * 1000000000 + (nNowNSec - nNSec);
+}
 
-      for ( ; i < j; i++, pDbgEntry++)
-      {
-         /* Set new debug level for specified module(s) */
-         DSL_g_dbgLvl[i].nDbgLvl = pData->data.nDbgLevel;
-         DSL_DEBUG( DSL_DBG_LOCAL,
-            (pContext, SYS_DBG_LOCAL"DSL[%02d]: new debug level: %s = %s - 0x%02X" DSL_DRV_CRLF ,
-                 DSL_DEV_NUM(pContext), DSL_g_dbgLvl[i].pcName,
-                 pDbgLvlNames->pcName,
-                 pData->data.nDbgLevel) );
-      }
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_MsgStatisticsGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_MsgStatistics_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_MsgStatisticsTable_t *pTable;
+   DSL_uint32_t i;
 
-#if defined(INCLUDE_DSL_CPE_API_VRX)
-      if (pData->data.nDbgModule == DSL_DBG_MESSAGE_DUMP)
-      {
-         dev = DSL_DEVICE_LOWHANDLE(pContext);
-         fioVrxDrvDbgLevelSet.eDbgModule = e_MEI_DBGMOD_MEI_MSG_DUMP_API;
-         switch (pData->data.nDbgLevel)
-         {
-            case DSL_DBG_NONE:
-            case DSL_DBG_PRN:
-            default:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_OFF;
-               break;
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
 
-            case DSL_DBG_ERR:
-            case DSL_DBG_WRN:
-            case DSL_DBG_MSG:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_NORMAL;
-               break;
+   pTable = &(pContext->msgStats);
 
-            case DSL_DBG_LOCAL:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_LOW;
-               break;
-         }
-         if (DSL_DRV_VRX_InternalDebugLevelSet((MEI_DYN_CNTRL_T*)dev, &fioVrxDrvDbgLevelSet) < 0)
-         {
-            DSL_DEBUG( DSL_DBG_ERR, (pContext,
-               SYS_DBG_ERR"DSL[%02d]: MEI debug level set failed, error %d" DSL_DRV_CRLF,
-               DSL_DEV_NUM(pContext), fioVrxDrvDbgLevelSet.ictl.retCode));
+   pData->data.nElapsedTime = DSL_DRV_TimeMSecGet() - pTable->nResetTime;
+   pData->data.nOverflow    = pTable->nOverflow;
+   pData->data.nEntries     = 0;
 
-            return DSL_ERROR;
-         }
-      }
-      if (pData->data.nDbgModule == DSL_DBG_LOW_LEVEL_DRIVER)
+   /* Copy the used slots without locking the message handling*/
+   for (i = 0; i < DSL_MSG_STATISTICS_ENTRIES_MAX; i++)
+   {
+      if (pTable->entry[i].nSent == 0)
       {
-         dev = DSL_DEVICE_LOWHANDLE(pContext);
-         fioVrxDrvDbgLevelSet.eDbgModule = e_MEI_DBGMOD_MEI_DRV;
-         switch (pData->data.nDbgLevel)
-         {
-            case DSL_DBG_NONE:
-            case DSL_DBG_PRN:
-            default:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_OFF;
-               break;
-
-            case DSL_DBG_ERR:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_HIGH;
-               break;
-
-            case DSL_DBG_WRN:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_NORMAL;
-               break;
-
-            case DSL_DBG_MSG:
-            case DSL_DBG_LOCAL:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_LOW;
-               break;
-         }
-         if (DSL_DRV_VRX_InternalDebugLevelSet((MEI_DYN_CNTRL_T*)dev, &fioVrxDrvDbgLevelSet) < 0)
-         {
-            DSL_DEBUG( DSL_DBG_ERR, (pContext,
-               SYS_DBG_ERR"DSL[%02d]: MEI debug level set failed, error %d" DSL_DRV_CRLF,
-               DSL_DEV_NUM(pContext), fioVrxDrvDbgLevelSet.ictl.retCode));
-
-            return DSL_ERROR;
-         }
+         continue;
       }
 
-      if (pData->data.nDbgModule == DSL_DBG_NOTIFICATIONS)
-      {
-         dev = DSL_DEVICE_LOWHANDLE(pContext);
-         fioVrxDrvDbgLevelSet.eDbgModule = e_MEI_DBGMOD_MEI_NOTIFICATIONS;
-         switch (pData->data.nDbgLevel)
-         {
-            case DSL_DBG_NONE:
-            case DSL_DBG_PRN:
-            default:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_OFF;
-               break;
+      memcpy(&(pData->data.entry[pData->data.nEntries]), &(pTable->entry[i]),
+         sizeof(DSL_MsgStatisticsEntry_t));
+      pData->data.nEntries++;
+   }
 
-            case DSL_DBG_ERR:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_HIGH;
-               break;
+   return nErrCode;
+}
 
-            case DSL_DBG_WRN:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_NORMAL;
-               break;
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_MsgStatisticsReset(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_MsgStatisticsReset_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-            case DSL_DBG_MSG:
-            case DSL_DBG_LOCAL:
-               fioVrxDrvDbgLevelSet.valLevel = MEI_DBG_LEVEL_LOW;
-               break;
-         }
-         if (DSL_DRV_VRX_InternalDebugLevelSet((MEI_DYN_CNTRL_T*)dev, &fioVrxDrvDbgLevelSet) < 0)
-         {
-            DSL_DEBUG( DSL_DBG_ERR, (pContext,
-               SYS_DBG_ERR"DSL[%02d]: MEI debug level set failed, error %d" DSL_DRV_CRLF,
-               DSL_DEV_NUM(pContext), fioVrxDrvDbgLevelSet.ictl.retCode));
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
 
-            return DSL_ERROR;
-         }
-      }
-#endif /* INCLUDE_DSL_CPE_API_VRX */
-   }
-   else
+   /* The statistics are only written while the device is locked*/
+   if (DSL_DRV_MUTEX_LOCK(pContext->bspMutex))
    {
-      nErrCode = DSL_ERROR;
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Getting mei driver semaphore failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_SEMAPHORE_GET;
    }
 
+   memset(&(pContext->msgStats), 0x0, sizeof(DSL_MsgStatisticsTable_t));
+   pContext->msgStats.nResetTime = DSL_DRV_TimeMSecGet();
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+
    return nErrCode;
 }
-#endif /* DSL_DEBUG_DISABLE */
 
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
 */
-#ifndef DSL_DEBUG_DISABLE
-DSL_Error_t DSL_DRV_DBG_ModuleLevelGet(
+DSL_Error_t DSL_DRV_BringUpTimingGet(
    DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_DBG_ModuleLevel_t *pData)
+   DSL_OUT DSL_BringUpTiming_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_boolean_t bLvlOk = DSL_FALSE;
-   DSL_debugLevelEntry_t *pDbgEntry = DSL_NULL;
-   DSL_debugLevelEntry_t *pDbgLvlNames = DSL_NULL;
-   DSL_int_t i = 0;
 
    DSL_CHECK_POINTER(pContext, pData);
    DSL_CHECK_ERR_CODE();
 
-   /* Check if debug module number is valid */
-   pDbgEntry = &DSL_g_dbgLvl[1];
-   if ( (pData->data.nDbgModule >= DSL_DBG_LAST_BLOCK) ||
-        (pData->data.nDbgModule == DSL_DBG_NO_BLOCK) )
-   {
-      nErrCode = DSL_ERROR;
-      DSL_DEBUG_SET_ERROR(nErrCode);
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: DSL_DRV_DBG_ModuleLevelGet - "
-         "invalid debug module number specified:" DSL_DRV_CRLF,
-         DSL_DEV_NUM(pContext)));
-      DSL_DEBUG( DSL_DBG_PRN,
-         (pContext, SYS_DBG_PRN"   nDbgModules:" DSL_DRV_CRLF ) );
-      for (i = 1; i < (DSL_int_t)DSL_DBG_LAST_BLOCK; i++, pDbgEntry++)
-      {
-         DSL_DEBUG( DSL_DBG_PRN,
-            (pContext, SYS_DBG_PRN"      %d: %s" DSL_DRV_CRLF , i, pDbgEntry->pcName) );
-      }
-   }
-   else
-   {
-      pData->data.nDbgLevel = DSL_g_dbgLvl[pData->data.nDbgModule].nDbgLvl;
+   DSL_CTX_READ(pContext, nErrCode, bringUpTiming, pData->data);
+
+   return nErrCode;
+}
 
-      pDbgLvlNames = &DSL_g_dbgLvlNames[0];
-      for (i = 0; i < DSL_g_dbgLvlNumber; i++, pDbgLvlNames++)
-      {
-         if (pDbgLvlNames->nDbgLvl == pData->data.nDbgLevel)
-         {
-            /* debug level found  */
-            bLvlOk = DSL_TRUE;
-            DSL_DEBUG( DSL_DBG_LOCAL,
-               (pContext, SYS_DBG_LOCAL"DSL[%02d]: actual debug level: %s = %s - 0x%02X" DSL_DRV_CRLF,
-                    DSL_DEV_NUM(pContext), DSL_g_dbgLvl[pData->data.nDbgModule].pcName,
-                    pDbgLvlNames->pcName,
-                    pData->data.nDbgLevel) );
-            break;
-         }
-      }
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_Error_t DSL_DRV_RestartStatisticsGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_RestartStatistics_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-      if (bLvlOk == DSL_FALSE)
-      {
-         DSL_DEBUG( DSL_DBG_LOCAL,
-            (pContext, SYS_DBG_LOCAL"DSL[%02d]: actual debug level: %s = 0x%02X" DSL_DRV_CRLF,
-                 DSL_DEV_NUM(pContext), DSL_g_dbgLvl[pData->data.nDbgModule].pcName,
-                 pData->data.nDbgLevel) );
-      }
-   }
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CTX_READ(pContext, nErrCode, restartStats, pData->data);
 
    return nErrCode;
 }
-#endif /* DSL_DEBUG_DISABLE*/
+
 
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
 /*
@@ -4555,16 +5622,36 @@ DSL_Error_t DSL_DRV_InitDataPrepare(
 {
    DSL_G997_LineInventoryNeData_t *pInv = DSL_NULL;
    DSL_Error_t nErrCode = DSL_SUCCESS;
+#ifndef INCLUDE_FW_REQUEST_SUPPORT
+   DSL_uint8_t *pFirmware = DSL_NULL, *pFirmware2 = DSL_NULL;
+#endif /* INCLUDE_FW_REQUEST_SUPPORT*/
 
    DSL_CHECK_POINTER(pContext, pInit);
    DSL_CHECK_ERR_CODE();
 
 #ifndef INCLUDE_FW_REQUEST_SUPPORT
-   /* Store FW in the DSL CPE internal memory*/
-   nErrCode = DSL_DRV_FwStore(
-                 pContext, bIsInKernel,
-                 (DSL_char_t*)pInit->data.pFirmware, pInit->data.nFirmwareSize,
-                 (DSL_char_t*)pInit->data.pFirmware2, pInit->data.nFirmwareSize2);
+   /* Store FW in the DSL CPE internal memory, an image which is already
+      cached for another line is shared*/
+   nErrCode = DSL_DRV_FwCacheGet(pContext, bIsInKernel, pInit->data.pFirmware,
+                 pInit->data.nFirmwareSize, &pFirmware);
+#ifdef INCLUDE_DSL_2ND_FIRMWARE_SUPPORT
+   if (nErrCode == DSL_SUCCESS)
+   {
+      nErrCode = DSL_DRV_FwCacheGet(pContext, bIsInKernel,
+                    pInit->data.pFirmware2, pInit->data.nFirmwareSize2,
+                    &pFirmware2);
+   }
+#endif /* #ifdef INCLUDE_DSL_2ND_FIRMWARE_SUPPORT*/
+
+   if (nErrCode == DSL_SUCCESS)
+   {
+      DSL_DRV_FwStore(pContext,
+         pFirmware,  pInit->data.nFirmwareSize,
+         pFirmware2, pInit->data.nFirmwareSize2);
+   }
+
+   DSL_DRV_FwCacheRelease(pFirmware);
+   DSL_DRV_FwCacheRelease(pFirmware2);
 
    if( nErrCode != DSL_SUCCESS)
    {
@@ -4621,14 +5708,14 @@ DSL_void_t DSL_DRV_InitDataFree(
        be requested via the corresponding event further if necessary*/
    if( pContext->pFirmware != DSL_NULL )
    {
-      DSL_DRV_VFree(pContext->pFirmware);
+      DSL_DRV_FwCacheRelease(pContext->pFirmware);
       pContext->pFirmware     = DSL_NULL;
       pContext->nFirmwareSize = 0;
    }
 
    if( pContext->pFirmware2 != DSL_NULL )
    {
-      DSL_DRV_VFree(pContext->pFirmware2);
+      DSL_DRV_FwCacheRelease(pContext->pFirmware2);
       pContext->pFirmware2     = DSL_NULL;
       pContext->nFirmwareSize2 = 0;
    }
@@ -5404,6 +6491,14 @@ DSL_IOCTL_REGISTER(DSL_FIO_PM_CONFIG_GET, DSL_IOCTL_HELPER_GET,
                    sizeof(DSL_PM_Config_t)),
 #endif /* INCLUDE_DSL_CONFIG_GET*/
 #endif /* INCLUDE_DSL_CPE_PM_CONFIG*/
+/* DSL_FIO_PM_STATISTICS_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_PM_STATISTICS_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_PM_StatisticsGet,
+                   sizeof(DSL_PM_Statistics_t)),
+/* DSL_FIO_PM_GROUP_COUNTERS_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_PM_GROUP_COUNTERS_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_PM_GroupCountersGet,
+                   sizeof(DSL_PM_GroupCounters_t)),
 
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
 #ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
@@ -5830,6 +6925,18 @@ DSL_IOCTL_REGISTER(DSL_FIO_G997_SNMP_MESSAGE_SEND, DSL_IOCTL_HELPER_SET,
 DSL_IOCTL_REGISTER(DSL_FIO_G997_SNMP_MESSAGE_RECEIVE, DSL_IOCTL_HELPER_GET,
                    DSL_TRUE, DSL_DRV_G997_SnmpMessageReceive,
                    sizeof(DSL_G997_Snmp_t)),
+/* DSL_FIO_G997_SNMP_STATISTICS_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_G997_SNMP_STATISTICS_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_TRUE, DSL_DRV_G997_SnmpStatisticsGet,
+                   sizeof(DSL_G997_SnmpStatistics_t)),
+/* DSL_FIO_G997_SNMP_MESSAGE_QUEUE */
+DSL_IOCTL_REGISTER(DSL_FIO_G997_SNMP_MESSAGE_QUEUE, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_G997_SnmpMessageQueue,
+                   sizeof(DSL_G997_SnmpQueue_t)),
+/* DSL_FIO_G997_SNMP_TX_STATUS_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_G997_SNMP_TX_STATUS_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_G997_SnmpTxStatusGet,
+                   sizeof(DSL_G997_SnmpTxStatus_t)),
 #endif /* INCLUDE_DSL_CEOC*/
 
 /* DSL_FIO_G997_RATE_ADAPTATION_CONFIG_SET */
@@ -6135,6 +7242,46 @@ DSL_IOCTL_REGISTER(DSL_FIO_DBG_MODULE_LEVEL_GET, DSL_IOCTL_HELPER_GET,
                    DSL_FALSE, DSL_DRV_DBG_ModuleLevelGet,
                    sizeof(DSL_DBG_ModuleLevel_t)),
 #endif /* DSL_DEBUG_DISABLE*/
+/* DSL_FIO_DBG_MSG_TRACE_CONFIG_SET */
+DSL_IOCTL_REGISTER(DSL_FIO_DBG_MSG_TRACE_CONFIG_SET, DSL_IOCTL_HELPER_SET,
+                   DSL_FALSE, DSL_DRV_DBG_MsgTraceConfigSet,
+                   sizeof(DSL_DBG_MsgTraceConfig_t)),
+/* DSL_FIO_DBG_MSG_TRACE_CONFIG_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_DBG_MSG_TRACE_CONFIG_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_DBG_MsgTraceConfigGet,
+                   sizeof(DSL_DBG_MsgTraceConfig_t)),
+/* DSL_FIO_DBG_MSG_TRACE_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_DBG_MSG_TRACE_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_DBG_MsgTraceGet,
+                   sizeof(DSL_DBG_MsgTrace_t)),
+/* DSL_FIO_DBG_TRACE_CONFIG_SET */
+DSL_IOCTL_REGISTER(DSL_FIO_DBG_TRACE_CONFIG_SET, DSL_IOCTL_HELPER_SET,
+                   DSL_FALSE, DSL_DRV_DBG_TraceConfigSet,
+                   sizeof(DSL_DBG_TraceConfig_t)),
+/* DSL_FIO_DBG_TRACE_CONFIG_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_DBG_TRACE_CONFIG_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_DBG_TraceConfigGet,
+                   sizeof(DSL_DBG_TraceConfig_t)),
+/* DSL_FIO_DBG_TRACE_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_DBG_TRACE_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_DBG_TraceGet,
+                   sizeof(DSL_DBG_Trace_t)),
+/* DSL_FIO_MSG_STATISTICS_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_MSG_STATISTICS_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_MsgStatisticsGet,
+                   sizeof(DSL_MsgStatistics_t)),
+/* DSL_FIO_MSG_STATISTICS_RESET */
+DSL_IOCTL_REGISTER(DSL_FIO_MSG_STATISTICS_RESET, DSL_IOCTL_HELPER_SET,
+                   DSL_FALSE, DSL_DRV_MsgStatisticsReset,
+                   sizeof(DSL_MsgStatisticsReset_t)),
+/* DSL_FIO_BRINGUP_TIMING_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_BRINGUP_TIMING_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_BringUpTimingGet,
+                   sizeof(DSL_BringUpTiming_t)),
+/* DSL_FIO_RESTART_STATISTICS_GET */
+DSL_IOCTL_REGISTER(DSL_FIO_RESTART_STATISTICS_GET, DSL_IOCTL_HELPER_GET,
+                   DSL_FALSE, DSL_DRV_RestartStatisticsGet,
+                   sizeof(DSL_RestartStatistics_t)),
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
 #ifndef DSL_DEBUG_DISABLE
 /* DSL_FIO_DBG_MODULE_LEVEL_SET */
@@ -6257,7 +7404,7 @@ DSL_Error_t DSL_DRV_IoctlHandle(
    DSL_Context_t *pContext,
    DSL_boolean_t bIsInKernel,
    DSL_uint_t nCommand,
-   DSL_uint32_t nArg)
+   DSL_ulong_t nArg)
 {
    DSL_Error_t nErrCode = DSL_ERROR;
    DSL_Error_t nCtxRWErrCode = DSL_ERROR;
@@ -6276,6 +7423,9 @@ DSL_Error_t DSL_DRV_IoctlHandle(
    DSL_DEV_VersionCheck_t nVerCheck = DSL_VERSION_ERROR;
 #endif
    DSL_uint32_t nOppositeLine;
+#ifdef INCLUDE_DSL_G997_PER_TONE
+   DSL_uint32_t nBufferSize = 0;
+#endif /* INCLUDE_DSL_G997_PER_TONE*/
 
 #ifndef DSL_DEBUG_DISABLE
    DSL_DEBUG(DSL_DBG_MSG,
@@ -6426,6 +7576,174 @@ DSL_Error_t DSL_DRV_IoctlHandle(
          break;
 #endif /* INCLUDE_DSL_CPE_TRACE_BUFFER*/
 
+#ifdef INCLUDE_DSL_G997_PER_TONE
+      case DSL_FIO_G997_PER_TONE_WINDOW_GET:
+         pIOCTL_arg = DSL_DRV_VMalloc(sizeof(DSL_G997_PerToneWindow_t));
+
+         if(pIOCTL_arg == DSL_NULL)
+         {
+            DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, &nErrCode,
+               sizeof(DSL_Error_t));
+            break;
+         }
+
+         if (nArg == 0)
+         {
+            nErrCode = DSL_ERR_INVALID_PARAMETER;
+         }
+         else
+         {
+            DSL_IoctlMemCpyFrom(bIsInKernel, pIOCTL_arg, (DSL_void_t*)nArg,
+               sizeof(DSL_G997_PerToneWindow_t));
+
+            pOldMsgBuf = (DSL_uint8_t*)pIOCTL_arg->g997PerToneWindow.data.pNSCData;
+            nBufferSize = pIOCTL_arg->g997PerToneWindow.data.nNumTones *
+                             sizeof(DSL_uint16_t);
+            pDataBuf = DSL_NULL;
+            nErrCode = DSL_SUCCESS;
+
+            /* The window is read into a kernel buffer of the requested size,
+               a window without tones returns the table size only*/
+            if (((pOldMsgBuf == DSL_NULL) && (nBufferSize > 0)) ||
+                (pIOCTL_arg->g997PerToneWindow.data.nNumTones > DSL_MAX_NSC))
+            {
+               nErrCode = DSL_ERR_INVALID_PARAMETER;
+            }
+            else if (nBufferSize > 0)
+            {
+               pDataBuf = DSL_DRV_VMalloc(nBufferSize);
+               if (pDataBuf == DSL_NULL)
+               {
+                  nErrCode = DSL_ERR_MEMORY;
+               }
+            }
+
+            if (nErrCode == DSL_SUCCESS)
+            {
+               pIOCTL_arg->g997PerToneWindow.data.pNSCData =
+                  (DSL_uint16_t*)pDataBuf;
+
+               nErrCode = DSL_DRV_G997_PerToneWindowGet(pContext,
+                  &pIOCTL_arg->g997PerToneWindow);
+
+               if ((nErrCode >= DSL_SUCCESS) && (pDataBuf != DSL_NULL))
+               {
+                  DSL_IoctlMemCpyTo(bIsInKernel, pOldMsgBuf, pDataBuf,
+                     pIOCTL_arg->g997PerToneWindow.data.nNumReturned *
+                        sizeof(DSL_uint16_t));
+               }
+
+               pIOCTL_arg->g997PerToneWindow.data.pNSCData =
+                  (DSL_uint16_t*)pOldMsgBuf;
+            }
+
+            if (pDataBuf != DSL_NULL)
+            {
+               DSL_DRV_VFree(pDataBuf);
+            }
+
+            pIOCTL_arg->g997PerToneWindow.accessCtl.nReturn = nErrCode;
+
+            if (nErrCode >= DSL_SUCCESS)
+            {
+               DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, pIOCTL_arg,
+                  sizeof(DSL_G997_PerToneWindow_t));
+            }
+            else
+            {
+               DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, &nErrCode,
+                  sizeof(DSL_Error_t));
+            }
+         }
+         break;
+
+      case DSL_FIO_G997_PER_TONE_EXPORT:
+         pIOCTL_arg = DSL_DRV_VMalloc(sizeof(DSL_G997_PerToneExport_t));
+
+         if(pIOCTL_arg == DSL_NULL)
+         {
+            DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, &nErrCode,
+               sizeof(DSL_Error_t));
+            break;
+         }
+
+         if (nArg == 0)
+         {
+            nErrCode = DSL_ERR_INVALID_PARAMETER;
+         }
+         else
+         {
+            DSL_IoctlMemCpyFrom(bIsInKernel, pIOCTL_arg, (DSL_void_t*)nArg,
+               sizeof(DSL_G997_PerToneExport_t));
+
+            pOldMsgBuf = pIOCTL_arg->g997PerToneExport.data.pData;
+            nBufferSize = pIOCTL_arg->g997PerToneExport.data.nBufferSize;
+            pDataBuf = DSL_NULL;
+            nErrCode = DSL_SUCCESS;
+
+            /* The export is built within a kernel buffer which is limited to
+               the maximum export size*/
+            if (pOldMsgBuf == DSL_NULL)
+            {
+               pIOCTL_arg->g997PerToneExport.data.nBufferSize = 0;
+            }
+            else if (nBufferSize > DSL_G997_PER_TONE_EXPORT_SIZE_MAX)
+            {
+               pIOCTL_arg->g997PerToneExport.data.nBufferSize =
+                  DSL_G997_PER_TONE_EXPORT_SIZE_MAX;
+            }
+
+            if (pIOCTL_arg->g997PerToneExport.data.nBufferSize > 0)
+            {
+               pDataBuf = DSL_DRV_VMalloc(
+                  pIOCTL_arg->g997PerToneExport.data.nBufferSize);
+               if (pDataBuf == DSL_NULL)
+               {
+                  nErrCode = DSL_ERR_MEMORY;
+               }
+            }
+
+            if (nErrCode == DSL_SUCCESS)
+            {
+               pIOCTL_arg->g997PerToneExport.data.pData = pDataBuf;
+
+               nErrCode = DSL_DRV_G997_PerToneExport(pContext,
+                  &pIOCTL_arg->g997PerToneExport);
+
+               if ((nErrCode >= DSL_SUCCESS) && (pDataBuf != DSL_NULL))
+               {
+                  DSL_IoctlMemCpyTo(bIsInKernel, pOldMsgBuf, pDataBuf,
+                     (pIOCTL_arg->g997PerToneExport.data.nDataSize <
+                      pIOCTL_arg->g997PerToneExport.data.nBufferSize) ?
+                        pIOCTL_arg->g997PerToneExport.data.nDataSize :
+                        pIOCTL_arg->g997PerToneExport.data.nBufferSize);
+               }
+
+               pIOCTL_arg->g997PerToneExport.data.pData = pOldMsgBuf;
+               pIOCTL_arg->g997PerToneExport.data.nBufferSize = nBufferSize;
+            }
+
+            if (pDataBuf != DSL_NULL)
+            {
+               DSL_DRV_VFree(pDataBuf);
+            }
+
+            pIOCTL_arg->g997PerToneExport.accessCtl.nReturn = nErrCode;
+
+            if (nErrCode >= DSL_SUCCESS)
+            {
+               DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, pIOCTL_arg,
+                  sizeof(DSL_G997_PerToneExport_t));
+            }
+            else
+            {
+               DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, &nErrCode,
+                  sizeof(DSL_Error_t));
+            }
+         }
+         break;
+#endif /* INCLUDE_DSL_G997_PER_TONE*/
+
       case DSL_FIO_DBG_DEVICE_MESSAGE_SEND:
          pIOCTL_arg = DSL_DRV_VMalloc(sizeof(DSL_DeviceMessage_t));
 
@@ -6914,6 +8232,9 @@ DSL_Error_t DSL_DRV_IoctlHandle(
             {
                if (nResourceActivationMask & DSL_RESOURCE_ACTIVATION_SNMP)
                {
+                  /* drop the references to the queued messages */
+                  DSL_CEOC_FifoSnmpFlush(pOpenCtx, pContext);
+
                   /* release event structures */
                   if (pOpenCtx->rxSnmpFifo != DSL_NULL)
                   {
@@ -6928,7 +8249,7 @@ DSL_Error_t DSL_DRV_IoctlHandle(
                      pOpenCtx->rxSnmpFifoBuf = DSL_NULL;
                   }
                }
-               else
+               else if (pOpenCtx->rxSnmpFifo == DSL_NULL)
                {
                   /* initialize event structures */
                   pOpenCtx->rxSnmpFifo = DSL_DRV_VMalloc(sizeof(DSL_FIFO));
@@ -6942,13 +8263,14 @@ DSL_Error_t DSL_DRV_IoctlHandle(
                   else
                   {
                      pOpenCtx->rxSnmpFifoBuf =
-                        DSL_DRV_VMalloc(DSL_CEOC_RX_FIFO_ELEMENT_COUNT * sizeof(DSL_G997_SnmpData_t));
+                        DSL_DRV_VMalloc(DSL_CEOC_RX_FIFO_ELEMENT_COUNT * sizeof(DSL_CEOC_SnmpMsgBuf_t*));
                      if (pOpenCtx->rxSnmpFifoBuf == DSL_NULL)
                      {
                         DSL_DEBUG(DSL_DBG_ERR,
                            (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Could not allocate memory for SNMP FIFO buffer!!!"
                            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
                         DSL_DRV_VFree(pOpenCtx->rxSnmpFifo);
+                        pOpenCtx->rxSnmpFifo = DSL_NULL;
                         nErrCode = DSL_ERR_MEMORY;
                      }
                      else
@@ -6958,8 +8280,8 @@ DSL_Error_t DSL_DRV_IoctlHandle(
                                pOpenCtx->rxSnmpFifo,
                                pOpenCtx->rxSnmpFifoBuf,
                                pOpenCtx->rxSnmpFifoBuf +
-                               sizeof(DSL_CEOC_Message_t)*(DSL_CEOC_RX_FIFO_ELEMENT_COUNT - 1),
-                               sizeof(DSL_CEOC_Message_t)) != 0)
+                               sizeof(DSL_CEOC_SnmpMsgBuf_t*)*(DSL_CEOC_RX_FIFO_ELEMENT_COUNT - 1),
+                               sizeof(DSL_CEOC_SnmpMsgBuf_t*)) != 0)
                         {
                            DSL_DEBUG(DSL_DBG_ERR,
                               (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: Internal error in the DSL "
@@ -6967,6 +8289,8 @@ DSL_Error_t DSL_DRV_IoctlHandle(
                               DSL_DEV_NUM(pContext)));
                            DSL_DRV_VFree(pOpenCtx->rxSnmpFifoBuf);
                            DSL_DRV_VFree(pOpenCtx->rxSnmpFifo);
+                           pOpenCtx->rxSnmpFifoBuf = DSL_NULL;
+                           pOpenCtx->rxSnmpFifo = DSL_NULL;
                            nErrCode = DSL_ERR_INTERNAL;
                         }
                      }
@@ -7208,6 +8532,8 @@ DSL_Error_t DSL_DRV_FwDownload(
 
    DSL_DRV_LineStateSet(pContext, DSL_LINESTATE_IDLE_REQUEST);
 
+   DSL_DRV_BRINGUP_TIMESTAMP(pContext, nFwDownloadStartTime);
+
    nErrCode = DSL_DRV_DEV_FwDownload(pContext,
          pFw1, nSize1, pFw2, nSize2, pLoff, pCurrentOff, bLastChunk,
          bForceDownload);
@@ -7223,6 +8549,11 @@ DSL_Error_t DSL_DRV_FwDownload(
       DSL_DEBUG( DSL_DBG_MSG,
          (pContext, SYS_DBG_MSG"DSL[%02d]: Firmware download finished "
          "(total %d bytes)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), *pCurrentOff));
+
+      if (bLastChunk)
+      {
+         DSL_DRV_BRINGUP_TIMESTAMP(pContext, nFwDownloadEndTime);
+      }
    }
 
    return nErrCode;
@@ -7247,6 +8578,21 @@ DSL_Error_t DSL_DRV_LineStateSet(
          nOldLineState, nNewLineState));
       DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nLineState, nNewLineState);
 
+      if (nNewLineState == DSL_LINESTATE_HANDSHAKE)
+      {
+         DSL_DRV_BRINGUP_TIMESTAMP(pContext, nFirstHandshakeTime);
+      }
+      else if (nNewLineState == DSL_LINESTATE_SHOWTIME_TC_SYNC)
+      {
+         DSL_DRV_BRINGUP_TIMESTAMP(pContext, nShowtimeTime);
+         pContext->nShowtimeEpoch++;
+
+         if (pContext->nRestartStartTime != 0)
+         {
+            DSL_DRV_AutobootRestartRecoveryUpdate(pContext);
+         }
+      }
+
       /* There are special line states which needs to be signaled later on after
          some further action like copying data from firmware to API internal
          memory. In this cases the event will be not generated here. */
@@ -7266,6 +8612,11 @@ DSL_Error_t DSL_DRV_LineStateSet(
                /* On showtime entry datarates are needed which are only available in
                   case of TC-Sync */
                DSL_DRV_DEV_MeiShowtimeSignaling(pContext, DSL_TRUE);
+
+#if defined(INCLUDE_DSL_PM)
+               /* PM threads might wait with an extended poll cycle*/
+               DSL_DRV_PM_ShowtimeEntryNotify(pContext);
+#endif /* #if defined(INCLUDE_DSL_PM)*/
             }
             /* Showtime exit relevant handlings. In case of alternating TC-Sync and
                TC-No Sync NO showtime exit shall be signaled. */
@@ -7421,6 +8772,89 @@ DSL_Error_t DSL_DRV_CtxDataUpdate(
 
 /* Events stuff */
 
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern.h'
+*/
+DSL_boolean_t DSL_DRV_OpenContextEventQueue(
+   DSL_IN DSL_OpenContext_t *pOpenContext,
+   DSL_IN DSL_EventStatusData_t *pEvent,
+   DSL_IN DSL_uint32_t nDataSize)
+{
+   DSL_uint8_t *buf;
+   DSL_EventStatusData_t *pEvBuf;
+   DSL_boolean_t bQueued = DSL_FALSE;
+
+   if(DSL_DRV_MUTEX_LOCK(pOpenContext->eventMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock event mutex!"
+         DSL_DRV_CRLF, pOpenContext->pDevCtx->nNum));
+
+      return DSL_FALSE;
+   }
+
+   if ((pOpenContext->eventFifo != DSL_NULL) &&
+       (pOpenContext->eventFifoBuf != DSL_NULL) &&
+       (pOpenContext->bEventActivation == DSL_TRUE) &&
+       (pOpenContext->nEventMask & DSL_EVENT2MASK(pEvent->nEventType)) == 0)
+   {
+      if ( DSL_Fifo_isFull( pOpenContext->eventFifo ) == (DSL_int8_t)DSL_TRUE )
+      {
+         /* Set FIFO overflow indication flag*/
+         pOpenContext->bFifoFull = DSL_TRUE;
+         DSL_DEBUG( DSL_DBG_WRN,
+            (DSL_NULL, SYS_DBG_WRN"DSL[%02d]: WARNING - The fifo is full!"
+            DSL_DRV_CRLF, pOpenContext->pDevCtx->nNum));
+      }
+      else
+      {
+         if ((buf = DSL_Fifo_writeElement(pOpenContext->eventFifo)) == DSL_NULL)
+         {
+            DSL_DEBUG( DSL_DBG_ERR,
+               (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Event could not be added!"
+               DSL_DRV_CRLF, pOpenContext->pDevCtx->nNum));
+         }
+         else
+         {
+            /* copy an element */
+            memcpy(buf, pEvent, sizeof(DSL_EventStatusData_t));
+
+            if (pEvent->pData != DSL_NULL)
+            {
+               pEvBuf = (DSL_EventStatusData_t *)buf;
+               /* DSL_FIO_EVENT_STATUS_GET returns the complete union*/
+               pEvBuf->pData = DSL_DRV_VMalloc(sizeof(DSL_EventData_Union_t));
+               if (pEvBuf->pData != DSL_NULL)
+               {
+                  /* copy an element data */
+                  DSL_DRV_MemSet(pEvBuf->pData, 0, sizeof(DSL_EventData_Union_t));
+                  memcpy(pEvBuf->pData, pEvent->pData,
+                     nDataSize < sizeof(DSL_EventData_Union_t) ?
+                     nDataSize : sizeof(DSL_EventData_Union_t));
+               }
+               else
+               {
+                  DSL_DEBUG( DSL_DBG_WRN,
+                     (DSL_NULL, SYS_DBG_WRN"DSL[%02d]: WRN - Could not allocate memory for an "
+                     "event data, it will be lost!"DSL_DRV_CRLF,
+                     pOpenContext->pDevCtx->nNum));
+               }
+            }
+
+            bQueued = DSL_TRUE;
+
+            /* wake up */
+            DSL_DRV_WAKEUP_WAKELIST(pOpenContext->eventWaitQueue);
+         }
+      }
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(pOpenContext->eventMutex);
+
+   return bQueued;
+}
+
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern.h'
@@ -7431,8 +8865,6 @@ DSL_Error_t DSL_DRV_EventQueue(
    DSL_IN DSL_uint32_t nDataSize)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint8_t *buf;
-   DSL_EventStatusData_t *pEvBuf;
    DSL_OpenContext_t *pCurr;
 
    DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
@@ -7465,71 +8897,15 @@ DSL_Error_t DSL_DRV_EventQueue(
          continue;
       }
 
-      if(DSL_DRV_MUTEX_LOCK(pCurr->eventMutex))
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock event mutex!"
-            DSL_DRV_CRLF, pOpenContextList->pDevCtx->nNum));
-      }
-      else
-      {
-         if ((pCurr->eventFifo != DSL_NULL) &&
-             (pCurr->eventFifoBuf != DSL_NULL) &&
-             (pCurr->bEventActivation == DSL_TRUE) &&
-             (pCurr->nEventMask & DSL_EVENT2MASK(pEvent->nEventType)) == 0)
-         {
-            if ( DSL_Fifo_isFull( pCurr->eventFifo ) == (DSL_int8_t)DSL_TRUE )
-            {
-               /* Set FIFO overflow indication flag*/
-               pCurr->bFifoFull = DSL_TRUE;
-               DSL_DEBUG( DSL_DBG_WRN,
-                  (DSL_NULL, SYS_DBG_WRN"DSL[%02d]: WARNING - The fifo is full!"
-                  DSL_DRV_CRLF, pOpenContextList->pDevCtx->nNum));
-            }
-            else
-            {
-               if ((buf = DSL_Fifo_writeElement(pCurr->eventFifo)) == DSL_NULL)
-               {
-                  DSL_DEBUG( DSL_DBG_ERR,
-                     (DSL_NULL, SYS_DBG_ERR"DSL[%02d]: ERROR - Event could not be added!"
-                     DSL_DRV_CRLF, pOpenContextList->pDevCtx->nNum));
-               }
-               else
-               {
-                  /* copy an element */
-                  memcpy(buf, pEvent, sizeof(DSL_EventStatusData_t));
-
-                  if (pEvent->pData != DSL_NULL)
-                  {
-                     pEvBuf = (DSL_EventStatusData_t *)buf;
-                     pEvBuf->pData = DSL_DRV_VMalloc(nDataSize);
-                     if (pEvBuf->pData != DSL_NULL)
-                     {
-                        /* copy an element data */
-                        memcpy(pEvBuf->pData, pEvent->pData, nDataSize);
-                     }
-                     else
-                     {
-                        DSL_DEBUG( DSL_DBG_WRN,
-                           (DSL_NULL, SYS_DBG_WRN"DSL[%02d]: WRN - Could not allocate memory for an "
-                           "event data, it will be lost!"DSL_DRV_CRLF,
-                           pOpenContextList->pDevCtx->nNum));
-                     }
-                  }
-
-                  /* wake up */
-                  DSL_DRV_WAKEUP_WAKELIST(pCurr->eventWaitQueue);
-               }
-            }
-         }
-
-         DSL_DRV_MUTEX_UNLOCK(pCurr->eventMutex);
-      }
+      DSL_DRV_OpenContextEventQueue(pCurr, pEvent, nDataSize);
    }
 
    /* Unlock Open Context List*/
    DSL_DRV_MUTEX_UNLOCK(pContext->pDevCtx->openContextListMutex);
 
+   DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_EVENT_QUEUE, nErrCode,
+      pEvent->nEventType, pEvent->pData != DSL_NULL ? nDataSize : 0, 0, 0);
+
    /* free event data */
    if (pEvent->pData != DSL_NULL)
    {
@@ -207,7 +207,7 @@ DSL_Error_t DSL_DRV_AutobootThreadStart(
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          nErrCode = (DSL_Error_t)DSL_DRV_THREAD(
-            &pContext->AutobootControl, "autbtex", DSL_DRV_AutobootThreadMain, (DSL_uint32_t)pContext);
+            &pContext->AutobootControl, "autbtex", DSL_DRV_AutobootThreadMain, (DSL_ulong_t)pContext);
       }
 
       DSL_DEBUG(DSL_DBG_MSG,
@@ -320,7 +320,7 @@ static DSL_int_t DSL_DRV_AutobootThreadMain(
    }
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: autoboot ending (%lu)"DSL_DRV_CRLF,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: autoboot ending (%u)"DSL_DRV_CRLF,
       DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
 
 #if defined (DSL_VRX_DEVICE_VR11)
@@ -342,7 +342,7 @@ static DSL_int_t DSL_DRV_AutobootThreadMain(
    pContext->bAutobootThreadStarted = DSL_FALSE;
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: autoboot complete (%lu)"DSL_DRV_CRLF,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: autoboot complete (%u)"DSL_DRV_CRLF,
       DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
 
    DSL_DRV_THREAD_DELETE(pContext->AutobootControl, 0);
@@ -361,7 +361,7 @@ DSL_Error_t DSL_DRV_AutobootThreadStop(
       return DSL_ERR_AUTOBOOT_NOT_STARTED;
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: Stopping autoboot thread... (%lu)"
+      (pContext, SYS_DBG_MSG"DSL[%02d]: Stopping autoboot thread... (%u)"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
 
    pContext->bAutobootThreadShutdown = DSL_TRUE;
@@ -373,7 +373,7 @@ DSL_Error_t DSL_DRV_AutobootThreadStop(
    pContext->bAutobootThreadStarted = DSL_FALSE;
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: Autoboot thread has stopped... (%lu)"
+      (pContext, SYS_DBG_MSG"DSL[%02d]: Autoboot thread has stopped... (%u)"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
 
    return DSL_SUCCESS;
@@ -408,6 +408,7 @@ DSL_Error_t DSL_DRV_AutobootStateSet(
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_TestModeControlSet_t nTestMode = DSL_TESTMODE_DISABLE;
+   DSL_Autoboot_State_t nPrevState = DSL_AUTOBOOTSTATE_UNKNOWN;
 
    DSL_CTX_READ_SCALAR(pContext, nErrCode, nTestModeControl, nTestMode);
 
@@ -423,13 +424,188 @@ DSL_Error_t DSL_DRV_AutobootStateSet(
          SYS_DBG_MSG"DSL[%02d]: Autoboot State: %s" DSL_DRV_CRLF,
          DSL_DEV_NUM(pContext), DSL_DBG_PRN_AUTOBOOT_STATE[nState]));
 
+      if (DSL_DRV_DBG_TRACE_ENABLED(pContext))
+      {
+         DSL_CTX_READ_SCALAR(pContext, nErrCode, nAutobootState, nPrevState);
+      }
+
       DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nAutobootState, nState);
       DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nAutobootPollTime, nPollTimeSec);
+
+      DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_AUTOBOOT_STATE, nErrCode,
+         nPrevState, nState, nPollTimeSec, 0);
+
+      if (nState == DSL_AUTOBOOTSTATE_FIRMWARE_REQUEST)
+      {
+         DSL_DRV_BRINGUP_TIMESTAMP(pContext, nFwRequestTime);
+      }
+      else if (nState == DSL_AUTOBOOTSTATE_FIRMWARE_READY)
+      {
+         DSL_DRV_BRINGUP_TIMESTAMP(pContext, nFwReadyTime);
+      }
+      else if (nState == DSL_AUTOBOOTSTATE_TRAIN)
+      {
+         /* The link was activated*/
+         pContext->bFastRestartPending = DSL_FALSE;
+      }
+
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+      /* A requested firmware is expected to be downloaded, the slave port
+         waits for it. Leaving the firmware states without a download
+         withdraws the request. */
+      if (DSL_DRV_MUTEX_LOCK(pContext->bringUpMutex) == 0)
+      {
+         if (nState == DSL_AUTOBOOTSTATE_FIRMWARE_REQUEST)
+         {
+            if (pContext->nFwDownloadState == DSL_DRV_FW_DOWNLOAD_IDLE)
+            {
+               pContext->nFwDownloadState = DSL_DRV_FW_DOWNLOAD_REQUESTED;
+            }
+         }
+         else if ((nState != DSL_AUTOBOOTSTATE_FIRMWARE_WAIT) &&
+                  (pContext->nFwDownloadState ==
+                     DSL_DRV_FW_DOWNLOAD_REQUESTED))
+         {
+            pContext->nFwDownloadState = DSL_DRV_FW_DOWNLOAD_IDLE;
+         }
+         DSL_DRV_MUTEX_UNLOCK(pContext->bringUpMutex);
+      }
+
+      /* Firmware loader might wait for the state change*/
+      DSL_DRV_WAKEUP_EVENT(pContext->bringUpEvent);
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
    }
 
    return nErrCode;
 }
 
+/*
+   Counts the last restart as fast or full restart, each restart is counted
+   once only.
+
+   \param pContext     Pointer to dsl library context structure, [I]
+   \param bFastRestart Restart keeps the loaded firmware, [I]
+*/
+static DSL_void_t DSL_DRV_AutobootRestartCount(
+   DSL_Context_t *pContext,
+   DSL_boolean_t bFastRestart)
+{
+   if ((pContext->nRestartStartTime == 0) || pContext->bRestartCounted)
+   {
+      /* No restart, e.g. initial firmware request*/
+      return;
+   }
+
+   if (DSL_DRV_MUTEX_LOCK(pContext->dataMutex))
+   {
+      return;
+   }
+
+   if (bFastRestart)
+   {
+      pContext->restartStats.nFastRestarts++;
+   }
+   else
+   {
+      pContext->restartStats.nFullRestarts++;
+   }
+
+   pContext->bRestartCounted = DSL_TRUE;
+   pContext->bFastRestart    = bFastRestart;
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->dataMutex);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_autoboot.h'
+*/
+DSL_void_t DSL_DRV_AutobootRestartRecoveryUpdate(
+   DSL_Context_t *pContext)
+{
+   DSL_RestartStatisticsData_t *pStats = &(pContext->restartStats);
+   DSL_uint32_t nTime;
+
+   if (DSL_DRV_MUTEX_LOCK(pContext->dataMutex))
+   {
+      return;
+   }
+
+   nTime = DSL_DRV_BringUpTimeGet() - pContext->nRestartStartTime;
+
+   if (pContext->bFastRestart)
+   {
+      pStats->nFastRecoveries++;
+      pStats->nFastRecoveryTimeLast   = nTime;
+      pStats->nFastRecoveryTimeTotal += nTime;
+   }
+   else
+   {
+      pStats->nFullRecoveries++;
+      pStats->nFullRecoveryTimeLast   = nTime;
+      pStats->nFullRecoveryTimeTotal += nTime;
+   }
+
+   pContext->nRestartStartTime = 0;
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->dataMutex);
+
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+      "DSL[%02d]: Showtime reached %d ms after the %s restart"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext), nTime, pContext->bFastRestart ? "fast" : "full"));
+}
+
+#if defined(INCLUDE_DSL_CPE_API_VRX) && defined(INCLUDE_DSL_CPE_FAST_RESTART)
+/*
+   Checks whether the loaded firmware can be kept for the next training and
+   stops the modem in this case.
+
+   \param pContext Pointer to dsl library context structure, [I]
+
+   \return
+   DSL_TRUE if the firmware download can be skipped
+*/
+static DSL_boolean_t DSL_DRV_AutobootFastRestartCheck(
+   DSL_Context_t *pContext)
+{
+   DSL_boolean_t bFastRestart = DSL_FALSE;
+
+   if (pContext->bFastRestartPending)
+   {
+      /* The last fast restart did not reach the link activation*/
+      pContext->bFastRestartPending = DSL_FALSE;
+
+      if (DSL_DRV_MUTEX_LOCK(pContext->dataMutex) == 0)
+      {
+         pContext->restartStats.nFastRestartFailures++;
+         DSL_DRV_MUTEX_UNLOCK(pContext->dataMutex);
+      }
+
+      DSL_DEBUG(DSL_DBG_WRN, (pContext, SYS_DBG_WRN
+         "DSL[%02d]: WARNING - Fast restart failed, reloading the firmware"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_FALSE;
+   }
+
+   if ((DSL_DRV_VRX_FastRestartCheck(pContext, &bFastRestart) != DSL_SUCCESS) ||
+       !bFastRestart)
+   {
+      return DSL_FALSE;
+   }
+
+   /* Stop the modem, the firmware ready handling waits for its reset state*/
+   if (DSL_DRV_LinkTerminate(pContext) != DSL_SUCCESS)
+   {
+      return DSL_FALSE;
+   }
+
+   pContext->bFastRestartPending = DSL_TRUE;
+
+   return DSL_TRUE;
+}
+#endif /* defined(INCLUDE_DSL_CPE_API_VRX) && defined(INCLUDE_DSL_CPE_FAST_RESTART)*/
+
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_autoboot.h'
@@ -746,7 +922,7 @@ DSL_Error_t DSL_DRV_AutobootStateCheck(
    {
       DSL_DEBUG(DSL_DBG_MSG,
          (pContext, SYS_DBG_MSG"DSL[%02d]: autoboot state was switched: %d "
-         "to %d (%ld), retCode=%d"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), (int)nPrev,
+         "to %d (%u), retCode=%d"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), (int)nPrev,
          (int)pContext->nAutobootState, DSL_DRV_TimeMSecGet(), nErrCode));
    }
 
@@ -1217,6 +1393,13 @@ static DSL_Error_t DSL_DRV_AutobootHandleRestart(
    /* Reset the showtime indication flag*/
    DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bShowtimeReached, DSL_FALSE);
 
+   /* The recovery time is measured from the first restart on*/
+   if (pContext->nRestartStartTime == 0)
+   {
+      pContext->nRestartStartTime = DSL_DRV_BringUpTimeGet();
+   }
+   pContext->bRestartCounted = DSL_FALSE;
+
    DSL_CTX_READ_SCALAR(pContext, nErrCode, bAutobootFwLoadPending, bAutobootFwLoadPending);
    /* Check for pending FW download*/
    if (!bAutobootFwLoadPending)
@@ -1378,6 +1561,7 @@ static DSL_Error_t DSL_DRV_AutobootHandleRestart(
          else
          {
             DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bFwReLoaded, DSL_TRUE);
+            DSL_DRV_AutobootRestartCount(pContext, DSL_FALSE);
 
             nErrCode = DSL_DRV_AutobootStateSet(
                pContext, DSL_AUTOBOOTSTATE_FIRMWARE_READY, DSL_AUTOBOOT_FW_READY_POLL_TIME);
@@ -1387,6 +1571,7 @@ static DSL_Error_t DSL_DRV_AutobootHandleRestart(
          {
             DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bSoftRestart, DSL_FALSE);
             DSL_CTX_WRITE_SCALAR(pContext, nErrCode, bFwReLoaded, DSL_TRUE);
+            DSL_DRV_AutobootRestartCount(pContext, DSL_TRUE);
 
             nErrCode = DSL_DRV_AutobootStateSet(
                pContext, DSL_AUTOBOOTSTATE_FIRMWARE_READY,
@@ -1716,6 +1901,23 @@ static DSL_Error_t DSL_DRV_AutobootHandleFwRequest(
    }
 #endif
 
+#if defined(INCLUDE_DSL_CPE_API_VRX) && defined(INCLUDE_DSL_CPE_FAST_RESTART)
+   /* Keep the loaded firmware if it matches the CAM FSM requirements*/
+   if (DSL_DRV_AutobootFastRestartCheck(pContext))
+   {
+      DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+         "DSL[%02d]: Fast restart, keeping the loaded firmware"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      DSL_DRV_AutobootRestartCount(pContext, DSL_TRUE);
+
+      return DSL_DRV_AutobootStateSet(pContext,
+         DSL_AUTOBOOTSTATE_FIRMWARE_READY, DSL_AUTOBOOT_FW_READY_POLL_TIME);
+   }
+#endif /* defined(INCLUDE_DSL_CPE_API_VRX) && defined(INCLUDE_DSL_CPE_FAST_RESTART)*/
+
+   DSL_DRV_AutobootRestartCount(pContext, DSL_FALSE);
+
 #if defined(INCLUDE_DSL_CPE_API_VRX)
    nFwType = DSL_FW_REQUEST_XDSL;
    DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.nPortMode, nPortMode);
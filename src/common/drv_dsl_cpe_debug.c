@@ -125,6 +125,57 @@ DSL_uint16_t DSL_g_dbgStopLine = DSL_MAX_LINE_NUMBER;
 /* Array of line debug levels */
 DSL_debugLevels_t DSL_g_dbgLineLvl[DSL_MAX_LINE_NUMBER];
 
+#ifdef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS
+/* Static keys of all debug blocks, all output is disabled until the first
+   call of DSL_DRV_DBG_StaticKeysUpdate() */
+struct static_key_false DSL_g_dbgKey[DSL_DBG_MAX_ENTRIES][DSL_DBG_KEY_LEVELS] =
+{
+   [0 ... DSL_DBG_MAX_ENTRIES - 1] =
+      { [0 ... DSL_DBG_KEY_LEVELS - 1] = STATIC_KEY_FALSE_INIT }
+};
+
+/* Debug level that is represented by each static key index */
+static const DSL_debugLevels_t DSL_g_dbgKeyLvl[DSL_DBG_KEY_LEVELS] =
+{
+   DSL_DBG_PRN, DSL_DBG_ERR, DSL_DBG_WRN, DSL_DBG_MSG, DSL_DBG_LOCAL
+};
+
+DSL_void_t DSL_DRV_DBG_StaticKeysUpdate(DSL_void_t)
+{
+   DSL_int_t nBlock, nIdx;
+   DSL_debugLevels_t nLevel;
+   DSL_boolean_t bEnable;
+
+   for (nBlock = 0; nBlock < DSL_DBG_MAX_ENTRIES; nBlock++)
+   {
+      for (nIdx = 0; nIdx < DSL_DBG_KEY_LEVELS; nIdx++)
+      {
+         nLevel = DSL_g_dbgKeyLvl[nIdx];
+
+         /* Same evaluation as done at runtime without static keys */
+         if (DSL_g_globalDbgLvl == DSL_DBG_LOCAL)
+         {
+            bEnable = (nLevel <= DSL_g_dbgLvl[nBlock].nDbgLvl) ?
+               DSL_TRUE : DSL_FALSE;
+         }
+         else
+         {
+            bEnable = (nLevel <= DSL_g_globalDbgLvl) ? DSL_TRUE : DSL_FALSE;
+         }
+
+         if (bEnable == DSL_TRUE)
+         {
+            static_branch_enable(&DSL_g_dbgKey[nBlock][nIdx]);
+         }
+         else
+         {
+            static_branch_disable(&DSL_g_dbgKey[nBlock][nIdx]);
+         }
+      }
+   }
+}
+#endif /* INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS */
+
 DSL_char_t* DSL_DBG_IoctlName(DSL_uint_t nIoctlCode)
 {
    switch (nIoctlCode)
@@ -155,6 +206,26 @@ DSL_char_t* DSL_DBG_IoctlName(DSL_uint_t nIoctlCode)
       return "DSL_FIO_DBG_MODULE_LEVEL_GET";
    case DSL_FIO_DBG_DEVICE_MESSAGE_SEND:
       return "DSL_FIO_DBG_DEVICE_MESSAGE_SEND";
+   case DSL_FIO_DBG_MSG_TRACE_CONFIG_SET:
+      return "DSL_FIO_DBG_MSG_TRACE_CONFIG_SET";
+   case DSL_FIO_DBG_MSG_TRACE_CONFIG_GET:
+      return "DSL_FIO_DBG_MSG_TRACE_CONFIG_GET";
+   case DSL_FIO_DBG_MSG_TRACE_GET:
+      return "DSL_FIO_DBG_MSG_TRACE_GET";
+   case DSL_FIO_DBG_TRACE_CONFIG_SET:
+      return "DSL_FIO_DBG_TRACE_CONFIG_SET";
+   case DSL_FIO_DBG_TRACE_CONFIG_GET:
+      return "DSL_FIO_DBG_TRACE_CONFIG_GET";
+   case DSL_FIO_DBG_TRACE_GET:
+      return "DSL_FIO_DBG_TRACE_GET";
+   case DSL_FIO_MSG_STATISTICS_GET:
+      return "DSL_FIO_MSG_STATISTICS_GET";
+   case DSL_FIO_MSG_STATISTICS_RESET:
+      return "DSL_FIO_MSG_STATISTICS_RESET";
+   case DSL_FIO_BRINGUP_TIMING_GET:
+      return "DSL_FIO_BRINGUP_TIMING_GET";
+   case DSL_FIO_RESTART_STATISTICS_GET:
+      return "DSL_FIO_RESTART_STATISTICS_GET";
    case DSL_FIO_DBG_DEVICE_MESSAGE_MODIFY_SEND:
       return "DSL_FIO_DBG_DEVICE_MESSAGE_MODIFY_SEND";
    case DSL_FIO_TEST_MODE_CONTROL_SET:
@@ -305,6 +376,10 @@ DSL_char_t* DSL_DBG_IoctlName(DSL_uint_t nIoctlCode)
       return "DSL_FIO_G997_GAIN_ALLOCATION_NSC_GET";
    case DSL_FIO_G997_SNR_ALLOCATION_NSC_GET:
       return "DSL_FIO_G997_SNR_ALLOCATION_NSC_GET";
+   case DSL_FIO_G997_PER_TONE_WINDOW_GET:
+      return "DSL_FIO_G997_PER_TONE_WINDOW_GET";
+   case DSL_FIO_G997_PER_TONE_EXPORT:
+      return "DSL_FIO_G997_PER_TONE_EXPORT";
    case DSL_FIO_G997_ALARM_MASK_LINE_FAILURES_CONFIG_SET:
       return "DSL_FIO_G997_ALARM_MASK_LINE_FAILURES_CONFIG_SET";
    case DSL_FIO_G997_ALARM_MASK_LINE_FAILURES_CONFIG_GET:
@@ -339,6 +414,12 @@ DSL_char_t* DSL_DBG_IoctlName(DSL_uint_t nIoctlCode)
       return "DSL_FIO_G997_SNMP_MESSAGE_SEND";
    case DSL_FIO_G997_SNMP_MESSAGE_RECEIVE:
       return "DSL_FIO_G997_SNMP_MESSAGE_RECEIVE";
+   case DSL_FIO_G997_SNMP_STATISTICS_GET:
+      return "DSL_FIO_G997_SNMP_STATISTICS_GET";
+   case DSL_FIO_G997_SNMP_MESSAGE_QUEUE:
+      return "DSL_FIO_G997_SNMP_MESSAGE_QUEUE";
+   case DSL_FIO_G997_SNMP_TX_STATUS_GET:
+      return "DSL_FIO_G997_SNMP_TX_STATUS_GET";
    case DSL_FIO_G997_RATE_ADAPTATION_CONFIG_SET:
       return "DSL_FIO_G997_RATE_ADAPTATION_CONFIG_SET";
    case DSL_FIO_G997_RATE_ADAPTATION_CONFIG_GET:
@@ -502,6 +583,10 @@ DSL_char_t* DSL_DBG_IoctlName(DSL_uint_t nIoctlCode)
       return "DSL_FIO_PM_RETX_THRESHOLDS_1DAY_SET";
    case DSL_FIO_PM_SYNC_MODE_GET:
       return "DSL_FIO_PM_SYNC_MODE_GET";
+   case DSL_FIO_PM_STATISTICS_GET:
+      return "DSL_FIO_PM_STATISTICS_GET";
+   case DSL_FIO_PM_GROUP_COUNTERS_GET:
+      return "DSL_FIO_PM_GROUP_COUNTERS_GET";
 #endif /* #if defined(INCLUDE_DSL_PM)*/
 
 #ifdef INCLUDE_REAL_TIME_TRACE
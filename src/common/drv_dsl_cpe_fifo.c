@@ -40,7 +40,7 @@
    if (p == pFifo->pEnd)         \
       p = pFifo->pStart;         \
    else                          \
-      p = (DSL_void_t*)(((DSL_uint_t)p) + pFifo->size); \
+      p = (DSL_void_t*)(((DSL_uint8_t*)p) + pFifo->size); \
 }
 
 /* decrement FIFO index */
@@ -49,7 +49,7 @@
    if (p == pFifo->pStart)       \
       p = pFifo->pEnd;           \
    else                          \
-      p = (DSL_void_t*)(((DSL_uint_t)p) - pFifo->size); \
+      p = (DSL_void_t*)(((DSL_uint8_t*)p) - pFifo->size); \
 }
 
 /* ============================= */
@@ -91,12 +91,12 @@ DSL_int8_t DSL_Fifo_Init (DSL_FIFO* pFifo, DSL_void_t* pStart, DSL_void_t* pEnd,
    pFifo->size   = elSize;
    pFifo->count  = 0;
 
-   if (((DSL_uint32_t)pFifo->pEnd - (DSL_uint32_t)pFifo->pStart) % elSize != 0)
+   if ((DSL_uint32_t)((DSL_uint8_t*)pFifo->pEnd - (DSL_uint8_t*)pFifo->pStart) % elSize != 0)
    {
       /* element size must be a multiple of fifo memory */
       return -1;
    }
-   pFifo->nMaxSize = ((DSL_uint32_t)pFifo->pEnd - (DSL_uint32_t)pFifo->pStart) / elSize + 1;
+   pFifo->nMaxSize = (DSL_uint32_t)((DSL_uint8_t*)pFifo->pEnd - (DSL_uint8_t*)pFifo->pStart) / elSize + 1;
 
    return 0;
 }
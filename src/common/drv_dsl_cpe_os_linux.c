@@ -20,6 +20,10 @@
 #include "drv_dsl_cpe_debug.h"
 
 #include <linux/device.h>
+#include <linux/highmem.h> /* kmap */
+#ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
+#include <linux/workqueue.h>
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
 
 #include "drv_mei_cpe_api_intern.h" /* MEI_InternalDevLayout */
 
@@ -60,8 +64,51 @@ static int DSL_DRV_Release(DSL_DRV_inode_t * ino, DSL_DRV_file_t * fil);
 static DSL_uint_t DSL_DRV_Poll(DSL_DRV_file_t *pFile, DSL_DRV_Poll_Table_t *wait);
 
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
-static void DSL_DRV_NlSendMsg(DSL_char_t* pMsg);
-#endif
+#ifndef DSL_DEBUG_DISABLE
+/** Size of a netlink logger staging buffer [bytes] */
+#define DSL_DRV_NL_LOG_BUF_SIZE        2048
+/** Size of the completed lines which triggers the immediate sending [bytes] */
+#define DSL_DRV_NL_LOG_FLUSH_SIZE      1024
+/** Delay for sending the completed lines of a partially filled buffer [ms] */
+#define DSL_DRV_NL_LOG_FLUSH_DELAY     20
+/** Number of staging buffers, one per line and one for the debug output
+    without line context */
+#define DSL_DRV_NL_LOG_BUF_NUM         (DSL_DRV_MAX_SUPPORTED_ENTITIES + 1)
+
+/**
+   Netlink logger staging buffer. The debug output fragments are collected
+   here and the completed lines are sent as netlink messages, one message per
+   line or, with INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING, as the records
+   (NLM_F_MULTI) of one netlink message.
+*/
+typedef struct
+{
+   /** Buffer access lock, the debug output may be generated in atomic
+       context */
+   spinlock_t bufLock;
+   /** Delayed sending of the completed lines */
+   struct delayed_work flushWork;
+   /** Number of used bytes */
+   DSL_uint32_t nFill;
+   /** Number of bytes of the completed lines */
+   DSL_uint32_t nLineEnd;
+   /** Buffered debug output */
+   DSL_char_t buf[DSL_DRV_NL_LOG_BUF_SIZE];
+} DSL_DRV_NlLogBuffer_t;
+
+static DSL_DRV_NlLogBuffer_t DSL_DRV_NlLogBuf[DSL_DRV_NL_LOG_BUF_NUM];
+
+/** Number of debug output lines dropped by the netlink logger */
+static atomic_t nl_log_dropped = ATOMIC_INIT(0);
+
+static void DSL_DRV_NlLogInit(void);
+static void DSL_DRV_NlLogCleanup(void);
+static DSL_int_t DSL_DRV_NlLogAppend(
+   DSL_Context_t const *pContext,
+   DSL_char_t const *fmt,
+   va_list ap);
+#endif /* DSL_DEBUG_DISABLE */
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
 
 /*DSL_int_t DSL_DRV_Ioctls(DSL_DRV_inode_t * pINode, DSL_DRV_file_t * pFile,
                            unsigned long nCommand, unsigned long nArg);*/
@@ -414,36 +461,23 @@ int DSL_DRV_debug_printf(DSL_Context_t const *pContext, DSL_char_t const *fmt, .
    DSL_boolean_t bPrint = DSL_FALSE;
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
 #ifndef DSL_DEBUG_DISABLE
-   DSL_char_t debugString[DSL_DBG_MAX_DEBUG_PRINT_CHAR + 1] = {0};
    va_list ap;   /* points to each unnamed arg in turn */
 
    if (bPrint == DSL_FALSE)
    {
-      /* add the debug string itself */
       va_start(ap, fmt);   /* set ap pointer to 1st unnamed arg */
-      nRet = vsnprintf(&debugString[0], DSL_DBG_MAX_DEBUG_PRINT_CHAR, fmt, ap);
-      va_end(ap);
 
-      if (nRet < 0)
-      {
-         nLength = DSL_DBG_MAX_DEBUG_PRINT_CHAR;
-         printk(KERN_ERR "DSL CPE API: WARNING - printout truncated in "
-                        "'DSL_DRV_debug_printf'!" DSL_DRV_CRLF );
-      }
-      else
-      {
-         nLength = nRet;
-      }
-
-      /* send the formed string to the logger */
       if (DSL_g_dbgDestination == DSL_DBG_DST_CONSOLE)
       {
-         nRet = printk("%s",debugString);      
+         nRet = vprintk(fmt, ap);
       }
       else
       {
-         DSL_DRV_NlSendMsg(debugString);
+         /* format directly into the logger staging buffer */
+         nRet = DSL_DRV_NlLogAppend(pContext, fmt, ap);
       }
+
+      va_end(ap);
    }
 #endif /* DSL_DEBUG_DISABLE */
    return nRet;
@@ -610,6 +644,188 @@ DSL_void_t* DSL_IoctlMemCpyTo(
    return pRet;
 }
 
+/*
+   Mapping of a user space memory block, see DSL_DRV_UserBufferMap
+*/
+typedef struct
+{
+   /** Pinned pages of a user space block, DSL_NULL for a kernel block*/
+   struct page **ppPages;
+   /** Number of pinned pages*/
+   unsigned long nPages;
+   /** Start address of the memory block*/
+   DSL_uint8_t *pSrc;
+   /** Size of the memory block*/
+   DSL_DRV_size_t nSize;
+} DSL_DRV_UserBufferMap_t;
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_UserBufferMap(
+   DSL_boolean_t bIsInKernel,
+   DSL_void_t    *pSrc,
+   DSL_DRV_size_t    nSize)
+{
+   DSL_DRV_UserBufferMap_t *pMap = DSL_NULL;
+   unsigned long nStart, nOffset, nPages;
+   DSL_int_t nPinned = 0, i;
+
+   if ((pSrc == DSL_NULL) || (nSize == 0) ||
+       (nSize > DSL_DRV_USER_BUFFER_MAP_SIZE_MAX))
+   {
+      return DSL_NULL;
+   }
+
+   nStart  = (unsigned long)pSrc & PAGE_MASK;
+   nOffset = (unsigned long)pSrc & ~PAGE_MASK;
+
+   /* Reject blocks which wrap around the end of the address space*/
+   if (((nOffset + nSize) < nOffset) ||
+       (((unsigned long)pSrc + nSize) < (unsigned long)pSrc))
+   {
+      return DSL_NULL;
+   }
+
+   pMap = (DSL_DRV_UserBufferMap_t*)kmalloc(sizeof(DSL_DRV_UserBufferMap_t),
+      GFP_KERNEL);
+   if (pMap == DSL_NULL)
+   {
+      return DSL_NULL;
+   }
+
+   pMap->pSrc    = (DSL_uint8_t*)pSrc;
+   pMap->nSize   = nSize;
+   pMap->ppPages = DSL_NULL;
+   pMap->nPages  = 0;
+
+   if (bIsInKernel == DSL_TRUE)
+   {
+      return pMap;
+   }
+
+   nPages = (nOffset + nSize + PAGE_SIZE - 1) >> PAGE_SHIFT;
+   pMap->ppPages = (struct page **)vmalloc(nPages * sizeof(struct page *));
+
+   if (pMap->ppPages != DSL_NULL)
+   {
+      /* Pin the pages for read access, the caller's buffer is not modified.
+         The size limit keeps the page count within the int range*/
+      nPinned = get_user_pages_fast(nStart, (DSL_int_t)nPages, 0,
+                   pMap->ppPages);
+      if ((nPinned > 0) && ((unsigned long)nPinned == nPages))
+      {
+         pMap->nPages = nPages;
+      }
+   }
+
+   if (pMap->nPages == 0)
+   {
+      for (i = 0; i < nPinned; i++)
+      {
+         put_page(pMap->ppPages[i]);
+      }
+
+      if (pMap->ppPages != DSL_NULL)
+      {
+         vfree(pMap->ppPages);
+      }
+      kfree(pMap);
+
+      return DSL_NULL;
+   }
+
+   return pMap;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_UserBufferChunkMap(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset,
+   DSL_DRV_size_t    *pnSize)
+{
+   DSL_DRV_UserBufferMap_t *pMap = (DSL_DRV_UserBufferMap_t*)pHandle;
+   unsigned long nPos, nPageOffset;
+
+   if ((pMap == DSL_NULL) || (nOffset >= pMap->nSize) || (*pnSize == 0))
+   {
+      return DSL_NULL;
+   }
+
+   if (*pnSize > pMap->nSize - nOffset)
+   {
+      *pnSize = pMap->nSize - nOffset;
+   }
+
+   if (pMap->ppPages == DSL_NULL)
+   {
+      return pMap->pSrc + nOffset;
+   }
+
+   /* Only the page of the chunk is mapped*/
+   nPos        = ((unsigned long)pMap->pSrc & ~PAGE_MASK) + nOffset;
+   nPageOffset = nPos & ~PAGE_MASK;
+
+   if (*pnSize > (PAGE_SIZE - nPageOffset))
+   {
+      *pnSize = PAGE_SIZE - nPageOffset;
+   }
+
+   return (DSL_uint8_t*)kmap(pMap->ppPages[nPos >> PAGE_SHIFT]) + nPageOffset;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_UserBufferChunkUnmap(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset)
+{
+   DSL_DRV_UserBufferMap_t *pMap = (DSL_DRV_UserBufferMap_t*)pHandle;
+   unsigned long nPos;
+
+   if ((pMap == DSL_NULL) || (pMap->ppPages == DSL_NULL) ||
+       (nOffset >= pMap->nSize))
+   {
+      return;
+   }
+
+   nPos = ((unsigned long)pMap->pSrc & ~PAGE_MASK) + nOffset;
+   kunmap(pMap->ppPages[nPos >> PAGE_SHIFT]);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_UserBufferUnmap(
+   DSL_void_t    *pHandle)
+{
+   DSL_DRV_UserBufferMap_t *pMap = (DSL_DRV_UserBufferMap_t*)pHandle;
+   unsigned long i;
+
+   if (pMap == DSL_NULL)
+   {
+      return;
+   }
+
+   for (i = 0; i < pMap->nPages; i++)
+   {
+      put_page(pMap->ppPages[i]);
+   }
+
+   if (pMap->ppPages != DSL_NULL)
+   {
+      vfree(pMap->ppPages);
+   }
+   kfree(pMap);
+}
+
 #ifndef INCLUDE_DSL_CPE_API_IFXOS_SUPPORT
 /**
    LINUX Kernel - Thread stub function. The stub function will be called
@@ -732,8 +948,8 @@ DSL_int32_t DSL_DRV_ThreadInit(
                DSL_DRV_ThreadFunction_t pThreadFunction,
                DSL_uint32_t   nStackSize,
                DSL_uint32_t   nPriority,
-               DSL_uint32_t   nArg1,
-               DSL_uint32_t   nArg2)
+               DSL_ulong_t    nArg1,
+               DSL_ulong_t    nArg2)
 {
    if(pThrCntrl)
    {
@@ -968,6 +1184,28 @@ DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset)
    return (nTime - nOffset);
 }
 
+/**
+   Returns the monotonic system time with nanosecond resolution.
+
+   \param pSec   Seconds part of the time, [O]
+   \param pNSec  Nanoseconds part of the time, [O]
+*/
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec)
+{
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(3,17,0))
+   struct timespec64 ts;
+
+   ktime_get_ts64(&ts);
+#else
+   struct timespec ts;
+
+   ktime_get_ts(&ts);
+#endif
+
+   *pSec  = (DSL_uint32_t)ts.tv_sec;
+   *pNSec = (DSL_uint32_t)ts.tv_nsec;
+}
+
 #ifndef INCLUDE_DSL_CPE_API_IFXOS_SUPPORT
 #define DSL_DRV_RESOLUTION_MS    (1000LL / HZ)
 #if (DSL_DRV_RESOLUTION_MS > 1)
@@ -1198,52 +1436,306 @@ static void DSL_DRV_DebugInit(void)
          /* Nothing to do */
          break;
    }
+
+#ifdef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS
+   /* Apply the initial debug levels to the debug static keys*/
+   DSL_DRV_DBG_StaticKeysUpdate();
+#endif /* INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS*/
 #endif /* #ifndef DSL_DEBUG_DISABLE*/
 
    return;
 }
 
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
-static void DSL_DRV_NlSendMsg(DSL_char_t* pMsg)
+#ifndef DSL_DEBUG_DISABLE
+/*
+   Returns the length of the line starting at pLine including the line end.
+*/
+static DSL_uint32_t DSL_DRV_NlLogLineLen(DSL_char_t const *pLine, DSL_uint32_t nMax)
+{
+   DSL_char_t const *pEnd = memchr(pLine, '\n', nMax);
+
+   return (pEnd != DSL_NULL) ? (DSL_uint32_t)(pEnd - pLine) + 1 : nMax;
+}
+
+#ifndef INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING
+/*
+   Returns a netlink message with the given text as payload, DSL_NULL if no
+   message can be allocated.
+*/
+static struct sk_buff* DSL_DRV_NlLogSkbGet(DSL_char_t const *pText, DSL_uint32_t nLen)
 {
    struct nlmsghdr *pNlMsgHdr;
    struct sk_buff *pSkbOut;
-   DSL_int_t nMsgSize = 0;
 
-   if(pMsg == IFX_NULL)
+   pSkbOut = alloc_skb(nlmsg_total_size(nLen + 1), GFP_ATOMIC);
+   if (!pSkbOut)
+   {
+      return DSL_NULL;
+   }
+
+   pNlMsgHdr = nlmsg_put(pSkbOut, 0, 0, NLMSG_DONE, nLen + 1, 0);
+   if (!pNlMsgHdr)
+   {
+      kfree_skb(pSkbOut);
+      return DSL_NULL;
+   }
+   memcpy(nlmsg_data(pNlMsgHdr), pText, nLen);
+   ((DSL_char_t *)nlmsg_data(pNlMsgHdr))[nLen] = '\0';
+
+   return pSkbOut;
+}
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING */
+
+/*
+   Moves the completed lines (or the whole content if bAll is set) of the
+   staging buffer into netlink messages which are added to pQueue. Each line
+   becomes its own netlink message, with INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING
+   the lines become the records of one netlink message (the logger
+   application has to walk all records). The buffer lock has to be held, the
+   messages are sent by DSL_DRV_NlLogSend() after it is released.
+*/
+static void DSL_DRV_NlLogFlush(
+   DSL_DRV_NlLogBuffer_t *pBuf,
+   DSL_boolean_t bAll,
+   struct sk_buff_head *pQueue)
+{
+   struct sk_buff *pSkbOut = DSL_NULL;
+#ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING
+   struct nlmsghdr *pNlMsgHdr;
+   DSL_uint32_t nSize = 0, nRecords = 0;
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING */
+   DSL_uint32_t nEnd, nPos, nLen, nDropped = 0;
+
+   nEnd = (bAll == DSL_TRUE) ? pBuf->nFill : pBuf->nLineEnd;
+   if (nEnd == 0)
    {
-      printk("ERROR: Debug string is empty!\n");
       return;
    }
 
-   nMsgSize = strlen(pMsg);
+#ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING
+   for (nPos = 0; nPos < nEnd; nPos += nLen)
+   {
+      nLen = DSL_DRV_NlLogLineLen(&pBuf->buf[nPos], nEnd - nPos);
+      nSize += nlmsg_total_size(nLen + 1);
+      nRecords++;
+   }
 
-   pSkbOut = nlmsg_new(nMsgSize, GFP_KERNEL);
+   if (nl_debug_sock)
+   {
+      pSkbOut = alloc_skb(nSize, GFP_ATOMIC);
+   }
 
    if (!pSkbOut)
    {
-      printk("Failed to allocate new skb\n");
-      return;
+      nDropped = nRecords;
    }
-   pNlMsgHdr = nlmsg_put(pSkbOut, 0, 0, NLMSG_DONE, nMsgSize, 0);
-   NETLINK_CB(pSkbOut).dst_group = NL_DBG_MSG_GROUP;
-   strncpy(nlmsg_data(pNlMsgHdr), pMsg, nMsgSize);
+   else
+   {
+      for (nPos = 0; nPos < nEnd; nPos += nLen)
+      {
+         nLen = DSL_DRV_NlLogLineLen(&pBuf->buf[nPos], nEnd - nPos);
+         pNlMsgHdr = nlmsg_put(pSkbOut, 0, 0, NLMSG_DONE, nLen + 1, NLM_F_MULTI);
+         if (!pNlMsgHdr)
+         {
+            nDropped++;
+            continue;
+         }
+         memcpy(nlmsg_data(pNlMsgHdr), &pBuf->buf[nPos], nLen);
+         ((DSL_char_t *)nlmsg_data(pNlMsgHdr))[nLen] = '\0';
+      }
 
-	if (!nl_debug_sock) {
-		kfree_skb(pSkbOut);
-      printk("Failed to free skb\n");
-      return;
-	}
-   
-   nlmsg_multicast(nl_debug_sock, pSkbOut, 0, NL_DBG_MSG_GROUP, GFP_KERNEL);
+      __skb_queue_tail(pQueue, pSkbOut);
+   }
+#else
+   for (nPos = 0; nPos < nEnd; nPos += nLen)
+   {
+      nLen = DSL_DRV_NlLogLineLen(&pBuf->buf[nPos], nEnd - nPos);
+
+      pSkbOut = nl_debug_sock ? DSL_DRV_NlLogSkbGet(&pBuf->buf[nPos], nLen) :
+                                DSL_NULL;
+      if (!pSkbOut)
+      {
+         nDropped++;
+         continue;
+      }
+
+      __skb_queue_tail(pQueue, pSkbOut);
+   }
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING */
+
+   if (nDropped)
+   {
+      atomic_add(nDropped, &nl_log_dropped);
+   }
+
+   /* keep the not completed line */
+   memmove(&pBuf->buf[0], &pBuf->buf[nEnd], pBuf->nFill - nEnd);
+   pBuf->nFill   -= nEnd;
+   pBuf->nLineEnd = 0;
 }
+
+/*
+   Sends the netlink messages of pQueue, called without the buffer lock.
+*/
+static void DSL_DRV_NlLogSend(struct sk_buff_head *pQueue)
+{
+   struct sk_buff *pSkbOut;
+
+   while ((pSkbOut = __skb_dequeue(pQueue)) != DSL_NULL)
+   {
+      NETLINK_CB(pSkbOut).dst_group = NL_DBG_MSG_GROUP;
+      nlmsg_multicast(nl_debug_sock, pSkbOut, 0, NL_DBG_MSG_GROUP, GFP_ATOMIC);
+   }
+}
+
+static void DSL_DRV_NlLogFlushWork(struct work_struct *pWork)
+{
+   DSL_DRV_NlLogBuffer_t *pBuf = container_of(to_delayed_work(pWork),
+                                    DSL_DRV_NlLogBuffer_t, flushWork);
+   struct sk_buff_head queue;
+   unsigned long nFlags;
+
+   __skb_queue_head_init(&queue);
+
+   spin_lock_irqsave(&pBuf->bufLock, nFlags);
+   DSL_DRV_NlLogFlush(pBuf, DSL_FALSE, &queue);
+   spin_unlock_irqrestore(&pBuf->bufLock, nFlags);
+
+   DSL_DRV_NlLogSend(&queue);
+}
+
+static DSL_int_t DSL_DRV_NlLogAppend(
+   DSL_Context_t const *pContext,
+   DSL_char_t const *fmt,
+   va_list ap)
+{
+   DSL_DRV_NlLogBuffer_t *pBuf;
+   DSL_uint32_t nBuf = DSL_DRV_NL_LOG_BUF_NUM - 1, i;
+   DSL_int_t nRet;
+   va_list apCopy;
+   struct sk_buff_head queue;
+   unsigned long nFlags;
+
+   if ((pContext != DSL_NULL) && (pContext->pDevCtx != DSL_NULL) &&
+       (pContext->pDevCtx->nNum < DSL_DRV_MAX_SUPPORTED_ENTITIES))
+   {
+      nBuf = pContext->pDevCtx->nNum;
+   }
+   pBuf = &DSL_DRV_NlLogBuf[nBuf];
+
+   __skb_queue_head_init(&queue);
+
+   spin_lock_irqsave(&pBuf->bufLock, nFlags);
+
+   va_copy(apCopy, ap);
+   nRet = vsnprintf(&pBuf->buf[pBuf->nFill],
+                    DSL_DRV_NL_LOG_BUF_SIZE - pBuf->nFill, fmt, apCopy);
+   va_end(apCopy);
+
+   if ((nRet >= 0) && ((DSL_uint32_t)nRet >= DSL_DRV_NL_LOG_BUF_SIZE - pBuf->nFill))
+   {
+      /* not enough space left, send the buffered output first */
+      DSL_DRV_NlLogFlush(pBuf, DSL_TRUE, &queue);
+
+      nRet = vsnprintf(&pBuf->buf[0], DSL_DRV_NL_LOG_BUF_SIZE, fmt, ap);
+      if (nRet >= DSL_DRV_NL_LOG_BUF_SIZE)
+      {
+         nRet = DSL_DRV_NL_LOG_BUF_SIZE - 1;
+      }
+   }
+
+   if (nRet > 0)
+   {
+      for (i = pBuf->nFill + nRet; i > pBuf->nFill; i--)
+      {
+         if (pBuf->buf[i - 1] == '\n')
+         {
+            pBuf->nLineEnd = i;
+            break;
+         }
+      }
+      pBuf->nFill += nRet;
+   }
+
+   if (pBuf->nLineEnd >= DSL_DRV_NL_LOG_FLUSH_SIZE)
+   {
+      DSL_DRV_NlLogFlush(pBuf, DSL_FALSE, &queue);
+   }
+   else if (pBuf->nLineEnd > 0)
+   {
+      schedule_delayed_work(&pBuf->flushWork,
+         msecs_to_jiffies(DSL_DRV_NL_LOG_FLUSH_DELAY));
+   }
+
+   spin_unlock_irqrestore(&pBuf->bufLock, nFlags);
+
+   DSL_DRV_NlLogSend(&queue);
+
+   return nRet;
+}
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,36))
+/*
+   Reads the nl_log_dropped counter for the module parameter.
+*/
+static int DSL_DRV_NlLogDroppedGet(char *pBuffer, const struct kernel_param *pKp)
+{
+   return sprintf(pBuffer, "%u", (unsigned int)atomic_read(&nl_log_dropped));
+}
+
+static const struct kernel_param_ops DSL_DRV_NlLogDroppedOps =
+{
+   .get = DSL_DRV_NlLogDroppedGet,
+};
 #endif
 
+static void DSL_DRV_NlLogInit(void)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < DSL_DRV_NL_LOG_BUF_NUM; i++)
+   {
+      spin_lock_init(&DSL_DRV_NlLogBuf[i].bufLock);
+      INIT_DELAYED_WORK(&DSL_DRV_NlLogBuf[i].flushWork, DSL_DRV_NlLogFlushWork);
+      DSL_DRV_NlLogBuf[i].nFill    = 0;
+      DSL_DRV_NlLogBuf[i].nLineEnd = 0;
+   }
+}
+
+static void DSL_DRV_NlLogCleanup(void)
+{
+   DSL_uint32_t i;
+   struct sk_buff_head queue;
+   unsigned long nFlags;
+
+   __skb_queue_head_init(&queue);
+
+   for (i = 0; i < DSL_DRV_NL_LOG_BUF_NUM; i++)
+   {
+      cancel_delayed_work_sync(&DSL_DRV_NlLogBuf[i].flushWork);
+
+      spin_lock_irqsave(&DSL_DRV_NlLogBuf[i].bufLock, nFlags);
+      DSL_DRV_NlLogFlush(&DSL_DRV_NlLogBuf[i], DSL_TRUE, &queue);
+      spin_unlock_irqrestore(&DSL_DRV_NlLogBuf[i].bufLock, nFlags);
+
+      DSL_DRV_NlLogSend(&queue);
+   }
+}
+#endif /* DSL_DEBUG_DISABLE */
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
+
 /* Entry point of driver */
 int __init DSL_ModuleInit(void)
 {
    DSL_int_t i;
 
+#ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
+#ifndef DSL_DEBUG_DISABLE
+   DSL_DRV_NlLogInit();
+#endif /* DSL_DEBUG_DISABLE */
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
+
    printk(DSL_DRV_CRLF DSL_DRV_CRLF "Lantiq CPE API Driver version: %s" DSL_DRV_CRLF,
       &(dsl_cpe_api_version[4]));
 
@@ -1297,6 +1789,20 @@ int __init DSL_ModuleInit(void)
       new modules insert */
    DSL_DRV_DebugInit();
 
+   /* Initialize the firmware image cache shared by all lines*/
+   DSL_DRV_FwCacheInit();
+   DSL_DRV_BringUpInit();
+
+#ifdef INCLUDE_DSL_DELT
+   /* Initialize the DELT buffer pool shared by all lines*/
+   DSL_DRV_G997_DeltPoolInit();
+#endif /* INCLUDE_DSL_DELT*/
+
+#if defined(INCLUDE_DSL_PM)
+   /* Initialize the bonding group PM counters shared by all lines*/
+   DSL_DRV_PM_GroupInit();
+#endif /* #if defined(INCLUDE_DSL_PM)*/
+
    /* Get handles for lower level driver */
    for (i = 0; i < g_MaxEntieties; i++)
    {
@@ -1343,6 +1849,13 @@ void __exit DSL_ModuleCleanup(void)
    
    DSL_DRV_Cleanup();
 
+#ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
+#ifndef DSL_DEBUG_DISABLE
+   /* send the remaining debug output */
+   DSL_DRV_NlLogCleanup();
+#endif /* DSL_DEBUG_DISABLE */
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
+
    return;
 }
 
@@ -1360,6 +1873,14 @@ module_param(debug_level, byte, 0);
 module_param(g_MaxDeviceNumber, byte, 0);
 module_param(g_LinesPerDevice, byte, 0);
 module_param(g_ChannelsPerLine, byte, 0);
+#ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
+#ifndef DSL_DEBUG_DISABLE
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,36))
+module_param_cb(nl_log_dropped, &DSL_DRV_NlLogDroppedOps, DSL_NULL, 0444);
+MODULE_PARM_DESC(nl_log_dropped, "number of debug lines dropped by the netlink logger");
+#endif
+#endif /* DSL_DEBUG_DISABLE */
+#endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
 
 #endif
 MODULE_PARM_DESC(debug_level, "set to get more (1) or fewer (4) debug outputs");
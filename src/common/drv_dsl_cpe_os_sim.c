@@ -0,0 +1,957 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+#if defined(DSL_CPE_SIMULATOR_DRIVER) && !defined(__KERNEL__)
+
+#define DSL_INTERN
+
+#include "drv_dsl_cpe_api.h"
+#include "drv_dsl_cpe_api_ioctl.h"
+
+#include "drv_dsl_cpe_intern.h"
+#include "drv_dsl_cpe_intern_mib.h"
+
+#include "drv_dsl_cpe_debug.h"
+
+#undef DSL_DBG_BLOCK
+#define DSL_DBG_BLOCK DSL_DBG_OS
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#define DSL_DRV_STATIC
+
+static const char* dsl_cpe_api_version = "@(#)DSL CPE API V" DSL_CPE_API_PACKAGE_VERSION;
+
+/* global parameter debug_level: LOW (1), NORMAL (2), HIGH (3), OFF (4) */
+#ifdef DSL_DBG_MAX_LEVEL
+   #if (DSL_DBG_MAX_LEVEL >= DSL_DBGLVL_MSG)
+      DSL_DRV_STATIC DSL_uint8_t debug_level = 1;
+   #elif (DSL_DBG_MAX_LEVEL >= DSL_DBGLVL_WRN)
+      DSL_DRV_STATIC DSL_uint8_t debug_level = 2;
+   #elif (DSL_DBG_MAX_LEVEL >= DSL_DBGLVL_ERR)
+      DSL_DRV_STATIC DSL_uint8_t debug_level = 3;
+   #else
+      DSL_DRV_STATIC DSL_uint8_t debug_level = 4;
+   #endif
+#else
+   /* Activate high level by default */
+   DSL_DRV_STATIC DSL_uint8_t debug_level = 3;
+#endif
+
+DSL_uint8_t g_MaxDeviceNumber = -1;
+DSL_uint8_t g_LinesPerDevice = -1;
+DSL_uint8_t g_ChannelsPerLine = -1;
+
+DSL_uint8_t g_MaxEntieties = 1;
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_void_t* DSL_DRV_SIM_Open(DSL_int_t nNum)
+{
+   DSL_OpenContext_t *pOpenCtx = DSL_NULL;
+
+   DSL_DEBUG(DSL_DBG_MSG, (DSL_NULL, SYS_DBG_MSG"Device will be opened..."DSL_DRV_CRLF));
+
+   if ((nNum < 0) || (nNum >= DSL_DRV_ENTITIES))
+   {
+      return DSL_NULL;
+   }
+
+   if ( DSL_DRV_HandleInit(nNum, &pOpenCtx) != DSL_SUCCESS )
+   {
+      return DSL_NULL;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG, (DSL_NULL, SYS_DBG_MSG"Open successfull..."DSL_DRV_CRLF));
+
+   return (DSL_void_t*)pOpenCtx;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_int_t DSL_DRV_SIM_Close(DSL_void_t *pHandle)
+{
+   DSL_DEBUG(DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"Device will be closed..."DSL_DRV_CRLF));
+
+   if (pHandle == DSL_NULL)
+   {
+      return -EIO;
+   }
+
+   DSL_DRV_HandleDelete((DSL_OpenContext_t*)pHandle);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"Close successfull..."DSL_DRV_CRLF));
+
+   return 0;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_ssize_t DSL_DRV_SIM_Write(
+   DSL_void_t *pHandle,
+   const DSL_char_t *pBuf,
+   DSL_DRV_size_t nSize)
+{
+   DSL_Error_t nErrCode = DSL_ERROR;
+   DSL_OpenContext_t *pOpenCtx = (DSL_OpenContext_t*)pHandle;
+   DSL_int32_t nLoff = 0;
+   DSL_uint32_t nOffset = 0;
+
+   if (pOpenCtx == DSL_NULL)
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"Instance handle is NULL"DSL_DRV_CRLF));
+      return -EIO;
+   }
+
+   if (pOpenCtx->pDevCtx == DSL_NULL)
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"Device context pointer is NULL"DSL_DRV_CRLF));
+      return -EIO;
+   }
+
+   pOpenCtx->pDevCtx->bFirmwareReady = DSL_FALSE;
+
+   nErrCode = DSL_DRV_DEV_FwDownload(pOpenCtx->pDevCtx->pContext,
+      pBuf, (DSL_uint32_t)nSize, DSL_NULL, 0, &nLoff,
+      (DSL_int32_t*)&nOffset, DSL_TRUE, DSL_TRUE);
+
+   if (nErrCode != DSL_SUCCESS)
+      return -EIO;
+
+   pOpenCtx->pDevCtx->bFirmwareReady = DSL_TRUE;
+
+   DSL_DEBUG(DSL_DBG_MSG, (DSL_NULL, SYS_DBG_MSG"Firmware was downloaded successfully "
+                                    "%d bytes has written..."DSL_DRV_CRLF, nOffset));
+   return (DSL_ssize_t)nOffset;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_int_t DSL_DRV_SIM_Ioctl(
+   DSL_void_t *pHandle,
+   DSL_uint_t nCommand,
+   DSL_ulong_t nArg)
+{
+   DSL_int_t nErr = 0;
+   DSL_Error_t nRetCode = DSL_SUCCESS;
+   DSL_Context_t *pContext;
+   DSL_OpenContext_t *pOpenCtx = (DSL_OpenContext_t*)pHandle;
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"DSL: IN - DSL_DRV_SIM_Ioctl: The ioctl "
+      "command(0x%X) is called" DSL_DRV_CRLF, nCommand));
+
+   if ((pOpenCtx == DSL_NULL) || (pOpenCtx->pDevCtx == DSL_NULL) ||
+       ((pContext = pOpenCtx->pDevCtx->pContext) == DSL_NULL))
+   {
+      /* This should never happen */
+      DSL_DEBUG(DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"DSL: Ioctl call for instance which was not "
+         "opened correctly" DSL_DRV_CRLF));
+
+      return -EFAULT;
+   }
+
+   /* There is a single address space, the argument is always accessed
+      directly as it is done for the calls from the kernel space */
+   if ( (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_CPE_API) ||
+        (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_CPE_API_G997) ||
+        (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_CPE_API_PM) ||
+        (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_CPE_API_BND) ||
+        (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_CPE_API_DEP) ||
+        (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_CPE_API_RTT) )
+   {
+      nRetCode = DSL_DRV_IoctlHandle(pOpenCtx, pContext, DSL_TRUE, nCommand,
+         nArg);
+
+      if (nRetCode < DSL_SUCCESS)
+      {
+         nErr = DSL_DRV_ErrorToOS(nRetCode);
+      }
+   }
+#if defined(INCLUDE_DSL_ADSL_MIB)
+   else if (_IOC_TYPE(nCommand) == DSL_IOC_MAGIC_MIB)
+   {
+      nRetCode = DSL_DRV_MIB_IoctlHandle(pContext, DSL_TRUE, nCommand,
+         nArg);
+      nErr = nRetCode;
+   }
+#endif
+   else
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL, SYS_DBG_ERR"DSL: The ioctl command(0x%X) is not "
+         "supported!" DSL_DRV_CRLF, nCommand));
+
+      return -ENOTTY;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"DSL: OUT - DSL_DRV_SIM_Ioctl(), retCode=%d"
+      DSL_DRV_CRLF, nErr));
+
+   return nErr;
+}
+
+/*
+   Checks whether an event is available for the instance.
+
+   \param pOpenCtx   Instance context, [I]
+
+   \return
+   1 if an event is available, 0 if not, -1 in case of an error
+*/
+DSL_DRV_STATIC DSL_int_t DSL_DRV_SIM_EventCheck(DSL_OpenContext_t *pOpenCtx)
+{
+   DSL_int_t nRet = 0;
+
+   if(DSL_DRV_MUTEX_LOCK(pOpenCtx->eventMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR, (DSL_NULL, SYS_DBG_ERR"Couldn't lock event mutex"DSL_DRV_CRLF));
+      return -1;
+   }
+
+   if (pOpenCtx->eventFifo == DSL_NULL
+      || pOpenCtx->eventFifoBuf == DSL_NULL
+      || pOpenCtx->bEventActivation == DSL_FALSE)
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (DSL_NULL, SYS_DBG_WRN"!!! Poll call for instance which was not configured"
+                    " for event handling!!!" DSL_DRV_CRLF));
+   }
+   else
+   {
+      if ( DSL_Fifo_isEmpty( pOpenCtx->eventFifo ) == 0 )
+      {
+         nRet = 1; /* an event available */
+      }
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(pOpenCtx->eventMutex);
+
+   return nRet;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_int_t DSL_DRV_SIM_Poll(DSL_void_t *pHandle, DSL_uint32_t nTimeout)
+{
+   DSL_OpenContext_t *pOpenCtx = (DSL_OpenContext_t*)pHandle;
+   DSL_uint32_t nStart, nElapsed;
+   DSL_int_t nRet;
+
+   if (pOpenCtx == DSL_NULL)
+   {
+      return -1;
+   }
+
+   nStart = DSL_DRV_TimeMSecGet();
+
+   for (;;)
+   {
+      nRet = DSL_DRV_SIM_EventCheck(pOpenCtx);
+      if (nRet != 0)
+      {
+         break;
+      }
+
+      if (nTimeout == DSL_DRV_EVENT_WAIT_FOREVER)
+      {
+         DSL_DRV_WAIT_EVENT(pOpenCtx->eventWaitQueue);
+         continue;
+      }
+
+      nElapsed = DSL_DRV_ElapsedTimeMSecGet(nStart);
+      if (nElapsed >= nTimeout)
+      {
+         break;
+      }
+
+      /* a wake up might be left from an event which was already read,
+         so the FIFO is checked again in any case */
+      DSL_DRV_WAIT_EVENT_TIMEOUT(pOpenCtx->eventWaitQueue, nTimeout - nElapsed);
+   }
+
+   return nRet;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+int DSL_DRV_debug_printf(DSL_Context_t const *pContext, DSL_char_t const *fmt, ...)
+{
+   DSL_int_t nRet = 0;
+   va_list ap;   /* points to each unnamed arg in turn */
+
+   va_start(ap, fmt);   /* set ap pointer to 1st unnamed arg */
+   nRet = vfprintf(stdout, fmt, ap);
+   va_end(ap);
+
+   return nRet;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+int DSL_DRV_ErrorToOS(DSL_Error_t nError)
+{
+   switch (nError)
+   {
+      case DSL_ERR_POINTER:
+      case DSL_ERR_INVALID_PARAMETER:
+         return -EINVAL;
+
+      case DSL_ERR_NOT_IMPLEMENTED:
+      case DSL_ERR_NOT_SUPPORTED:
+      case DSL_ERR_NOT_SUPPORTED_BY_DEVICE:
+         return -EOPNOTSUPP;
+
+      case DSL_ERR_NOT_SUPPORTED_BY_FIRMWARE:
+         return -ENOTTY;
+
+      case DSL_ERR_MEMORY:
+         return -ENOMEM;
+
+      case DSL_ERR_FILE_CLOSE:
+      case DSL_ERR_FILE_OPEN:
+      case DSL_ERR_FILE_READ:
+      case DSL_ERR_FILE_WRITE:
+         return -EPERM;
+
+      case DSL_WRN_LAST:
+      case DSL_SUCCESS:
+         return 0;
+
+      case DSL_ERR_INTERNAL:
+      case DSL_ERR_TIMEOUT:
+      case DSL_ERROR:
+      default:
+         return -EFAULT;
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_VMalloc(
+   DSL_DRV_size_t    nSize)
+{
+   return malloc(nSize);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_VFree(
+   DSL_void_t*    pPtr)
+{
+   free(pPtr);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_int_t DSL_DRV_snprintf(
+   DSL_char_t        *pStr,
+   DSL_DRV_size_t        nStrSz,
+   const DSL_char_t  *pFormat,  ...)
+{
+   va_list arg;
+   int rv;
+
+   va_start(arg, pFormat);
+   rv = vsnprintf(pStr, nStrSz, pFormat, arg);
+   va_end(arg);
+
+   return rv;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_IoctlMemCpyFrom(
+   DSL_boolean_t bIsInKernel,
+   DSL_void_t    *pDest,
+   DSL_void_t    *pSrc,
+   DSL_DRV_size_t    nSize)
+{
+   return memcpy(pDest, pSrc, nSize);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_IoctlMemCpyTo(
+   DSL_boolean_t bIsInKernel,
+   DSL_void_t    *pDest,
+   DSL_void_t    *pSrc,
+   DSL_DRV_size_t    nSize)
+{
+   return memcpy(pDest, pSrc, nSize);
+}
+
+/*
+   Mapping of a memory block, see DSL_DRV_UserBufferMap
+*/
+typedef struct
+{
+   /** Start address of the memory block*/
+   DSL_uint8_t *pSrc;
+   /** Size of the memory block*/
+   DSL_DRV_size_t nSize;
+} DSL_DRV_UserBufferMap_t;
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_UserBufferMap(
+   DSL_boolean_t bIsInKernel,
+   DSL_void_t    *pSrc,
+   DSL_DRV_size_t    nSize)
+{
+   DSL_DRV_UserBufferMap_t *pMap;
+
+   if ((pSrc == DSL_NULL) || (nSize == 0) ||
+       (nSize > DSL_DRV_USER_BUFFER_MAP_SIZE_MAX))
+   {
+      return DSL_NULL;
+   }
+
+   /* Single address space, the memory block is used directly*/
+   pMap = (DSL_DRV_UserBufferMap_t*)DSL_DRV_VMalloc(
+      sizeof(DSL_DRV_UserBufferMap_t));
+   if (pMap != DSL_NULL)
+   {
+      pMap->pSrc  = (DSL_uint8_t*)pSrc;
+      pMap->nSize = nSize;
+   }
+
+   return pMap;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_UserBufferChunkMap(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset,
+   DSL_DRV_size_t    *pnSize)
+{
+   DSL_DRV_UserBufferMap_t *pMap = (DSL_DRV_UserBufferMap_t*)pHandle;
+
+   if ((pMap == DSL_NULL) || (nOffset >= pMap->nSize) || (*pnSize == 0))
+   {
+      return DSL_NULL;
+   }
+
+   if (*pnSize > pMap->nSize - nOffset)
+   {
+      *pnSize = pMap->nSize - nOffset;
+   }
+
+   return pMap->pSrc + nOffset;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_UserBufferChunkUnmap(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset)
+{
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_UserBufferUnmap(
+   DSL_void_t    *pHandle)
+{
+   if (pHandle != DSL_NULL)
+   {
+      DSL_DRV_VFree(pHandle);
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_void_t DSL_DRV_EventInit(DSL_DRV_Event_t *pEvent)
+{
+   pthread_condattr_t condAttr;
+
+   pthread_condattr_init(&condAttr);
+   /* the timeouts must not be affected by changes of the wall clock */
+   pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+
+   pthread_mutex_init(&pEvent->mutex, DSL_NULL);
+   pthread_cond_init(&pEvent->cond, &condAttr);
+   pEvent->bSignaled = DSL_FALSE;
+
+   pthread_condattr_destroy(&condAttr);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_int_t DSL_DRV_EventWait(DSL_DRV_Event_t *pEvent, DSL_uint32_t nTimeout)
+{
+   struct timespec ts;
+   DSL_int_t nRet = 0;
+
+   if (nTimeout != DSL_DRV_EVENT_WAIT_FOREVER)
+   {
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      ts.tv_sec  += nTimeout / 1000;
+      ts.tv_nsec += (long)(nTimeout % 1000) * 1000000L;
+      if (ts.tv_nsec >= 1000000000L)
+      {
+         ts.tv_sec++;
+         ts.tv_nsec -= 1000000000L;
+      }
+   }
+
+   pthread_mutex_lock(&pEvent->mutex);
+
+   while ((pEvent->bSignaled == DSL_FALSE) && (nRet == 0))
+   {
+      if (nTimeout == DSL_DRV_EVENT_WAIT_FOREVER)
+      {
+         pthread_cond_wait(&pEvent->cond, &pEvent->mutex);
+      }
+      else if (pthread_cond_timedwait(&pEvent->cond, &pEvent->mutex, &ts) == ETIMEDOUT)
+      {
+         nRet = -1;
+      }
+   }
+
+   pEvent->bSignaled = DSL_FALSE;
+
+   pthread_mutex_unlock(&pEvent->mutex);
+
+   return nRet;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_void_t DSL_DRV_EventWakeUp(DSL_DRV_Event_t *pEvent)
+{
+   pthread_mutex_lock(&pEvent->mutex);
+   pEvent->bSignaled = DSL_TRUE;
+   pthread_cond_broadcast(&pEvent->cond);
+   pthread_mutex_unlock(&pEvent->mutex);
+}
+
+/**
+   Thread stub function, runs the user thread routine and signals the run
+   state.
+
+\param
+   pArg   Thread control structure
+
+\return
+   always DSL_NULL, the return value of the user thread routine is not used
+*/
+DSL_DRV_STATIC DSL_void_t* DSL_DRV_ThreadStartup(DSL_void_t *pArg)
+{
+   DSL_DRV_ThreadCtrl_t *pThrCntrl = (DSL_DRV_ThreadCtrl_t*)pArg;
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"ENTER - Thread Startup <%s>"
+      DSL_DRV_CRLF, pThrCntrl->thrParams.pName));
+
+   pThrCntrl->pThrFct(&pThrCntrl->thrParams);
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (DSL_NULL, SYS_DBG_MSG"EXIT - Thread Startup <%s>" DSL_DRV_CRLF,
+        pThrCntrl->thrParams.pName));
+
+   pThrCntrl->thrParams.bRunning = DSL_FALSE;
+
+   return DSL_NULL;
+}
+
+/*
+   Creates a new thread, refer to the kernel implementation in
+   'drv_dsl_cpe_os_linux.c' for a description of the arguments and the
+   return value. The stack size and priority are not used.
+*/
+DSL_int32_t DSL_DRV_ThreadInit(
+               DSL_DRV_ThreadCtrl_t *pThrCntrl,
+               DSL_char_t     *pName,
+               DSL_DRV_ThreadFunction_t pThreadFunction,
+               DSL_uint32_t   nStackSize,
+               DSL_uint32_t   nPriority,
+               DSL_ulong_t    nArg1,
+               DSL_ulong_t    nArg2)
+{
+   if(pThrCntrl == DSL_NULL)
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"ERROR - ThreadInit, missing object"
+         DSL_DRV_CRLF));
+
+      return -1;
+   }
+
+   if (DSL_DRV_THREAD_INIT_VALID(pThrCntrl) == DSL_TRUE)
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"ERROR - ThreadInit, object already valid"
+         DSL_DRV_CRLF));
+
+      return -1;
+   }
+
+   /* set thread function arguments */
+   strncpy(pThrCntrl->thrParams.pName, pName, DSL_DRV_THREAD_NAME_LEN - 1);
+   pThrCntrl->thrParams.pName[DSL_DRV_THREAD_NAME_LEN - 1] = 0;
+   pThrCntrl->nPriority = (DSL_int32_t)nPriority;
+   pThrCntrl->thrParams.nArg1 = nArg1;
+   pThrCntrl->thrParams.nArg2 = nArg2;
+   pThrCntrl->thrParams.bShutDown = DSL_FALSE;
+
+   /* set thread control settings */
+   pThrCntrl->pThrFct = pThreadFunction;
+
+   /* The run state is set before the start, otherwise a shutdown directly
+      after the start would not wait for the thread*/
+   pThrCntrl->thrParams.bRunning = DSL_TRUE;
+
+   if (pthread_create(&pThrCntrl->tid, DSL_NULL, DSL_DRV_ThreadStartup,
+          (DSL_void_t*)pThrCntrl) != 0)
+   {
+      pThrCntrl->thrParams.bRunning = DSL_FALSE;
+
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"ERROR - ThreadInit <%s>, create failed"
+         DSL_DRV_CRLF, pThrCntrl->thrParams.pName));
+
+      return -1;
+   }
+
+   pThrCntrl->bValid = DSL_TRUE;
+
+   return 0;
+}
+
+/*
+   Shuts down a thread, refer to the kernel implementation in
+   'drv_dsl_cpe_os_linux.c' for a description of the arguments and the
+   return value.
+*/
+DSL_int32_t DSL_DRV_ThreadShutdown(
+               DSL_DRV_ThreadCtrl_t *pThrCntrl,
+               DSL_uint32_t       waitTime_ms)
+{
+   DSL_uint32_t   waitCnt = 1;
+
+   if ((pThrCntrl == DSL_NULL) || (DSL_DRV_THREAD_INIT_VALID(pThrCntrl) == DSL_FALSE))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"ERROR - Thread Shutdown, invalid object"
+         DSL_DRV_CRLF));
+
+      return -1;
+   }
+
+   /* trigger user thread routine to shutdown */
+   pThrCntrl->thrParams.bShutDown = DSL_TRUE;
+
+   if (waitTime_ms != DSL_DRV_THREAD_DELETE_WAIT_FOREVER)
+   {
+      waitCnt = waitTime_ms / DSL_DRV_THREAD_DOWN_WAIT_POLL_MS;
+   }
+
+   while (waitCnt && (pThrCntrl->thrParams.bRunning == DSL_TRUE) )
+   {
+      DSL_DRV_MSecSleep(DSL_DRV_THREAD_DOWN_WAIT_POLL_MS);
+
+      if (waitTime_ms != DSL_DRV_THREAD_DELETE_WAIT_FOREVER)
+         waitCnt--;
+   }
+
+   pThrCntrl->bValid = DSL_FALSE;
+
+   if (pThrCntrl->thrParams.bRunning == DSL_TRUE)
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (DSL_NULL, SYS_DBG_ERR"ERROR - Thread Shutdown <%s> not stopped"
+         DSL_DRV_CRLF, pThrCntrl->thrParams.pName));
+
+      /* the thread releases its resources on its own if it ends later*/
+      pthread_detach(pThrCntrl->tid);
+
+      return 0;
+   }
+
+   pthread_join(pThrCntrl->tid, DSL_NULL);
+
+   return 0;
+}
+
+DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset)
+{
+   struct timespec ts;
+   DSL_uint32_t nTime = 0;
+
+   clock_gettime(CLOCK_REALTIME, &ts);
+   nTime = (DSL_uint32_t)ts.tv_sec;
+
+   if ( (nOffset == 0) || (nOffset > nTime) )
+   {
+      return nTime;
+   }
+
+   return (nTime - nOffset);
+}
+
+/**
+   Returns the monotonic system time with nanosecond resolution.
+
+   \param pSec   Seconds part of the time, [O]
+   \param pNSec  Nanoseconds part of the time, [O]
+*/
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   *pSec  = (DSL_uint32_t)ts.tv_sec;
+   *pNSec = (DSL_uint32_t)ts.tv_nsec;
+}
+
+DSL_uint32_t DSL_DRV_ElapsedTimeMSecGet(
+               DSL_uint32_t refTime_ms)
+{
+   struct timespec ts;
+   DSL_uint32_t currTime_ms;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   currTime_ms = (DSL_uint32_t)ts.tv_sec * 1000 +
+                 (DSL_uint32_t)(ts.tv_nsec / 1000000);
+
+   /* the modulo arithmetic handles the wrap around of the counter*/
+   return currTime_ms - refTime_ms;
+}
+
+DSL_void_t DSL_DRV_MSecSleep(DSL_uint32_t msec)
+{
+   struct timespec ts;
+
+   ts.tv_sec  = msec / 1000;
+   ts.tv_nsec = (long)(msec % 1000) * 1000000L;
+
+   while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+   {
+      /* continue with the remaining time */
+   }
+}
+
+#ifndef DSL_DEBUG_DISABLE
+/** Debug blocks which are set to the predefined debug level*/
+static const DSL_debugModules_t DSL_DRV_SIM_DbgBlocks[] =
+{
+   DSL_DBG_CPE_API,
+   DSL_DBG_G997,
+   DSL_DBG_PM,
+   DSL_DBG_MIB,
+   DSL_DBG_CEOC,
+   DSL_DBG_LED,
+   DSL_DBG_SAR,
+   DSL_DBG_DEVICE,
+   DSL_DBG_AUTOBOOT_THREAD,
+   DSL_DBG_OS,
+   DSL_DBG_CALLBACK,
+   DSL_DBG_LOW_LEVEL_DRIVER,
+   DSL_DBG_MULTIMODE,
+   DSL_DBG_NOTIFICATIONS
+};
+#endif /* #ifndef DSL_DEBUG_DISABLE*/
+
+static void DSL_DRV_DebugInit(void)
+{
+#ifndef DSL_DEBUG_DISABLE
+   DSL_uint_t i;
+   DSL_debugLevels_t nLevel;
+#endif /* #ifndef DSL_DEBUG_DISABLE*/
+
+   printf(DSL_DRV_CRLF "Predefined debug level: %d" DSL_DRV_CRLF,
+      (DSL_int_t)debug_level);
+
+#ifndef DSL_DEBUG_DISABLE
+   switch (debug_level)
+   {
+      case 1:
+         nLevel = DSL_DBG_MSG;
+         break;
+      case 2:
+         nLevel = DSL_DBG_WRN;
+         break;
+      case 3:
+         nLevel = DSL_DBG_ERR;
+         break;
+      case 4:
+         nLevel = DSL_DBG_NONE;
+         break;
+      default:
+         /* Nothing to do */
+         return;
+   }
+
+   for (i = 0; i < sizeof(DSL_DRV_SIM_DbgBlocks) / sizeof(DSL_DRV_SIM_DbgBlocks[0]); i++)
+   {
+      DSL_g_dbgLvl[DSL_DRV_SIM_DbgBlocks[i]].nDbgLvl = nLevel;
+   }
+
+   /* The message dump is only enabled for the lowest level as done by the
+      kernel driver */
+   DSL_g_dbgLvl[DSL_DBG_MESSAGE_DUMP].nDbgLvl =
+      (debug_level == 1) ? DSL_DBG_ERR : DSL_DBG_NONE;
+#endif /* #ifndef DSL_DEBUG_DISABLE*/
+
+   return;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_int_t DSL_DRV_SIM_ModuleInit(DSL_void_t)
+{
+   DSL_int_t i;
+   DSL_uint32_t nDevices, nLines, nChannels;
+
+   printf(DSL_DRV_CRLF "Lantiq CPE API Driver version: %s (simulation)" DSL_DRV_CRLF,
+      &(dsl_cpe_api_version[4]));
+
+   if (DSL_DRV_SIM_VRX_Init() != DSL_SUCCESS)
+   {
+      return -1;
+   }
+
+   /** Take the layout from the simulated device if not set before*/
+   if (g_MaxDeviceNumber == (DSL_uint8_t)(-1)
+      && g_LinesPerDevice == (DSL_uint8_t)(-1)
+      && g_ChannelsPerLine == (DSL_uint8_t)(-1))
+   {
+      DSL_DRV_SIM_VRX_DevLayoutGet(&nDevices, &nLines, &nChannels);
+
+      g_MaxDeviceNumber = (DSL_uint8_t)nDevices;
+      g_LinesPerDevice = (DSL_uint8_t)nLines;
+      g_ChannelsPerLine = (DSL_uint8_t)nChannels;
+   }
+
+   if (
+      (g_MaxDeviceNumber <= 0)    || (g_MaxDeviceNumber > 2) ||
+      (g_LinesPerDevice <= 0)     || (g_LinesPerDevice > 1) ||
+      (g_ChannelsPerLine <= 0)    || (g_ChannelsPerLine > 1)
+      )
+   {
+        printf("Invalid VRX configuration:MaxDeviceNumber:%d, LinesPerDevice:%d ChannelsPerLine:%d" DSL_DRV_CRLF,
+               g_MaxDeviceNumber, g_LinesPerDevice, g_ChannelsPerLine);
+        return -1;
+   }
+#ifndef INCLUDE_FW_REQUEST_SUPPORT
+   else if (g_MaxDeviceNumber * g_LinesPerDevice > 1)
+   {
+        printf("FW Request support missing, needs to be enabled on bonding enabled boards" DSL_DRV_CRLF);
+        return -1;
+   }
+#endif
+
+   g_MaxEntieties = g_MaxDeviceNumber * g_LinesPerDevice;
+   DSL_DRV_MemSet( ifxDevices, 0, sizeof(DSL_devCtx_t) * g_MaxEntieties );
+
+   DSL_DRV_DebugInit();
+
+   /* Initialize the firmware image cache shared by all lines*/
+   DSL_DRV_FwCacheInit();
+   DSL_DRV_BringUpInit();
+
+#ifdef INCLUDE_DSL_DELT
+   /* Initialize the DELT buffer pool shared by all lines*/
+   DSL_DRV_G997_DeltPoolInit();
+#endif /* INCLUDE_DSL_DELT*/
+
+#if defined(INCLUDE_DSL_PM)
+   /* Initialize the bonding group PM counters shared by all lines*/
+   DSL_DRV_PM_GroupInit();
+#endif /* #if defined(INCLUDE_DSL_PM)*/
+
+   /* Get handles for lower level driver */
+   for (i = 0; i < g_MaxEntieties; i++)
+   {
+      ifxDevices[i].lowHandle = DSL_DRV_DEV_DriverHandleGet(0,i);
+      if (ifxDevices[i].lowHandle == DSL_NULL)
+      {
+         printf("Get BSP Driver Handle Fail!"DSL_DRV_CRLF);
+      }
+#ifdef INCLUDE_DSL_NFC_HANDLE
+      ifxDevices[i].nfc_lowHandle = DSL_DRV_DEV_DriverHandleGet(0,i);
+      if (ifxDevices[i].nfc_lowHandle == DSL_NULL)
+      {
+         printf("Get BSP Driver NFC Handle Fail!"DSL_DRV_CRLF);
+      }
+#endif /* INCLUDE_DSL_NFC_HANDLE*/
+
+      ifxDevices[i].nUsageCount = 0;
+      ifxDevices[i].bFirstPowerOn = DSL_TRUE;
+   }
+
+   return 0;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os_sim.h'
+*/
+DSL_void_t DSL_DRV_SIM_ModuleCleanup(DSL_void_t)
+{
+   DSL_DRV_Cleanup();
+
+   DSL_DRV_SIM_VRX_Cleanup();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #if defined(DSL_CPE_SIMULATOR_DRIVER) && !defined(__KERNEL__)*/
@@ -434,6 +434,93 @@ DSL_void_t* DSL_IoctlMemCpyTo(
    return pRet;
 }
 
+/*
+   Mapping of a memory block, see DSL_DRV_UserBufferMap
+*/
+typedef struct
+{
+   /** Start address of the memory block*/
+   DSL_uint8_t *pSrc;
+   /** Size of the memory block*/
+   DSL_DRV_size_t nSize;
+} DSL_DRV_UserBufferMap_t;
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_UserBufferMap(
+   DSL_boolean_t bIsInKernel,
+   DSL_void_t    *pSrc,
+   DSL_DRV_size_t    nSize)
+{
+   DSL_DRV_UserBufferMap_t *pMap;
+
+   if ((pSrc == DSL_NULL) || (nSize == 0) ||
+       (nSize > DSL_DRV_USER_BUFFER_MAP_SIZE_MAX))
+   {
+      return DSL_NULL;
+   }
+
+   /* Single address space, the memory block is used directly*/
+   pMap = (DSL_DRV_UserBufferMap_t*)DSL_DRV_VMalloc(
+      sizeof(DSL_DRV_UserBufferMap_t));
+   if (pMap != DSL_NULL)
+   {
+      pMap->pSrc  = (DSL_uint8_t*)pSrc;
+      pMap->nSize = nSize;
+   }
+
+   return pMap;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t* DSL_DRV_UserBufferChunkMap(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset,
+   DSL_DRV_size_t    *pnSize)
+{
+   DSL_DRV_UserBufferMap_t *pMap = (DSL_DRV_UserBufferMap_t*)pHandle;
+
+   if ((pMap == DSL_NULL) || (nOffset >= pMap->nSize) || (*pnSize == 0))
+   {
+      return DSL_NULL;
+   }
+
+   if (*pnSize > pMap->nSize - nOffset)
+   {
+      *pnSize = pMap->nSize - nOffset;
+   }
+
+   return pMap->pSrc + nOffset;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_UserBufferChunkUnmap(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset)
+{
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_os.h'
+*/
+DSL_void_t DSL_DRV_UserBufferUnmap(
+   DSL_void_t    *pHandle)
+{
+   if (pHandle != DSL_NULL)
+   {
+      DSL_DRV_VFree(pHandle);
+   }
+}
+
 DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset)
 {
    DSL_uint32_t nTime = 0;
@@ -448,6 +535,23 @@ DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset)
    return (nTime - nOffset);
 }
 
+/**
+   Returns the monotonic system time with nanosecond resolution.
+
+   \param pSec   Seconds part of the time, [O]
+   \param pNSec  Nanoseconds part of the time, [O]
+*/
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec)
+{
+   struct timespec ts;
+
+   memset(&ts, 0, sizeof(ts));
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   *pSec  = (DSL_uint32_t)ts.tv_sec;
+   *pNSec = (DSL_uint32_t)ts.tv_nsec;
+}
+
 
 #ifndef DSL_DEBUG_DISABLE
 DSL_DRV_STATIC void DSL_DRV_DebugInit(void)
@@ -562,6 +666,20 @@ int DSL_DRV_DeviceCreate(void)
    DSL_DRV_DebugInit();
 #endif
 
+   /* Initialize the firmware image cache shared by all lines*/
+   DSL_DRV_FwCacheInit();
+   DSL_DRV_BringUpInit();
+
+#ifdef INCLUDE_DSL_DELT
+   /* Initialize the DELT buffer pool shared by all lines*/
+   DSL_DRV_G997_DeltPoolInit();
+#endif /* INCLUDE_DSL_DELT*/
+
+#if defined(INCLUDE_DSL_PM)
+   /* Initialize the bonding group PM counters shared by all lines*/
+   DSL_DRV_PM_GroupInit();
+#endif /* #if defined(INCLUDE_DSL_PM)*/
+
    DSL_DRV_DrvNum = iosDrvInstall(IFX_NULL, IFX_NULL,
                                 (FUNCPTR)DSL_DRV_Open,
                                 (FUNCPTR)DSL_DRV_Close,
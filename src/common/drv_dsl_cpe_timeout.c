@@ -77,6 +77,7 @@ DSL_Error_t DSL_DRV_Timeout_Init(
       else
       {
          memset((DSL_void_t *)pListElement, 0, sizeof(DSL_TimeoutElement_t));
+         pListElement->nId = j + 1;
 
          if (j == 0)
          {
@@ -210,7 +211,7 @@ DSL_Error_t DSL_DRV_Timeout_GetNextActiveEvent(
       if (pListHead->nStopTime <= nActTime)
       {
          *nEventType = pListHead->nEventType;
-         *nTimeoutID = (DSL_uint32_t)pListHead;
+         *nTimeoutID = pListHead->nId;
          DSL_TIMEOUT_LIST_UNLOCK();
          return DSL_SUCCESS;
       }
@@ -243,18 +244,17 @@ DSL_Error_t DSL_DRV_Timeout_Reset(
    DSL_uint32_t nNewTimeout)
 {
    DSL_TimeoutContext_t *pTCtx = &pContext->TimeoutListsContext;
-   DSL_TimeoutElement_t *pListElement = DSL_NULL, *pListResetElement = DSL_NULL;
+   DSL_TimeoutElement_t *pListElement = DSL_NULL;
    DSL_uint32_t i = 0;
 
    DSL_TIMEOUT_LIST_LOCK();
    pListElement = pTCtx->TimeoutList.pListHead;
-   pListResetElement = (DSL_TimeoutElement_t *)nTimeoutID;
 
    if (nTimeoutID != 0)
    {
       for (i = 0; i < pTCtx->nNrOfElements; i++)
       {
-         if (pListElement == pListResetElement)
+         if (pListElement->nId == nTimeoutID)
             break;
 
          pListElement = pListElement->pNext;
@@ -277,9 +277,9 @@ DSL_Error_t DSL_DRV_Timeout_Reset(
 
    DSL_DEBUG( DSL_DBG_MSG, (pContext,
       SYS_DBG_MSG"DSL[%02d]: Reset timeout event (nEventType=%d, "
-      "pListElement=0x%08X) successfully!" DSL_DRV_CRLF,
+      "nTimeoutID=0x%08X) successfully!" DSL_DRV_CRLF,
       DSL_DEV_NUM(pContext), pListElement->nEventType,
-      (DSL_uint32_t)pListElement));
+      pListElement->nId));
 
    DSL_TIMEOUT_LIST_UNLOCK();
    return DSL_SUCCESS;
@@ -378,7 +378,7 @@ DSL_uint32_t DSL_DRV_Timeout_AddEvent(
    pListElement->nTimeout = nTimeout;
    pListElement->nStopTime = nActTime + nTimeout;
    pListElement->nEventType = nEventType;
-   nRetVal = (DSL_uint32_t)pListElement;
+   nRetVal = pListElement->nId;
 
    /* if there is more than one element in the list,
       add the removed element in place of ascending timeout order.
@@ -501,7 +501,6 @@ DSL_Error_t DSL_DRV_Timeout_RemoveEvent(
    DSL_TimeoutContext_t *pTCtx = &pContext->TimeoutListsContext;
    DSL_TimeoutElement_t *pListElement = DSL_NULL;
    DSL_TimeoutElement_t *pListTail = DSL_NULL;
-   DSL_TimeoutElement_t *pListRemoveElement = DSL_NULL;
    DSL_TimeoutElement_t *pPreListElement = DSL_NULL;
    DSL_TimeoutElement_t *pNextListElement = DSL_NULL;
    DSL_boolean_t bFirst = DSL_FALSE, bLast = DSL_FALSE;
@@ -510,7 +509,6 @@ DSL_Error_t DSL_DRV_Timeout_RemoveEvent(
 
    DSL_TIMEOUT_LIST_LOCK();
    pListElement = pTCtx->TimeoutList.pListHead;
-   pListRemoveElement = (DSL_TimeoutElement_t *)nTimeoutID;
 
    if (nTimeoutID == 0)
    {
@@ -524,7 +522,7 @@ DSL_Error_t DSL_DRV_Timeout_RemoveEvent(
    {
       for (i = 0; i < pTCtx->nNrOfElements; i++)
       {
-         if (pListElement == pListRemoveElement)
+         if (pListElement->nId == nTimeoutID)
          {
             bRemove = DSL_TRUE;
          }
@@ -683,11 +681,11 @@ DSL_Error_t DSL_DRV_Timeout_Debug_PrintTimeoutList(
    DSL_DEBUG(DSL_DBG_MSG,
             (pContext, SYS_DBG_MSG"DSL[%02d]: Content of list" DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
    DSL_DEBUG(DSL_DBG_MSG,
-            (pContext, SYS_DBG_MSG"DSL[%02d]: pListHead=0x%08X" DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext), (DSL_uint32_t)(pTCtx->TimeoutList.pListHead)));
+            (pContext, SYS_DBG_MSG"DSL[%02d]: pListHead=%p" DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext), (DSL_void_t*)(pTCtx->TimeoutList.pListHead)));
    DSL_DEBUG(DSL_DBG_MSG,
-            (pContext, SYS_DBG_MSG"DSL[%02d]: pListTail=0x%08X" DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext), (DSL_uint32_t)(pTCtx->TimeoutList.pListTail)));
+            (pContext, SYS_DBG_MSG"DSL[%02d]: pListTail=%p" DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext), (DSL_void_t*)(pTCtx->TimeoutList.pListTail)));
 
    for (j = 0; j < pTCtx->nNrOfElements; j++)
    {
@@ -697,14 +695,14 @@ DSL_Error_t DSL_DRV_Timeout_Debug_PrintTimeoutList(
             (pContext, SYS_DBG_MSG"DSL[%02d]:    Content of element %d" DSL_DRV_CRLF,
             DSL_DEV_NUM(pContext), j));
       DSL_DEBUG(DSL_DBG_MSG,
-            (pContext, SYS_DBG_MSG"DSL[%02d]:    pList=0x%08X" DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext), (DSL_uint32_t)(pListElement)));
+            (pContext, SYS_DBG_MSG"DSL[%02d]:    pList=%p" DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext), (DSL_void_t*)(pListElement)));
       DSL_DEBUG(DSL_DBG_MSG,
-            (pContext, SYS_DBG_MSG"DSL[%02d]:    pPrevious=0x%08X" DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext), (DSL_uint32_t)(pListElement->pPrevious)));
+            (pContext, SYS_DBG_MSG"DSL[%02d]:    pPrevious=%p" DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext), (DSL_void_t*)(pListElement->pPrevious)));
       DSL_DEBUG(DSL_DBG_MSG,
-            (pContext, SYS_DBG_MSG"DSL[%02d]:    pNext=0x%08X" DSL_DRV_CRLF,
-            DSL_DEV_NUM(pContext), (DSL_uint32_t)(pListElement->pNext)));
+            (pContext, SYS_DBG_MSG"DSL[%02d]:    pNext=%p" DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext), (DSL_void_t*)(pListElement->pNext)));
       DSL_DEBUG(DSL_DBG_MSG,
             (pContext, SYS_DBG_MSG"DSL[%02d]:    bValid=%d" DSL_DRV_CRLF,
             DSL_DEV_NUM(pContext), (DSL_int_t)(pListElement->bValid)));
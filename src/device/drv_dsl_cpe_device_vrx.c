@@ -1775,6 +1775,17 @@ DSL_Error_t DSL_DRV_VRX_FailReasonGet(
       }
    }
 
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   if ((nErrCode != DSL_SUCCESS) ||
+       (sAck.ErrorCode == ALM_ModemFSM_FailReasonGet_E_CHIPSET) ||
+       (sAck.ErrorCode == ALM_ModemFSM_FailReasonGet_E_UNKNOWN))
+   {
+      /* The firmware does not respond or failed internally, it might have
+         been restarted and its configuration is unknown*/
+      DSL_DRV_VRX_ConfigWriteInvalidate(pContext);
+   }
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
    switch( sAck.SubErrorCode )
    {
    case ALM_ModemFSM_FailReasonGet_S_MODE:
@@ -4101,7 +4112,12 @@ DSL_Error_t DSL_DRV_DEV_LowLevelConfigurationSet(
    return nErrCode;
 }
 
-DSL_Error_t DSL_DRV_DEV_ModemWriteConfig(
+/*
+   Writes the modem configuration to the firmware, refer to
+   DSL_DRV_DEV_ModemWriteConfig for a description of the arguments and
+   return value.
+*/
+static DSL_Error_t DSL_DRV_VRX_ModemWriteConfig(
    DSL_Context_t *pContext)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
@@ -4479,6 +4495,32 @@ DSL_Error_t DSL_DRV_DEV_ModemWriteConfig(
    return DSL_SUCCESS;
 }
 
+DSL_Error_t DSL_DRV_DEV_ModemWriteConfig(
+   DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_POINTER(pContext, pContext->pDevCtx);
+   DSL_CHECK_ERR_CODE();
+
+   /* As long as the firmware keeps its configuration only the changed
+      configuration messages are sent*/
+   DSL_DRV_VRX_ConfigWriteStart(pContext);
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
+   nErrCode = DSL_DRV_VRX_ModemWriteConfig(pContext);
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   DSL_DRV_VRX_ConfigWriteEnd(pContext, nErrCode);
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
+   return nErrCode;
+}
+
 DSL_DEV_Handle_t DSL_DRV_DEV_DriverHandleGet(
    DSL_int_t nMaj,
    DSL_int_t nNum)
@@ -4498,10 +4540,100 @@ DSL_Error_t DSL_DRV_DEV_DriverHandleDelete(
 }
 
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_device.h'
+   Writes the selected firmware binary to the device. The binary of a
+   zero-copy download (pFwMap set) is passed to the MEI driver chunk by chunk
+   from its pinned pages, no kernel copy or mapping of the whole image is made.
+   Returns 0 in case of success, the MEI return code is set in
+   pFwDl->ictl.retCode.
 */
-DSL_Error_t DSL_DRV_DEV_FwDownload(
+static DSL_int_t DSL_DRV_VRX_FwImageWrite(
+   DSL_Context_t *pContext,
+   DSL_DEV_Handle_t dev,
+   IOCTL_MEI_fwDownLoad_t *pFwDl,
+   DSL_void_t *pFwMap)
+{
+#ifdef MEI_SUPPORT_FW_CHUNK_DOWNLOAD
+   IOCTL_MEI_fwChunkDownLoad_t fwChunk;
+   DSL_DRV_size_t nOffset = 0, nChunkSize = 0;
+   DSL_int_t nRet = 0;
+#endif /* MEI_SUPPORT_FW_CHUNK_DOWNLOAD*/
+
+   /* Binary in kernel memory or chunks reuse mode*/
+   if ((pFwMap == DSL_NULL) || (pFwDl->pFwImage == DSL_NULL))
+   {
+      return DSL_DRV_VRX_InternalFirmwareDownload((MEI_DYN_CNTRL_T*)dev, pFwDl);
+   }
+
+#ifdef MEI_SUPPORT_FW_CHUNK_DOWNLOAD
+   while ((nRet == 0) && (nOffset < pFwDl->size_byte))
+   {
+      memset(&fwChunk, 0x0, sizeof(IOCTL_MEI_fwChunkDownLoad_t));
+
+      /* The chunk ends at the next page boundary*/
+      nChunkSize = pFwDl->size_byte - nOffset;
+      fwChunk.pFwChunk = (unsigned char *)DSL_DRV_UserBufferChunkMap(pFwMap,
+                            nOffset, &nChunkSize);
+      if (fwChunk.pFwChunk == DSL_NULL)
+      {
+         DSL_DEBUG( DSL_DBG_ERR, (pContext,
+            SYS_DBG_ERR"DSL[%02d]: ERROR - mapping of FW chunk at %u failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), (DSL_uint32_t)nOffset));
+
+         return -1;
+      }
+
+      fwChunk.size_byte       = (unsigned int)nChunkSize;
+      fwChunk.offset_byte     = (unsigned int)nOffset;
+      fwChunk.image_size_byte = pFwDl->size_byte;
+
+      nRet = DSL_DRV_VRX_InternalFirmwareChunkDownload((MEI_DYN_CNTRL_T*)dev,
+                &fwChunk);
+      DSL_DRV_UserBufferChunkUnmap(pFwMap, nOffset);
+
+      pFwDl->ictl.retCode = fwChunk.ictl.retCode;
+      nOffset += nChunkSize;
+   }
+
+   return nRet;
+#else
+   DSL_DEBUG( DSL_DBG_ERR, (pContext,
+      SYS_DBG_ERR"DSL[%02d]: ERROR - zero-copy FW download is not supported "
+      "by the MEI driver!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   return -1;
+#endif /* MEI_SUPPORT_FW_CHUNK_DOWNLOAD*/
+}
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+/*
+   Drops the recorded configuration payloads of all lines of the device, the
+   device reset clears the firmware configuration of each line.
+*/
+static DSL_void_t DSL_DRV_VRX_DeviceConfigWriteInvalidate(
+   DSL_Context_t *pContext)
+{
+   DSL_int_t nFirst, i;
+
+   nFirst = DSL_DEV_NUM(pContext) -
+      (DSL_DEV_NUM(pContext) % DSL_DRV_LINES_PER_DEVICE);
+
+   for (i = nFirst; i < nFirst + DSL_DRV_LINES_PER_DEVICE; i++)
+   {
+      if ((i < DSL_DRV_MAX_SUPPORTED_ENTITIES) &&
+          (ifxDevices[i].pContext != DSL_NULL) &&
+          (ifxDevices[i].pContext->pDevCtx != DSL_NULL))
+      {
+         DSL_DRV_VRX_ConfigWriteInvalidate(ifxDevices[i].pContext);
+      }
+   }
+}
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
+/*
+   Downloads the firmware to the device, refer to DSL_DRV_DEV_FwDownload for
+   a description of the arguments and return value.
+*/
+static DSL_Error_t DSL_DRV_VRX_FwDownload(
    DSL_Context_t *pContext,
    const DSL_char_t *pFirmware,
    DSL_uint32_t nFirmwareSize,
@@ -4536,6 +4668,7 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
 #endif /* defined (DSL_VRX_DEVICE_VR11) */
    DSL_boolean_t bFwEventActivation;
    DSL_uint32_t nOppositeLine;
+   DSL_void_t *pFwMap = DSL_NULL;
 
    DSL_CHECK_POINTER(pContext, pContext->pDevCtx->lowHandle);
    DSL_CHECK_ERR_CODE();
@@ -4598,6 +4731,7 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
    for(;;)
    {
       memset(&Vdsl2_FwDl,0x0,sizeof(IOCTL_MEI_fwDownLoad_t));
+      pFwMap = DSL_NULL;
 
       if (bForceDownload)
       {
@@ -4612,6 +4746,7 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
                   /* use 2nd fw */
                   Vdsl2_FwDl.pFwImage  = (unsigned char *)pFirmware2;
                   Vdsl2_FwDl.size_byte = (unsigned long)nFirmwareSize2;
+                  pFwMap               = pContext->pFwMap2;
                   DSL_CTX_READ(pContext, nErrCode, nFwFeatures2, nFwFeatures);
                   /* update context fw features */
                   DSL_CTX_WRITE(pContext, nErrCode, nFwFeatures, nFwFeatures);
@@ -4634,6 +4769,7 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
                   /* use 1st fw */
                   Vdsl2_FwDl.pFwImage  = (unsigned char *)pFirmware;
                   Vdsl2_FwDl.size_byte = (unsigned long)nFirmwareSize;
+                  pFwMap               = pContext->pFwMap;
                   DSL_CTX_READ(pContext, nErrCode, nFwFeatures, nFwFeatures);
                }
                /* 1st fw is empty */
@@ -4651,6 +4787,7 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
          {
             Vdsl2_FwDl.pFwImage  = (unsigned char *)pFirmware;
             Vdsl2_FwDl.size_byte = (unsigned long)nFirmwareSize;
+            pFwMap               = pContext->pFwMap;
             DSL_CTX_READ(pContext, nErrCode, nFwFeatures, nFwFeatures);
          }
 
@@ -4721,6 +4858,9 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
             /* Reset bFirmwareReady flag*/
             DSL_CTX_WRITE_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, DSL_FALSE);
             DSL_DRV_FirmwareDownloadStatusSet(pContext, DSL_FW_DWNLD_STATUS_NA);
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+            DSL_DRV_VRX_DeviceConfigWriteInvalidate(pContext);
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
          }
 
          /* Set VRX device FW mode*/
@@ -4745,7 +4885,7 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
 
       /* Do the FW Download*/
       DSL_DRV_FirmwareDownloadStatusSet(pContext, DSL_FW_DWNLD_STATUS_PENDING);
-      if( DSL_DRV_VRX_InternalFirmwareDownload( (MEI_DYN_CNTRL_T*)dev, &Vdsl2_FwDl) != 0 )
+      if (DSL_DRV_VRX_FwImageWrite(pContext, dev, &Vdsl2_FwDl, pFwMap) != 0)
       {
          DSL_DEBUG( DSL_DBG_ERR, (pContext,
             SYS_DBG_ERR"DSL[%02d]: ERROR - VRx FW downloading failed, (nReturn = %d)!"
@@ -4989,6 +5129,264 @@ DSL_Error_t DSL_DRV_DEV_FwDownload(
    return nErrCode;
 }
 
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+/* Maximum time the slave port waits for the master port download [ms]*/
+#define DSL_DRV_VRX_BRINGUP_MASTER_WAIT_MAX  30000
+
+/*
+   Waits until the firmware download decision of the master port of the same
+   device is known, that is until the master port has neither a requested nor
+   an ongoing firmware download. If the master port has loaded the same image
+   before, the slave port reuses the firmware chunks of the master port
+   instead of downloading the image again.
+
+   \param pContext        Pointer to dsl cpe library context structure of the
+                          slave port, [I]
+   \param pFirmware       Firmware image requested by the slave port, [I]
+   \param pForceDownload  Force download flag, cleared if the chunks of the
+                          master port can be reused, [I/O]
+*/
+static DSL_void_t DSL_DRV_VRX_BringUpMasterWait(
+   DSL_Context_t *pContext,
+   const DSL_char_t *pFirmware,
+   DSL_boolean_t *pForceDownload)
+{
+   DSL_Context_t *pMaster = ifxDevices[DSL_DEV_NUM(pContext) - 1].pContext;
+   DSL_uint32_t nStartTime = DSL_DRV_TimeMSecGet(), nWaitTime = 0;
+   DSL_uint32_t nImageId = 0, nMasterImageId = 0;
+   DSL_DRV_FwDownloadState_t nState = DSL_DRV_FW_DOWNLOAD_IDLE;
+
+   if (pMaster == DSL_NULL)
+   {
+      return;
+   }
+
+   for (;;)
+   {
+      if (DSL_DRV_MUTEX_LOCK(pMaster->bringUpMutex))
+      {
+         DSL_DEBUG(DSL_DBG_ERR, (pContext, SYS_DBG_ERR
+            "DSL[%02d]: ERROR - Couldn't lock bring-up mutex!"DSL_DRV_CRLF,
+            DSL_DEV_NUM(pContext)));
+         return;
+      }
+      nState         = pMaster->nFwDownloadState;
+      nMasterImageId = pMaster->nFwDownloadImageId;
+      DSL_DRV_MUTEX_UNLOCK(pMaster->bringUpMutex);
+
+      nWaitTime = DSL_DRV_TimeMSecGet() - nStartTime;
+      if ((nState == DSL_DRV_FW_DOWNLOAD_IDLE) ||
+          (nWaitTime >= DSL_DRV_VRX_BRINGUP_MASTER_WAIT_MAX))
+      {
+         break;
+      }
+
+      /* The state is checked again after each wake-up, the timeout only
+         covers a wake-up which was signaled before the wait started*/
+      DSL_DRV_WAIT_EVENT_TIMEOUT(pMaster->bringUpEvent, 100);
+   }
+
+   DSL_DRV_BRINGUP_TIMESTAMP_SET(pContext, nMasterWaitTime, nWaitTime);
+
+   if (nState != DSL_DRV_FW_DOWNLOAD_IDLE)
+   {
+      /* Safety fallback only, the slave port downloads the full image*/
+      DSL_DEBUG(DSL_DBG_WRN, (pContext, SYS_DBG_WRN
+         "DSL[%02d]: WARNING - Timeout while waiting for the firmware download "
+         "of the master port!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return;
+   }
+
+   if (*pForceDownload)
+   {
+      nImageId = DSL_DRV_FwCacheIdGet((const DSL_uint8_t*)pFirmware);
+   }
+
+   if ((nImageId != 0) && (nImageId == nMasterImageId))
+   {
+      /* Same image content as loaded by the master port. Reuse the chunks of
+         the master port, the download falls back to the image if the reuse
+         fails. */
+      *pForceDownload = DSL_FALSE;
+
+      DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+         "DSL[%02d]: Reusing the firmware download of the master port (waited "
+         "%d ms)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nWaitTime));
+   }
+}
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_device.h'
+*/
+DSL_Error_t DSL_DRV_DEV_FwDownload(
+   DSL_Context_t *pContext,
+   const DSL_char_t *pFirmware,
+   DSL_uint32_t nFirmwareSize,
+   const DSL_char_t *pFirmware2,
+   DSL_uint32_t nFirmwareSize2,
+   DSL_int32_t *pLoff,
+   DSL_int32_t *pCurrentOff,
+   DSL_boolean_t bLastChunk,
+   DSL_boolean_t bForceDownload)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+   DSL_boolean_t bMasterPort = DSL_FALSE;
+
+   /* Both ports of a dual-line device share the firmware. The master port
+      downloads it while the slave port waits for the completion. */
+   if (DSL_DRV_LINES_PER_DEVICE == 2)
+   {
+      if (DSL_DEV_NUM(pContext) % DSL_DRV_LINES_PER_DEVICE)
+      {
+         DSL_DRV_VRX_BringUpMasterWait(pContext, pFirmware, &bForceDownload);
+      }
+      else
+      {
+         bMasterPort = DSL_TRUE;
+         if (DSL_DRV_MUTEX_LOCK(pContext->bringUpMutex) == 0)
+         {
+            pContext->nFwDownloadState = DSL_DRV_FW_DOWNLOAD_PENDING;
+            DSL_DRV_MUTEX_UNLOCK(pContext->bringUpMutex);
+         }
+      }
+   }
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   /* The firmware configuration is lost with the download*/
+   DSL_DRV_VRX_ConfigWriteInvalidate(pContext);
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+#ifdef INCLUDE_DSL_CPE_FAST_RESTART
+   pContext->pDevCtx->data.fwLoaded.bValid = DSL_FALSE;
+#endif /* INCLUDE_DSL_CPE_FAST_RESTART*/
+
+   nErrCode = DSL_DRV_VRX_FwDownload(pContext, pFirmware, nFirmwareSize,
+      pFirmware2, nFirmwareSize2, pLoff, pCurrentOff, bLastChunk,
+      bForceDownload);
+
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+   if (bMasterPort)
+   {
+      DSL_uint32_t nImageId = 0;
+
+      if (nErrCode >= DSL_SUCCESS)
+      {
+         nImageId = DSL_DRV_FwCacheIdGet((const DSL_uint8_t*)pFirmware);
+      }
+
+      if (DSL_DRV_MUTEX_LOCK(pContext->bringUpMutex) == 0)
+      {
+         pContext->nFwDownloadImageId = nImageId;
+         pContext->nFwDownloadState   = DSL_DRV_FW_DOWNLOAD_IDLE;
+         DSL_DRV_MUTEX_UNLOCK(pContext->bringUpMutex);
+      }
+
+      DSL_DRV_WAKEUP_EVENT(pContext->bringUpEvent);
+   }
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
+
+#ifdef INCLUDE_DSL_CPE_FAST_RESTART
+   if (nErrCode >= DSL_SUCCESS)
+   {
+      DSL_Error_t nRet = DSL_SUCCESS;
+      DSL_VRX_FwLoadedInfo_t fwLoaded;
+
+      /* Remember the loaded firmware for the fast restart check*/
+      fwLoaded.bValid = DSL_TRUE;
+      DSL_CTX_READ_SCALAR(pContext, nRet, pDevCtx->data.deviceCfg.nFwType,
+         fwLoaded.nFwType);
+      DSL_CTX_READ_SCALAR(pContext, nRet, pDevCtx->data.nPortMode,
+         fwLoaded.nPortMode);
+      DSL_CTX_READ(pContext, nRet, nFwFeatures, fwLoaded.nFwFeatures);
+      DSL_CTX_WRITE(pContext, nRet, pDevCtx->data.fwLoaded, fwLoaded);
+   }
+#endif /* INCLUDE_DSL_CPE_FAST_RESTART*/
+
+   return nErrCode;
+}
+
+#ifdef INCLUDE_DSL_CPE_FAST_RESTART
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_device_vrx.h'
+*/
+DSL_Error_t DSL_DRV_VRX_FastRestartCheck(
+   DSL_Context_t *pContext,
+   DSL_boolean_t *pFastRestart)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_boolean_t bFwReady = DSL_FALSE, bDownload = DSL_TRUE;
+   DSL_VRX_FwMode_t nFwMode;
+   DSL_VRX_FwLoadedInfo_t fwLoaded;
+   DSL_VRX_FwVersion_t sFwVersion, sFwVersionLoaded;
+   DSL_FirmwareRequestType_t nFwType = DSL_FW_REQUEST_NA;
+   DSL_PortMode_t nPortMode = DSL_PORT_MODE_NA;
+   DSL_FirmwareFeatures_t nFwFeatures;
+   DSL_uint32_t verNum = 0;
+
+   DSL_CHECK_POINTER(pContext, pFastRestart);
+   DSL_CHECK_ERR_CODE();
+
+   *pFastRestart = DSL_FALSE;
+
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->bFirmwareReady, bFwReady);
+   DSL_CTX_READ(pContext, nErrCode, pDevCtx->data.fwLoaded, fwLoaded);
+   if (!bFwReady || !fwLoaded.bValid)
+   {
+      return nErrCode;
+   }
+
+   /* xDSL mode required by the CAM FSM*/
+   nErrCode = DSL_DRV_VRX_CamFwLoadNeededCheck(pContext, &bDownload, &nFwMode);
+   if ((nErrCode != DSL_SUCCESS) || bDownload)
+   {
+      return nErrCode;
+   }
+
+   /* Port mode and features required for the next training*/
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.deviceCfg.nFwType,
+      nFwType);
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, pDevCtx->data.nPortMode, nPortMode);
+   DSL_CTX_READ(pContext, nErrCode, nFwFeatures, nFwFeatures);
+
+   if ((nFwType != fwLoaded.nFwType) || (nPortMode != fwLoaded.nPortMode) ||
+       (memcmp(&nFwFeatures, &fwLoaded.nFwFeatures,
+          sizeof(DSL_FirmwareFeatures_t)) != 0))
+   {
+      return nErrCode;
+   }
+
+   /* The running firmware has to be the downloaded one*/
+   nErrCode = DSL_DRV_VRX_SendMsgFwVerInfoGet(pContext, &verNum);
+   if (nErrCode != DSL_SUCCESS)
+   {
+      DSL_DEBUG(DSL_DBG_WRN, (pContext, SYS_DBG_WRN
+         "DSL[%02d]: WARNING - Firmware not responding, no fast restart!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_SUCCESS;
+   }
+
+   memset(&sFwVersion, 0x0, sizeof(DSL_VRX_FwVersion_t));
+   DSL_DRV_VRX_FirmwareVersionDecode(pContext, verNum, &sFwVersion);
+   DSL_CTX_READ(pContext, nErrCode, pDevCtx->data.fwFeatures, sFwVersionLoaded);
+
+   if (memcmp(&sFwVersion, &sFwVersionLoaded, sizeof(DSL_VRX_FwVersion_t)) == 0)
+   {
+      *pFastRestart = DSL_TRUE;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+      "DSL[%02d]: Fast restart check, firmware %s"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext), *pFastRestart ? "kept" : "changed"));
+
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_CPE_FAST_RESTART*/
+
 
 /*
    For a detailed description of the function, its arguments and return value
@@ -5279,6 +5677,11 @@ DSL_Error_t DSL_DRV_DEV_LinkPowerDown(
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_DEV_LinkPowerDown"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   /* The firmware configuration is lost with the power down*/
+   DSL_DRV_VRX_ConfigWriteInvalidate(pContext);
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
    nErrCode = DSL_DRV_VRX_SendMsgModemStateSet(
                 pContext, CMD_ModemFSM_StateSet_POWERDOWN);
    if( nErrCode != DSL_SUCCESS )
@@ -5832,7 +6235,8 @@ DSL_Error_t DSL_DRV_DEV_ShowtimeStatusUpdate(
 #ifndef DSL_CPE_STATIC_DELT_DATA
          if (pContext->DELT_SHOWTIME == DSL_NULL)
          {
-            pContext->DELT_SHOWTIME = DSL_DRV_Malloc(sizeof(DSL_G997_DeltShowtimeData_t));
+            pContext->DELT_SHOWTIME = DSL_DRV_G997_DeltBufferGet(pContext,
+                                         DSL_G997_DELT_POOL_SHOWTIME);
             if( pContext->DELT_SHOWTIME == DSL_NULL )
             {
                DSL_DEBUG( DSL_DBG_ERR,
@@ -6847,33 +7251,18 @@ DSL_Error_t DSL_DRV_VRX_SnrPerGroupCalculate(
    DSL_G997_NSCData8_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint8_t *pDest = DSL_NULL;
-   DSL_uint32_t nAvrg = 0, i = 0;
+   DSL_uint16_t nNumData = 0;
 
-   pDest = &(pData->nNSCData[0]);
-   while((i < pData->nNumData) && (i < DSL_MAX_NSC))
+   if (nGroupSize == 0)
    {
-      if (pData->nNSCData[i] == 255)
-      {
-         /* as soon as one value is not valid,
-            the whole group shall be invalid */
-         nAvrg += (nGroupSize * 255);
-      }
-      else
-      {
-         nAvrg += pData->nNSCData[i];
-      }
-
-      if ((i % nGroupSize) == (DSL_uint8_t)(nGroupSize - 1))
-      {
-         /* one group is summarized */
-         *pDest = (DSL_uint8_t)DSL_MIN(255, (nAvrg / nGroupSize));
-         nAvrg = 0;
-         pDest++;
-      }
-      i++;
+      return DSL_ERROR;
    }
 
+   nNumData = (DSL_uint16_t)DSL_MIN(pData->nNumData, DSL_MAX_NSC);
+
+   DSL_DRV_VRX_ToneGroupAverage(&(pData->nNSCData[0]), &(pData->nNSCData[0]),
+      (DSL_uint16_t)(nNumData / nGroupSize), nGroupSize);
+
    pData->nNumData = pData->nNumData / nGroupSize;
 
    return(nErrCode);
@@ -7232,7 +7621,8 @@ static DSL_Error_t DSL_DRV_VRX_LoopDiagnosticCompleteHandle(DSL_Context_t *pCont
    #ifndef DSL_CPE_STATIC_DELT_DATA
    if (pContext->DELT == DSL_NULL)
    {
-      pContext->DELT = DSL_DRV_Malloc(sizeof(DSL_G997_DeltData_t));
+      pContext->DELT = DSL_DRV_G997_DeltBufferGet(pContext,
+                          DSL_G997_DELT_POOL_DIAG);
       if( pContext->DELT == DSL_NULL )
       {
          DSL_DEBUG( DSL_DBG_ERR,
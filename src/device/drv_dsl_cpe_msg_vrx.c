@@ -44,6 +44,7 @@ VRX_MsgId_t DSL_DRV_VRX_g_MsgDumpBlacklist[]=
    {(DSL_uint16_t)(CMD_LINEFAILURENE_GET)    },
    { 0xFFFF }
 };
+#endif /* #ifndef DSL_DEBUG_DISABLE*/
 
 /** ARC to ME indication (NFC) */
 #define DSL_MBOX_CODE_NFC       0x01
@@ -52,8 +53,6 @@ VRX_MsgId_t DSL_DRV_VRX_g_MsgDumpBlacklist[]=
 /** ARC to ME event (ALM) */
 #define DSL_MBOX_CODE_ALM       0x04
 
-#endif /* #ifndef DSL_DEBUG_DISABLE*/
-
 static DSL_uint16_t g_VRxMsgWhitelist[] =
 {
                                     /*           :             : FW           */
@@ -218,6 +217,204 @@ static DSL_Error_t DSL_DRV_VRX_SendMsgAuxInventoryInfoOGet(
    DSL_AuxLineInventoryData_t *pData);
 #endif /* #ifdef INCLUDE_DSL_G997_LINE_INVENTORY*/
 
+/* Byte offsets of the even and odd tone within a received pair entry and of
+   the low and high byte within a received 16 bit word*/
+#if DSL_BYTE_ORDER == DSL_BIG_ENDIAN
+#define DSL_VRX_TONE_PAIR_00  1
+#define DSL_VRX_TONE_PAIR_01  0
+#define DSL_VRX_TONE_WORD_LO  1
+#define DSL_VRX_TONE_WORD_HI  0
+#else
+#define DSL_VRX_TONE_PAIR_00  0
+#define DSL_VRX_TONE_PAIR_01  1
+#define DSL_VRX_TONE_WORD_LO  0
+#define DSL_VRX_TONE_WORD_HI  1
+#endif
+
+/*
+   The per tone kernels below do not contain debug output, data dependent
+   branches or divisions per tone to allow the compiler to vectorize them.
+*/
+
+/*
+   Returns the number of entries (out of nNum) starting at nIndex that fit into
+   an array of nSize entries.
+*/
+static DSL_uint16_t DSL_DRV_VRX_ToneNumLimit(
+   const DSL_uint32_t nIndex,
+   const DSL_uint32_t nNum,
+   const DSL_uint32_t nSize)
+{
+   if (nIndex >= nSize)
+   {
+      return 0;
+   }
+
+   return (DSL_uint16_t)DSL_MIN(nNum, nSize - nIndex);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ToneDataPairsUnpack(
+   DSL_uint8_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nPairs)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < nPairs; i++)
+   {
+      pDest[2 * i]     = pSrc[2 * i + DSL_VRX_TONE_PAIR_00];
+      pDest[2 * i + 1] = pSrc[2 * i + DSL_VRX_TONE_PAIR_01];
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_uint32_t DSL_DRV_VRX_ToneDataSum(
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum)
+{
+   DSL_uint32_t i, nSum = 0;
+
+   for (i = 0; i < nNum; i++)
+   {
+      nSum += pSrc[i];
+   }
+
+   return nSum;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ToneSnrQ88Convert(
+   DSL_uint8_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum)
+{
+   DSL_uint32_t i;
+   DSL_uint16_t snr, snrQ88;
+
+   for (i = 0; i < nNum; i++)
+   {
+      /* assembled from bytes, the message data is not aligned*/
+      snr = (DSL_uint16_t)((pSrc[2 * i + DSL_VRX_TONE_WORD_HI] << 8) |
+                           pSrc[2 * i + DSL_VRX_TONE_WORD_LO]);
+
+      /* (SNR[dB]+32)*2 in Q8.8, rounded to the integer part*/
+      snrQ88 = (DSL_uint16_t)((snr + (32 << 8)) * 2);
+
+      pDest[i] = (snr == Q88_NOVALUE) ? 255 :
+         (DSL_uint8_t)(((snrQ88 >> 8) & 0xFF) + ((snrQ88 >> 7) & 0x1));
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ToneGroupAverage(
+   DSL_uint8_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nGroups,
+   const DSL_uint8_t nGroupSize)
+{
+   DSL_uint32_t nGroup, i, nSum, nInvalid;
+
+   for (nGroup = 0; nGroup < nGroups; nGroup++)
+   {
+      nSum = 0;
+      nInvalid = 0;
+
+      for (i = 0; i < nGroupSize; i++)
+      {
+         nSum += pSrc[i];
+         /* 255 + 1 is the only value which sets bit 8*/
+         nInvalid |= ((DSL_uint32_t)pSrc[i] + 1) >> 8;
+      }
+      pSrc += nGroupSize;
+
+      pDest[nGroup] = nInvalid ? 255 : (DSL_uint8_t)(nSum / nGroupSize);
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_uint16_t DSL_DRV_VRX_ToneStatsGet(
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum,
+   DSL_uint8_t *pMin,
+   DSL_uint8_t *pMax,
+   DSL_uint8_t *pMean)
+{
+   DSL_uint32_t i, nValid, nSum = 0, nCount = 0;
+   DSL_uint8_t nMin = 255, nMax = 0;
+
+   for (i = 0; i < nNum; i++)
+   {
+      /* 1 for a valid value, 0 for 255*/
+      nValid = (((DSL_uint32_t)pSrc[i] + 1) >> 8) ^ 1;
+
+      nSum   += pSrc[i] & (0 - nValid);
+      nCount += nValid;
+      /* 255 never lowers the minimum, it is only masked for the maximum*/
+      nMin = DSL_MIN(nMin, pSrc[i]);
+      nMax = DSL_MAX(nMax, (DSL_uint8_t)(pSrc[i] & (0 - nValid)));
+   }
+
+   *pMin  = nMin;
+   *pMax  = nCount ? nMax : 255;
+   *pMean = nCount ? (DSL_uint8_t)(nSum / nCount) : 255;
+
+   return (DSL_uint16_t)nCount;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ToneHlogToDb(
+   DSL_int16_t *pDest,
+   const DSL_uint16_t *pSrc,
+   const DSL_uint16_t nNum)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < nNum; i++)
+   {
+      /* HLOG[dB] = 6 - m/10 (see chapter 7.5.1.26.6 of G.997.1)*/
+      pDest[i] = (pSrc[i] == 1023) ? DSL_VRX_TONE_DB_INVALID :
+         (DSL_int16_t)(60 - (DSL_int32_t)pSrc[i]);
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ToneQlnToDb(
+   DSL_int16_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < nNum; i++)
+   {
+      /* QLN[dBm/Hz] = -23 - n/2 (see chapter 7.5.1.27.3 of G.997.1)*/
+      pDest[i] = (pSrc[i] == 255) ? DSL_VRX_TONE_DB_INVALID :
+         (DSL_int16_t)(-230 - 5 * (DSL_int32_t)pSrc[i]);
+   }
+}
+
 #if defined(INCLUDE_DSL_G997_PER_TONE) || defined(INCLUDE_DSL_CPE_MISC_LINE_STATUS)
 /*
    For a detailed description of the function, its arguments and return value
@@ -233,7 +430,7 @@ DSL_Error_t DSL_DRV_VRX_BitAllocationTableGet(
                   nRetCode = DSL_SUCCESS;
    DSL_uint32_t   nMsgId = 0;
    DSL_uint16_t   i = 0, nTonesLeft = 0, nTonesCurrent = 0, nTonesMax = 0,
-                  nAckSize = 0, nAckIndex = 0, nAckLength = 0;
+                  nAckSize = 0, nAckIndex = 0, nAckLength = 0, nPairs = 0;
    DSL_LineStateValue_t   nCurrentState = DSL_LINESTATE_UNKNOWN;
    /* assume US/DS ADSL/VDSL to have the same CMD Structures */
    CMD_BAT_TableEntriesGet_t  sCmd;
@@ -365,36 +562,31 @@ DSL_Error_t DSL_DRV_VRX_BitAllocationTableGet(
                }
 
                /* The indexed words contain 2 values each */
-               for(i = 0;
-                  (i < nAckLength) && (i < nMaxNumOfEntries) &&
-                  (((i + nAckIndex) * 2 + 1) < DSL_MAX_NSC); i++)
-               {
-                  /* VDSL and ADSL Ack structures differ
-                     only in length of entries */
-                  if (pData != DSL_NULL)
-                  {
-                     pData->nNSCData[(i + nAckIndex) * 2]     = sAck.Vdsl.BAT[i].data_00;
+               nPairs = DSL_DRV_VRX_ToneNumLimit(nAckIndex,
+                  DSL_MIN(nAckLength, nMaxNumOfEntries), DSL_MAX_NSC/2);
 
-                     if ( ((i + nAckIndex) * 2 + 1) <= pBand->nLastToneIndex)
-                     {
-                        pData->nNSCData[(i + nAckIndex) * 2 + 1] = sAck.Vdsl.BAT[i].data_01;
-                     }
-                     else
-                     {
-                        pData->nNSCData[(i + nAckIndex) * 2 + 1] = 0x0;
-                     }
-
-                     DSL_DEBUG(DSL_DBG_MSG,(pContext,
-                        SYS_DBG_MSG"%04X, ", pData->nNSCData[(i+nAckIndex)*2]));
-                     DSL_DEBUG(DSL_DBG_MSG,(pContext,
-                        SYS_DBG_MSG"%04X, ", pData->nNSCData[(i+nAckIndex)*2 + 1]));
-                  }
+               /* VDSL and ADSL Ack structures differ
+                  only in length of entries */
+               DSL_DRV_VRX_ToneDataPairsUnpack(&(pData->nNSCData[nAckIndex * 2]),
+                  (DSL_uint8_t*)sAck.Vdsl.BAT, nPairs);
 
-                  if (pBitsPerSymbol != DSL_NULL)
+               for(i = 0; i < nPairs; i++)
+               {
+                  if ( ((i + nAckIndex) * 2 + 1) > pBand->nLastToneIndex)
                   {
-                     *pBitsPerSymbol += sAck.Vdsl.BAT[i].data_00;
-                     *pBitsPerSymbol += sAck.Vdsl.BAT[i].data_01;
+                     pData->nNSCData[(i + nAckIndex) * 2 + 1] = 0x0;
                   }
+
+                  DSL_DEBUG(DSL_DBG_MSG,(pContext,
+                     SYS_DBG_MSG"%04X, ", pData->nNSCData[(i+nAckIndex)*2]));
+                  DSL_DEBUG(DSL_DBG_MSG,(pContext,
+                     SYS_DBG_MSG"%04X, ", pData->nNSCData[(i+nAckIndex)*2 + 1]));
+               }
+
+               if (pBitsPerSymbol != DSL_NULL)
+               {
+                  *pBitsPerSymbol += DSL_DRV_VRX_ToneDataSum(
+                     (DSL_uint8_t*)sAck.Vdsl.BAT, (DSL_uint16_t)(2 * nPairs));
                }
             }
             else
@@ -1716,6 +1908,52 @@ static DSL_Error_t DSL_DRV_VRX_FeXtseCapabilitiesAdslGet(
 }
 #endif /* INCLUDE_DSL_G997_LINE_INVENTORY*/
 
+/*
+   Stores a sent or received device message in the binary message trace of
+   the line. Has to be called only if the message trace is enabled. The trace
+   is independent of the message dump debug level, the decoding is done by
+   the application.
+
+   \param pContext Pointer to dsl library context structure, [I]
+   \param nClass   Message classifier, [I]
+   \param nMsgId   Message ID, [I]
+   \param pData    Message data starting with the two header words, [I]
+   \param nSize    Message size [bytes], [I]
+   \param bReceive DSL_TRUE for a received message, [I]
+*/
+static DSL_void_t DSL_DRV_VRX_MsgTrace(
+   DSL_Context_t *pContext,
+   const DSL_uint16_t nClass,
+   const DSL_uint16_t nMsgId,
+   const DSL_void_t *pData,
+   const DSL_uint32_t nSize,
+   DSL_boolean_t bReceive)
+{
+   DSL_DBG_MsgTraceDir_t nDir = DSL_DBG_MSG_TRACE_TX;
+
+   if ((pData == DSL_NULL) || (nSize < 4))
+   {
+      return;
+   }
+
+   if (bReceive == DSL_TRUE)
+   {
+      if (((nClass & 0x00FF) == DSL_MBOX_CODE_NFC) ||
+          ((nClass & 0x00FF) == DSL_MBOX_CODE_EVT) ||
+          ((nClass & 0x00FF) == DSL_MBOX_CODE_ALM))
+      {
+         nDir = DSL_DBG_MSG_TRACE_EVT;
+      }
+      else
+      {
+         nDir = DSL_DBG_MSG_TRACE_RX;
+      }
+   }
+
+   DSL_DRV_DBG_MsgTraceRecord(pContext, nDir, nClass, nMsgId,
+      (const DSL_uint8_t*)pData, (DSL_uint16_t)nSize);
+}
+
 #ifndef DSL_DEBUG_DISABLE
 /**
    Checks if a message is on a defined blacklist.
@@ -1752,20 +1990,17 @@ DSL_void_t DSL_DRV_VRX_DumpMessage(
 {
    static const DSL_uint16_t *pMsg16;
    static const DSL_uint32_t *pMsg32;
-   DSL_DBG_ModuleLevel_t dbgmlData;
+   DSL_debugLevels_t nDbgLevel;
    DSL_boolean_t bPrint = DSL_FALSE, bDirSet = DSL_FALSE, bAutoMsg = DSL_FALSE;
    DSL_uint8_t i;
 
-   dbgmlData.data.nDbgLevel  = DSL_DBG_NONE;
-   dbgmlData.data.nDbgModule = DSL_DBG_MESSAGE_DUMP;
+   /* The message dump is called for each message, avoid the debug level
+      check overhead of DSL_DRV_DBG_ModuleLevelGet()*/
+   nDbgLevel = DSL_g_dbgLvl[DSL_DBG_MESSAGE_DUMP].nDbgLvl;
 
-   if (DSL_DRV_DBG_ModuleLevelGet(pContext,&dbgmlData) != DSL_SUCCESS)
+   if (nDbgLevel < DSL_DBG_ERR)
    {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: Debug module level get failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return;
+      return ;
    }
 
    if((pData == DSL_NULL) || (nSize < 4))
@@ -1776,14 +2011,9 @@ DSL_void_t DSL_DRV_VRX_DumpMessage(
    pMsg16 = (DSL_uint16_t*)(pData+2);
    pMsg32 = (DSL_uint32_t*)(pData+2);
 
-   if (dbgmlData.data.nDbgLevel < DSL_DBG_ERR)
-   {
-      return ;
-   }
-
    bDirSet = (nMsgId & 0x40) ? DSL_TRUE : DSL_FALSE;
 
-   switch (dbgmlData.data.nDbgLevel)
+   switch (nDbgLevel)
    {
    case DSL_DBG_ERR:
       if ((DSL_DRV_VRX_CheckMessageDumpBlacklist(pContext, nMsgId) == DSL_FALSE) &&
@@ -1874,6 +2104,12 @@ DSL_Error_t DSL_DRV_VRX_ChReadMessage(
       else
          nErrCode = DSL_ERROR;
 
+      if (pContext->msgTrace.ctrl.bEnable == DSL_TRUE)
+      {
+         DSL_DRV_VRX_MsgTrace(pContext, pMsg->msgClassifier, pMsg->msgId,
+            pMsg->pPayload, pMsg->paylSize_byte, DSL_TRUE);
+      }
+
 #ifndef DSL_DEBUG_DISABLE
       DSL_DRV_VRX_DumpMessage(pContext, pMsg->msgClassifier,
          pMsg->msgId, (DSL_uint16_t *)pMsg->pPayload,
@@ -1903,6 +2139,13 @@ DSL_Error_t DSL_DRV_VRX_ChRequestMessage(
    DSL_CHECK_POINTER(pContext, pContext->pDevCtx->lowHandle);
    DSL_CHECK_ERR_CODE();
 
+   if (pContext->msgTrace.ctrl.bEnable == DSL_TRUE)
+   {
+      DSL_DRV_VRX_MsgTrace(pContext, pRw->write_msg.msgClassifier,
+         pRw->write_msg.msgId, pRw->write_msg.pPayload,
+         pRw->write_msg.paylSize_byte, DSL_FALSE);
+   }
+
 #ifndef DSL_DEBUG_DISABLE
    DSL_DRV_VRX_DumpMessage(pContext, pRw->write_msg.msgClassifier,
       pRw->write_msg.msgId, (DSL_uint16_t *)pRw->write_msg.pPayload,
@@ -1927,6 +2170,13 @@ DSL_Error_t DSL_DRV_VRX_ChRequestMessage(
       nErrCode = DSL_ERROR;
    }
 
+   if ((ret >= 0) && (pContext->msgTrace.ctrl.bEnable == DSL_TRUE))
+   {
+      DSL_DRV_VRX_MsgTrace(pContext, pRw->ack_msg.msgClassifier,
+         pRw->ack_msg.msgId, pRw->ack_msg.pPayload,
+         pRw->ack_msg.paylSize_byte, DSL_TRUE);
+   }
+
 #ifndef DSL_DEBUG_DISABLE
    /* if ret was ok, pRw contains the proper answer already */
    DSL_DRV_VRX_DumpMessage(pContext, pRw->ack_msg.msgClassifier,
@@ -1945,6 +2195,7 @@ DSL_Error_t DSL_DRV_VRX_ChRequestMessage(
 
    \param pContext Pointer to DSL CPE library context structure, [I]
    \param pMsg     pointer to message exchange data, [I/O]
+   \param pRetries number of retries, incremented for each retry, [I/O]
 
    \return
    Return values are defined within the DSL_Error_t definition
@@ -1953,7 +2204,8 @@ DSL_Error_t DSL_DRV_VRX_ChRequestMessage(
 */
 static DSL_Error_t DSL_DRV_VRX_MsgTransmit(
    DSL_Context_t *pContext,
-   IOCTL_MEI_messageSend_t *pMsg)
+   IOCTL_MEI_messageSend_t *pMsg,
+   DSL_uint32_t *pRetries)
 {
    DSL_Error_t nRet = DSL_SUCCESS;
    DSL_boolean_t bBlockLine = DSL_FALSE;
@@ -1966,6 +2218,11 @@ static DSL_Error_t DSL_DRV_VRX_MsgTransmit(
 
    for (i=0; i<3; i++)
    {
+      if (i > 0)
+      {
+         (*pRetries)++;
+      }
+
       /* for any retry set the CMD and ACK Buffer length again,
          because the driver is changing these fields to indicate
          the bytes processed */
@@ -2120,6 +2377,323 @@ static DSL_Error_t DSL_DRV_VRX_MsgTransmit(
    return nRet;
 }
 
+/*
+   Updates the device message statistics of the line.
+   Has to be called while the device (bspMutex) is locked.
+
+   \param pContext     Pointer to dsl cpe drive context structure, [I]
+   \param nMsgID       Message ID, [I]
+   \param nResult      Result of the message exchange, [I]
+   \param nRetries     Number of retries including the ack mismatches, [I]
+   \param nAckMismatch Number of acknowledges with a wrong message ID, [I]
+   \param nRoundTrip   Round-trip time [ns], [I]
+*/
+static DSL_void_t DSL_DRV_VRX_MsgStatisticsUpdate(
+   DSL_Context_t *pContext,
+   const DSL_uint16_t nMsgID,
+   const DSL_Error_t nResult,
+   const DSL_uint32_t nRetries,
+   const DSL_uint32_t nAckMismatch,
+   const DSL_uint32_t nRoundTrip)
+{
+   DSL_MsgStatisticsTable_t *pTable = &(pContext->msgStats);
+   DSL_MsgStatisticsEntry_t *pEntry = DSL_NULL;
+   DSL_uint32_t i, nSlot, nLatency, nBin;
+
+   /* Find the slot of the message ID or the first free one*/
+   nSlot = ((DSL_uint32_t)nMsgID * 0x9E37) >> 10;
+   for (i = 0; i < DSL_MSG_STATISTICS_ENTRIES_MAX; i++, nSlot++)
+   {
+      pEntry = &(pTable->entry[nSlot & (DSL_MSG_STATISTICS_ENTRIES_MAX - 1)]);
+      if ((pEntry->nSent == 0) || (pEntry->nMsgId == nMsgID))
+      {
+         break;
+      }
+   }
+
+   if (i == DSL_MSG_STATISTICS_ENTRIES_MAX)
+   {
+      pTable->nOverflow++;
+      return;
+   }
+
+   nLatency = nRoundTrip / 1000;
+   for (nBin = 0; (nLatency > 1) && (nBin < DSL_MSG_STATISTICS_HIST_BINS - 1);
+        nBin++)
+   {
+      nLatency >>= 1;
+   }
+   nLatency = nRoundTrip / 1000;
+
+   if (pEntry->nSent == 0)
+   {
+      /* Claim the slot, it becomes visible with the first nSent update*/
+      pEntry->nMsgId      = nMsgID;
+      pEntry->nLatencyMin = nLatency;
+      pEntry->nLatencyMax = nLatency;
+   }
+   else
+   {
+      if (nLatency < pEntry->nLatencyMin)
+      {
+         pEntry->nLatencyMin = nLatency;
+      }
+      if (nLatency > pEntry->nLatencyMax)
+      {
+         pEntry->nLatencyMax = nLatency;
+      }
+   }
+
+   pEntry->nLatencyHist[nBin]++;
+   pEntry->nRetries     += nRetries;
+   pEntry->nAckMismatch += nAckMismatch;
+
+   switch (nResult)
+   {
+   case DSL_SUCCESS:
+      break;
+   case DSL_WRN_FIRMWARE_MSG_DENIED:
+      pEntry->nDenied++;
+      break;
+   case DSL_ERR_FUNCTION_WAITING:
+   case DSL_ERR_FUNCTION_WAITING_TIMEOUT:
+      pEntry->nTimeouts++;
+      break;
+   default:
+      if (nResult < DSL_SUCCESS)
+      {
+         pEntry->nErrors++;
+      }
+      break;
+   }
+
+   pEntry->nSent++;
+}
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+/*
+   Configuration messages written by DSL_DRV_DEV_ModemWriteConfig which are
+   handled by the delta write. Actions like CMD_MODEMFSM_STATESET are never
+   skipped.
+*/
+static const DSL_uint16_t g_VRxConfigWriteMsgList[] =
+{
+   CMD_HS_TONEGROUPSET,
+   CMD_REINITNE_CONFIGURE,
+   CMD_XTSE_CONFIGURE,
+   CMD_OPERATIONOPTIONSSET,
+   CMD_BEARERCH0_DS_SET,
+   CMD_BEARERCH0_US_SET,
+   CMD_HS_VDSL2PROFILECONTROL,
+   CMD_OLR_CONTROL,
+   CMD_RTX_CONTROL,
+   CMD_NOISEMARGINDELTASET,
+   CMD_SYSVENDORID_R_SET,
+   CMD_SYSVENDORVERSIONNUM_R_SET,
+   CMD_SYSVENDORSERIALNUM_R_SET,
+   CMD_AUXINVENTORYINFO_R_SET,
+   CMD_MISC_CONFIGSET,
+   CMD_TESTOPTIONSSET,
+#ifdef FW_R9
+   CMD_MODEMFSM_OPTIONS2SET,
+#else
+   CMD_MODEMOPTIONSSET,
+#endif
+   CMD_PSD_CALIBRATION_US_SET,
+   CMD_PSD_CALIBRATION_DS_SET,
+   CMD_MODEMFSM_EVENTCONFIGURE,
+   CMD_PAF_HS_CONTROL,
+   CMD_PAF_PME_ID_SET,
+   /* Delimeter only*/
+   0xFFFF
+};
+
+/*
+   Checks whether a message has to be sent with respect to the configuration
+   delta write. Has to be called while the device (bspMutex) is locked.
+
+   \param pContext Pointer to dsl cpe drive context structure, [I]
+   \param nMsgID   Message ID, [I]
+   \param nLength  number of bytes of the message payload, [I]
+   \param pData    pointer to the message payload data, [I]
+   \param nLenAck  available buffer size for received ack, [I]
+   \param pDataAck pointer to buffer for receiving ack message, filled with
+                   the recorded acknowledge if the message is skipped, [O]
+   \param ppEntry  entry to be updated after the message has been sent,
+                   DSL_NULL if the payload shall not be recorded, [O]
+
+   \return
+   DSL_FALSE if the message is unchanged since the last configuration write
+   within the current firmware session and might be skipped
+*/
+static DSL_boolean_t DSL_DRV_VRX_ConfigWriteCheck(
+   DSL_Context_t *pContext,
+   const DSL_uint16_t nMsgID,
+   const DSL_uint16_t nLength,
+   const DSL_uint8_t *pData,
+   const DSL_uint16_t nLenAck,
+   DSL_uint8_t *pDataAck,
+   DSL_VRX_ConfigWriteEntry_t **ppEntry)
+{
+   DSL_VRX_ConfigWriteCache_t *pCache = &(pContext->pDevCtx->data.configWrite);
+   DSL_VRX_ConfigWriteEntry_t *pEntry = DSL_NULL, *pFree = DSL_NULL;
+   DSL_uint32_t nHash = 0x811C9DC5, i;
+
+   *ppEntry = DSL_NULL;
+
+   /* Only configuration messages are handled*/
+   for (i = 0; g_VRxConfigWriteMsgList[i] != 0xFFFF; i++)
+   {
+      if (g_VRxConfigWriteMsgList[i] == nMsgID)
+      {
+         break;
+      }
+   }
+
+   if (g_VRxConfigWriteMsgList[i] == 0xFFFF)
+   {
+      return DSL_TRUE;
+   }
+
+   for (i = 0; i < DSL_VRX_CONFIG_WRITE_ENTRIES_MAX; i++)
+   {
+      if (!pCache->entry[i].bValid)
+      {
+         if (pFree == DSL_NULL)
+         {
+            pFree = &(pCache->entry[i]);
+         }
+      }
+      else if (pCache->entry[i].nMsgID == nMsgID)
+      {
+         pEntry = &(pCache->entry[i]);
+         break;
+      }
+   }
+
+   if (!pCache->bActive || (nLenAck > DSL_VRX_CONFIG_WRITE_ACK_MAX))
+   {
+      /* Written outside of the configuration write, the recorded payload does
+         not reflect the firmware configuration anymore. The same applies if
+         the acknowledge can not be recorded*/
+      if (pEntry != DSL_NULL)
+      {
+         pEntry->bValid = DSL_FALSE;
+      }
+
+      return DSL_TRUE;
+   }
+
+   for (i = 0; i < nLength; i++)
+   {
+      nHash = (nHash ^ pData[i]) * 0x01000193;
+   }
+
+   if (pEntry != DSL_NULL)
+   {
+      if (pCache->bValid && (pEntry->nLength == nLength) &&
+          (pEntry->nHash == nHash) && (pEntry->nLenAck == nLenAck))
+      {
+         memcpy(pDataAck, pEntry->ack, nLenAck);
+         pCache->nSkipped++;
+         return DSL_FALSE;
+      }
+   }
+   else
+   {
+      pEntry = pFree;
+   }
+
+   if (pEntry != DSL_NULL)
+   {
+      /* Claimed on successful transmission only*/
+      pEntry->nMsgID  = nMsgID;
+      pEntry->nLength = nLength;
+      pEntry->nHash   = nHash;
+      pEntry->nLenAck = nLenAck;
+      pEntry->bValid  = DSL_FALSE;
+      *ppEntry = pEntry;
+   }
+
+   return DSL_TRUE;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ConfigWriteStart(
+   DSL_Context_t *pContext)
+{
+   DSL_VRX_ConfigWriteCache_t *pCache = &(pContext->pDevCtx->data.configWrite);
+
+   if (DSL_DRV_MUTEX_LOCK(pContext->bspMutex))
+   {
+      /* Send all messages*/
+      return;
+   }
+
+   pCache->bActive  = DSL_TRUE;
+   pCache->nSkipped = 0;
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ConfigWriteEnd(
+   DSL_Context_t *pContext,
+   const DSL_Error_t nResult)
+{
+   DSL_VRX_ConfigWriteCache_t *pCache = &(pContext->pDevCtx->data.configWrite);
+   DSL_boolean_t bLocked;
+
+   bLocked = DSL_DRV_MUTEX_LOCK(pContext->bspMutex) ? DSL_FALSE : DSL_TRUE;
+
+   pCache->bActive = DSL_FALSE;
+   if ((nResult == DSL_SUCCESS) && bLocked)
+   {
+      pCache->bValid = DSL_TRUE;
+
+      DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+         "DSL[%02d]: Configuration write skipped %d unchanged messages"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCache->nSkipped));
+   }
+   else
+   {
+      /* The firmware configuration is unknown*/
+      memset(pCache, 0x0, sizeof(DSL_VRX_ConfigWriteCache_t));
+   }
+
+   if (bLocked)
+   {
+      DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_void_t DSL_DRV_VRX_ConfigWriteInvalidate(
+   DSL_Context_t *pContext)
+{
+   DSL_boolean_t bLocked;
+
+   bLocked = DSL_DRV_MUTEX_LOCK(pContext->bspMutex) ? DSL_FALSE : DSL_TRUE;
+
+   memset(&(pContext->pDevCtx->data.configWrite), 0x0,
+      sizeof(DSL_VRX_ConfigWriteCache_t));
+
+   if (bLocked)
+   {
+      DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+   }
+}
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
 /*
    This function triggers to send a specified message which requests data from
    the local device and waits for appropriate answer.
@@ -2151,6 +2725,11 @@ DSL_Error_t DSL_DRV_VRX_SendMessage(
    DSL_boolean_t bMsgSendRequired = DSL_FALSE;
    DSL_uint32_t i = 0;
    DSL_uint8_t nMaxRetry;
+   DSL_uint32_t nStartSec = 0, nStartNSec = 0, nLockWait = 0, nRoundTrip = 0;
+   DSL_uint32_t nRetries = 0;
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   DSL_VRX_ConfigWriteEntry_t *pCfgEntry = DSL_NULL;
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
 
    /* Handle VRX message white list*/
    while (g_VRxMsgWhitelist[i] != 0xFFFF)
@@ -2210,15 +2789,41 @@ DSL_Error_t DSL_DRV_VRX_SendMessage(
       return nErrCode;
    }
 
+   DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_MSG_SEND_ENTRY, 0,
+      nMsgID, nLength, 0, 0);
+   DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
+
    if (DSL_DRV_MUTEX_LOCK(pContext->bspMutex))
    {
       DSL_DEBUG(DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Getting mei driver semaphore failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
+      DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_MSG_SEND_EXIT, DSL_ERROR,
+         nMsgID, 0, DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec), 0);
+
       return DSL_ERROR;
    }
 
+   nLockWait = DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   if (!DSL_DRV_VRX_ConfigWriteCheck(pContext, (DSL_uint16_t)(nMsgID & 0xFFFF),
+          nLength, pData, nLenAck, pDataAck, &pCfgEntry))
+   {
+      DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
+
+      DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+         "DSL[%02d]: MsgID=0x%04X transmit skipped (unchanged configuration)"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nMsgID));
+
+      DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_MSG_SEND_EXIT, DSL_SUCCESS,
+         nMsgID, 0, nLockWait, 0);
+
+      return DSL_SUCCESS;
+   }
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
    i = 0;
    nMaxRetry = 3;
    while (i < nMaxRetry)
@@ -2234,7 +2839,7 @@ DSL_Error_t DSL_DRV_VRX_SendMessage(
       sMsg.write_msg.paylSize_byte  = nLength;
       sMsg.ack_msg.paylSize_byte    = nLenAck;
 
-      nErrCode = DSL_DRV_VRX_MsgTransmit(pContext, &sMsg);
+      nErrCode = DSL_DRV_VRX_MsgTransmit(pContext, &sMsg, &nRetries);
 
       /* check if received ID was the same as the sent one */
       if ( ((DSL_uint16_t)(nMsgID & 0xFFFF)) !=
@@ -2263,8 +2868,25 @@ DSL_Error_t DSL_DRV_VRX_SendMessage(
          DSL_DEV_NUM(pContext), nMaxRetry));
    }
 
+   nRoundTrip = DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec) - nLockWait;
+
+   /* The statistics are protected by the device lock*/
+   DSL_DRV_VRX_MsgStatisticsUpdate(pContext, (DSL_uint16_t)(nMsgID & 0xFFFF),
+      nErrCode, nRetries + i, i, nRoundTrip);
+
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   if ((pCfgEntry != DSL_NULL) && (nErrCode == DSL_SUCCESS))
+   {
+      memcpy(pCfgEntry->ack, pDataAck, nLenAck);
+      pCfgEntry->bValid = DSL_TRUE;
+   }
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
    DSL_DRV_MUTEX_UNLOCK(pContext->bspMutex);
 
+   DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_MSG_SEND_EXIT, nErrCode,
+      nMsgID, nRetries + i, nLockWait, nRoundTrip);
+
    return nErrCode;
 }
 
@@ -2279,7 +2901,7 @@ DSL_Error_t DSL_DRV_VRX_SendMsgSnrGet(
    DSL_G997_NSCData8_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint16_t i = 0;
+   DSL_uint16_t i = 0, nPairs = 0;
    DSL_uint16_t nTonesLeft, nTonesCurrent, nTonesDone, nDataNum = 512;
    /* assume US/DS to have the same Msg Structures */
    CMD_SNR_DS_Get_t  sCmd;
@@ -2346,15 +2968,16 @@ DSL_Error_t DSL_DRV_VRX_SendMsgSnrGet(
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
             2*sAck.Index, 2*(sAck.Index + sAck.Length - 1)));
 
-         for (i = 0;
-               (i < sAck.Length) && (i < nTonesMax/2) && (i < nMaxNumOfEntries) &&
-               ((2*(i + sAck.Index) + 1) < DSL_MAX_NSC); i++)
+         nPairs = DSL_DRV_VRX_ToneNumLimit(sAck.Index,
+            DSL_MIN(DSL_MIN(sAck.Length, nTonesMax/2), nMaxNumOfEntries),
+            DSL_MAX_NSC/2);
+
+         /* Copy received data to structure */
+         DSL_DRV_VRX_ToneDataPairsUnpack(&(pData->nNSCData[2*sAck.Index]),
+            (DSL_uint8_t*)sAck.SNRpsds, nPairs);
+
+         for (i = 0; i < nPairs; i++)
          {
-            /* Copy received data to structure */
-            pData->nNSCData[2*(i + sAck.Index)] =
-               sAck.SNRpsds[i].snr_00;
-            pData->nNSCData[2*(i + sAck.Index) + 1] =
-               sAck.SNRpsds[i].snr_01;
             DSL_DEBUG(DSL_DBG_MSG,(pContext, SYS_DBG_MSG"%04X, %04X, ",
                pData->nNSCData[2*(i + sAck.Index)],
                pData->nNSCData[2*(i + sAck.Index) + 1]));
@@ -2396,7 +3019,7 @@ DSL_Error_t DSL_DRV_VRX_SendMsgSnrPerGroupesGet(
    DSL_G997_NSCData8_t *pData)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint16_t i = 0;
+   DSL_uint16_t i = 0, nPairs = 0;
    DSL_uint16_t nGroupesLeft, nGroupesCurrent;
    /* assume US/DS to have the same Msg Structures */
    CMD_SNR_DS_Get_t  sCmd;
@@ -2474,15 +3097,16 @@ DSL_Error_t DSL_DRV_VRX_SendMsgSnrPerGroupesGet(
                DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
                2*sAck.Index, 2*(sAck.Index + sAck.Length - 1)));
 
-            for (i = 0;
-                  (i < sAck.Length) && (i < nGroupesMax/2) && (i < nMaxNumOfEntries) &&
-                  ((2*(i + sAck.Index) + 1) < DSL_MAX_NSC); i++)
+            nPairs = DSL_DRV_VRX_ToneNumLimit(sAck.Index,
+               DSL_MIN(DSL_MIN(sAck.Length, nGroupesMax/2), nMaxNumOfEntries),
+               DSL_MAX_NSC/2);
+
+            /* Copy received data to structure */
+            DSL_DRV_VRX_ToneDataPairsUnpack(&(pData->nNSCData[2*sAck.Index]),
+               (DSL_uint8_t*)sAck.SNRpsds, nPairs);
+
+            for (i = 0; i < nPairs; i++)
             {
-               /* Copy received data to structure */
-               pData->nNSCData[2*(i + sAck.Index)] =
-                  sAck.SNRpsds[i].snr_00;
-               pData->nNSCData[2*(i + sAck.Index) + 1] =
-                  sAck.SNRpsds[i].snr_01;
                DSL_DEBUG(DSL_DBG_MSG,(pContext, SYS_DBG_MSG"%04X, %04X, ",
                   pData->nNSCData[2*(i + sAck.Index)],
                   pData->nNSCData[2*(i + sAck.Index) + 1]));
@@ -2690,7 +3314,7 @@ DSL_Error_t DSL_DRV_VRX_SendMsgHlogGet(
 {
    DSL_uint16_t nTonesMax = 128, nDataNum = 512;
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint16_t i = 0;
+   DSL_uint16_t i = 0, nNum = 0;
    DSL_uint16_t nTonesLeft, nTonesCurrent, nTonesDone;
    /* assume US/DS to have the same Msg Structures */
    CMD_HlogDS_Get_t  sCmd;
@@ -2754,12 +3378,16 @@ DSL_Error_t DSL_DRV_VRX_SendMsgHlogGet(
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
             sAck.Index, sAck.Index + sAck.Length - 1));
 
-         for( i = 0;
-             (i < sAck.Length) && (i < nTonesMax) && (i < nMaxNumOfEntries) &&
-             (i + sAck.Index < DSL_MAX_NSC); i++)
+         nNum = DSL_DRV_VRX_ToneNumLimit(sAck.Index,
+            DSL_MIN(DSL_MIN(sAck.Length, nTonesMax), nMaxNumOfEntries),
+            DSL_MAX_NSC);
+
+         /* Copy received data to structure */
+         memcpy(&(pData->nNSCData[sAck.Index]), sAck.HLOGpsds,
+            nNum * sizeof(pData->nNSCData[0]));
+
+         for (i = 0; i < nNum; i++)
          {
-            /* Copy received data to structure */
-            pData->nNSCData[i + sAck.Index] = sAck.HLOGpsds[i];
             DSL_DEBUG(DSL_DBG_MSG,
                (pContext, SYS_DBG_MSG"%04X, ", pData->nNSCData[i + sAck.Index]));
          }
@@ -2805,7 +3433,7 @@ DSL_Error_t DSL_DRV_VRX_SendMsgQlnGet(
 {
    static const DSL_uint16_t nTonesMax = 128;
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint16_t i = 0, nDataNum = 512;
+   DSL_uint16_t i = 0, nPairs = 0, nDataNum = 512;
    DSL_uint16_t nTonesLeft, nTonesCurrent, nTonesDone;
    /* assume US/DS to have the same Msg Structures */
    CMD_QLN_DS_Get_t  sCmd;
@@ -2870,15 +3498,16 @@ DSL_Error_t DSL_DRV_VRX_SendMsgQlnGet(
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
             2*sAck.Index, 2*(sAck.Index + sAck.Length)));
 
-         for (i = 0;
-               (i < sAck.Length) && (i < nTonesMax/2) && (i < nMaxNumOfEntries) &&
-               ((2 * (i + sAck.Index) + 1) < DSL_MAX_NSC); i++)
+         nPairs = DSL_DRV_VRX_ToneNumLimit(sAck.Index,
+            DSL_MIN(DSL_MIN(sAck.Length, nTonesMax/2), nMaxNumOfEntries),
+            DSL_MAX_NSC/2);
+
+         /* Copy received data to structure */
+         DSL_DRV_VRX_ToneDataPairsUnpack(&(pData->nNSCData[2 * sAck.Index]),
+            (DSL_uint8_t*)sAck.QLNds, nPairs);
+
+         for (i = 0; i < nPairs; i++)
          {
-            /* Copy received data to structure */
-            pData->nNSCData[2 * (i + sAck.Index)] =
-               (DSL_uint8_t)(sAck.QLNds[i].qln_00);
-            pData->nNSCData[2 * (i + sAck.Index) + 1] =
-               (DSL_uint8_t)(sAck.QLNds[i].qln_01);
             DSL_DEBUG(DSL_DBG_MSG,(pContext, SYS_DBG_MSG"%02X, %02X, ",
                pData->nNSCData[2 * (i + sAck.Index)],
                pData->nNSCData[2 * (i + sAck.Index) + 1]));
@@ -2914,11 +3543,92 @@ DSL_Error_t DSL_DRV_VRX_SendMsgQlnGet(
 #endif /* INCLUDE_DSL_DELT*/
 
 #ifdef INCLUDE_DSL_G997_PER_TONE
-static DSL_int16_t DSL_DRV_VRX_G997_Q8_8dB_to_Q3_13Linear(DSL_int16_t s_gain_db)
+/**
+   Q8.8 dB to Q3.13 linear conversion, polynomial part. The input range
+   [-14.0dB, +6.0dB] is mapped to [+1.0dB, +3.0dB] in 2dB steps. The table
+   holds the rounded approximation c2*x*x + c1*x + c0 of the mapped Q8.8
+   input x = 0x100 ... 0x300, the entry of x is found at index x - (1<<8).
+*/
+static const DSL_int16_t DSL_DRV_VRX_G997_GainPolyTable[] =
+{
+    9192,  9196,  9200,  9205,  9209,  9213,  9217,  9221,  9225,  9229,
+    9233,  9238,  9242,  9246,  9250,  9254,  9258,  9262,  9267,  9271,
+    9275,  9279,  9283,  9287,  9292,  9296,  9300,  9304,  9308,  9312,
+    9317,  9321,  9325,  9329,  9333,  9337,  9342,  9346,  9350,  9354,
+    9358,  9363,  9367,  9371,  9375,  9379,  9384,  9388,  9392,  9396,
+    9400,  9405,  9409,  9413,  9417,  9422,  9426,  9430,  9434,  9438,
+    9443,  9447,  9451,  9455,  9460,  9464,  9468,  9472,  9477,  9481,
+    9485,  9489,  9494,  9498,  9502,  9506,  9511,  9515,  9519,  9524,
+    9528,  9532,  9536,  9541,  9545,  9549,  9554,  9558,  9562,  9566,
+    9571,  9575,  9579,  9584,  9588,  9592,  9597,  9601,  9605,  9609,
+    9614,  9618,  9622,  9627,  9631,  9635,  9640,  9644,  9648,  9653,
+    9657,  9661,  9666,  9670,  9675,  9679,  9683,  9688,  9692,  9696,
+    9701,  9705,  9709,  9714,  9718,  9722,  9727,  9731,  9736,  9740,
+    9744,  9749,  9753,  9757,  9762,  9766,  9771,  9775,  9779,  9784,
+    9788,  9793,  9797,  9802,  9806,  9810,  9815,  9819,  9824,  9828,
+    9832,  9837,  9841,  9846,  9850,  9855,  9859,  9863,  9868,  9872,
+    9877,  9881,  9886,  9890,  9895,  9899,  9903,  9908,  9912,  9917,
+    9921,  9926,  9930,  9935,  9939,  9944,  9948,  9953,  9957,  9962,
+    9966,  9971,  9975,  9980,  9984,  9989,  9993,  9998, 10002, 10007,
+   10011, 10016, 10020, 10025, 10029, 10034, 10038, 10043, 10047, 10052,
+   10056, 10061, 10065, 10070, 10074, 10079, 10083, 10088, 10093, 10097,
+   10102, 10106, 10111, 10115, 10120, 10124, 10129, 10134, 10138, 10143,
+   10147, 10152, 10156, 10161, 10166, 10170, 10175, 10179, 10184, 10188,
+   10193, 10198, 10202, 10207, 10211, 10216, 10221, 10225, 10230, 10234,
+   10239, 10244, 10248, 10253, 10258, 10262, 10267, 10271, 10276, 10281,
+   10285, 10290, 10295, 10299, 10304, 10308, 10313, 10318, 10322, 10327,
+   10332, 10336, 10341, 10346, 10350, 10355, 10360, 10364, 10369, 10374,
+   10378, 10383, 10388, 10392, 10397, 10402, 10406, 10411, 10416, 10421,
+   10425, 10430, 10435, 10439, 10444, 10449, 10453, 10458, 10463, 10468,
+   10472, 10477, 10482, 10486, 10491, 10496, 10501, 10505, 10510, 10515,
+   10520, 10524, 10529, 10534, 10539, 10543, 10548, 10553, 10558, 10562,
+   10567, 10572, 10577, 10581, 10586, 10591, 10596, 10600, 10605, 10610,
+   10615, 10619, 10624, 10629, 10634, 10639, 10643, 10648, 10653, 10658,
+   10663, 10667, 10672, 10677, 10682, 10687, 10691, 10696, 10701, 10706,
+   10711, 10716, 10720, 10725, 10730, 10735, 10740, 10744, 10749, 10754,
+   10759, 10764, 10769, 10774, 10778, 10783, 10788, 10793, 10798, 10803,
+   10808, 10812, 10817, 10822, 10827, 10832, 10837, 10842, 10847, 10851,
+   10856, 10861, 10866, 10871, 10876, 10881, 10886, 10890, 10895, 10900,
+   10905, 10910, 10915, 10920, 10925, 10930, 10935, 10940, 10945, 10949,
+   10954, 10959, 10964, 10969, 10974, 10979, 10984, 10989, 10994, 10999,
+   11004, 11009, 11014, 11019, 11024, 11028, 11033, 11038, 11043, 11048,
+   11053, 11058, 11063, 11068, 11073, 11078, 11083, 11088, 11093, 11098,
+   11103, 11108, 11113, 11118, 11123, 11128, 11133, 11138, 11143, 11148,
+   11153, 11158, 11163, 11168, 11173, 11178, 11183, 11188, 11193, 11198,
+   11203, 11208, 11213, 11218, 11223, 11228, 11233, 11238, 11244, 11249,
+   11254, 11259, 11264, 11269, 11274, 11279, 11284, 11289, 11294, 11299,
+   11304, 11309, 11314, 11319, 11325, 11330, 11335, 11340, 11345, 11350,
+   11355, 11360, 11365, 11370, 11375, 11381, 11386, 11391, 11396, 11401,
+   11406, 11411, 11416, 11421, 11427, 11432, 11437, 11442, 11447, 11452,
+   11457, 11462, 11468, 11473, 11478, 11483, 11488, 11493, 11498, 11504,
+   11509, 11514, 11519, 11524, 11529, 11535, 11540, 11545, 11550, 11555,
+   11560, 11566, 11571
+};
+
+/**
+   Adjustment factors (Q2.14) for every 2dB step of the mapping above,
+   10^(2/20) steps for values above +3dB, 10^(-2/20) steps for values
+   below +1dB. The factors include the truncation of the former
+   iterative calculation.
+*/
+static const DSL_int16_t DSL_DRV_VRX_G997_GainAdjUpTable[] =
 {
-   DSL_int32_t s_adj_factor = (1 << 14);   /* nominal adjustment factor*/
-   DSL_int32_t l_Acc, l_temp;
-   DSL_int16_t s_DecimalValue;
+   16384, 20626, 25966
+};
+
+static const DSL_int16_t DSL_DRV_VRX_G997_GainAdjDownTable[] =
+{
+   16384, 13014, 10337,  8210,  6521,  5179,  4113,  3267,  2595
+};
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_int16_t DSL_DRV_VRX_G997_Q8_8dB_to_Q3_13Linear(DSL_int16_t s_gain_db)
+{
+   DSL_int32_t l_Acc, s_adj_factor;
+   DSL_int16_t nSteps;
 
    if ((DSL_uint16_t)s_gain_db == 0x8000)
    {
@@ -2934,53 +3644,31 @@ static DSL_int16_t DSL_DRV_VRX_G997_Q8_8dB_to_Q3_13Linear(DSL_int16_t s_gain_db)
    }
    else
    {
+      /* Map input to range [+1, +3] in 2dB steps*/
       if (s_gain_db > 3<<8)
       {
-         while (s_gain_db > 3<<8)
-         {
-            s_gain_db -= 2<<8;
-            /* for every 2dB, we adjust the final result by 10^(2/20) = (20626/16384)*/
-            l_temp = (DSL_int32_t)(20626 * s_adj_factor);
-            s_adj_factor = (DSL_int16_t)(l_temp >> 14);
-         }
+         nSteps = (DSL_int16_t)((s_gain_db - (3<<8) + (2<<8) - 1) >> 9);
+         s_gain_db -= (DSL_int16_t)(nSteps << 9);
+         s_adj_factor = DSL_DRV_VRX_G997_GainAdjUpTable[nSteps];
       }
-      else if (s_gain_db < 256)
+      else if (s_gain_db < 1<<8)
       {
-         /* Map input to range [+1, +3], where the approximation is optimized for*/
-         while (s_gain_db < 256)
-         {
-            s_gain_db += 2<<8;
-            /* for every 2dB, we adjust the final result by 10^(-2/20) = (13014/16384)*/
-            l_temp = (DSL_int32_t)(13014 * s_adj_factor);
-            s_adj_factor = (DSL_int16_t)(l_temp >> 14);
-         }
+         nSteps = (DSL_int16_t)(((1<<8) - s_gain_db + (2<<8) - 1) >> 9);
+         s_gain_db += (DSL_int16_t)(nSteps << 9);
+         s_adj_factor = DSL_DRV_VRX_G997_GainAdjDownTable[nSteps];
+      }
+      else
+      {
+         s_adj_factor = (1 << 14);
       }
 
-      /* The coefficients c0, c1 and c2 are represented as mantissa
-         plus exponent pairs to get the maximum dynamic range. Hence
-         the rightshifts after the multiplications. c0 is a constant and
-         can be greater than 16 bits.*/
-      l_Acc = (DSL_int32_t)(s_gain_db * s_gain_db);
-
-      l_Acc  = l_Acc  >> 5;
-
-      l_temp = l_Acc * 17500;
-      l_Acc  = l_temp >> 6;                           // c2*x*x
-      l_temp = (DSL_int32_t)(29306 * s_gain_db);
-      l_Acc += l_temp;
-
-      l_Acc +=  67240537;                         // c2*x*x + c1*x + c0
-      l_Acc  = (l_Acc + (1 << 12)) >> 13;         // round result
-
-      // Adjust and round in case original input was not in range [+1, +3]
-      l_temp = l_Acc * s_adj_factor;
-      l_Acc  = (l_temp + (1 << 13)) >> 14;
+      l_Acc = DSL_DRV_VRX_G997_GainPolyTable[s_gain_db - (1<<8)];
 
+      /* Adjust and round in case original input was not in range [+1, +3]*/
+      l_Acc = (l_Acc * s_adj_factor + (1 << 13)) >> 14;
    }
 
-   s_DecimalValue = (DSL_int16_t) l_Acc;
-
-   return (s_DecimalValue);
+   return (DSL_int16_t)l_Acc;
 }
 
 /*
@@ -3251,6 +3939,237 @@ DSL_Error_t DSL_DRV_VRX_GainAllocationTableGet(
    return (nErrCode);
 }
 
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
+*/
+DSL_Error_t DSL_DRV_VRX_ToneRangeGet(
+   DSL_Context_t *pContext,
+   const DSL_G997_PerToneType_t nType,
+   const DSL_AccessDir_t nDirection,
+   DSL_G997_PerToneWindowData_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t nMsgId = 0, nStop = 0;
+   DSL_uint16_t nDataNum = 0, nTonesMax = 0, nMaxNumOfEntries = 0,
+                nTone = 0, nLast = 0, nBase = 0, nNum = 0, i = 0;
+   DSL_boolean_t bPairs = DSL_FALSE;
+   /* assume all tables to have the same CMD Structures */
+   CMD_BAT_TableEntriesGet_t sCmd;
+   union
+   {
+      ACK_BAT_TableEntriesGet_t Bat;
+      ACK_GainTableEntriesGet_t Gains;
+      ACK_SNR_DS_Get_t Snr;
+      ACK_HlogDS_Get_t Hlog;
+      ACK_QLN_DS_Get_t Qln;
+   } sAck;
+   const DSL_uint8_t *pSrc = DSL_NULL;
+   DSL_uint8_t nPairData[2 * DSL_ARRAY_LENGTH(sAck.Bat.BAT)];
+   DSL_uint16_t nValue = 0;
+   DSL_BandList_t sBandList;
+   DSL_uint16_t nBand = 0;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_VRX_ToneRangeGet(nType=%d, "
+      "nDirection=%d, nFirstTone=%d, nNumTones=%d)"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext), nType, nDirection, pData->nFirstTone,
+      pData->nNumTones));
+
+   if (!DSL_DRV_VRX_FirmwareXdslModeCheck(pContext, DSL_VRX_FW_VDSL2))
+   {
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   memset(&sBandList, 0x0, sizeof(DSL_BandList_t));
+
+   switch (nType)
+   {
+   case DSL_G997_PER_TONE_BITS:
+      nMsgId = CMD_BAT_TABLEENTRIESGET;
+      nMaxNumOfEntries = DSL_ARRAY_LENGTH(sAck.Bat.BAT);
+      nTonesMax = 2 * nMaxNumOfEntries;
+      nDataNum = DSL_MAX_NSC;
+      pSrc = (const DSL_uint8_t*)sAck.Bat.BAT;
+      bPairs = DSL_TRUE;
+      break;
+   case DSL_G997_PER_TONE_GAINS:
+      nMsgId = CMD_GAINTABLEENTRIESGET;
+      nMaxNumOfEntries = DSL_ARRAY_LENGTH(sAck.Gains.Gains);
+      nTonesMax = nMaxNumOfEntries;
+      nDataNum = DSL_MAX_NSC;
+      pSrc = (const DSL_uint8_t*)sAck.Gains.Gains;
+      break;
+   case DSL_G997_PER_TONE_SNR:
+      nMsgId = (nDirection == DSL_DOWNSTREAM) ? CMD_SNR_DS_GET : CMD_SNR_US_GET;
+      nMaxNumOfEntries = DSL_ARRAY_LENGTH(sAck.Snr.SNRpsds);
+      nTonesMax = 256;
+      nDataNum = VRX_MAX_SCGROUPS;
+      pSrc = (const DSL_uint8_t*)sAck.Snr.SNRpsds;
+      bPairs = DSL_TRUE;
+      break;
+   case DSL_G997_PER_TONE_DELT_HLOG:
+      nMsgId = (nDirection == DSL_DOWNSTREAM) ? CMD_HLOGDS_GET : CMD_HLOGUS_GET;
+      nMaxNumOfEntries = DSL_ARRAY_LENGTH(sAck.Hlog.HLOGpsds);
+      nTonesMax = 128;
+      nDataNum = VRX_MAX_SCGROUPS;
+      pSrc = (const DSL_uint8_t*)sAck.Hlog.HLOGpsds;
+      break;
+   case DSL_G997_PER_TONE_DELT_QLN:
+      nMsgId = (nDirection == DSL_DOWNSTREAM) ? CMD_QLN_DS_GET : CMD_QLN_US_GET;
+      nMaxNumOfEntries = DSL_ARRAY_LENGTH(sAck.Qln.QLNds);
+      nTonesMax = 128;
+      nDataNum = VRX_MAX_SCGROUPS;
+      pSrc = (const DSL_uint8_t*)sAck.Qln.QLNds;
+      bPairs = DSL_TRUE;
+      break;
+   default:
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   /* The allocation tables contain the tones of the used bands only, the
+      other tables are read as one band*/
+   if ((nType == DSL_G997_PER_TONE_BITS) || (nType == DSL_G997_PER_TONE_GAINS))
+   {
+      nErrCode = DSL_DRV_VRX_SendMsgBandControlGet(pContext, nDirection,
+                    &sBandList);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         DSL_DEBUG(DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - getting current band "
+            "config failed!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         return nErrCode;
+      }
+   }
+   else
+   {
+      sBandList.nNumData = 1;
+      sBandList.nBand[0].nFirstToneIndex = 0;
+      sBandList.nBand[0].nLastToneIndex = (DSL_uint16_t)(nDataNum - 1);
+   }
+
+   /* End of the window (exclusive) within the table*/
+   nStop = (DSL_uint32_t)pData->nFirstTone + pData->nNumTones;
+   if (nStop > nDataNum)
+   {
+      nStop = nDataNum;
+   }
+
+   pData->nNumData = nDataNum;
+   pData->nNumReturned = (nStop > pData->nFirstTone) ?
+      (DSL_uint16_t)(nStop - pData->nFirstTone) : 0;
+
+   if (pData->nNumReturned > 0)
+   {
+      memset(pData->pNSCData, 0x0,
+         pData->nNumReturned * sizeof(pData->pNSCData[0]));
+   }
+
+   /* retrieve data only for the part of the window within each band*/
+   for (nBand = 0; (nBand < sBandList.nNumData) &&
+                   (nBand < DSL_MAX_NUMBER_OF_BANDS) &&
+                   (pData->nNumReturned > 0); nBand++)
+   {
+      nTone = DSL_MAX(pData->nFirstTone, sBandList.nBand[nBand].nFirstToneIndex);
+      nLast = (DSL_uint16_t)DSL_MIN(nStop - 1,
+                 sBandList.nBand[nBand].nLastToneIndex);
+
+      while (nTone <= nLast)
+      {
+         /* Tables with 8 bit values are retrieved in pairs only*/
+         nBase = bPairs ? (DSL_uint16_t)(nTone & ~1) : nTone;
+         nNum = (DSL_uint16_t)DSL_MIN(nLast - nBase + 1, nTonesMax);
+
+         sCmd.Index = bPairs ? (DSL_uint16_t)(nBase / 2) : nBase;
+         sCmd.Length = bPairs ? (DSL_uint16_t)((nNum + 1) / 2) : nNum;
+
+         memset(&sAck, 0x0, sizeof(sAck));
+         nErrCode = DSL_DRV_VRX_SendMessage(pContext, nMsgId,
+                       sizeof(sCmd), (DSL_uint8_t*)&sCmd,
+                       sizeof(sAck), (DSL_uint8_t*)&sAck);
+
+         /* Copy data only if successful and valid */
+         if ((nErrCode < DSL_SUCCESS) || (sAck.Bat.Index != sCmd.Index) ||
+             (sAck.Bat.Length == 0))
+         {
+            DSL_DEBUG(DSL_DBG_ERR,
+               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Failed to retrieve "
+               "tones %d to %d (nType=%d)!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
+               nBase, nBase + nNum - 1, nType));
+
+            nErrCode = DSL_ERROR;
+            break;
+         }
+
+         /* Number of returned tones*/
+         if (bPairs)
+         {
+            nNum = (DSL_uint16_t)(2 * DSL_MIN(DSL_MIN(sAck.Bat.Length,
+                      sCmd.Length), nMaxNumOfEntries));
+            DSL_DRV_VRX_ToneDataPairsUnpack(nPairData, pSrc,
+               (DSL_uint16_t)(nNum / 2));
+         }
+         else
+         {
+            nNum = (DSL_uint16_t)DSL_MIN(DSL_MIN(sAck.Bat.Length, sCmd.Length),
+                      nMaxNumOfEntries);
+         }
+
+         for (i = (DSL_uint16_t)(nTone - nBase);
+              (i < nNum) && (nBase + i <= nLast); i++)
+         {
+            if (bPairs)
+            {
+               nValue = nPairData[i];
+            }
+            else
+            {
+               nValue = ((const DSL_uint16_t*)pSrc)[i];
+
+               if (nType == DSL_G997_PER_TONE_GAINS)
+               {
+                  /* FW Format is Q3.13, see
+                     DSL_DRV_VRX_GainAllocationTableGet*/
+                  if (nDirection == DSL_DOWNSTREAM)
+                  {
+                     nValue = (nValue == 0) ? 0 :
+                        (DSL_uint16_t)(0x400000 / nValue);
+                  }
+                  else
+                  {
+                     nValue >>= 4;
+                  }
+               }
+            }
+
+            pData->pNSCData[nBase + i - pData->nFirstTone] = nValue;
+         }
+
+         nTone = (DSL_uint16_t)(nBase + i);
+      }
+
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+   }
+
+   if (nErrCode != DSL_SUCCESS)
+   {
+      pData->nNumReturned = 0;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_VRX_ToneRangeGet, "
+      "retCode=%d"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return (nErrCode);
+}
+
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_msg_vrx.h'
@@ -3261,14 +4180,14 @@ DSL_Error_t DSL_DRV_VRX_SnrAllocationTableNeGet(
 {
    static const DSL_uint16_t nTonesMax = 100;
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint16_t nTonesLeft = 0, snrQ88 = 0, nTonesCurrent;
-   DSL_uint16_t i = 0;
+   DSL_uint16_t nTonesLeft = 0, nTonesCurrent;
+   DSL_uint16_t i = 0, nNum = 0;
    /* assume US/DS to have the same Msg Structures */
    CMD_SNR_NE_TableEntriesGet_t  sCmd;
    ACK_SNR_NE_TableEntriesGet_t  sAck;
    DSL_BandList_t  sBandList;
    DSL_Band_t    *pBand = DSL_NULL;
-   DSL_uint16_t  nBand = 0, intPart = 0;
+   DSL_uint16_t  nBand = 0;
    DSL_LineStateValue_t nCurrentState = DSL_LINESTATE_UNKNOWN;
    static const DSL_uint8_t nMaxNumOfEntries =
                                sizeof(sAck.SNRps)/sizeof(sAck.SNRps[0]);
@@ -3359,34 +4278,18 @@ DSL_Error_t DSL_DRV_VRX_SnrAllocationTableNeGet(
                      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), sAck.Length, nMaxNumOfEntries));
                }
 
-               for( i = 0;
-                   (i < sAck.Length) && (i<nTonesMax) &&
-                   (i < nMaxNumOfEntries) && (i + sAck.Index < DSL_MAX_NSC); i++)
-               {
-                  /* Copy received data to structure */
-                  if (sAck.SNRps[i]  == Q88_NOVALUE)
-                  {
-                     /* a 0 value indicates that no measurement took place
-                        in FW. DSL CPE API indicates 0xFF in this case. */
-                     pData->nNSCData[i + sAck.Index] = 255;
-                  }
-                  else
-                  {
-                     /* SNR Data from the message is Q8.8 coded,
-                        API value is (SNR[dB]+32)*2
-                       (see chapter 7.5.1.20.4 of G.997.1) */
-                     /*pData->nNSCData[i + sAck.Index] =
-                       (DSL_uint8_t)
-                       ((DSL_DRV_VRX_GetDbFromQ88(sAck.SNRps[i],1)+32) * 2 + 0.5);
-                     */
-
-                     snrQ88  = (DSL_uint16_t)(((sAck.SNRps[i]) + (32 << 8)) * 2);
-                     intPart = (snrQ88 >> 8) & 0xFF;
-
-                     pData->nNSCData[i + sAck.Index] =
-                        (DSL_uint8_t)((snrQ88 & 0xFF) < 128 ? intPart : intPart + 1);
-                  }
+               nNum = DSL_DRV_VRX_ToneNumLimit(sAck.Index,
+                  DSL_MIN(DSL_MIN(sAck.Length, nTonesMax), nMaxNumOfEntries),
+                  DSL_MAX_NSC);
+
+               /* Copy received data to structure. SNR Data from the message
+                  is Q8.8 coded, a 0x8000 value indicates that no measurement
+                  took place in FW. DSL CPE API indicates 0xFF in this case. */
+               DSL_DRV_VRX_ToneSnrQ88Convert(&(pData->nNSCData[sAck.Index]),
+                  (DSL_uint8_t*)sAck.SNRps, nNum);
 
+               for (i = 0; i < nNum; i++)
+               {
                   DSL_DEBUG(DSL_DBG_MSG,
                      (pContext, SYS_DBG_MSG"%02X, ", pData->nNSCData[i + sAck.Index]));
                }
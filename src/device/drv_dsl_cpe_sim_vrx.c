@@ -0,0 +1,918 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+#define DSL_INTERN
+
+#include "drv_dsl_cpe_api.h"
+
+#if defined(DSL_CPE_SIMULATOR_DRIVER) && !defined(__KERNEL__) && \
+    defined(INCLUDE_DSL_CPE_API_VRX)
+
+#include "drv_dsl_cpe_device_vrx.h"
+#include "drv_mei_cpe_api_atm_ptm_intern.h"
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+#undef DSL_DBG_BLOCK
+#define DSL_DBG_BLOCK DSL_DBG_LOW_LEVEL_DRIVER
+
+/** Version string reported by the simulated MEI driver */
+#define DSL_DRV_SIM_VRX_DRV_VERSION    "1.5.0-sim"
+
+/** Maximum length of a script line */
+#define DSL_DRV_SIM_VRX_SCRIPT_LINE_MAX 1024
+
+/** NFC callback as registered by DSL_DRV_VRX_InternalNfcCallBackDataSet */
+typedef DSL_Error_t (*DSL_DRV_SIM_VRX_NfcCallBack_t)(DSL_void_t *pData);
+
+/** Pending notification */
+typedef struct
+{
+   DSL_uint32_t nMsgId;
+   DSL_uint32_t nSize;
+   DSL_uint8_t payload[DSL_DRV_SIM_VRX_PAYLOAD_MAX];
+} DSL_DRV_SIM_VRX_Nfc_t;
+
+/** State of a simulated line, the handle is passed as MEI_DYN_CNTRL_T */
+typedef struct
+{
+   /** Number of open handles (message and NFC handle) */
+   DSL_uint32_t nOpenCount;
+   /** Device was initialized by DSL_DRV_VRX_InternalInitDevice */
+   DSL_boolean_t bInitialized;
+   /** Firmware was downloaded */
+   DSL_boolean_t bFwLoaded;
+   /** Registered NFC callback */
+   DSL_DRV_SIM_VRX_NfcCallBack_t pNfcCallBack;
+   /** Argument of the NFC callback */
+   DSL_void_t *pNfcCallBackData;
+   /** Notification FIFO */
+   DSL_DRV_SIM_VRX_Nfc_t nfcFifo[DSL_DRV_SIM_VRX_NFC_FIFO_SIZE];
+   DSL_uint32_t nNfcRead;
+   DSL_uint32_t nNfcCount;
+   /** Statistics */
+   DSL_DRV_SIM_VRX_Statistics_t stats;
+} DSL_DRV_SIM_VRX_Line_t;
+
+/** Protects the rules and the line states */
+static pthread_mutex_t simVrxMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static DSL_DRV_SIM_VRX_Line_t simVrxLines[DSL_DRV_SIM_VRX_LINES_MAX];
+
+static DSL_DRV_SIM_VRX_Rule_t simVrxRules[DSL_DRV_SIM_VRX_RULES_MAX];
+static DSL_uint32_t simVrxRuleCount = 0;
+
+static DSL_uint32_t simVrxDevices = 1;
+static DSL_uint32_t simVrxLinesPerDevice = 1;
+static DSL_uint32_t simVrxChannelsPerLine = 1;
+
+/**
+   Returns the line state of a handle.
+*/
+static DSL_DRV_SIM_VRX_Line_t* DSL_DRV_SIM_VRX_LineGet(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = (DSL_DRV_SIM_VRX_Line_t*)pMeiDynCntrl;
+
+   if ((pLine < &simVrxLines[0]) ||
+       (pLine >= &simVrxLines[DSL_DRV_SIM_VRX_LINES_MAX]))
+   {
+      return DSL_NULL;
+   }
+
+   return pLine;
+}
+
+/**
+   Sleeps for the given number of microseconds.
+*/
+static DSL_void_t DSL_DRV_SIM_VRX_USecSleep(DSL_uint32_t nUsec)
+{
+   struct timespec ts;
+
+   ts.tv_sec  = nUsec / 1000000;
+   ts.tv_nsec = (long)(nUsec % 1000000) * 1000L;
+
+   while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+   {
+      /* continue with the remaining time */
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_Init(DSL_void_t)
+{
+   const DSL_char_t *pScript;
+
+   DSL_DRV_SIM_VRX_Cleanup();
+
+   pScript = getenv(DSL_DRV_SIM_VRX_SCRIPT_ENV);
+   if ((pScript != DSL_NULL) && (pScript[0] != '\0'))
+   {
+      return (DSL_DRV_SIM_VRX_ScriptLoad(pScript) == DSL_SUCCESS) ?
+         DSL_SUCCESS : DSL_ERROR;
+   }
+
+   return DSL_SUCCESS;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_void_t DSL_DRV_SIM_VRX_Cleanup(DSL_void_t)
+{
+   pthread_mutex_lock(&simVrxMutex);
+
+   memset(simVrxLines, 0, sizeof(simVrxLines));
+   simVrxRuleCount = 0;
+
+   pthread_mutex_unlock(&simVrxMutex);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_void_t DSL_DRV_SIM_VRX_DevLayoutGet(
+   DSL_uint32_t *pDevices,
+   DSL_uint32_t *pLines,
+   DSL_uint32_t *pChannels)
+{
+   *pDevices = simVrxDevices;
+   *pLines = simVrxLinesPerDevice;
+   *pChannels = simVrxChannelsPerLine;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_void_t DSL_DRV_SIM_VRX_DevLayoutSet(
+   DSL_uint32_t nDevices,
+   DSL_uint32_t nLines,
+   DSL_uint32_t nChannels)
+{
+   simVrxDevices = nDevices;
+   simVrxLinesPerDevice = nLines;
+   simVrxChannelsPerLine = nChannels;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_RuleAdd(const DSL_DRV_SIM_VRX_Rule_t *pRule)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   if ((pRule == DSL_NULL) || (pRule->nAckSize > DSL_DRV_SIM_VRX_PAYLOAD_MAX))
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+
+   if (simVrxRuleCount < DSL_DRV_SIM_VRX_RULES_MAX)
+   {
+      simVrxRules[simVrxRuleCount++] = *pRule;
+   }
+   else
+   {
+      nErrCode = DSL_ERR_MEMORY;
+   }
+
+   pthread_mutex_unlock(&simVrxMutex);
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_void_t DSL_DRV_SIM_VRX_RulesClear(DSL_void_t)
+{
+   pthread_mutex_lock(&simVrxMutex);
+   simVrxRuleCount = 0;
+   pthread_mutex_unlock(&simVrxMutex);
+}
+
+/**
+   Parses a numeric script token, '*' is returned as nAny.
+
+   \return
+   DSL_TRUE if the token is valid, DSL_FALSE otherwise
+*/
+static DSL_boolean_t DSL_DRV_SIM_VRX_TokenGet(
+   DSL_char_t **ppSavePtr,
+   DSL_uint32_t nAny,
+   DSL_int32_t nBase,
+   DSL_uint32_t *pValue)
+{
+   DSL_char_t *pToken, *pEnd;
+
+   pToken = strtok_r(DSL_NULL, " \t\r\n", ppSavePtr);
+   if (pToken == DSL_NULL)
+   {
+      return DSL_FALSE;
+   }
+
+   if (strcmp(pToken, "*") == 0)
+   {
+      *pValue = nAny;
+      return DSL_TRUE;
+   }
+
+   *pValue = (DSL_uint32_t)strtol(pToken, &pEnd, nBase);
+
+   return (*pEnd == '\0') ? DSL_TRUE : DSL_FALSE;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_ScriptLoad(const DSL_char_t *pFileName)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   FILE *pFile;
+   DSL_char_t lineBuf[DSL_DRV_SIM_VRX_SCRIPT_LINE_MAX];
+   DSL_char_t *pToken, *pSavePtr, *pComment;
+   DSL_uint32_t nLineNum = 0, nValue, nLayout[3];
+   DSL_DRV_SIM_VRX_Rule_t rule;
+   DSL_boolean_t bValid;
+
+   pFile = fopen(pFileName, "r");
+   if (pFile == DSL_NULL)
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL, SYS_DBG_ERR
+         "DSL: SIM - could not open script '%s'" DSL_DRV_CRLF, pFileName));
+
+      return DSL_ERR_FILE_OPEN;
+   }
+
+   while ((nErrCode == DSL_SUCCESS) &&
+          (fgets(lineBuf, sizeof(lineBuf), pFile) != DSL_NULL))
+   {
+      nLineNum++;
+
+      pComment = strchr(lineBuf, '#');
+      if (pComment != DSL_NULL)
+      {
+         *pComment = '\0';
+      }
+
+      pToken = strtok_r(lineBuf, " \t\r\n", &pSavePtr);
+      if (pToken == DSL_NULL)
+      {
+         continue;
+      }
+
+      bValid = DSL_FALSE;
+
+      if (strcmp(pToken, "layout") == 0)
+      {
+         if (DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &nLayout[0]) &&
+             DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &nLayout[1]) &&
+             DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &nLayout[2]))
+         {
+            DSL_DRV_SIM_VRX_DevLayoutSet(nLayout[0], nLayout[1], nLayout[2]);
+            bValid = DSL_TRUE;
+         }
+      }
+      else if (strcmp(pToken, "rule") == 0)
+      {
+         memset(&rule, 0, sizeof(rule));
+
+         if (DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, DSL_DRV_SIM_VRX_LINE_ANY, 0, &nValue))
+         {
+            rule.nLine = (DSL_uint16_t)nValue;
+
+            if (DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, DSL_DRV_SIM_VRX_MSG_ID_ANY, 0, &rule.nMsgId) &&
+                DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &rule.nLatency) &&
+                DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &nValue))
+            {
+               rule.nRetCode = (DSL_int32_t)nValue;
+
+               if (DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &nValue))
+               {
+                  rule.nFctOpCode = (DSL_uint8_t)nValue;
+
+                  if (DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 0, &rule.nCount))
+                  {
+                     bValid = DSL_TRUE;
+
+                     /* optional acknowledge payload */
+                     while (DSL_DRV_SIM_VRX_TokenGet(&pSavePtr, 0, 16, &nValue))
+                     {
+                        if (rule.nAckSize >= DSL_DRV_SIM_VRX_PAYLOAD_MAX)
+                        {
+                           bValid = DSL_FALSE;
+                           break;
+                        }
+                        rule.ackPayload[rule.nAckSize++] = (DSL_uint8_t)nValue;
+                     }
+                  }
+               }
+            }
+         }
+
+         if (bValid == DSL_TRUE)
+         {
+            nErrCode = DSL_DRV_SIM_VRX_RuleAdd(&rule);
+         }
+      }
+
+      if (bValid == DSL_FALSE)
+      {
+         DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL, SYS_DBG_ERR
+            "DSL: SIM - syntax error in script '%s', line %u" DSL_DRV_CRLF,
+            pFileName, nLineNum));
+
+         nErrCode = DSL_ERR_INVALID_PARAMETER;
+      }
+   }
+
+   fclose(pFile);
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_NfcInject(
+   DSL_uint16_t nLine,
+   DSL_uint32_t nMsgId,
+   const DSL_uint8_t *pPayload,
+   DSL_uint32_t nSize)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine;
+   DSL_DRV_SIM_VRX_Nfc_t *pNfc;
+   DSL_DRV_SIM_VRX_NfcCallBack_t pCallBack;
+   DSL_void_t *pCallBackData;
+
+   if ((nLine >= DSL_DRV_SIM_VRX_LINES_MAX) ||
+       (nSize > DSL_DRV_SIM_VRX_PAYLOAD_MAX) ||
+       ((nSize > 0) && (pPayload == DSL_NULL)))
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   pLine = &simVrxLines[nLine];
+
+   pthread_mutex_lock(&simVrxMutex);
+
+   if (pLine->nNfcCount >= DSL_DRV_SIM_VRX_NFC_FIFO_SIZE)
+   {
+      pLine->stats.nNfcLost++;
+      pthread_mutex_unlock(&simVrxMutex);
+
+      return DSL_ERR_MEMORY;
+   }
+
+   pNfc = &pLine->nfcFifo[(pLine->nNfcRead + pLine->nNfcCount) %
+      DSL_DRV_SIM_VRX_NFC_FIFO_SIZE];
+   pNfc->nMsgId = nMsgId;
+   pNfc->nSize = nSize;
+   if (nSize > 0)
+   {
+      memcpy(pNfc->payload, pPayload, nSize);
+   }
+   pLine->nNfcCount++;
+
+   pCallBack = pLine->pNfcCallBack;
+   pCallBackData = pLine->pNfcCallBackData;
+
+   pthread_mutex_unlock(&simVrxMutex);
+
+   /* The callback takes the locks of the driver, so it is called without
+      holding the simulation lock */
+   if (pCallBack != DSL_NULL)
+   {
+      pCallBack(pCallBackData);
+   }
+
+   return DSL_SUCCESS;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_StatisticsGet(
+   DSL_uint16_t nLine,
+   DSL_DRV_SIM_VRX_Statistics_t *pStats)
+{
+   if ((nLine >= DSL_DRV_SIM_VRX_LINES_MAX) || (pStats == DSL_NULL))
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   *pStats = simVrxLines[nLine].stats;
+   pthread_mutex_unlock(&simVrxMutex);
+
+   return DSL_SUCCESS;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_sim_vrx.h'
+*/
+DSL_void_t DSL_DRV_SIM_VRX_StatisticsReset(DSL_void_t)
+{
+   DSL_uint32_t i;
+
+   pthread_mutex_lock(&simVrxMutex);
+   for (i = 0; i < DSL_DRV_SIM_VRX_LINES_MAX; i++)
+   {
+      memset(&simVrxLines[i].stats, 0, sizeof(DSL_DRV_SIM_VRX_Statistics_t));
+   }
+   pthread_mutex_unlock(&simVrxMutex);
+}
+
+int DSL_DRV_VRX_InternalDevOpen(
+   unsigned short nLineNum,
+   MEI_DYN_CNTRL_T **ppMeiDynCntrl)
+{
+   if ((nLineNum >= DSL_DRV_SIM_VRX_LINES_MAX) || (ppMeiDynCntrl == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   simVrxLines[nLineNum].nOpenCount++;
+   pthread_mutex_unlock(&simVrxMutex);
+
+   *ppMeiDynCntrl = (MEI_DYN_CNTRL_T*)&simVrxLines[nLineNum];
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalDevClose(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+   int nRet = 0;
+
+   if (pLine == DSL_NULL)
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+
+   if (pLine->nOpenCount > 0)
+   {
+      pLine->nOpenCount--;
+      if (pLine->nOpenCount == 0)
+      {
+         pLine->pNfcCallBack = DSL_NULL;
+         pLine->pNfcCallBackData = DSL_NULL;
+      }
+   }
+   else
+   {
+      nRet = -1;
+   }
+
+   pthread_mutex_unlock(&simVrxMutex);
+
+   return nRet;
+}
+
+int DSL_DRV_VRX_InternalInitDevice(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_devInit_t *pInitDev)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if ((pLine == DSL_NULL) || (pInitDev == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pLine->bInitialized = DSL_TRUE;
+   pInitDev->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalDrvVersionGet(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_drvVersion_t *pArgDrvVersion)
+{
+   if ((DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl) == DSL_NULL) ||
+       (pArgDrvVersion == DSL_NULL) || (pArgDrvVersion->pVersionStr == DSL_NULL) ||
+       (pArgDrvVersion->strSize == 0))
+   {
+      return -1;
+   }
+
+   snprintf(pArgDrvVersion->pVersionStr, pArgDrvVersion->strSize, "%s",
+      DSL_DRV_SIM_VRX_DRV_VERSION);
+   pArgDrvVersion->strSize = strlen(pArgDrvVersion->pVersionStr);
+   pArgDrvVersion->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalDevReset(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_reset_t *pArgRstArgs,
+   int rstSrc)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if ((pLine == DSL_NULL) || (pArgRstArgs == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   pLine->bFwLoaded = DSL_FALSE;
+   pLine->nNfcRead = 0;
+   pLine->nNfcCount = 0;
+   pthread_mutex_unlock(&simVrxMutex);
+
+   pArgRstArgs->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalRequestConfig(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_reqCfg_t *pArgDrvCfg)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if ((pLine == DSL_NULL) || (pArgDrvCfg == DSL_NULL))
+   {
+      return -1;
+   }
+
+   memset(pArgDrvCfg, 0, sizeof(IOCTL_MEI_reqCfg_t));
+   pArgDrvCfg->currDrvState = (pLine->bInitialized == DSL_TRUE) ? 1 : 0;
+   pArgDrvCfg->devNum = (unsigned int)(pLine - &simVrxLines[0]);
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalFirmwareDownload(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_fwDownLoad_t *pArgFwDl)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if ((pLine == DSL_NULL) || (pArgFwDl == DSL_NULL) ||
+       (pArgFwDl->pFwImage == DSL_NULL) || (pArgFwDl->size_byte == 0))
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   pLine->bFwLoaded = DSL_TRUE;
+   pLine->stats.nFwDownload++;
+   pthread_mutex_unlock(&simVrxMutex);
+
+   pArgFwDl->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalFirmwareChunkDownload(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_fwChunkDownLoad_t *pArgFwDl)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if ((pLine == DSL_NULL) || (pArgFwDl == DSL_NULL) ||
+       (pArgFwDl->pFwChunk == DSL_NULL) || (pArgFwDl->size_byte == 0) ||
+       (pArgFwDl->offset_byte >= pArgFwDl->image_size_byte) ||
+       (pArgFwDl->size_byte >
+          (pArgFwDl->image_size_byte - pArgFwDl->offset_byte)))
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   if (pArgFwDl->offset_byte == 0)
+   {
+      pLine->bFwLoaded = DSL_FALSE;
+   }
+   pLine->stats.nFwChunk++;
+   if ((pArgFwDl->offset_byte + pArgFwDl->size_byte) ==
+       pArgFwDl->image_size_byte)
+   {
+      pLine->bFwLoaded = DSL_TRUE;
+      pLine->stats.nFwDownload++;
+   }
+   pthread_mutex_unlock(&simVrxMutex);
+
+   pArgFwDl->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalFwModeCtrlSet(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_FwModeCtrlSet_t *pArgFwModeCtrl)
+{
+   if ((DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl) == DSL_NULL) ||
+       (pArgFwModeCtrl == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pArgFwModeCtrl->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalMsgSend(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_messageSend_t *pUserMsgs)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+   DSL_DRV_SIM_VRX_Rule_t *pRule = DSL_NULL;
+   DSL_uint16_t nLine;
+   DSL_uint32_t i, nLatency = 0, nAckSize = 0;
+   DSL_int32_t nRetCode = 0;
+   DSL_uint8_t nFctOpCode = 0;
+   DSL_uint8_t ackPayload[DSL_DRV_SIM_VRX_PAYLOAD_MAX];
+
+   if ((pLine == DSL_NULL) || (pUserMsgs == DSL_NULL))
+   {
+      return -1;
+   }
+
+   nLine = (DSL_uint16_t)(pLine - &simVrxLines[0]);
+
+   pthread_mutex_lock(&simVrxMutex);
+
+   for (i = 0; i < simVrxRuleCount; i++)
+   {
+      if (((simVrxRules[i].nLine == DSL_DRV_SIM_VRX_LINE_ANY) ||
+           (simVrxRules[i].nLine == nLine)) &&
+          ((simVrxRules[i].nMsgId == DSL_DRV_SIM_VRX_MSG_ID_ANY) ||
+           (simVrxRules[i].nMsgId == pUserMsgs->write_msg.msgId)))
+      {
+         pRule = &simVrxRules[i];
+         break;
+      }
+   }
+
+   if (pRule != DSL_NULL)
+   {
+      nLatency = pRule->nLatency;
+      nRetCode = pRule->nRetCode;
+      nFctOpCode = pRule->nFctOpCode;
+      nAckSize = pRule->nAckSize;
+      memcpy(ackPayload, pRule->ackPayload, nAckSize);
+
+      /* a used up rule is removed, the order of the others is kept */
+      if ((pRule->nCount > 0) && (--pRule->nCount == 0))
+      {
+         memmove(pRule, pRule + 1,
+            (simVrxRuleCount - i - 1) * sizeof(DSL_DRV_SIM_VRX_Rule_t));
+         simVrxRuleCount--;
+      }
+   }
+
+   pLine->stats.nMsgSend++;
+   pLine->stats.nLatencyTotal += nLatency;
+   if (nRetCode != 0)
+   {
+      pLine->stats.nMsgError++;
+   }
+
+   pthread_mutex_unlock(&simVrxMutex);
+
+   if (nLatency > 0)
+   {
+      DSL_DRV_SIM_VRX_USecSleep(nLatency);
+   }
+
+   pUserMsgs->ictl.retCode = nRetCode;
+
+   if (nRetCode != 0)
+   {
+      /* negative acknowledge, the function op code is reported in the
+         classifier as done by the firmware */
+      pUserMsgs->ack_msg.msgId = pUserMsgs->write_msg.msgId;
+      pUserMsgs->ack_msg.msgClassifier = ((DSL_uint32_t)nFctOpCode) << 8;
+      pUserMsgs->ack_msg.paylSize_byte = 0;
+
+      return -1;
+   }
+
+   pUserMsgs->ack_msg.msgId = pUserMsgs->write_msg.msgId;
+   pUserMsgs->ack_msg.msgClassifier = pUserMsgs->write_msg.msgClassifier;
+
+   if (pUserMsgs->ack_msg.pPayload != DSL_NULL)
+   {
+      if (nAckSize > 0)
+      {
+         if (nAckSize > pUserMsgs->ack_msg.paylSize_byte)
+         {
+            nAckSize = pUserMsgs->ack_msg.paylSize_byte;
+         }
+         memcpy(pUserMsgs->ack_msg.pPayload, ackPayload, nAckSize);
+         pUserMsgs->ack_msg.paylSize_byte = nAckSize;
+      }
+      else
+      {
+         memset(pUserMsgs->ack_msg.pPayload, 0,
+            pUserMsgs->ack_msg.paylSize_byte);
+      }
+   }
+   else
+   {
+      pUserMsgs->ack_msg.paylSize_byte = 0;
+   }
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalNfcEnable(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl)
+{
+   return (DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl) == DSL_NULL) ? -1 : 0;
+}
+
+int DSL_DRV_VRX_InternalNfcMsgRead(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_message_t *pUserMsg)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+   DSL_DRV_SIM_VRX_Nfc_t *pNfc;
+   DSL_uint32_t nSize;
+
+   if ((pLine == DSL_NULL) || (pUserMsg == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+
+   if (pLine->nNfcCount == 0)
+   {
+      pthread_mutex_unlock(&simVrxMutex);
+
+      /* no notification available */
+      pUserMsg->ictl.retCode = 0;
+      return -1;
+   }
+
+   pNfc = &pLine->nfcFifo[pLine->nNfcRead];
+
+   nSize = pNfc->nSize;
+   if ((pUserMsg->pPayload == DSL_NULL) || (nSize > pUserMsg->paylSize_byte))
+   {
+      nSize = (pUserMsg->pPayload == DSL_NULL) ? 0 : pUserMsg->paylSize_byte;
+   }
+
+   pUserMsg->msgId = pNfc->nMsgId;
+   pUserMsg->msgClassifier = 0;
+   if (nSize > 0)
+   {
+      memcpy(pUserMsg->pPayload, pNfc->payload, nSize);
+   }
+   pUserMsg->paylSize_byte = nSize;
+   pUserMsg->ictl.retCode = 0;
+
+   pLine->nNfcRead = (pLine->nNfcRead + 1) % DSL_DRV_SIM_VRX_NFC_FIFO_SIZE;
+   pLine->nNfcCount--;
+   pLine->stats.nNfcRead++;
+
+   pthread_mutex_unlock(&simVrxMutex);
+
+   return (int)nSize;
+}
+
+int DSL_DRV_VRX_InternalDebugLevelSet(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_dbgLevel_t *pArgDbgLevel)
+{
+   if ((DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl) == DSL_NULL) ||
+       (pArgDbgLevel == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pArgDbgLevel->ictl.retCode = 0;
+
+   return 0;
+}
+
+int DSL_DRV_VRX_InternalNfcCallBackDataSet(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   void *pNfcCallBack,
+   void *pNfcCallBackData)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if (pLine == DSL_NULL)
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   pLine->pNfcCallBack = (DSL_DRV_SIM_VRX_NfcCallBack_t)pNfcCallBack;
+   pLine->pNfcCallBackData = pNfcCallBackData;
+   pthread_mutex_unlock(&simVrxMutex);
+
+   return 0;
+}
+
+/*
+   Clear EOC, frames written by the API are only counted
+*/
+int MEI_InternalCEocInit(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_CEOC_init_t *pArgCEocInit)
+{
+   if ((DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl) == DSL_NULL) ||
+       (pArgCEocInit == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pArgCEocInit->ictl.retCode = 0;
+
+   return 0;
+}
+
+int MEI_InternalCEocCntrl(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_CEOC_cntrl_t *pArgCEocCntrl)
+{
+   if ((DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl) == DSL_NULL) ||
+       (pArgCEocCntrl == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pArgCEocCntrl->ictl.retCode = 0;
+
+   return 0;
+}
+
+int MEI_InternalCEocFrameWr(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   IOCTL_MEI_CEOC_frame_t *pArgCEocFrame)
+{
+   DSL_DRV_SIM_VRX_Line_t *pLine = DSL_DRV_SIM_VRX_LineGet(pMeiDynCntrl);
+
+   if ((pLine == DSL_NULL) || (pArgCEocFrame == DSL_NULL) ||
+       (pArgCEocFrame->pEocData == DSL_NULL))
+   {
+      return -1;
+   }
+
+   pthread_mutex_lock(&simVrxMutex);
+   pLine->stats.nCeocFrameWr++;
+   pthread_mutex_unlock(&simVrxMutex);
+
+   pArgCEocFrame->ictl.retCode = 0;
+
+   return 0;
+}
+
+/*
+   The showtime signalling towards the PP subsystem is not simulated
+*/
+int MEI_InternalXtmSwhowtimeEntrySignal(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   MEI_XTM_ShowtimeEnter_t *pMeiShowtimeSignal)
+{
+   return 0;
+}
+
+int MEI_InternalXtmSwhowtimeExitSignal(
+   MEI_DYN_CNTRL_T *pMeiDynCntrl,
+   MEI_XTM_ShowtimeExit_t *pMeiShowtimeSignal)
+{
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSL_CPE_SIMULATOR_DRIVER && !__KERNEL__ && INCLUDE_DSL_CPE_API_VRX*/
@@ -82,6 +82,105 @@ DSL_Error_t DSL_DRV_G997_SnmpMessageReceive(
 
    return nErrCode;
 }
+
+/*
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_SNMP_STATISTICS_GET
+*/
+DSL_Error_t DSL_DRV_G997_SnmpStatisticsGet(
+   DSL_OpenContext_t *pOpenCtx,
+   DSL_IN  DSL_Context_t *pContext,
+   DSL_OUT DSL_G997_SnmpStatistics_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+   DSL_CHECK_POINTER(pContext, pOpenCtx);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_G997_SnmpStatisticsGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* The counters are updated with the Open Context list locked*/
+   if (DSL_DRV_MUTEX_LOCK(pContext->pDevCtx->openContextListMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock Context List mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   pData->data = pContext->snmpStats;
+   pData->data.nRxDropped = pOpenCtx->nRxSnmpDropped;
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->pDevCtx->openContextListMutex);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_G997_SnmpStatisticsGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_SNMP_MESSAGE_QUEUE
+*/
+DSL_Error_t DSL_DRV_G997_SnmpMessageQueue(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_SnmpQueue_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_G997_SnmpMessageQueue"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Queue SNMP message, it is sent by the CEOC thread*/
+   nErrCode = DSL_CEOC_MessageQueue(
+                 pContext,
+                 DSL_CEOC_SNMP_PROTOCOL_ID,
+                 (DSL_CEOC_Message_t*)&(pData->data.message),
+                 &(pData->data.nSeqNum));
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_G997_SnmpMessageQueue, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_SNMP_TX_STATUS_GET
+*/
+DSL_Error_t DSL_DRV_G997_SnmpTxStatusGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_G997_SnmpTxStatus_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_G997_SnmpTxStatusGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   nErrCode = DSL_CEOC_TxStatusGet(pContext, &(pData->data));
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_G997_SnmpTxStatusGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
 #endif
 
 /*
@@ -888,6 +987,581 @@ DSL_Error_t DSL_DRV_G997_SnrAllocationNscGet(
 
    return nErrCode;
 }
+
+/*
+   Reads a complete per subcarrier table into the snapshot of the caller.
+*/
+static DSL_Error_t DSL_DRV_G997_PerToneSnapshotUpdate(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_PerToneSnapshot_t *pSnapshot,
+   DSL_IN DSL_G997_PerToneType_t nType,
+   DSL_IN DSL_AccessDir_t nDirection,
+   DSL_IN DSL_DeltDataType_t nDeltDataType)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   /* Invalidate the snapshot until it is read completely*/
+   pSnapshot->nType = DSL_G997_PER_TONE_LAST;
+
+   switch (nType)
+   {
+   case DSL_G997_PER_TONE_BITS:
+      pSnapshot->table.bits.nDirection = nDirection;
+      nErrCode = DSL_DRV_G997_BitAllocationNSCGet(pContext,
+                    &(pSnapshot->table.bits));
+      break;
+
+   case DSL_G997_PER_TONE_GAINS:
+      pSnapshot->table.gains.nDirection = nDirection;
+      nErrCode = DSL_DRV_G997_GainAllocationNscGet(pContext,
+                    &(pSnapshot->table.gains));
+      break;
+
+   case DSL_G997_PER_TONE_SNR:
+      pSnapshot->table.snr.nDirection = nDirection;
+      nErrCode = DSL_DRV_G997_SnrAllocationNscGet(pContext,
+                    &(pSnapshot->table.snr));
+      break;
+
+#ifdef INCLUDE_DSL_DELT
+   case DSL_G997_PER_TONE_DELT_HLOG:
+      pSnapshot->table.hlog.nDirection = nDirection;
+      pSnapshot->table.hlog.nDeltDataType = nDeltDataType;
+      nErrCode = DSL_DRV_G997_DeltHlogGet(pContext, &(pSnapshot->table.hlog));
+      break;
+
+   case DSL_G997_PER_TONE_DELT_QLN:
+      pSnapshot->table.qln.nDirection = nDirection;
+      pSnapshot->table.qln.nDeltDataType = nDeltDataType;
+      nErrCode = DSL_DRV_G997_DeltQLNGet(pContext, &(pSnapshot->table.qln));
+      break;
+
+   case DSL_G997_PER_TONE_DELT_SNR:
+      pSnapshot->table.deltSnr.nDirection = nDirection;
+      pSnapshot->table.deltSnr.nDeltDataType = nDeltDataType;
+      nErrCode = DSL_DRV_G997_DeltSNRGet(pContext,
+                    &(pSnapshot->table.deltSnr));
+      break;
+
+   case DSL_G997_PER_TONE_DELT_HLIN:
+      pSnapshot->table.hlin.nDirection = nDirection;
+      pSnapshot->table.hlin.nDeltDataType = nDeltDataType;
+      nErrCode = DSL_DRV_G997_DeltHlinGet(pContext, &(pSnapshot->table.hlin));
+      break;
+#endif /* INCLUDE_DSL_DELT*/
+
+   default:
+      nErrCode = DSL_ERR_NOT_SUPPORTED;
+      break;
+   }
+
+   if (nErrCode >= DSL_SUCCESS)
+   {
+      pSnapshot->nType = nType;
+      pSnapshot->nDirection = nDirection;
+      pSnapshot->nDeltDataType = nDeltDataType;
+   }
+
+   return nErrCode;
+}
+
+/*
+   Reads a complete per subcarrier table and returns the requested window of
+   it, used for the tables which the device does not read by tone range.
+*/
+static DSL_Error_t DSL_DRV_G997_PerToneWindowCopy(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_PerToneWindow_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_G997_PerToneSnapshot_t *pSnapshot = DSL_NULL;
+   DSL_G997_NSCData8_t *pNsc8 = DSL_NULL;
+   DSL_G997_NSCData16_t *pNsc16 = DSL_NULL;
+   DSL_uint16_t nNumData = 0, nNum = 0, i = 0;
+
+   pSnapshot = DSL_DRV_VMalloc(sizeof(DSL_G997_PerToneSnapshot_t));
+   if (pSnapshot == DSL_NULL)
+   {
+      return DSL_ERR_MEMORY;
+   }
+
+   nErrCode = DSL_DRV_G997_PerToneSnapshotUpdate(pContext, pSnapshot,
+                 pData->nType, pData->nDirection, pData->nDeltDataType);
+
+   if (nErrCode >= DSL_SUCCESS)
+   {
+      switch (pSnapshot->nType)
+      {
+      case DSL_G997_PER_TONE_BITS:
+         pNsc8 = &(pSnapshot->table.bits.data.bitAllocationNsc);
+         break;
+      case DSL_G997_PER_TONE_GAINS:
+         pNsc16 = &(pSnapshot->table.gains.data.gainAllocationNsc);
+         break;
+      case DSL_G997_PER_TONE_SNR:
+         pNsc8 = &(pSnapshot->table.snr.data.snrAllocationNsc);
+         break;
+#ifdef INCLUDE_DSL_DELT
+      case DSL_G997_PER_TONE_DELT_HLOG:
+         pNsc16 = &(pSnapshot->table.hlog.data.deltHlog);
+         pData->data.nGroupSize = pSnapshot->table.hlog.data.nGroupSize;
+         break;
+      case DSL_G997_PER_TONE_DELT_QLN:
+         pNsc8 = &(pSnapshot->table.qln.data.deltQln);
+         pData->data.nGroupSize = pSnapshot->table.qln.data.nGroupSize;
+         break;
+      case DSL_G997_PER_TONE_DELT_SNR:
+         pNsc8 = &(pSnapshot->table.deltSnr.data.deltSnr);
+         pData->data.nGroupSize = pSnapshot->table.deltSnr.data.nGroupSize;
+         break;
+#endif /* INCLUDE_DSL_DELT*/
+      default:
+         break;
+      }
+
+      if (pNsc8 != DSL_NULL)
+      {
+         nNumData = pNsc8->nNumData;
+      }
+      else if (pNsc16 != DSL_NULL)
+      {
+         nNumData = pNsc16->nNumData;
+      }
+
+      if (nNumData > DSL_MAX_NSC)
+      {
+         nNumData = DSL_MAX_NSC;
+      }
+
+      if (pData->data.nFirstTone < nNumData)
+      {
+         nNum = nNumData - pData->data.nFirstTone;
+         if (nNum > pData->data.nNumTones)
+         {
+            nNum = pData->data.nNumTones;
+         }
+      }
+
+      if (pNsc16 != DSL_NULL)
+      {
+         memcpy(pData->data.pNSCData,
+            &(pNsc16->nNSCData[pData->data.nFirstTone]),
+            nNum * sizeof(DSL_uint16_t));
+      }
+      else if (pNsc8 != DSL_NULL)
+      {
+         for (i = 0; i < nNum; i++)
+         {
+            pData->data.pNSCData[i] =
+               pNsc8->nNSCData[pData->data.nFirstTone + i];
+         }
+      }
+
+      pData->data.nNumData = nNumData;
+      pData->data.nNumReturned = nNum;
+   }
+
+   DSL_DRV_VFree(pSnapshot);
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_PER_TONE_WINDOW_GET
+*/
+DSL_Error_t DSL_DRV_G997_PerToneWindowGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_PerToneWindow_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_DIRECTION(pData->nDirection);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_G997_PerToneWindowGet "
+      "(nType=%d, nFirstTone=%d, nNumTones=%d)"DSL_DRV_CRLF,
+      DSL_DEV_NUM(pContext), pData->nType, pData->data.nFirstTone,
+      pData->data.nNumTones));
+
+   if ((pData->nType >= DSL_G997_PER_TONE_LAST) ||
+       (pData->data.nNumTones > DSL_MAX_NSC) ||
+       ((pData->data.nNumTones > 0) && (pData->data.pNSCData == DSL_NULL)))
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   /* Complex values do not fit into the window*/
+   if (pData->nType == DSL_G997_PER_TONE_DELT_HLIN)
+   {
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   pData->data.nNumData = 0;
+   pData->data.nNumReturned = 0;
+   pData->data.nGroupSize = 0;
+
+   nErrCode = DSL_DRV_DEV_G997_PerToneRangeGet(pContext, pData->nType,
+                 pData->nDirection, pData->nDeltDataType, &(pData->data));
+
+   /* Tables which are not read by tone range are read completely*/
+   if (nErrCode == DSL_ERR_NOT_SUPPORTED)
+   {
+      nErrCode = DSL_DRV_G997_PerToneWindowCopy(pContext, pData);
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_G997_PerToneWindowGet, "
+      "retCode=%d"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   Writes one byte of a per subcarrier export, bytes beyond the buffer are
+   only counted to return the required size.
+*/
+#define DSL_G997_PER_TONE_EXPORT_PUT(pBuf, nBufSize, nPos, nVal) \
+   do \
+   { \
+      if ((nPos) < (nBufSize)) \
+      { \
+         (pBuf)[(nPos)] = (DSL_uint8_t)(nVal); \
+      } \
+      (nPos)++; \
+   } while (0)
+
+/*
+   Writes the lower nBytes bytes of nVal in little endian byte order to a per
+   subcarrier export and returns the new write position.
+*/
+static DSL_uint32_t DSL_DRV_G997_PerToneExportPutLe(
+   DSL_OUT DSL_uint8_t *pBuf,
+   DSL_IN DSL_uint32_t nBufSize,
+   DSL_IN DSL_uint32_t nPos,
+   DSL_IN DSL_uint32_t nVal,
+   DSL_IN DSL_uint32_t nBytes)
+{
+   DSL_uint32_t i = 0;
+
+   for (i = 0; i < nBytes; i++)
+   {
+      DSL_G997_PER_TONE_EXPORT_PUT(pBuf, nBufSize, nPos, nVal >> (8 * i));
+   }
+
+   return nPos;
+}
+
+/*
+   Serializes the export header to the start of the export, see
+   DSL_G997_PerToneExportHeader_t for the layout.
+*/
+static DSL_void_t DSL_DRV_G997_PerToneExportHeaderWrite(
+   DSL_OUT DSL_uint8_t *pBuf,
+   DSL_IN DSL_uint32_t nBufSize,
+   DSL_IN const DSL_G997_PerToneExportHeader_t *pHeader)
+{
+   DSL_uint32_t nPos = 0;
+
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pHeader->nMagic, 4);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pHeader->nVersion, 2);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pHeader->nNumTables, 2);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pHeader->nShowtimeEpoch, 4);
+   DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos, pHeader->nSize, 4);
+}
+
+/*
+   Serializes a table header at nPos, see DSL_G997_PerToneExportTable_t for
+   the layout.
+*/
+static DSL_void_t DSL_DRV_G997_PerToneExportTableWrite(
+   DSL_OUT DSL_uint8_t *pBuf,
+   DSL_IN DSL_uint32_t nBufSize,
+   DSL_IN DSL_uint32_t nPos,
+   DSL_IN const DSL_G997_PerToneExportTable_t *pTable)
+{
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pTable->nType, 1);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pTable->nDirection, 1);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pTable->nGroupSize, 1);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pTable->nNumStreams, 1);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pTable->nNumData, 2);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             pTable->nInvalid, 2);
+   nPos = DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos,
+             (DSL_uint32_t)pTable->nResult, 4);
+   DSL_DRV_G997_PerToneExportPutLe(pBuf, nBufSize, nPos, pTable->nSize, 4);
+}
+
+/*
+   Encodes one stream of per subcarrier values as described for
+   DSL_G997_PerToneExportTable_t and returns the new write position.
+   Each value is read from pSrc with a distance of nStride bytes, either as
+   8 bit (bWide = DSL_FALSE) or 16 bit value.
+*/
+static DSL_uint32_t DSL_DRV_G997_PerToneStreamEncode(
+   DSL_OUT DSL_uint8_t *pBuf,
+   DSL_IN DSL_uint32_t nBufSize,
+   DSL_IN DSL_uint32_t nPos,
+   DSL_IN const DSL_uint8_t *pSrc,
+   DSL_IN DSL_uint32_t nStride,
+   DSL_IN DSL_boolean_t bWide,
+   DSL_IN DSL_uint16_t nNumData,
+   DSL_IN DSL_uint16_t nInvalid)
+{
+   DSL_uint16_t i = 0, nVal = 0, nPrev = 0, nZigzag = 0;
+   DSL_int16_t nDelta = 0;
+   DSL_uint32_t nCtrlPos = 0;
+   DSL_uint8_t nCount = 0;
+   DSL_boolean_t bRun = DSL_FALSE, bInvalid = DSL_FALSE;
+
+   for (i = 0; i < nNumData; i++, pSrc += nStride)
+   {
+      nVal = bWide ? *((const DSL_uint16_t*)pSrc) : *pSrc;
+      bInvalid = (nVal == nInvalid) ? DSL_TRUE : DSL_FALSE;
+
+      /* Start a new token if the kind of values changes or it is full*/
+      if ((nCount == 0) || (bRun != bInvalid) || (nCount == 0x80))
+      {
+         nCtrlPos = nPos;
+         DSL_G997_PER_TONE_EXPORT_PUT(pBuf, nBufSize, nPos, 0);
+         nCount = 0;
+         bRun = bInvalid;
+      }
+
+      nCount++;
+      if (nCtrlPos < nBufSize)
+      {
+         pBuf[nCtrlPos] = (DSL_uint8_t)((bRun ? 0x80 : 0x00) | (nCount - 1));
+      }
+
+      if (bInvalid)
+      {
+         continue;
+      }
+
+      nDelta = (DSL_int16_t)(nVal - nPrev);
+      nZigzag = (nDelta < 0) ?
+         (DSL_uint16_t)((((DSL_uint16_t)~nDelta) << 1) | 1) :
+         (DSL_uint16_t)(((DSL_uint16_t)nDelta) << 1);
+      while (nZigzag >= 0x80)
+      {
+         DSL_G997_PER_TONE_EXPORT_PUT(pBuf, nBufSize, nPos,
+            (nZigzag & 0x7F) | 0x80);
+         nZigzag >>= 7;
+      }
+      DSL_G997_PER_TONE_EXPORT_PUT(pBuf, nBufSize, nPos, nZigzag);
+
+      nPrev = nVal;
+   }
+
+   return nPos;
+}
+
+/*
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_PER_TONE_EXPORT
+*/
+DSL_Error_t DSL_DRV_G997_PerToneExport(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_PerToneExport_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_G997_PerToneSnapshot_t *pSnapshot = DSL_NULL;
+   DSL_G997_PerToneExportHeader_t header;
+   DSL_G997_PerToneExportTable_t table;
+   DSL_uint8_t *pBuf = DSL_NULL;
+   const DSL_uint8_t *pSrc = DSL_NULL, *pSrc2 = DSL_NULL;
+   DSL_uint32_t nBufSize = 0, nPos = 0, nTablePos = 0, nStride = 0;
+   DSL_uint32_t nEpoch = 0, nEpochEnd = 0;
+   DSL_boolean_t bWide = DSL_FALSE;
+   DSL_int_t nDirection = 0, nType = 0;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_G997_PerToneExport"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   pBuf = pData->data.pData;
+   nBufSize = (pBuf != DSL_NULL) ? pData->data.nBufferSize : 0;
+
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, nShowtimeEpoch, nEpoch);
+
+   /* A size request returns the maximum size without reading the tables*/
+   if (nBufSize == 0)
+   {
+      pData->data.nDataSize = DSL_G997_PER_TONE_EXPORT_SIZE_MAX;
+      pData->data.nShowtimeEpoch = nEpoch;
+
+      return nErrCode;
+   }
+
+   /* The tables are read one after the other into a buffer of this call*/
+   pSnapshot = DSL_DRV_VMalloc(sizeof(DSL_G997_PerToneSnapshot_t));
+   if (pSnapshot == DSL_NULL)
+   {
+      return DSL_ERR_MEMORY;
+   }
+
+   memset(&header, 0x0, sizeof(DSL_G997_PerToneExportHeader_t));
+   nPos = DSL_G997_PER_TONE_EXPORT_HEADER_SIZE;
+
+   for (nDirection = DSL_UPSTREAM; nDirection <= DSL_DOWNSTREAM; nDirection++)
+   {
+      for (nType = 0; nType < DSL_G997_PER_TONE_LAST; nType++)
+      {
+         memset(&table, 0x0, sizeof(DSL_G997_PerToneExportTable_t));
+         table.nType = (DSL_uint8_t)nType;
+         table.nDirection = (DSL_uint8_t)nDirection;
+         table.nNumStreams = 1;
+
+         nTablePos = nPos;
+         nPos += DSL_G997_PER_TONE_EXPORT_TABLE_SIZE;
+
+         table.nResult = (DSL_int32_t)DSL_DRV_G997_PerToneSnapshotUpdate(
+            pContext, pSnapshot, (DSL_G997_PerToneType_t)nType,
+            (DSL_AccessDir_t)nDirection, pData->data.nDeltDataType);
+
+         pSrc = DSL_NULL;
+         pSrc2 = DSL_NULL;
+         nStride = 1;
+         bWide = DSL_FALSE;
+
+         if (table.nResult >= DSL_SUCCESS)
+         {
+            switch (nType)
+            {
+            case DSL_G997_PER_TONE_BITS:
+               table.nNumData =
+                  pSnapshot->table.bits.data.bitAllocationNsc.nNumData;
+               pSrc = pSnapshot->table.bits.data.bitAllocationNsc.nNSCData;
+               break;
+            case DSL_G997_PER_TONE_GAINS:
+               table.nNumData =
+                  pSnapshot->table.gains.data.gainAllocationNsc.nNumData;
+               pSrc = (const DSL_uint8_t*)
+                  pSnapshot->table.gains.data.gainAllocationNsc.nNSCData;
+               nStride = sizeof(DSL_uint16_t);
+               bWide = DSL_TRUE;
+               break;
+            case DSL_G997_PER_TONE_SNR:
+               table.nNumData =
+                  pSnapshot->table.snr.data.snrAllocationNsc.nNumData;
+               pSrc = pSnapshot->table.snr.data.snrAllocationNsc.nNSCData;
+               table.nInvalid = 255;
+               break;
+#ifdef INCLUDE_DSL_DELT
+            case DSL_G997_PER_TONE_DELT_HLOG:
+               table.nNumData = pSnapshot->table.hlog.data.deltHlog.nNumData;
+               table.nGroupSize = pSnapshot->table.hlog.data.nGroupSize;
+               pSrc = (const DSL_uint8_t*)
+                  pSnapshot->table.hlog.data.deltHlog.nNSCData;
+               nStride = sizeof(DSL_uint16_t);
+               bWide = DSL_TRUE;
+               table.nInvalid = 1023;
+               break;
+            case DSL_G997_PER_TONE_DELT_QLN:
+               table.nNumData = pSnapshot->table.qln.data.deltQln.nNumData;
+               table.nGroupSize = pSnapshot->table.qln.data.nGroupSize;
+               pSrc = pSnapshot->table.qln.data.deltQln.nNSCData;
+               table.nInvalid = 255;
+               break;
+            case DSL_G997_PER_TONE_DELT_SNR:
+               table.nNumData = pSnapshot->table.deltSnr.data.deltSnr.nNumData;
+               table.nGroupSize = pSnapshot->table.deltSnr.data.nGroupSize;
+               pSrc = pSnapshot->table.deltSnr.data.deltSnr.nNSCData;
+               table.nInvalid = 255;
+               break;
+            case DSL_G997_PER_TONE_DELT_HLIN:
+               table.nNumData =
+                  pSnapshot->table.hlin.data.deltHlin.nNumData;
+               table.nGroupSize = pSnapshot->table.hlin.data.nGroupSize;
+               table.nNumStreams = 2;
+               pSrc = (const DSL_uint8_t*)
+                  &(pSnapshot->table.hlin.data.deltHlin.nNSCComplexData[0].nReal);
+               pSrc2 = (const DSL_uint8_t*)
+                  &(pSnapshot->table.hlin.data.deltHlin.nNSCComplexData[0].nImag);
+               nStride = sizeof(DSL_G997_ComplexNumber_t);
+               bWide = DSL_TRUE;
+               table.nInvalid = 0x8000;
+               break;
+#endif /* INCLUDE_DSL_DELT*/
+            default:
+               break;
+            }
+         }
+
+         if (table.nNumData > DSL_MAX_NSC)
+         {
+            table.nNumData = DSL_MAX_NSC;
+         }
+
+         if (pSrc != DSL_NULL)
+         {
+            nPos = DSL_DRV_G997_PerToneStreamEncode(pBuf, nBufSize, nPos,
+               pSrc, nStride, bWide, table.nNumData, table.nInvalid);
+         }
+         else
+         {
+            table.nNumData = 0;
+         }
+
+         if (pSrc2 != DSL_NULL)
+         {
+            nPos = DSL_DRV_G997_PerToneStreamEncode(pBuf, nBufSize, nPos,
+               pSrc2, nStride, bWide, table.nNumData, table.nInvalid);
+         }
+
+         table.nSize = nPos - nTablePos - DSL_G997_PER_TONE_EXPORT_TABLE_SIZE;
+         DSL_DRV_G997_PerToneExportTableWrite(pBuf, nBufSize, nTablePos, &table);
+
+         header.nNumTables++;
+      }
+   }
+
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, nShowtimeEpoch, nEpochEnd);
+
+   DSL_DRV_VFree(pSnapshot);
+
+   header.nMagic = DSL_G997_PER_TONE_EXPORT_MAGIC;
+   header.nVersion = DSL_G997_PER_TONE_EXPORT_VERSION;
+   header.nShowtimeEpoch = nEpoch;
+   header.nSize = nPos;
+   DSL_DRV_G997_PerToneExportHeaderWrite(pBuf, nBufSize, &header);
+
+   pData->data.nDataSize = nPos;
+   pData->data.nShowtimeEpoch = nEpoch;
+
+   if (nErrCode == DSL_SUCCESS)
+   {
+      /* The tables are mixed from two showtimes or the buffer is too small*/
+      if ((nEpochEnd != nEpoch) || (nPos > nBufSize))
+      {
+         nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+      }
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_G997_PerToneExport, "
+      "size=%u, retCode=%d"DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
+      pData->data.nDataSize, nErrCode));
+
+   return nErrCode;
+}
 #endif /* INCLUDE_DSL_G997_PER_TONE*/
 
 #ifdef INCLUDE_DSL_G997_ALARM
@@ -1539,13 +2213,14 @@ DSL_Error_t DSL_DRV_G997_DeltFreeResources(
 #ifndef DSL_CPE_STATIC_DELT_DATA
    if (pContext->DELT != DSL_NULL)
    {
-      DSL_DRV_MemFree(pContext->DELT);
+      DSL_DRV_G997_DeltBufferRelease(DSL_G997_DELT_POOL_DIAG, pContext->DELT);
       pContext->DELT = DSL_NULL;
    }
 #if defined(INCLUDE_DSL_CPE_API_VRX)
    if (pContext->DELT_SHOWTIME != DSL_NULL)
    {
-      DSL_DRV_MemFree(pContext->DELT_SHOWTIME);
+      DSL_DRV_G997_DeltBufferRelease(DSL_G997_DELT_POOL_SHOWTIME,
+         pContext->DELT_SHOWTIME);
       pContext->DELT_SHOWTIME = DSL_NULL;
    }
 #endif
@@ -1559,6 +2234,188 @@ DSL_Error_t DSL_DRV_G997_DeltFreeResources(
 
    return nErrCode;
 }
+
+#ifndef DSL_CPE_STATIC_DELT_DATA
+/* Free buffer of the DELT buffer pool, the link is kept within the buffer*/
+typedef struct DSL_G997_DeltSlab
+{
+   struct DSL_G997_DeltSlab *pNext;
+} DSL_G997_DeltSlab_t;
+
+/* Free buffers of the DELT buffer pool shared by all lines*/
+static DSL_G997_DeltSlab_t *pDeltPoolFree[DSL_G997_DELT_POOL_LAST];
+/* Usage statistics of the DELT buffer pool*/
+static DSL_G997_DeltPoolStatistics_t deltPoolStats[DSL_G997_DELT_POOL_LAST];
+/* Protects the DELT buffer pool*/
+static DSL_DRV_Mutex_t deltPoolMutex;
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+
+/*
+   For a detailed description please refer to the drv_dsl_cpe_intern_g997.h
+*/
+DSL_void_t DSL_DRV_G997_DeltPoolInit(DSL_void_t)
+{
+#ifndef DSL_CPE_STATIC_DELT_DATA
+   memset(pDeltPoolFree, 0x0, sizeof(pDeltPoolFree));
+   memset(deltPoolStats, 0x0, sizeof(deltPoolStats));
+
+   deltPoolStats[DSL_G997_DELT_POOL_DIAG].nSlabSize =
+      sizeof(DSL_G997_DeltData_t);
+#if defined(INCLUDE_DSL_CPE_API_VRX)
+   deltPoolStats[DSL_G997_DELT_POOL_SHOWTIME].nSlabSize =
+      sizeof(DSL_G997_DeltShowtimeData_t);
+#endif /* INCLUDE_DSL_CPE_API_VRX*/
+
+   DSL_DRV_MUTEX_INIT(deltPoolMutex);
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+}
+
+/*
+   For a detailed description please refer to the drv_dsl_cpe_intern_g997.h
+*/
+DSL_void_t DSL_DRV_G997_DeltPoolCleanup(DSL_void_t)
+{
+#ifndef DSL_CPE_STATIC_DELT_DATA
+   DSL_G997_DeltSlab_t *pSlab = DSL_NULL;
+   DSL_int_t nType = 0;
+
+   if (DSL_DRV_MUTEX_LOCK(deltPoolMutex))
+   {
+      return;
+   }
+
+   for (nType = 0; nType < DSL_G997_DELT_POOL_LAST; nType++)
+   {
+      while (pDeltPoolFree[nType] != DSL_NULL)
+      {
+         pSlab = pDeltPoolFree[nType];
+         pDeltPoolFree[nType] = pSlab->pNext;
+         DSL_DRV_MemFree(pSlab);
+         deltPoolStats[nType].nSlabs--;
+      }
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(deltPoolMutex);
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+}
+
+/*
+   For a detailed description please refer to the drv_dsl_cpe_intern_g997.h
+*/
+DSL_void_t* DSL_DRV_G997_DeltBufferGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_G997_DeltPoolType_t nType)
+{
+#ifndef DSL_CPE_STATIC_DELT_DATA
+   DSL_G997_DeltSlab_t *pSlab = DSL_NULL;
+   DSL_G997_DeltPoolStatistics_t *pStats = DSL_NULL;
+
+   if ((nType >= DSL_G997_DELT_POOL_LAST) ||
+       (deltPoolStats[nType].nSlabSize == 0))
+   {
+      return DSL_NULL;
+   }
+
+   if (DSL_DRV_MUTEX_LOCK(deltPoolMutex))
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - DELT pool mutex lock failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_NULL;
+   }
+
+   pStats = &deltPoolStats[nType];
+
+   /* Reuse a free buffer, allocate only if the pool is empty*/
+   pSlab = pDeltPoolFree[nType];
+   if (pSlab != DSL_NULL)
+   {
+      pDeltPoolFree[nType] = pSlab->pNext;
+   }
+   else
+   {
+      pSlab = DSL_DRV_Malloc(pStats->nSlabSize);
+      if (pSlab != DSL_NULL)
+      {
+         pStats->nSlabs++;
+      }
+   }
+
+   if (pSlab != DSL_NULL)
+   {
+      pStats->nInUse++;
+      if (pStats->nInUse > pStats->nInUseMax)
+      {
+         pStats->nInUseMax = pStats->nInUse;
+      }
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(deltPoolMutex);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: DELT pool buffer (type %d) %s"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nType,
+      (pSlab != DSL_NULL) ? "taken" : "not available"));
+
+   return pSlab;
+#else
+   return DSL_NULL;
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+}
+
+/*
+   For a detailed description please refer to the drv_dsl_cpe_intern_g997.h
+*/
+DSL_void_t DSL_DRV_G997_DeltBufferRelease(
+   DSL_IN DSL_G997_DeltPoolType_t nType,
+   DSL_IN DSL_void_t *pBuffer)
+{
+#ifndef DSL_CPE_STATIC_DELT_DATA
+   DSL_G997_DeltSlab_t *pSlab = (DSL_G997_DeltSlab_t*)pBuffer;
+
+   if ((pSlab == DSL_NULL) || (nType >= DSL_G997_DELT_POOL_LAST))
+   {
+      return;
+   }
+
+   if (DSL_DRV_MUTEX_LOCK(deltPoolMutex))
+   {
+      /* Do not lose the memory if the pool is not accessible*/
+      DSL_DRV_MemFree(pBuffer);
+      return;
+   }
+
+   pSlab->pNext = pDeltPoolFree[nType];
+   pDeltPoolFree[nType] = pSlab;
+   deltPoolStats[nType].nInUse--;
+
+   DSL_DRV_MUTEX_UNLOCK(deltPoolMutex);
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+}
+
+/*
+   For a detailed description please refer to the drv_dsl_cpe_intern_g997.h
+*/
+DSL_void_t DSL_DRV_G997_DeltPoolStatisticsGet(
+   DSL_IN DSL_G997_DeltPoolType_t nType,
+   DSL_OUT DSL_G997_DeltPoolStatistics_t *pStats)
+{
+   memset(pStats, 0x0, sizeof(DSL_G997_DeltPoolStatistics_t));
+
+#ifndef DSL_CPE_STATIC_DELT_DATA
+   if (nType >= DSL_G997_DELT_POOL_LAST)
+   {
+      return;
+   }
+
+   if (DSL_DRV_MUTEX_LOCK(deltPoolMutex) == 0)
+   {
+      *pStats = deltPoolStats[nType];
+      DSL_DRV_MUTEX_UNLOCK(deltPoolMutex);
+   }
+#endif /* DSL_CPE_STATIC_DELT_DATA*/
+}
 #endif /* INCLUDE_DSL_DELT*/
 
 #ifdef INCLUDE_DSL_CPE_API_VRX
@@ -146,6 +146,99 @@ DSL_Error_t DSL_DRV_DEV_G997_SnrAllocationNscGet(
 
    return (nErrCode);
 }
+
+/*
+   For a detailed description please refer to the drv_dsl_cpe_device_g997.h
+*/
+DSL_Error_t DSL_DRV_DEV_G997_PerToneRangeGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_G997_PerToneType_t nType,
+   DSL_IN DSL_AccessDir_t nDirection,
+   DSL_IN DSL_DeltDataType_t nDeltDataType,
+   DSL_IN_OUT DSL_G997_PerToneWindowData_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_LineStateValue_t nCurrentState = DSL_LINESTATE_UNKNOWN;
+   DSL_DEV_VersionCheck_t nVerCheck = DSL_VERSION_ERROR;
+   ACK_TestParamsAuxDS_Get_t sAck;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+      "DSL[%02d]: IN - DSL_DRV_DEV_G997_PerToneRangeGet (nType=%d, "
+      "nDirection=%d)"DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nType, nDirection));
+
+   /* Only the VDSL showtime tables are read from the FW by tone range, the
+      DELT diagnostics data is kept within the internal buffer*/
+   if (!DSL_DRV_VRX_FirmwareXdslModeCheck(pContext, DSL_VRX_FW_VDSL2) ||
+       (nType > DSL_G997_PER_TONE_DELT_QLN) ||
+       ((nType >= DSL_G997_PER_TONE_DELT_HLOG) &&
+        (nDeltDataType != DSL_DELT_DATA_SHOWTIME)))
+   {
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   /* Get current line state*/
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, nLineState, nCurrentState);
+
+   /* Only proceed if the specified line is in SHOWTIME state.*/
+   if ((nCurrentState != DSL_LINESTATE_SHOWTIME_TC_SYNC) &&
+       (nCurrentState != DSL_LINESTATE_SHOWTIME_NO_SYNC))
+   {
+      return DSL_ERR_ONLY_AVAILABLE_IN_SHOWTIME;
+   }
+
+   if ((nType != DSL_G997_PER_TONE_BITS) &&
+       (nType != DSL_G997_PER_TONE_GAINS) &&
+       (nDirection == DSL_UPSTREAM))
+   {
+      /* Get FW information*/
+      nErrCode = DSL_DRV_VRX_FirmwareVersionCheck(pContext,
+                     DSL_MIN_FW_VERSION_FE_DELT, &nVerCheck);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         DSL_DEBUG(DSL_DBG_ERR, (pContext,
+            SYS_DBG_ERR"DSL[%02d]: ERROR - FW version check failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         return nErrCode;
+      }
+
+      /* The FE showtime parameters of older FW are kept within the internal
+         buffer*/
+      if (nVerCheck < DSL_VERSION_EQUAL)
+      {
+         return DSL_ERR_NOT_SUPPORTED;
+      }
+   }
+
+   if ((nType == DSL_G997_PER_TONE_DELT_HLOG) ||
+       (nType == DSL_G997_PER_TONE_DELT_QLN))
+   {
+      memset(&sAck, 0, sizeof(sAck));
+
+      /* Get Aux Parameters directly from the FW*/
+      nErrCode = DSL_DRV_VRX_SendMsgTestParamsAuxGet(
+                    pContext, nDirection, (DSL_uint8_t*)&sAck);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         DSL_DEBUG(DSL_DBG_ERR,(pContext, SYS_DBG_ERR
+            "DSL[%02d]: ERROR - Aux Test Parameters get failed (nDirection=%d)"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nDirection));
+      }
+
+      pData->nGroupSize = (DSL_uint8_t)((nType == DSL_G997_PER_TONE_DELT_HLOG) ?
+         sAck.HLOGG : sAck.QLNG);
+   }
+
+   nErrCode = DSL_DRV_VRX_ToneRangeGet(pContext, nType, nDirection, pData);
+
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG
+      "DSL[%02d]: OUT - DSL_DRV_DEV_G997_PerToneRangeGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return (nErrCode);
+}
 #endif /* INCLUDE_DSL_G997_PER_TONE*/
 
 /*
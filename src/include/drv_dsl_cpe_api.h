@@ -3563,6 +3563,14 @@ typedef enum
    internal context will be returned immediately. */
    DSL_EVENT_S_FE_TESTPARAMS_AVAILABLE = 24,
    /**
+   (25) SNMP message sent Event.
+   Signals the completion of a message which was queued with
+   \ref DSL_FIO_G997_SNMP_MESSAGE_QUEUE.
+   For a detailed description of the information provided with this event
+   please refer to the description of the following structure(s)
+   - ref DSL_G997_SnmpTxCompletionData_t */
+   DSL_EVENT_S_SNMP_MESSAGE_SENT = 25,
+   /**
    alias for last callback event */
    DSL_EVENT_LAST
 } DSL_EventType_t;
@@ -4015,6 +4023,7 @@ typedef union
    DSL_G997_PowerManagementStatusData_t          powerMgmtStatusData;
    DSL_FwDownloadStatusData_t                    fwDownloadStatus;
    DSL_AutobootStatusData_t                      autobootStatus;
+   DSL_G997_SnmpTxCompletionData_t               snmpTxCompletion;
 
 #if defined(INCLUDE_DSL_CPE_API_DANUBE)
    DSL_ReTxStatisticsData_t                      reTxStatistics;
@@ -4054,7 +4063,8 @@ typedef enum
    Activates/deactivates SNMP resource buffer.
    Creates a FIFO on activation which includes a number of elements that is
    defined by DSL_CEOC_RX_FIFO_ELEMENT_COUNT (number of max. stored events).
-   Each elements size is defined by size of structure DSL_CEOC_Message_t. */
+   Each element references a received message which is shared by all
+   instances of the line. */
    DSL_RESOURCE_ACTIVATION_SNMP = 0x00000001
 } DSL_BF_ResourceActivationType_t;
 
@@ -4463,6 +4473,18 @@ typedef struct
    In case of using chunks it should be true for last download call */
    DSL_IN DSL_boolean_t bLastChunk;
    DSL_IN DSL_boolean_t bForceDownload;
+   /**
+   Zero-copy firmware download.
+   If DSL_TRUE the firmware buffers are not copied to the kernel. Their pages
+   are pinned and passed to the device one page at a time, neither a kernel
+   buffer nor a kernel mapping of the image size is created. The buffers can
+   be any readable user memory, for example the firmware file mapped with
+   mmap().
+   \note This requires an MEI driver with chunked firmware download
+         (MEI_SUPPORT_FW_CHUNK_DOWNLOAD), otherwise the download fails.
+   \note If the firmware is stored for later reloads (no firmware request
+         support) a kernel copy is kept anyhow. */
+   DSL_IN DSL_boolean_t bMappedBuffer;
 } DSL_AutobootLoadFirmwareData_t;
 
 /**
@@ -5006,6 +5028,472 @@ typedef struct
 } DSL_DBG_ModuleDestination_t;
 #endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
 
+/** Number of message bytes stored per message trace entry. Longer messages
+    are truncated, the original size is kept in nSize. */
+#define DSL_DBG_MSG_TRACE_DATA_MAX        128
+/** Number of message trace entries stored per line, has to be a power
+    of two */
+#define DSL_DBG_MSG_TRACE_RING_SIZE       64
+/** Maximum number of message trace entries returned by one read call */
+#define DSL_DBG_MSG_TRACE_READ_MAX        16
+
+/**
+   Direction and type of a traced device message.
+*/
+typedef enum
+{
+   /** Message sent to the device */
+   DSL_DBG_MSG_TRACE_TX = 0,
+   /** Acknowledge received from the device */
+   DSL_DBG_MSG_TRACE_RX = 1,
+   /** Autonomous message (notification, event or alarm) received from the
+       device */
+   DSL_DBG_MSG_TRACE_EVT = 2
+} DSL_DBG_MsgTraceDir_t;
+
+/**
+   One binary entry of the device message trace. The entry keeps the raw
+   message as it is exchanged with the device, the decoding to text has to be
+   done by the application.
+*/
+typedef struct
+{
+   /**
+   Sequence number of the entry, incremented for each traced message of the
+   line */
+   DSL_OUT DSL_uint32_t nSeq;
+   /**
+   Monotonic time stamp, seconds part [s] */
+   DSL_OUT DSL_uint32_t nTimeSec;
+   /**
+   Monotonic time stamp, nanoseconds part [ns] */
+   DSL_OUT DSL_uint32_t nTimeNSec;
+   /**
+   Line number */
+   DSL_OUT DSL_uint8_t nLine;
+   /**
+   Message direction, refer to \ref DSL_DBG_MsgTraceDir_t */
+   DSL_OUT DSL_uint8_t nDir;
+   /**
+   Message classifier */
+   DSL_OUT DSL_uint16_t nClass;
+   /**
+   Message ID */
+   DSL_OUT DSL_uint16_t nMsgId;
+   /**
+   Original message size including the two header words [bytes] */
+   DSL_OUT DSL_uint16_t nSize;
+   /**
+   Message data starting with the two header words, only the first
+   \ref DSL_DBG_MSG_TRACE_DATA_MAX bytes are valid for longer messages */
+   DSL_OUT DSL_uint8_t nData[DSL_DBG_MSG_TRACE_DATA_MAX];
+} DSL_DBG_MsgTraceEntry_t;
+
+/**
+   Structure used to read (GET) or write (SET) the message trace
+   configuration.
+*/
+typedef struct
+{
+   /**
+   Enables the binary message trace. While enabled the messages selected by
+   the debug level of \ref DSL_DBG_MESSAGE_DUMP are stored in the per line
+   trace buffer instead of being printed. */
+   DSL_CFG DSL_boolean_t bEnable;
+} DSL_DBG_MsgTraceConfigData_t;
+
+/**
+   Structure used to read (GET) or write (SET) the message trace
+   configuration.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_DBG_MSG_TRACE_CONFIG_SET
+   - \ref DSL_FIO_DBG_MSG_TRACE_CONFIG_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains message trace configuration data */
+   DSL_CFG DSL_DBG_MsgTraceConfigData_t data;
+} DSL_DBG_MsgTraceConfig_t;
+
+/**
+   Structure used to read a block of message trace entries.
+*/
+typedef struct
+{
+   /**
+   Sequence number of the first entry to read. To read the trace
+   continuously the value returned in nNextSeq has to be used for the
+   following call. */
+   DSL_IN DSL_uint32_t nStartSeq;
+   /**
+   Sequence number to be used for the next read */
+   DSL_OUT DSL_uint32_t nNextSeq;
+   /**
+   Number of entries which were overwritten before they could be read */
+   DSL_OUT DSL_uint32_t nLost;
+   /**
+   Number of valid entries */
+   DSL_OUT DSL_uint32_t nEntries;
+   /**
+   Message trace entries */
+   DSL_OUT DSL_DBG_MsgTraceEntry_t entry[DSL_DBG_MSG_TRACE_READ_MAX];
+} DSL_DBG_MsgTraceData_t;
+
+/**
+   Structure used to read a block of message trace entries.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_DBG_MSG_TRACE_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains message trace data */
+   DSL_IN_OUT DSL_DBG_MsgTraceData_t data;
+} DSL_DBG_MsgTrace_t;
+
+/** Number of tracepoint entries stored per line, has to be a power of two */
+#define DSL_DBG_TRACE_RING_SIZE           256
+/** Maximum number of tracepoint entries returned by one read call */
+#define DSL_DBG_TRACE_READ_MAX            32
+/** Number of arguments stored per tracepoint entry */
+#define DSL_DBG_TRACE_ARG_MAX             4
+
+/**
+   Tracepoints of the driver. The meaning of the result and argument values
+   of \ref DSL_DBG_TraceEntry_t depends on the tracepoint.
+*/
+typedef enum
+{
+   /** Entry of the device message transmission.
+       nArg[0]: message ID, nArg[1]: payload size [bytes] */
+   DSL_DBG_TRACE_MSG_SEND_ENTRY = 0,
+   /** Exit of the device message transmission.
+       nResult: return code, nArg[0]: message ID, nArg[1]: number of retries,
+       nArg[2]: wait time for the device lock [ns], nArg[3]: round-trip time
+       of the message including all retries [ns] */
+   DSL_DBG_TRACE_MSG_SEND_EXIT = 1,
+   /** Autoboot state transition.
+       nArg[0]: previous state, nArg[1]: new state, nArg[2]: poll time [s]
+       (refer to \ref DSL_Autoboot_State_t) */
+   DSL_DBG_TRACE_AUTOBOOT_STATE = 2,
+   /** Event queued for the applications.
+       nResult: return code, nArg[0]: event type (\ref DSL_EventType_t),
+       nArg[1]: event data size [bytes] */
+   DSL_DBG_TRACE_EVENT_QUEUE = 3,
+   /** Entry of the PM counters update.
+       nArg[0]: direction, nArg[1]: bit field of the 15min (0x1), 1day (0x2),
+       total (0x4) and showtime (0x8) update flags */
+   DSL_DBG_TRACE_PM_UPDATE_ENTRY = 4,
+   /** Exit of the PM counters update.
+       nResult: return code, nArg[0]: direction */
+   DSL_DBG_TRACE_PM_UPDATE_EXIT = 5,
+   /** Delimiter only */
+   DSL_DBG_TRACE_LAST = 6
+} DSL_DBG_TracePoint_t;
+
+/**
+   One binary tracepoint entry.
+*/
+typedef struct
+{
+   /**
+   Sequence number of the entry, incremented for each tracepoint hit of the
+   line */
+   DSL_OUT DSL_uint32_t nSeq;
+   /**
+   Monotonic time stamp, seconds part [s] */
+   DSL_OUT DSL_uint32_t nTimeSec;
+   /**
+   Monotonic time stamp, nanoseconds part [ns] */
+   DSL_OUT DSL_uint32_t nTimeNSec;
+   /**
+   Line number */
+   DSL_OUT DSL_uint8_t nLine;
+   /**
+   Tracepoint, refer to \ref DSL_DBG_TracePoint_t */
+   DSL_OUT DSL_uint8_t nPoint;
+   /**
+   Reserved */
+   DSL_OUT DSL_uint16_t nReserved;
+   /**
+   Result value of the tracepoint */
+   DSL_OUT DSL_int32_t nResult;
+   /**
+   Argument values of the tracepoint */
+   DSL_OUT DSL_uint32_t nArg[DSL_DBG_TRACE_ARG_MAX];
+} DSL_DBG_TraceEntry_t;
+
+/**
+   Structure used to read (GET) or write (SET) the tracepoint configuration.
+*/
+typedef struct
+{
+   /**
+   Enables the recording of the tracepoints in the per line trace buffer */
+   DSL_CFG DSL_boolean_t bEnable;
+} DSL_DBG_TraceConfigData_t;
+
+/**
+   Structure used to read (GET) or write (SET) the tracepoint configuration.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_DBG_TRACE_CONFIG_SET
+   - \ref DSL_FIO_DBG_TRACE_CONFIG_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains tracepoint configuration data */
+   DSL_CFG DSL_DBG_TraceConfigData_t data;
+} DSL_DBG_TraceConfig_t;
+
+/**
+   Structure used to read a block of tracepoint entries.
+*/
+typedef struct
+{
+   /**
+   Sequence number of the first entry to read. To read the trace
+   continuously the value returned in nNextSeq has to be used for the
+   following call. */
+   DSL_IN DSL_uint32_t nStartSeq;
+   /**
+   Sequence number to be used for the next read */
+   DSL_OUT DSL_uint32_t nNextSeq;
+   /**
+   Number of entries which were overwritten before they could be read */
+   DSL_OUT DSL_uint32_t nLost;
+   /**
+   Number of valid entries */
+   DSL_OUT DSL_uint32_t nEntries;
+   /**
+   Tracepoint entries */
+   DSL_OUT DSL_DBG_TraceEntry_t entry[DSL_DBG_TRACE_READ_MAX];
+} DSL_DBG_TraceData_t;
+
+/**
+   Structure used to read a block of tracepoint entries.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_DBG_TRACE_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains tracepoint data */
+   DSL_IN_OUT DSL_DBG_TraceData_t data;
+} DSL_DBG_Trace_t;
+
+/** Number of different device message IDs for which statistics are kept
+    per line, has to be a power of two */
+#define DSL_MSG_STATISTICS_ENTRIES_MAX    64
+/** Number of latency histogram bins of the device message statistics */
+#define DSL_MSG_STATISTICS_HIST_BINS      20
+
+/**
+   Statistics of one device message ID.
+*/
+typedef struct
+{
+   /**
+   Message ID */
+   DSL_OUT DSL_uint16_t nMsgId;
+   /**
+   Reserved */
+   DSL_OUT DSL_uint16_t nReserved;
+   /**
+   Number of message transmissions (including failed ones) */
+   DSL_OUT DSL_uint32_t nSent;
+   /**
+   Number of transmission retries (mailbox and acknowledge mismatch
+   retries) */
+   DSL_OUT DSL_uint32_t nRetries;
+   /**
+   Number of received acknowledges with a wrong message ID */
+   DSL_OUT DSL_uint32_t nAckMismatch;
+   /**
+   Number of messages denied by the firmware
+   (\ref DSL_WRN_FIRMWARE_MSG_DENIED) */
+   DSL_OUT DSL_uint32_t nDenied;
+   /**
+   Number of messages which could not be exchanged in time (no acknowledge
+   or retries exhausted) */
+   DSL_OUT DSL_uint32_t nTimeouts;
+   /**
+   Number of messages which failed with any other error */
+   DSL_OUT DSL_uint32_t nErrors;
+   /**
+   Minimum round-trip time [us] */
+   DSL_OUT DSL_uint32_t nLatencyMin;
+   /**
+   Maximum round-trip time [us] */
+   DSL_OUT DSL_uint32_t nLatencyMax;
+   /**
+   Round-trip time histogram with logarithmic bins. Bin n counts the
+   messages with a round-trip time of 2^n up to 2^(n+1)-1 [us], bin 0 also
+   includes 0 us and the last bin includes all longer times. */
+   DSL_OUT DSL_uint32_t nLatencyHist[DSL_MSG_STATISTICS_HIST_BINS];
+} DSL_MsgStatisticsEntry_t;
+
+/**
+   Structure used to read the device message statistics.
+*/
+typedef struct
+{
+   /**
+   Time since the last reset of the statistics [ms] */
+   DSL_OUT DSL_uint32_t nElapsedTime;
+   /**
+   Number of messages which could not be counted because the statistics
+   table is full */
+   DSL_OUT DSL_uint32_t nOverflow;
+   /**
+   Number of valid entries */
+   DSL_OUT DSL_uint32_t nEntries;
+   /**
+   Statistics per message ID */
+   DSL_OUT DSL_MsgStatisticsEntry_t entry[DSL_MSG_STATISTICS_ENTRIES_MAX];
+} DSL_MsgStatisticsData_t;
+
+/**
+   Structure used to read the device message statistics.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_MSG_STATISTICS_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains the message statistics */
+   DSL_OUT DSL_MsgStatisticsData_t data;
+} DSL_MsgStatistics_t;
+
+/**
+   Structure used to reset the device message statistics.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_MSG_STATISTICS_RESET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+} DSL_MsgStatisticsReset_t;
+
+/**
+   Structure used to read the bring-up time stamps of the line.
+   All time stamps are given in [ms] since the driver start, a value of 0
+   means that the respective step was not reached yet. Each time stamp is
+   only taken on the first occurrence of its step after the driver start.
+*/
+typedef struct
+{
+   /**
+   First switch to the firmware request autoboot state */
+   DSL_OUT DSL_uint32_t nFwRequestTime;
+   /**
+   Start of the first firmware download */
+   DSL_OUT DSL_uint32_t nFwDownloadStartTime;
+   /**
+   End of the first successful firmware download */
+   DSL_OUT DSL_uint32_t nFwDownloadEndTime;
+   /**
+   Time the slave port of a dual-line device has waited for the firmware
+   download of the master port [ms]. Only used for the coordinated bring-up
+   of both lines of a device. */
+   DSL_OUT DSL_uint32_t nMasterWaitTime;
+   /**
+   First switch to the firmware ready autoboot state */
+   DSL_OUT DSL_uint32_t nFwReadyTime;
+   /**
+   First entry of the handshake (G.hs) line state */
+   DSL_OUT DSL_uint32_t nFirstHandshakeTime;
+   /**
+   First entry of the showtime (TC-Sync) line state */
+   DSL_OUT DSL_uint32_t nShowtimeTime;
+} DSL_BringUpTimingData_t;
+
+/**
+   Structure used to read the bring-up time stamps of the line.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_BRINGUP_TIMING_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains the bring-up time stamps */
+   DSL_OUT DSL_BringUpTimingData_t data;
+} DSL_BringUpTiming_t;
+
+/**
+   Structure used to read the autoboot restart statistics of the line.
+   A fast restart keeps the loaded firmware and only resets the modem state,
+   a full restart reloads the firmware. The recovery time of a restart is
+   measured from the restart until the next showtime entry.
+*/
+typedef struct
+{
+   /**
+   Number of full restarts */
+   DSL_OUT DSL_uint32_t nFullRestarts;
+   /**
+   Number of fast restarts */
+   DSL_OUT DSL_uint32_t nFastRestarts;
+   /**
+   Number of fast restarts which failed before the link activation. The
+   restart following such a failure is always a full restart. */
+   DSL_OUT DSL_uint32_t nFastRestartFailures;
+   /**
+   Number of full restarts which reached showtime */
+   DSL_OUT DSL_uint32_t nFullRecoveries;
+   /**
+   Recovery time of the last full restart [ms] */
+   DSL_OUT DSL_uint32_t nFullRecoveryTimeLast;
+   /**
+   Sum of the recovery times of all full restarts [ms] */
+   DSL_OUT DSL_uint32_t nFullRecoveryTimeTotal;
+   /**
+   Number of fast restarts which reached showtime */
+   DSL_OUT DSL_uint32_t nFastRecoveries;
+   /**
+   Recovery time of the last fast restart [ms] */
+   DSL_OUT DSL_uint32_t nFastRecoveryTimeLast;
+   /**
+   Sum of the recovery times of all fast restarts [ms] */
+   DSL_OUT DSL_uint32_t nFastRecoveryTimeTotal;
+} DSL_RestartStatisticsData_t;
+
+/**
+   Structure used to read the autoboot restart statistics of the line.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_RESTART_STATISTICS_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains the restart statistics */
+   DSL_OUT DSL_RestartStatisticsData_t data;
+} DSL_RestartStatistics_t;
+
 /**
    Structure used for sending plain byte data and low level device messages
 */
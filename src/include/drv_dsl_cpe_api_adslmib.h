@@ -2208,6 +2208,96 @@ typedef struct
    DSL_uint8_t flags;
 } adslAturChanIntvlInfo_t;
 
+/**
+   Maximum number of rows that are returned by
+   \ref DSL_FIO_MIB_ADSL_TABLE_GET (one row for each 15-min interval of the
+   previous 24 hours) */
+#define ADSL_MIB_TABLE_ROWS_MAX  96
+
+/** Definitions of the tables that can be read row by row
+    (\ref DSL_FIO_MIB_ADSL_TABLE_GET) */
+typedef enum
+{
+   /** adslAtucIntervalTable, rows according to \ref adslAtucIntvlInfo_t */
+   ADSL_ATUC_INTVL_TABLE = 0,
+   /** adslAturIntervalTable, rows according to \ref adslAturIntvlInfo_t */
+   ADSL_ATUR_INTVL_TABLE = 1,
+   /** adslAtucChanIntervalTable, rows according to
+       \ref adslAtucChanIntvlInfo_t */
+   ADSL_ATUC_CHAN_INTVL_TABLE = 2,
+   /** adslAturChanIntervalTable, rows according to
+       \ref adslAturChanIntvlInfo_t */
+   ADSL_ATUR_CHAN_INTVL_TABLE = 3,
+   /** Delimiter only */
+   ADSL_MIB_TABLE_LAST = 4
+} adslMibTable_t;
+
+/**
+   Rows of a table that is read by \ref DSL_FIO_MIB_ADSL_TABLE_GET, the valid
+   member depends on the selected \ref adslMibTable_t */
+typedef union
+{
+   /** Rows for \ref ADSL_ATUC_INTVL_TABLE */
+   adslAtucIntvlInfo_t atucIntvl[ADSL_MIB_TABLE_ROWS_MAX];
+   /** Rows for \ref ADSL_ATUR_INTVL_TABLE */
+   adslAturIntvlInfo_t aturIntvl[ADSL_MIB_TABLE_ROWS_MAX];
+   /** Rows for \ref ADSL_ATUC_CHAN_INTVL_TABLE */
+   adslAtucChanIntvlInfo_t atucChanIntvl[ADSL_MIB_TABLE_ROWS_MAX];
+   /** Rows for \ref ADSL_ATUR_CHAN_INTVL_TABLE */
+   adslAturChanIntvlInfo_t aturChanIntvl[ADSL_MIB_TABLE_ROWS_MAX];
+} adslMibTableRows_t;
+
+/**
+   Structure that defines all parameters that are used in ioctl
+   \ref DSL_FIO_MIB_ADSL_TABLE_GET */
+typedef struct
+{
+   /**
+      Table index, the channel number in case of the channel tables */
+   DSL_int_t ifIndex;
+   /**
+      Table that shall be read */
+   adslMibTable_t nTable;
+   /**
+      Interval number of the first row that shall be returned (1..96) */
+   DSL_int_t nFirstInterval;
+   /**
+      Bitmask to specify which parameters shall be accessed for each row
+      according to the flags definition of the selected table, for example
+      \ref adslAturIntvlInfoFlags_t */
+   DSL_uint8_t flags;
+   /**
+      Number of rows that are returned, the rows are consecutive and start with
+      interval number nFirstInterval. Reading stops with the first interval that
+      is not (yet) available. */
+   DSL_uint32_t nNumRows;
+   /**
+      Returned rows, the flags of each row include the requested parameters
+      that could not be accessed */
+   adslMibTableRows_t rows;
+} adslMibTableBulk_t;
+
+/**
+   Structure that defines all parameters that are used in ioctl
+   \ref DSL_FIO_MIB_ADSL_TABLE_NEXT_INDEX_GET */
+typedef struct
+{
+   /**
+      Table index, the channel number in case of the channel tables */
+   DSL_int_t ifIndex;
+   /**
+      Table that shall be searched */
+   adslMibTable_t nTable;
+   /**
+      Skip intervals whose data is not valid (intervalValidData is false) */
+   DSL_boolean_t bValidOnly;
+   /**
+      Interval number after which the search starts, 0 to get the first row.
+      Returns the interval number of the next existing row or 0 if there is
+      no further row. */
+   DSL_int_t IntervalNumber;
+} adslMibTableNextIndex_t;
+
 /**
    Structure that defines all parameters that are used in ioctl
    \ref DSL_FIO_MIB_ADSL_LINE_ALARM_CONF_PROFILE_ENTRY_GET and
@@ -55,6 +55,8 @@ typedef union
    adslAturChanIntvlInfo_t            adslAturChanIntvlInfo_pt;
    adslLineAlarmConfProfileEntry_t    adslLineAlarmConfProfileEntry_pt;
    adslAturTrapsFlags_t               adslAturTrapsFlags_pt;
+   adslMibTableBulk_t                 adslMibTableBulk_pt;
+   adslMibTableNextIndex_t            adslMibTableNextIndex_pt;
 
    #ifdef INCLUDE_ADSL_MIB_RFC3440
    adslLineExtTableEntry_t            adslLineExtTableEntry_pt;
@@ -1240,6 +1242,76 @@ typedef union
 
 #endif /* INCLUDE_ADSL_MIB_RFC3440 */
 
+/**
+   This ioctl returns consecutive rows of an interval table in one call. The
+   rows are taken from a per line cache which is refilled only if a 15-min
+   interval elapsed or the PM history was reset since the last access. An SNMP
+   agent can use it to walk a whole interval table instead of reading each
+   interval with a separate ioctl.
+
+   CLI
+   - long command: MIB_TableGet
+   - short command: mibtg
+
+   \param adslMibTableBulk_t*
+      The parameter points to a \ref adslMibTableBulk_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+
+   \code
+      adslMibTableBulk_t nData = { 0 };
+      DSL_int_t ret = 0;
+      nData.nTable = ADSL_ATUR_INTVL_TABLE;
+      nData.nFirstInterval = 1;
+      nData.flags = ATUR_INTVL_LOF_FLAG | ATUR_INTVL_LOS_FLAG |
+                    ATUR_INTVL_ESS_FLAG | ATUR_INTVL_VALID_DATA_FLAG;
+      ret = ioctl(fd, DSL_FIO_MIB_ADSL_TABLE_GET, (DSL_int_t) &nData);
+      // process nData.nNumRows rows of nData.rows.aturIntvl
+   \endcode
+
+   \remarks
+      Supported tables are listed in \ref adslMibTable_t.
+
+   \ingroup DRV_DSL_CPE_ADSL_MIB_IOCTL */
+#define DSL_FIO_MIB_ADSL_TABLE_GET \
+   _IOWR( DSL_IOC_MAGIC_MIB, 26, adslMibTableBulk_t )
+
+/**
+   This ioctl returns the interval number of the next existing row of an
+   interval table. Rows that are not (yet) filled are skipped, optionally also
+   rows whose data is not valid. An SNMP agent can use it for GETNEXT requests
+   instead of probing each interval number.
+
+   CLI
+   - long command: MIB_TableNextIndexGet
+   - short command: mibtnig
+
+   \param adslMibTableNextIndex_t*
+      The parameter points to a \ref adslMibTableNextIndex_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+
+   \code
+      adslMibTableNextIndex_t nData = { 0 };
+      DSL_int_t ret = 0;
+      nData.nTable = ADSL_ATUC_INTVL_TABLE;
+      nData.IntervalNumber = 0;
+      do
+      {
+         ret = ioctl(fd, DSL_FIO_MIB_ADSL_TABLE_NEXT_INDEX_GET, (DSL_int_t) &nData);
+         // read row nData.IntervalNumber if not 0
+      } while ((ret == 0) && (nData.IntervalNumber != 0));
+   \endcode
+
+   \remarks
+      Supported tables are listed in \ref adslMibTable_t.
+
+   \ingroup DRV_DSL_CPE_ADSL_MIB_IOCTL */
+#define DSL_FIO_MIB_ADSL_TABLE_NEXT_INDEX_GET \
+   _IOWR( DSL_IOC_MAGIC_MIB, 27, adslMibTableNextIndex_t )
+
 /** @} DRV_DSL_CPE_ADSL_MIB */
 
 #endif /* INCLUDE_DSL_ADSL_MIB */
@@ -58,9 +58,24 @@
 /* Add VRX support */
 #define INCLUDE_DSL_CPE_API_VRX /**/
 
+/* Enable delta write of the configuration messages */
+/* #undef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE */
+
+/* Enable coordinated bring-up of both lines of a device */
+/* #undef INCLUDE_DSL_CPE_COORDINATED_BRINGUP */
+
+/* Enable debug logger batching */
+#define INCLUDE_DSL_CPE_DEBUG_LOGGER_BATCHING /**/
+
 /* Enable debug logger support */
 #define INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT /**/
 
+/* Enable debug static keys */
+/* #undef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS */
+
+/* Enable fast restart without firmware reload */
+/* #undef INCLUDE_DSL_CPE_FAST_RESTART */
+
 /* Include Misc Line Status support */
 #define INCLUDE_DSL_CPE_MISC_LINE_STATUS /**/
 
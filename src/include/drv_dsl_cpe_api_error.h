@@ -86,6 +86,10 @@ typedef enum
    /* *********************************************************************** */
    /** transmission error */
    DSL_ERR_CEOC_TX_ERR = -300,
+   /** The CEOC Tx queue of the line is full and the message was not accepted.
+       The message has to be queued again after a queued message has been
+       sent, see \ref DSL_EVENT_S_SNMP_MESSAGE_SENT */
+   DSL_ERR_CEOC_TX_QUEUE_FULL = -301,
 
    /* *********************************************************************** */
    /* *** Error Codes for modem handling                                  *** */
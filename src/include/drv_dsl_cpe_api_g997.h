@@ -979,6 +979,223 @@ typedef struct
    DSL_OUT DSL_G997_SnrAllocationNscData_t data;
 } DSL_G997_SnrAllocationNsc_t;
 
+/**
+   Per subcarrier tables which are accessible with
+   \ref DSL_FIO_G997_PER_TONE_WINDOW_GET
+*/
+typedef enum
+{
+   /**
+   Bit allocation, see \ref DSL_FIO_G997_BIT_ALLOCATION_NSC_GET */
+   DSL_G997_PER_TONE_BITS = 0,
+   /**
+   Gain allocation, see \ref DSL_FIO_G997_GAIN_ALLOCATION_NSC_GET */
+   DSL_G997_PER_TONE_GAINS = 1,
+   /**
+   SNR allocation, see \ref DSL_FIO_G997_SNR_ALLOCATION_NSC_GET */
+   DSL_G997_PER_TONE_SNR = 2,
+   /**
+   DELT Hlog, see \ref DSL_FIO_G997_DELT_HLOG_GET */
+   DSL_G997_PER_TONE_DELT_HLOG = 3,
+   /**
+   DELT QLN, see \ref DSL_FIO_G997_DELT_QLN_GET */
+   DSL_G997_PER_TONE_DELT_QLN = 4,
+   /**
+   DELT SNR, see \ref DSL_FIO_G997_DELT_SNR_GET */
+   DSL_G997_PER_TONE_DELT_SNR = 5,
+   /**
+   DELT Hlin, see \ref DSL_FIO_G997_DELT_HLIN_GET
+   (\ref DSL_FIO_G997_PER_TONE_EXPORT only) */
+   DSL_G997_PER_TONE_DELT_HLIN = 6,
+   /**
+   Delimiter only */
+   DSL_G997_PER_TONE_LAST = 7
+} DSL_G997_PerToneType_t;
+
+/**
+   Window of a per subcarrier table.
+*/
+typedef struct
+{
+   /**
+   Index of the first tone of the window */
+   DSL_IN DSL_uint16_t nFirstTone;
+   /**
+   Number of requested tones, that is the number of data elements pNSCData
+   points to (up to \ref DSL_MAX_NSC). A value of 0 returns nNumData only */
+   DSL_IN DSL_uint16_t nNumTones;
+   /**
+   Number of used data elements of the complete table */
+   DSL_OUT DSL_uint16_t nNumData;
+   /**
+   Number of returned tones, 0 if nFirstTone is beyond nNumData */
+   DSL_OUT DSL_uint16_t nNumReturned;
+   /**
+   Subcarrier group size (DELT types only) */
+   DSL_OUT DSL_uint8_t nGroupSize;
+   /**
+   Buffer for the data elements of the window, starting with nFirstTone.
+   Tables with 8 bit values (bits, SNR, QLN) are returned within the lower
+   byte. May be DSL_NULL if nNumTones is 0 */
+   DSL_IN DSL_uint16_t *pNSCData;
+} DSL_G997_PerToneWindowData_t;
+
+/**
+   Window of a per subcarrier table.
+   This structure has to be used for ioctl
+   \ref DSL_FIO_G997_PER_TONE_WINDOW_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Specifies for which direction (upstream/downstream) the function will
+   apply */
+   DSL_IN DSL_AccessDir_t nDirection;
+   /**
+   Specifies the table */
+   DSL_IN DSL_G997_PerToneType_t nType;
+   /**
+   Specifies for which DELT parameter type (diagnostic/showtime) the function
+   will apply (DELT types only) */
+   DSL_IN DSL_DeltDataType_t nDeltDataType;
+   /**
+   Structure that contains the window data */
+   DSL_IN_OUT DSL_G997_PerToneWindowData_t data;
+} DSL_G997_PerToneWindow_t;
+
+/** Magic of a per subcarrier export ("DSPT") */
+#define DSL_G997_PER_TONE_EXPORT_MAGIC    0x44535054
+/** Format version of a per subcarrier export */
+#define DSL_G997_PER_TONE_EXPORT_VERSION  2
+/** Size of the serialized \ref DSL_G997_PerToneExportHeader_t [byte] */
+#define DSL_G997_PER_TONE_EXPORT_HEADER_SIZE   16
+/** Size of the serialized \ref DSL_G997_PerToneExportTable_t [byte] */
+#define DSL_G997_PER_TONE_EXPORT_TABLE_SIZE    16
+
+/**
+   Header of a per subcarrier export, see \ref DSL_FIO_G997_PER_TONE_EXPORT.
+   The members are serialized one after the other without padding as fixed
+   width little endian fields (\ref DSL_G997_PER_TONE_EXPORT_HEADER_SIZE
+   bytes), independent of the byte order and structure layout of the host.
+*/
+typedef struct
+{
+   /**
+   Always \ref DSL_G997_PER_TONE_EXPORT_MAGIC */
+   DSL_uint32_t nMagic;
+   /**
+   Format version, \ref DSL_G997_PER_TONE_EXPORT_VERSION */
+   DSL_uint16_t nVersion;
+   /**
+   Number of table headers that follow */
+   DSL_uint16_t nNumTables;
+   /**
+   Showtime epoch of the line the tables belong to */
+   DSL_uint32_t nShowtimeEpoch;
+   /**
+   Size of the complete export including this header [byte] */
+   DSL_uint32_t nSize;
+} DSL_G997_PerToneExportHeader_t;
+
+/**
+   Header of one table within a per subcarrier export. It is serialized like
+   \ref DSL_G997_PerToneExportHeader_t
+   (\ref DSL_G997_PER_TONE_EXPORT_TABLE_SIZE bytes) and followed by nSize
+   bytes of encoded data.
+
+   The values of the table are encoded as a sequence of tokens. Each token
+   starts with a control byte:
+   - 0x00..0x7F: (control + 1) valid values follow, each as the difference to
+     the previous valid value (starting with 0) in 16 bit arithmetic. The
+     difference is zigzag mapped (0, -1, 1, -2, ... to 0, 1, 2, 3, ...) and
+     stored as little endian base 128 varint (7 bits per byte, bit 7 set if
+     another byte follows).
+   - 0x80..0xFF: run of ((control & 0x7F) + 1) tones with the value nInvalid.
+
+   Tables with complex values (Hlin) contain two streams which are encoded
+   one after the other, first all real parts and then all imaginary parts.
+*/
+typedef struct
+{
+   /**
+   Table type, see \ref DSL_G997_PerToneType_t */
+   DSL_uint8_t nType;
+   /**
+   Direction, see \ref DSL_AccessDir_t */
+   DSL_uint8_t nDirection;
+   /**
+   Subcarrier group size (DELT types only) */
+   DSL_uint8_t nGroupSize;
+   /**
+   Number of encoded streams (1, or 2 for complex values) */
+   DSL_uint8_t nNumStreams;
+   /**
+   Number of values of each stream */
+   DSL_uint16_t nNumData;
+   /**
+   Value that marks an invalid or unused tone */
+   DSL_uint16_t nInvalid;
+   /**
+   Return code of the table read. The table contains no data in case of an
+   error (for example DELT data that is not available) */
+   DSL_int32_t nResult;
+   /**
+   Size of the encoded data that follows this header [byte] */
+   DSL_uint32_t nSize;
+} DSL_G997_PerToneExportTable_t;
+
+/**
+   Maximum size of a per subcarrier export [byte]
+*/
+#define DSL_G997_PER_TONE_EXPORT_SIZE_MAX \
+   (DSL_G997_PER_TONE_EXPORT_HEADER_SIZE + \
+    2 * DSL_G997_PER_TONE_LAST * DSL_G997_PER_TONE_EXPORT_TABLE_SIZE + \
+    2 * (DSL_G997_PER_TONE_LAST + 1) * 4 * DSL_MAX_NSC)
+
+/**
+   Per subcarrier export data.
+*/
+typedef struct
+{
+   /**
+   Specifies which DELT parameter type (diagnostic/showtime) is exported
+   for the DELT tables */
+   DSL_IN DSL_DeltDataType_t nDeltDataType;
+   /**
+   Size of the buffer pData points to [byte] */
+   DSL_IN DSL_uint32_t nBufferSize;
+   /**
+   Size of the complete export [byte]. If it exceeds nBufferSize, the export
+   is truncated and has to be requested again with a larger buffer */
+   DSL_OUT DSL_uint32_t nDataSize;
+   /**
+   Showtime epoch of the line the tables belong to */
+   DSL_OUT DSL_uint32_t nShowtimeEpoch;
+   /**
+   Buffer for the export. If DSL_NULL (or nBufferSize is 0), no table is
+   read and nDataSize returns the maximum export size
+   \ref DSL_G997_PER_TONE_EXPORT_SIZE_MAX */
+   DSL_IN DSL_uint8_t *pData;
+} DSL_G997_PerToneExportData_t;
+
+/**
+   Per subcarrier export.
+   This structure has to be used for ioctl
+   \ref DSL_FIO_G997_PER_TONE_EXPORT
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains the export data */
+   DSL_IN_OUT DSL_G997_PerToneExportData_t data;
+} DSL_G997_PerToneExport_t;
+
 /**
    Counters threshold crossing indication structure.
 */
@@ -2414,6 +2631,152 @@ typedef struct
    DSL_IN_OUT DSL_G997_SnmpData_t data;
 } DSL_G997_Snmp_t;
 
+/**
+   SNMP receive statistics.
+*/
+typedef struct
+{
+   /**
+   Number of SNMP messages received on the line */
+   DSL_OUT DSL_uint32_t nRxMessages;
+   /**
+   Number of SNMP messages which could not be queued because no memory was
+   available for the message buffer. These messages are lost for all
+   instances. */
+   DSL_OUT DSL_uint32_t nRxNoMemory;
+   /**
+   Number of SNMP messages dropped for the instance because its receive FIFO
+   was full */
+   DSL_OUT DSL_uint32_t nRxDropped;
+   /**
+   Number of SNMP messages dropped because of a full receive FIFO summed up
+   over all instances of the line */
+   DSL_OUT DSL_uint32_t nRxDroppedTotal;
+} DSL_G997_SnmpStatisticsData_t;
+
+/**
+   SNMP receive statistics structure.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_G997_SNMP_STATISTICS_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains SNMP statistics data */
+   DSL_OUT DSL_G997_SnmpStatisticsData_t data;
+} DSL_G997_SnmpStatistics_t;
+
+/**
+   SNMP message to be queued for transmission.
+*/
+typedef struct
+{
+   /**
+   SNMP message data */
+   DSL_IN DSL_G997_SnmpData_t message;
+   /**
+   Sequence number assigned to the message. It is returned with
+   \ref DSL_EVENT_S_SNMP_MESSAGE_SENT and within
+   \ref DSL_G997_SnmpTxStatusData_t once the message has been sent. */
+   DSL_OUT DSL_uint32_t nSeqNum;
+} DSL_G997_SnmpQueueData_t;
+
+/**
+   SNMP message queue structure.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_G997_SNMP_MESSAGE_QUEUE
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains the message to be queued */
+   DSL_IN_OUT DSL_G997_SnmpQueueData_t data;
+} DSL_G997_SnmpQueue_t;
+
+/**
+   Completion of a queued SNMP message.
+   This structure is used for the event \ref DSL_EVENT_S_SNMP_MESSAGE_SENT
+*/
+typedef struct
+{
+   /**
+   Sequence number of the message */
+   DSL_uint32_t nSeqNum;
+   /**
+   Result of the transmission, DSL_SUCCESS if the message has been passed to
+   the firmware */
+   DSL_Error_t nResult;
+   /**
+   Time between queueing and completion of the message [ms] */
+   DSL_uint32_t nLatency;
+} DSL_G997_SnmpTxCompletionData_t;
+
+/**
+   SNMP Tx queue status and statistics of the line.
+*/
+typedef struct
+{
+   /**
+   Number of messages the Tx queue can hold */
+   DSL_OUT DSL_uint32_t nQueueSize;
+   /**
+   Number of messages currently queued */
+   DSL_OUT DSL_uint32_t nQueueLevel;
+   /**
+   Highest number of messages which have been queued at the same time */
+   DSL_OUT DSL_uint32_t nQueueLevelMax;
+   /**
+   Sequence number of the message which was queued last */
+   DSL_OUT DSL_uint32_t nLastQueuedSeqNum;
+   /**
+   Completion of the message which was handled last */
+   DSL_OUT DSL_G997_SnmpTxCompletionData_t lastCompletion;
+   /**
+   Number of messages which have been sent */
+   DSL_OUT DSL_uint32_t nTxMessages;
+   /**
+   Number of messages whose transmission failed, including messages which
+   were discarded because the line left showtime */
+   DSL_OUT DSL_uint32_t nTxFailed;
+   /**
+   Number of messages which were rejected because the queue was full */
+   DSL_OUT DSL_uint32_t nTxRejected;
+   /**
+   Highest number of messages which were sent within one batch */
+   DSL_OUT DSL_uint32_t nBatchMax;
+   /**
+   Minimum time between queueing and completion of a message [ms] */
+   DSL_OUT DSL_uint32_t nLatencyMin;
+   /**
+   Maximum time between queueing and completion of a message [ms] */
+   DSL_OUT DSL_uint32_t nLatencyMax;
+   /**
+   Average time between queueing and completion of a message [ms].
+   Moving average, each new message contributes with a weight of 1/8. */
+   DSL_OUT DSL_uint32_t nLatencyAvg;
+} DSL_G997_SnmpTxStatusData_t;
+
+/**
+   SNMP Tx queue status structure.
+   This structure has to be used for ioctl
+   - \ref DSL_FIO_G997_SNMP_TX_STATUS_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Structure that contains the Tx queue status data */
+   DSL_OUT DSL_G997_SnmpTxStatusData_t data;
+} DSL_G997_SnmpTxStatus_t;
+
 /**
    Rate Adaptation Mode setting.
    This structure is both used for configuration as well as for status request.
@@ -145,6 +145,8 @@ typedef union
    DSL_G997_BitAllocationNsc_t         g997BitAllocationNsc;
    DSL_G997_SnrAllocationNsc_t         g997SnrAllocationNsc;
    DSL_G997_GainAllocationNsc_t        g997GainAllocationNsc;
+   DSL_G997_PerToneWindow_t            g997PerToneWindow;
+   DSL_G997_PerToneExport_t            g997PerToneExport;
    DSL_G997_DeltHlin_t                 g997DeltHlin;
    DSL_G997_DeltHlinScale_t            g997DeltHlinScale;
    DSL_G997_DeltHlog_t                 g997DeltHlog;
@@ -832,6 +834,363 @@ typedef union
    _IOWR(DSL_IOC_MAGIC_CPE_API, 71, DSL_DBG_ModuleDestination_t)
 #endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
 
+/**
+   This debug function enables or disables the binary device message trace.
+   While enabled all device messages which are sent or received are stored in
+   a per line ring buffer, independent of the debug level of
+   \ref DSL_DBG_MESSAGE_DUMP which only controls the text output. The stored
+   entries can be read in blocks with \ref DSL_FIO_DBG_MSG_TRACE_GET and
+   decoded by the application.
+
+   CLI
+   - long command: DBG_MsgTraceConfigSet
+   - short command: dbgmtcs
+
+   \param DSL_DBG_MsgTraceConfig_t*
+      The parameter points to a \ref DSL_DBG_MsgTraceConfig_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_DBG_MsgTraceConfig_t dbgMsgTraceConfig;
+      DSL_int_t ret = 0;
+
+      memset(&dbgMsgTraceConfig, 0x00, sizeof(DSL_DBG_MsgTraceConfig_t));
+      dbgMsgTraceConfig.data.bEnable = DSL_TRUE;
+      ret = ioctl(fd, DSL_FIO_DBG_MSG_TRACE_CONFIG_SET, &dbgMsgTraceConfig);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_DEBUG */
+#define DSL_FIO_DBG_MSG_TRACE_CONFIG_SET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 72, DSL_DBG_MsgTraceConfig_t)
+
+/**
+   This debug function returns the binary device message trace
+   configuration.
+
+   CLI
+   - long command: DBG_MsgTraceConfigGet
+   - short command: dbgmtcg
+
+   \param DSL_DBG_MsgTraceConfig_t*
+      The parameter points to a \ref DSL_DBG_MsgTraceConfig_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_DBG_MsgTraceConfig_t dbgMsgTraceConfig;
+      DSL_int_t ret = 0;
+
+      memset(&dbgMsgTraceConfig, 0x00, sizeof(DSL_DBG_MsgTraceConfig_t));
+      ret = ioctl(fd, DSL_FIO_DBG_MSG_TRACE_CONFIG_GET, &dbgMsgTraceConfig);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_DEBUG */
+#define DSL_FIO_DBG_MSG_TRACE_CONFIG_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 73, DSL_DBG_MsgTraceConfig_t)
+
+/**
+   This debug function reads a block of binary device message trace entries
+   starting with the given sequence number. Up to
+   \ref DSL_DBG_MSG_TRACE_READ_MAX entries are returned per call, the
+   sequence number for the next call is returned in nNextSeq. Entries which
+   were overwritten before they could be read are counted in nLost.
+   A capture of the raw \ref DSL_DBG_MsgTraceEntry_t entries can be decoded
+   into the text format of the message dump or merged into the tracepoint
+   timeline with the script 'scripts/dsl_cpe_trace_decode.py'.
+
+   CLI
+   - long command: DBG_MsgTraceGet
+   - short command: dbgmtg
+
+   \param DSL_DBG_MsgTrace_t*
+      The parameter points to a \ref DSL_DBG_MsgTrace_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+   Reading the trace does not block the message handling of the line.
+
+   \code
+      DSL_DBG_MsgTrace_t dbgMsgTrace;
+      DSL_uint32_t nSeq = 0;
+      DSL_int_t ret = 0;
+
+      do
+      {
+         memset(&dbgMsgTrace, 0x00, sizeof(DSL_DBG_MsgTrace_t));
+         dbgMsgTrace.data.nStartSeq = nSeq;
+         ret = ioctl(fd, DSL_FIO_DBG_MSG_TRACE_GET, &dbgMsgTrace);
+         // Decode dbgMsgTrace.data.entry[0 .. nEntries-1] here...
+         nSeq = dbgMsgTrace.data.nNextSeq;
+      } while ((ret == 0) && (dbgMsgTrace.data.nEntries > 0));
+   \endcode
+
+   \ingroup DRV_DSL_CPE_DEBUG */
+#define DSL_FIO_DBG_MSG_TRACE_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 74, DSL_DBG_MsgTrace_t)
+
+/**
+   This debug function enables or disables the recording of the driver
+   tracepoints (refer to \ref DSL_DBG_TracePoint_t). While enabled, each
+   tracepoint hit is stored with a nanosecond time stamp in a per line ring
+   buffer which can be read in blocks with \ref DSL_FIO_DBG_TRACE_GET.
+
+   CLI
+   - long command: DBG_TraceConfigSet
+   - short command: dbgtcs
+
+   \param DSL_DBG_TraceConfig_t*
+      The parameter points to a \ref DSL_DBG_TraceConfig_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_DBG_TraceConfig_t dbgTraceConfig;
+      DSL_int_t ret = 0;
+
+      memset(&dbgTraceConfig, 0x00, sizeof(DSL_DBG_TraceConfig_t));
+      dbgTraceConfig.data.bEnable = DSL_TRUE;
+      ret = ioctl(fd, DSL_FIO_DBG_TRACE_CONFIG_SET, &dbgTraceConfig);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_DEBUG */
+#define DSL_FIO_DBG_TRACE_CONFIG_SET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 75, DSL_DBG_TraceConfig_t)
+
+/**
+   This debug function returns the tracepoint configuration.
+
+   CLI
+   - long command: DBG_TraceConfigGet
+   - short command: dbgtcg
+
+   \param DSL_DBG_TraceConfig_t*
+      The parameter points to a \ref DSL_DBG_TraceConfig_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_DBG_TraceConfig_t dbgTraceConfig;
+      DSL_int_t ret = 0;
+
+      memset(&dbgTraceConfig, 0x00, sizeof(DSL_DBG_TraceConfig_t));
+      ret = ioctl(fd, DSL_FIO_DBG_TRACE_CONFIG_GET, &dbgTraceConfig);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_DEBUG */
+#define DSL_FIO_DBG_TRACE_CONFIG_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 76, DSL_DBG_TraceConfig_t)
+
+/**
+   This debug function reads a block of tracepoint entries starting with the
+   given sequence number. Up to \ref DSL_DBG_TRACE_READ_MAX entries are
+   returned per call, the sequence number for the next call is returned in
+   nNextSeq. Entries which were overwritten before they could be read are
+   counted in nLost.
+   A capture of the raw \ref DSL_DBG_TraceEntry_t entries can be converted
+   into a timeline or flame graph input with the script
+   'scripts/dsl_cpe_trace_decode.py'.
+
+   CLI
+   - long command: DBG_TraceGet
+   - short command: dbgtg
+
+   \param DSL_DBG_Trace_t*
+      The parameter points to a \ref DSL_DBG_Trace_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+   Reading the trace does not block the tracepoints of the line.
+
+   \code
+      DSL_DBG_Trace_t dbgTrace;
+      DSL_uint32_t nSeq = 0;
+      DSL_int_t ret = 0;
+
+      do
+      {
+         memset(&dbgTrace, 0x00, sizeof(DSL_DBG_Trace_t));
+         dbgTrace.data.nStartSeq = nSeq;
+         ret = ioctl(fd, DSL_FIO_DBG_TRACE_GET, &dbgTrace);
+         fwrite(dbgTrace.data.entry, sizeof(DSL_DBG_TraceEntry_t),
+            dbgTrace.data.nEntries, pCaptureFile);
+         nSeq = dbgTrace.data.nNextSeq;
+      } while ((ret == 0) && (dbgTrace.data.nEntries > 0));
+   \endcode
+
+   \ingroup DRV_DSL_CPE_DEBUG */
+#define DSL_FIO_DBG_TRACE_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 77, DSL_DBG_Trace_t)
+
+/**
+   This function returns the device message statistics of the line. For each
+   message ID the number of transmissions, retries, acknowledge mismatches,
+   denied messages, timeouts and errors is counted together with a
+   logarithmic histogram of the round-trip times.
+
+   CLI
+   - long command: MsgStatisticsGet
+   - short command: msg
+
+   \param DSL_MsgStatistics_t*
+      The parameter points to a \ref DSL_MsgStatistics_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+   The statistics are read without locking the message handling, so the
+   counters of an entry which is updated concurrently might differ by one
+   message.
+
+   \code
+      DSL_MsgStatistics_t msgStatistics;
+      DSL_int_t ret = 0;
+
+      memset(&msgStatistics, 0x00, sizeof(DSL_MsgStatistics_t));
+      ret = ioctl(fd, DSL_FIO_MSG_STATISTICS_GET, &msgStatistics);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_COMMON */
+#define DSL_FIO_MSG_STATISTICS_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 78, DSL_MsgStatistics_t)
+
+/**
+   This function resets the device message statistics of the line.
+
+   CLI
+   - long command: MsgStatisticsReset
+   - short command: msr
+
+   \param DSL_MsgStatisticsReset_t*
+      The parameter points to a \ref DSL_MsgStatisticsReset_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_MsgStatisticsReset_t msgStatisticsReset;
+      DSL_int_t ret = 0;
+
+      memset(&msgStatisticsReset, 0x00, sizeof(DSL_MsgStatisticsReset_t));
+      ret = ioctl(fd, DSL_FIO_MSG_STATISTICS_RESET, &msgStatisticsReset);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_COMMON */
+#define DSL_FIO_MSG_STATISTICS_RESET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 79, DSL_MsgStatisticsReset_t)
+
+/**
+   This function returns the bring-up time stamps of the line, from the first
+   firmware request up to the first handshake (G.hs) and showtime entry. The
+   time stamps are given relative to the driver start.
+
+   CLI
+   - long command: BringUpTimingGet
+   - short command: butg
+
+   \param DSL_BringUpTiming_t*
+      The parameter points to a \ref DSL_BringUpTiming_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+   The wait time of the slave port is only available if the driver was
+   configured with "--enable-coordinated-bringup".
+
+   \code
+      DSL_BringUpTiming_t bringUpTiming;
+      DSL_int_t ret = 0;
+
+      memset(&bringUpTiming, 0x00, sizeof(DSL_BringUpTiming_t));
+      ret = ioctl(fd, DSL_FIO_BRINGUP_TIMING_GET, &bringUpTiming);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_COMMON */
+#define DSL_FIO_BRINGUP_TIMING_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 80, DSL_BringUpTiming_t)
+
+/**
+   This function returns the autoboot restart statistics of the line. Fast
+   restarts which keep the loaded firmware are counted separately from full
+   restarts which reload the firmware, together with the recovery times until
+   the next showtime entry.
+
+   CLI
+   - long command: RestartStatisticsGet
+   - short command: rsg
+
+   \param DSL_RestartStatistics_t*
+      The parameter points to a \ref DSL_RestartStatistics_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+   Fast restarts are only done if the driver was configured with
+   "--enable-fast-restart".
+
+   \code
+      DSL_RestartStatistics_t restartStatistics;
+      DSL_int_t ret = 0;
+
+      memset(&restartStatistics, 0x00, sizeof(DSL_RestartStatistics_t));
+      ret = ioctl(fd, DSL_FIO_RESTART_STATISTICS_GET, &restartStatistics);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_COMMON */
+#define DSL_FIO_RESTART_STATISTICS_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API, 81, DSL_RestartStatistics_t)
+
 /**
    This debug function makes it possible to send a low level device message.
    In addition to the data word a mask word is used that makes it possible to
@@ -3330,6 +3689,108 @@ typedef union
 #define DSL_FIO_G997_SNR_ALLOCATION_NSC_GET \
    _IO(DSL_IOC_MAGIC_CPE_API_G997, 17)
 
+/**
+   This function returns a window of a per subcarrier table (bit, gain or SNR
+   allocation, DELT Hlog, QLN or SNR) for the specified direction into a
+   buffer of the caller. Compared to the ioctls which return the complete
+   table only the requested window is copied.
+
+   The showtime tables of VDSL are read from the device for the requested
+   tones only. Other tables (ADSL, DELT diagnostics data or DELT SNR) are
+   read completely for each call and only the window is returned. No table
+   is kept within the driver between the calls.
+
+   CLI
+   - long command: G997_PerToneWindowGet
+   - short command: g997ptwg
+
+   \param DSL_G997_PerToneWindow_t*
+      The parameter points to a \ref DSL_G997_PerToneWindow_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_G997_PerToneWindow_t perToneWindow;
+      DSL_uint16_t nData[256];
+      DSL_uint16_t nTone = 0;
+      DSL_int_t ret = 0;
+
+      do
+      {
+         memset(&perToneWindow, 0x00, sizeof(DSL_G997_PerToneWindow_t));
+         perToneWindow.nDirection = DSL_DOWNSTREAM;
+         perToneWindow.nType = DSL_G997_PER_TONE_BITS;
+         perToneWindow.data.nFirstTone = nTone;
+         perToneWindow.data.nNumTones = 256;
+         perToneWindow.data.pNSCData = nData;
+         ret = ioctl(fd, DSL_FIO_G997_PER_TONE_WINDOW_GET, &perToneWindow);
+         // process perToneWindow.data.nNumReturned tones
+         nTone += perToneWindow.data.nNumReturned;
+      } while ((ret == 0) && (perToneWindow.data.nNumReturned > 0));
+   \endcode
+
+   \ingroup DRV_DSL_CPE_G997 */
+#define DSL_FIO_G997_PER_TONE_WINDOW_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_G997, 42, DSL_G997_PerToneWindow_t)
+
+/**
+   This function exports all per subcarrier tables (bit, gain and SNR
+   allocation, DELT Hlog, QLN, SNR and Hlin) of both directions with one call
+   into a compact binary snapshot that is tagged with the showtime epoch of
+   the line.
+
+   The export starts with a \ref DSL_G997_PerToneExportHeader_t which is
+   followed by one \ref DSL_G997_PerToneExportTable_t and its encoded data for
+   each table. The values are delta encoded across adjacent tones and runs of
+   invalid or unused tones are run length encoded, see
+   \ref DSL_G997_PerToneExportTable_t for the format.
+
+   If pData is DSL_NULL or nBufferSize is 0, the tables are not read and the
+   maximum export size \ref DSL_G997_PER_TONE_EXPORT_SIZE_MAX is returned
+   within nDataSize. If nBufferSize is too small, the export is truncated and
+   the required size is returned within nDataSize.
+   All multi byte fields of the export are stored in little endian byte
+   order.
+
+   CLI
+   - long command: G997_PerToneExport
+   - short command: g997pte
+
+   \param DSL_G997_PerToneExport_t*
+      The parameter points to a \ref DSL_G997_PerToneExport_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+      - DSL_WRN_INCOMPLETE_RETURN_VALUES if the export was truncated or the
+        line has left showtime during the export
+
+   \remarks
+   Supported by all platforms.
+
+   \code
+      DSL_G997_PerToneExport_t perToneExport;
+      DSL_int_t ret = 0;
+
+      memset(&perToneExport, 0x00, sizeof(DSL_G997_PerToneExport_t));
+      perToneExport.data.nDeltDataType = DSL_DELT_DATA_SHOWTIME;
+      ret = ioctl(fd, DSL_FIO_G997_PER_TONE_EXPORT, &perToneExport);
+      perToneExport.data.pData = malloc(perToneExport.data.nDataSize);
+      perToneExport.data.nBufferSize = perToneExport.data.nDataSize;
+      ret = ioctl(fd, DSL_FIO_G997_PER_TONE_EXPORT, &perToneExport);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_G997 */
+#define DSL_FIO_G997_PER_TONE_EXPORT \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_G997, 43, DSL_G997_PerToneExport_t)
+
 /**
    This function configures the mask for the autonomous line failure event
    signalling.
@@ -3881,6 +4342,116 @@ typedef union
 #define DSL_FIO_G997_SNMP_MESSAGE_RECEIVE \
    _IOWR(DSL_IOC_MAGIC_CPE_API_G997, 34, DSL_G997_Snmp_t)
 
+/**
+   This function returns the SNMP receive statistics of the line and of the
+   calling instance. A message which arrives while the receive FIFO of an
+   instance is full is dropped for this instance only and counted in
+   nRxDropped.
+
+   CLI
+   - long command: G997_SnmpStatisticsGet
+   - short command: g997ssg
+
+   \param DSL_G997_SnmpStatistics_t*
+      The parameter points to a \ref DSL_G997_SnmpStatistics_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by
+   - ADSL only platforms (XWAY(TM) ARX100, XWAY(TM) ARX300)
+
+   \code
+      DSL_G997_SnmpStatistics_t snmpStats;
+      DSL_int_t ret = 0;
+
+      memset(&snmpStats, 0x00, sizeof(DSL_G997_SnmpStatistics_t));
+
+      ret = ioctl(fd, DSL_FIO_G997_SNMP_STATISTICS_GET, &snmpStats);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_G997 */
+#define DSL_FIO_G997_SNMP_STATISTICS_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_G997, 44, DSL_G997_SnmpStatistics_t)
+
+/**
+   This function queues an SNMP message for transmission and returns without
+   waiting for the firmware. The CEOC thread of the line sends the queued
+   messages back to back. Each sent message is signaled with
+   \ref DSL_EVENT_S_SNMP_MESSAGE_SENT and the state of the queue can be read
+   with \ref DSL_FIO_G997_SNMP_TX_STATUS_GET.
+   If the queue is full the message is rejected with
+   \ref DSL_ERR_CEOC_TX_QUEUE_FULL. Queued messages which can not be sent
+   because the line left showtime are completed with
+   \ref DSL_ERR_ONLY_AVAILABLE_IN_SHOWTIME.
+
+   CLI
+   - long command: G997_SnmpMessageQueue
+   - short command: g997smq
+
+   \param DSL_G997_SnmpQueue_t*
+      The parameter points to a \ref DSL_G997_SnmpQueue_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by
+   - ADSL only platforms (XWAY(TM) ARX100, XWAY(TM) ARX300)
+
+   \code
+      DSL_G997_SnmpQueue_t snmpQueue;
+      DSL_int_t ret = 0;
+
+      memset(&snmpQueue, 0x00, sizeof(DSL_G997_SnmpQueue_t));
+      // Set data within SNMP structure here...
+
+      ret = ioctl(fd, DSL_FIO_G997_SNMP_MESSAGE_QUEUE, &snmpQueue);
+      // snmpQueue.data.nSeqNum identifies the completion event
+   \endcode
+
+   \ingroup DRV_DSL_CPE_G997 */
+#define DSL_FIO_G997_SNMP_MESSAGE_QUEUE \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_G997, 45, DSL_G997_SnmpQueue_t)
+
+/**
+   This function returns the state and the statistics of the SNMP Tx queue of
+   the line, see \ref DSL_FIO_G997_SNMP_MESSAGE_QUEUE.
+
+   CLI
+   - long command: G997_SnmpTxStatusGet
+   - short command: g997stsg
+
+   \param DSL_G997_SnmpTxStatus_t*
+      The parameter points to a \ref DSL_G997_SnmpTxStatus_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by
+   - ADSL only platforms (XWAY(TM) ARX100, XWAY(TM) ARX300)
+
+   \code
+      DSL_G997_SnmpTxStatus_t snmpTxStatus;
+      DSL_int_t ret = 0;
+
+      memset(&snmpTxStatus, 0x00, sizeof(DSL_G997_SnmpTxStatus_t));
+
+      ret = ioctl(fd, DSL_FIO_G997_SNMP_TX_STATUS_GET, &snmpTxStatus);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_G997 */
+#define DSL_FIO_G997_SNMP_TX_STATUS_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_G997, 46, DSL_G997_SnmpTxStatus_t)
+
 /**
    This function writes the Rate Adaptation (SRA) Configuration settings.
 
@@ -6258,6 +6829,86 @@ typedef union
 #define DSL_FIO_PM_SYNC_MODE_GET \
    _IOWR(DSL_IOC_MAGIC_CPE_API_PM, 71, DSL_PM_SyncMode_t)
 
+/**
+   This function returns the PM module timing statistics. These are the
+   processing time of the PM thread ticks, the firmware read latency per
+   counter family, the number of overrun and skipped ticks and the wait time
+   for the PM module mutexes. All times are given in nano seconds, taken
+   from the monotonic driver clock.
+   The statistics are updated with atomic operations and may be read
+   without blocking the PM threads.
+
+   CLI
+   - long command: PM_StatisticsGet
+   - short command: pmsg
+
+   \param DSL_PM_Statistics_t*
+      The parameter points to a \ref DSL_PM_Statistics_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms.
+   The statistics are always collected. If bReset is set to DSL_TRUE the
+   statistics are cleared after the read out.
+
+   \code
+      DSL_PM_Statistics_t pmStatistics;
+      DSL_int_t ret = 0;
+
+      memset(&pmStatistics, 0x00, sizeof(DSL_PM_Statistics_t));
+      ret = ioctl(fd, DSL_FIO_PM_STATISTICS_GET, &pmStatistics);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_PM */
+#define DSL_FIO_PM_STATISTICS_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_PM, 72, DSL_PM_Statistics_t)
+
+/**
+   This function returns the aggregated PM counters of the bonding group.
+   The group counters are the sums of the line second, data path (bearer
+   channel 0) and retransmission counters of all lines which are members of
+   the enabled bonding group. They are updated incrementally with each PM
+   poll cycle of the member lines, so the read out does not depend on the
+   number of lines.
+
+   CLI
+   - long command: PM_GroupCountersGet
+   - short command: pmgcg
+
+   \param DSL_PM_GroupCounters_t*
+      The parameter points to a \ref DSL_PM_GroupCounters_t structure
+
+   \return
+      0 if successful and -1 in case of an error/warning
+      In case of an error/warning please refer to the value of 'nReturn' which
+      is included within accessCtl structure of user data.
+
+   \remarks
+   Supported by all platforms with bonding support.
+   The counters of the bonding pair of the line are returned (lines 2n and
+   2n+1 form one pair).
+   The 15-min and 1-day records are aligned to the group intervals. A new
+   group interval is started by the first member line which reaches the
+   interval boundary. The counters of the member lines which did not reach
+   the boundary yet are still added to the previous group interval.
+
+   \code
+      DSL_PM_GroupCounters_t pmGroupCounters;
+      DSL_int_t ret = 0;
+
+      memset(&pmGroupCounters, 0x00, sizeof(DSL_PM_GroupCounters_t));
+      pmGroupCounters.nDirection = DSL_NEAR_END;
+      ret = ioctl(fd, DSL_FIO_PM_GROUP_COUNTERS_GET, &pmGroupCounters);
+   \endcode
+
+   \ingroup DRV_DSL_CPE_PM */
+#define DSL_FIO_PM_GROUP_COUNTERS_GET \
+   _IOWR(DSL_IOC_MAGIC_CPE_API_PM, 73, DSL_PM_GroupCounters_t)
+
 #ifdef INCLUDE_DEPRECATED
 
 /* ************************************************************************** */
@@ -179,6 +179,22 @@ typedef struct
    The default configuration value is 10 which leads to 10s cycle in case of
    nBasicUpdateCycle=1s. */
    DSL_IN_OUT DSL_uint8_t nFeUpdateCycleFactorL2;
+   /**
+   Provides the possibility to switch on the adaptive PM counters polling.
+   If active, the NearEnd and FarEnd update cycles are still based on
+   nBasicUpdateCycle and the FarEnd factors but they are adapted at runtime:
+   - the basic cycle is used as long as counters are changing or one of the
+     current 15-min counters comes close to its configured threshold
+   - the cycle is doubled with each update without any counter change up to
+     16 times the basic cycle
+   - the cycle never exceeds the end of the current 15-min interval, so the
+     interval is always closed in time
+   - no cyclic firmware polling is done in L3 or outside of showtime, the
+     PM module only wakes up for the interval closure in this case
+   This setting is not applied in Burnin Mode.
+   - DSL_FALSE - Fixed update cycles are used (DEFAULT)
+   - DSL_TRUE  - Adaptive update cycles are used */
+   DSL_IN_OUT DSL_boolean_t bAdaptivePollingOn;
 } DSL_PM_ConfigData_t;
 
 /**
@@ -1688,6 +1704,222 @@ typedef struct
    DSL_IN DSL_PM_BurninModeData_t data;
 } DSL_PM_BurninMode_t;
 
+/**
+   Number of bins of the PM module timing histograms, refer to
+   \ref DSL_PM_TimingHistogram_t
+*/
+#define DSL_PM_TIMING_HISTOGRAM_BINS   22
+
+/**
+   Logarithmic histogram of PM module processing times.
+   All times are in nano seconds, single samples saturate at 0xFFFFFFFF ns.
+   The fields are updated lock-free one by one, so a read out taken while
+   samples are added might be off by the samples in progress.
+*/
+typedef struct
+{
+   /**
+   Number of samples */
+   DSL_OUT DSL_uint32_t nCount;
+   /**
+   Sum of all samples, lower 32 bits [nsec] */
+   DSL_OUT DSL_uint32_t nSumLow;
+   /**
+   Sum of all samples, upper 32 bits [nsec]. The average value is
+   ((nSumHigh << 32) + nSumLow) / nCount */
+   DSL_OUT DSL_uint32_t nSumHigh;
+   /**
+   Maximum sample value [nsec] */
+   DSL_OUT DSL_uint32_t nMax;
+   /**
+   Sample distribution. Bin 0 counts samples below 2^10 nsec (about 1 usec),
+   bin n counts the samples from 2^(n+9) up to 2^(n+10)-1 nsec, the last bin
+   counts all samples of 2^(DSL_PM_TIMING_HISTOGRAM_BINS+8) nsec (about
+   1 sec) and above */
+   DSL_OUT DSL_uint32_t nBin[DSL_PM_TIMING_HISTOGRAM_BINS];
+} DSL_PM_TimingHistogram_t;
+
+/**
+   Counter families read out of the firmware during the PM tick processing.
+   Used as index of \ref DSL_PM_StatisticsData_t::fwRead
+*/
+typedef enum
+{
+   /** Line Init counters (Near-End only) */
+   DSL_PM_FW_READ_LINE_INIT = 0,
+   /** Data Path failure counters */
+   DSL_PM_FW_READ_DATA_PATH_FAILURE = 1,
+   /** Line Event Showtime counters */
+   DSL_PM_FW_READ_LINE_EVENT_SHOWTIME = 2,
+   /** Line Sec counters */
+   DSL_PM_FW_READ_LINE_SEC = 3,
+   /** Channel counters */
+   DSL_PM_FW_READ_CHANNEL = 4,
+   /** Data Path counters */
+   DSL_PM_FW_READ_DATA_PATH = 5,
+   /** Retransmission counters */
+   DSL_PM_FW_READ_RETX = 6,
+   /** Delimiter only */
+   DSL_PM_FW_READ_LAST = 7
+} DSL_PM_FwReadFamily_t;
+
+/**
+   PM module mutexes covered by the lock wait statistics.
+   Used as index of \ref DSL_PM_StatisticsData_t::lockWait
+*/
+typedef enum
+{
+   /** Near-End direction mutex */
+   DSL_PM_LOCK_NE_DIRECTION = 0,
+   /** Far-End direction mutex */
+   DSL_PM_LOCK_FE_DIRECTION = 1,
+   /** Near-End access mutex */
+   DSL_PM_LOCK_NE_ACCESS = 2,
+   /** Far-End access mutex */
+   DSL_PM_LOCK_FE_ACCESS = 3,
+   /** Common PM module mutex */
+   DSL_PM_LOCK_COMMON = 4,
+   /** Delimiter only */
+   DSL_PM_LOCK_LAST = 5
+} DSL_PM_LockType_t;
+
+/**
+   PM module timing statistics of one direction.
+*/
+typedef struct
+{
+   /**
+   Processing time of the PM thread ticks */
+   DSL_OUT DSL_PM_TimingHistogram_t tick;
+   /**
+   Firmware read latency per counter family,
+   index is \ref DSL_PM_FwReadFamily_t */
+   DSL_OUT DSL_PM_TimingHistogram_t fwRead[DSL_PM_FW_READ_LAST];
+   /**
+   Number of ticks which exceeded the poll cycle */
+   DSL_OUT DSL_uint32_t nOverrunTicks;
+   /**
+   Number of ticks without firmware counters read out (PM data invalid,
+   polling disabled or blocked) */
+   DSL_OUT DSL_uint32_t nSkippedTicks;
+} DSL_PM_DirStatisticsData_t;
+
+/**
+   PM module timing statistics.
+*/
+typedef struct
+{
+   /**
+   Near-End statistics */
+   DSL_OUT DSL_PM_DirStatisticsData_t ne;
+   /**
+   Far-End statistics */
+   DSL_OUT DSL_PM_DirStatisticsData_t fe;
+   /**
+   Wait time to acquire the PM module mutexes,
+   index is \ref DSL_PM_LockType_t */
+   DSL_OUT DSL_PM_TimingHistogram_t lockWait[DSL_PM_LOCK_LAST];
+} DSL_PM_StatisticsData_t;
+
+/**
+   Defines structure for reading the PM module timing statistics.
+   This structure has to be used for ioctl
+   \ref DSL_FIO_PM_STATISTICS_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Specifies whether to reset the statistics after read out */
+   DSL_IN DSL_boolean_t bReset;
+   /**
+   Structure that contains the statistics data */
+   DSL_OUT DSL_PM_StatisticsData_t data;
+} DSL_PM_Statistics_t;
+
+/**
+   Aggregated counters of the lines of a bonding group.
+   Each value is the sum of the values of all member lines. For the Line
+   Second counters this is the number of line seconds, nEftrMin is the sum of
+   the minimum EFTR values of the member lines.
+*/
+typedef struct
+{
+   /**
+   Line Second counters */
+   DSL_OUT DSL_PM_LineSecData_t lineSec;
+   /**
+   Data Path counters (bearer channel 0) */
+   DSL_OUT DSL_PM_DataPathData_t dataPath;
+   /**
+   Retransmission counters */
+   DSL_OUT DSL_PM_ReTxData_t reTx;
+} DSL_PM_GroupCountersData_t;
+
+/**
+   Aggregated counters of the bonding group for all interval types.
+*/
+typedef struct
+{
+   /**
+   Mask of the member lines (bit n for line n) which currently contribute to
+   the group counters */
+   DSL_OUT DSL_uint32_t nMemberMask;
+   /**
+   Number of the current 15-min interval of the group. The group interval is
+   started as soon as the first member line enters a new 15-min interval,
+   lines which did not reach the interval boundary yet are still accumulated
+   into the previous interval. */
+   DSL_OUT DSL_uint32_t n15MinInterval;
+   /**
+   Number of the current 1-day interval of the group, refer to
+   n15MinInterval */
+   DSL_OUT DSL_uint32_t n1DayInterval;
+   /**
+   Number of member line updates which were dropped since the driver start
+   because the line was more than one interval behind the group */
+   DSL_OUT DSL_uint32_t nDroppedUpdates;
+   /**
+   Current 15-min interval counters */
+   DSL_OUT DSL_PM_GroupCountersData_t curr15Min;
+   /**
+   Previous 15-min interval counters */
+   DSL_OUT DSL_PM_GroupCountersData_t prev15Min;
+   /**
+   Current 1-day interval counters */
+   DSL_OUT DSL_PM_GroupCountersData_t curr1Day;
+   /**
+   Previous 1-day interval counters */
+   DSL_OUT DSL_PM_GroupCountersData_t prev1Day;
+   /**
+   Total counters */
+   DSL_OUT DSL_PM_GroupCountersData_t total;
+   /**
+   Current showtime counters */
+   DSL_OUT DSL_PM_GroupCountersData_t showtime;
+} DSL_PM_GroupCountersAllData_t;
+
+/**
+   Defines structure for reading the aggregated bonding group counters.
+   This structure has to be used for ioctl
+   \ref DSL_FIO_PM_GROUP_COUNTERS_GET
+*/
+typedef struct
+{
+   /**
+   Driver control/status structure */
+   DSL_IN_OUT DSL_AccessCtl_t accessCtl;
+   /**
+   Specifies for which (near-end/far-end) direction the function will
+   apply */
+   DSL_IN DSL_XTUDir_t nDirection;
+   /**
+   Structure that contains the group counters data */
+   DSL_OUT DSL_PM_GroupCountersAllData_t data;
+} DSL_PM_GroupCounters_t;
+
 #if defined(DSL_PM_DEBUG_MODE_ENABLE) && (DSL_PM_DEBUG_MODE_ENABLE > 0)
 /**
    Configuration structure for the PM dump functions.
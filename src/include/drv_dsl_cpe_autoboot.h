@@ -147,6 +147,19 @@ DSL_Error_t DSL_DRV_AutobootTimeoutSet(
    DSL_uint32_t nTimeout);
 #endif
 
+/**
+   This routine accounts the recovery time of the restarts which waited for
+   the showtime entry. It has to be called on the showtime entry.
+
+   \param pContext Pointer to dsl library context structure, [I]
+
+   \ingroup DRV_DSL_CPE_INIT
+*/
+#ifndef SWIG
+DSL_void_t DSL_DRV_AutobootRestartRecoveryUpdate(
+   DSL_Context_t *pContext);
+#endif
+
 #if defined(INCLUDE_DSL_CPE_API_VRX)
 #ifndef SWIG
 DSL_Error_t DSL_DRV_AutobootSignalDeviceEvt(
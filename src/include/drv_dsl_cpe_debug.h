@@ -103,6 +103,43 @@ DSL_void_t DSL_DRV_ErrorSet(DSL_void_t *pContext, DSL_Error_t code);
 
    #define DSL_DEBUG_SET_ERROR(code) DSL_DRV_ErrorSet(pContext, code);
 
+#ifdef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS
+#ifndef __LINUX__
+   #error "Debug static keys are supported for Linux only!"
+#endif
+
+/** Number of debug levels that owns a static key per debug block,
+    one for each of PRN, ERR, WRN, MSG and LOCAL */
+#define DSL_DBG_KEY_LEVELS 5
+
+/** Maps a (constant) debug level to the index of its static key */
+#define DSL_DBG_KEY_IDX(level) \
+   (((level) <= DSL_DBGLVL_PRN) ? 0 : \
+    ((level) <= DSL_DBGLVL_ERR) ? 1 : \
+    ((level) <= DSL_DBGLVL_WRN) ? 2 : \
+    ((level) <= DSL_DBGLVL_MSG) ? 3 : 4)
+
+/**
+   Checks whether debug output of the given level is enabled for the actual
+   debug block.
+   The check is done by a patched branch (static key) which is updated by
+   \ref DSL_DRV_DBG_StaticKeysUpdate whenever the debug levels are changed.
+   Thus a disabled debug statement costs neither a memory load nor a compare.
+*/
+#define DSL_DBG_LEVEL_ENABLED(level) \
+   ((DSL_DBG_MAX_LEVEL >= level) && \
+    static_branch_unlikely(&DSL_g_dbgKey[DSL_DBG_BLOCK][DSL_DBG_KEY_IDX(level)]))
+#else
+/**
+   Checks whether debug output of the given level is enabled for the actual
+   debug block according to the local and global debug levels.
+*/
+#define DSL_DBG_LEVEL_ENABLED(level) \
+   ((DSL_DBG_MAX_LEVEL >= level) && \
+    ((((level) <= DSL_g_dbgLvl[DSL_DBG_BLOCK].nDbgLvl) && (DSL_g_globalDbgLvl == DSL_DBG_LOCAL)) \
+     || (((level) <= DSL_g_globalDbgLvl) && (DSL_g_globalDbgLvl != DSL_DBG_LOCAL))))
+#endif /* INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS*/
+
 /**
    Macro to print debug info contained in "body" with a prepended header that
    contains current file name, current function name (if available) and
@@ -116,9 +153,7 @@ DSL_void_t DSL_DRV_ErrorSet(DSL_void_t *pContext, DSL_Error_t code);
    /*lint -save -e568 -e685 -e774 */ \
    /* Warning 568 non-negative quantity is never less than zero */ \
    /* Warning 685 Relational operator '<=' always evaluates to 'true' */ \
-   if ( (DSL_DBG_MAX_LEVEL >= level) && \
-      ((((level) <= DSL_g_dbgLvl[DSL_DBG_BLOCK].nDbgLvl) && (DSL_g_globalDbgLvl == DSL_DBG_LOCAL)) \
-      || (((level) <= DSL_g_globalDbgLvl) && (DSL_g_globalDbgLvl != DSL_DBG_LOCAL)))) \
+   if (DSL_DBG_LEVEL_ENABLED(level)) \
    { \
       DSL_DBG_PRINTF(DSL_NULL, __FILE__":"); \
       DSL_DBG_PRINTF_FUNCTION; \
@@ -149,9 +184,7 @@ DSL_void_t DSL_DRV_ErrorSet(DSL_void_t *pContext, DSL_Error_t code);
    /*lint -save -e568 -e685 -e774 */ \
    /* Warning 568 non-negative quantity is never less than zero */ \
    /* Warning 685 Relational operator '<=' always evaluates to 'true' */ \
-   if ( (DSL_DBG_MAX_LEVEL >= level) && \
-        (((((level) <= DSL_g_dbgLvl[DSL_DBG_BLOCK].nDbgLvl) && (DSL_g_globalDbgLvl == DSL_DBG_LOCAL))) \
-     || (((level) <= DSL_g_globalDbgLvl) && (DSL_g_globalDbgLvl != DSL_DBG_LOCAL))) ) \
+   if (DSL_DBG_LEVEL_ENABLED(level)) \
    { \
       DSL_DBG_PRINTF body; \
    } \
@@ -192,6 +225,19 @@ extern const DSL_char_t* DSL_DBG_PRN_AUTOBOOT_STATE[];
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
 extern DSL_debugDestinations_t DSL_g_dbgDestination;
 #endif /* INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT */
+#ifdef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS
+extern struct static_key_false DSL_g_dbgKey[DSL_DBG_MAX_ENTRIES][DSL_DBG_KEY_LEVELS];
+
+/**
+   Recalculates the debug static keys of all debug blocks from the actual
+   local and global debug levels. Has to be called after any change of
+   \ref DSL_g_dbgLvl or \ref DSL_g_globalDbgLvl.
+
+   \remarks Patching the branches might sleep, so this function shall not be
+            called from atomic context.
+*/
+DSL_void_t DSL_DRV_DBG_StaticKeysUpdate(DSL_void_t);
+#endif /* INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS */
 
 #endif /* ifdef DSL_DEBUG_DISABLE */
 
@@ -79,6 +79,26 @@ DSL_Error_t DSL_CEOC_DEV_MessageSend(
    DSL_uint16_t protIdent,
    DSL_CEOC_Message_t *pMsg);
 
+/**
+   This function sends an EOC message like \ref DSL_CEOC_DEV_MessageSend but
+   does not lock the device, it has to be called while the device (bspMutex)
+   is locked. Used to send several messages with one device lock.
+
+   \param pContext   Pointer to dsl library context structure, [I]
+   \param protIdent  EOC protocol identifier, [I]
+   \param pMsg       Pointer to the EOC message, [I]
+
+   \return
+   Return values are defined within the DSL_Error_t definition
+   - DSL_SUCCESS (0) in case of success
+   - DSL_ERROR (-1) if operation failed
+   - or any other defined specific error code
+*/
+DSL_Error_t DSL_CEOC_DEV_MessageSendLocked(
+   DSL_Context_t *pContext,
+   DSL_uint16_t protIdent,
+   DSL_CEOC_Message_t *pMsg);
+
 DSL_Error_t DSL_CEOC_DEV_MessageReceive(
    DSL_Context_t *pContext,
    DSL_uint16_t *protIdent,
@@ -44,6 +44,32 @@ DSL_Error_t DSL_DRV_DEV_G997_SnrAllocationNscGet(
    DSL_IN DSL_Context_t *pContext,
    DSL_IN_OUT DSL_G997_SnrAllocationNsc_t *pData
 );
+
+/**
+   Reads the window of a per subcarrier table for the requested tones only
+   (see \ref DSL_FIO_G997_PER_TONE_WINDOW_GET).
+
+   \param pContext      Pointer to dsl library context structure, [I]
+   \param nType         Table to read, [I]
+   \param nDirection    Direction of the table, [I]
+   \param nDeltDataType DELT data type (DELT tables only), [I]
+   \param pData         Window data, the window is returned within the
+                        buffer pNSCData points to, [IO]
+
+   \return
+   Return values are defined within the DSL_Error_t definition
+   - DSL_SUCCESS in case of success
+   - DSL_ERR_NOT_SUPPORTED if the table is not read by tone range, the
+     window has to be taken from the complete table in this case
+   - or any other defined specific error code
+*/
+DSL_Error_t DSL_DRV_DEV_G997_PerToneRangeGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_G997_PerToneType_t nType,
+   DSL_IN DSL_AccessDir_t nDirection,
+   DSL_IN DSL_DeltDataType_t nDeltDataType,
+   DSL_IN_OUT DSL_G997_PerToneWindowData_t *pData
+);
 #endif /* INCLUDE_DSL_G997_PER_TONE*/
 
 /**
@@ -282,6 +282,80 @@ typedef struct
    DSL_uint16_t nLen;
 } DSL_FctWaiting_t;
 
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+/** Maximum number of configuration messages tracked by the delta write */
+#define DSL_VRX_CONFIG_WRITE_ENTRIES_MAX  32
+/** Maximum acknowledge payload recorded per configuration message [byte],
+    messages with larger acknowledges are always sent */
+#define DSL_VRX_CONFIG_WRITE_ACK_MAX      16
+
+/**
+   Last payload written with a configuration message */
+typedef struct
+{
+   /**
+   Entry is in use */
+   DSL_boolean_t bValid;
+   /**
+   Message ID */
+   DSL_uint16_t nMsgID;
+   /**
+   Payload length [byte] */
+   DSL_uint16_t nLength;
+   /**
+   FNV-1a hash of the payload */
+   DSL_uint32_t nHash;
+   /**
+   Acknowledge payload length [byte] */
+   DSL_uint16_t nLenAck;
+   /**
+   Acknowledge payload as received for the recorded payload, returned to
+   the caller if the message is skipped */
+   DSL_uint8_t ack[DSL_VRX_CONFIG_WRITE_ACK_MAX];
+} DSL_VRX_ConfigWriteEntry_t;
+
+/**
+   Configuration messages written to the firmware since its download.
+   The table is only accessed while the device (bspMutex) is locked.*/
+typedef struct
+{
+   /**
+   Configuration write in progress, the payloads of the sent messages are
+   recorded */
+   DSL_boolean_t bActive;
+   /**
+   The recorded payloads reflect the firmware configuration, unchanged
+   messages might be skipped */
+   DSL_boolean_t bValid;
+   /**
+   Number of messages skipped within the current configuration write */
+   DSL_uint32_t nSkipped;
+   /**
+   Last written payload per message ID */
+   DSL_VRX_ConfigWriteEntry_t entry[DSL_VRX_CONFIG_WRITE_ENTRIES_MAX];
+} DSL_VRX_ConfigWriteCache_t;
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
+#ifdef INCLUDE_DSL_CPE_FAST_RESTART
+/**
+   Firmware as loaded by the last successful firmware download */
+typedef struct
+{
+   /**
+   Information is valid */
+   DSL_boolean_t bValid;
+   /**
+   Firmware type of the download */
+   DSL_FirmwareRequestType_t nFwType;
+   /**
+   Port mode of the download */
+   DSL_PortMode_t nPortMode;
+   /**
+   Features of the downloaded firmware */
+   DSL_FirmwareFeatures_t nFwFeatures;
+} DSL_VRX_FwLoadedInfo_t;
+#endif /* INCLUDE_DSL_CPE_FAST_RESTART*/
+
 /**
    VRX specific device data*/
 typedef struct
@@ -348,6 +422,14 @@ typedef struct
 #endif
    /** Defines the device port mode for the firmware request. */
    DSL_PortMode_t nPortMode;
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+   /** Configuration messages written within the current firmware session */
+   DSL_VRX_ConfigWriteCache_t configWrite;
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+#ifdef INCLUDE_DSL_CPE_FAST_RESTART
+   /** Firmware loaded by the last successful download */
+   DSL_VRX_FwLoadedInfo_t fwLoaded;
+#endif /* INCLUDE_DSL_CPE_FAST_RESTART*/
 } DSL_DEV_Data_t;
 
 typedef enum
@@ -478,6 +560,11 @@ typedef struct
 #endif /* INCLUDE_DSL_G997_ALARM*/
 
 #if defined(DSL_CPE_SIMULATOR_DRIVER) && defined(WIN32)
+#elif defined(DSL_CPE_SIMULATOR_DRIVER)
+/*
+   Low-level driver access is served by the simulated device
+*/
+#include "drv_dsl_cpe_sim_vrx.h"
 #else
 /*
    Low-level driver  access mapping
@@ -490,6 +577,9 @@ typedef struct
 #define DSL_DRV_VRX_InternalDevReset           MEI_InternalDevReset
 #define DSL_DRV_VRX_InternalRequestConfig      MEI_InternalRequestConfig
 #define DSL_DRV_VRX_InternalFirmwareDownload   MEI_InternalFirmwareDownload
+#ifdef MEI_SUPPORT_FW_CHUNK_DOWNLOAD
+#define DSL_DRV_VRX_InternalFirmwareChunkDownload MEI_InternalFirmwareChunkDownload
+#endif /* MEI_SUPPORT_FW_CHUNK_DOWNLOAD*/
 #define DSL_DRV_VRX_InternalFwModeCtrlSet      MEI_InternalFwModeCtrlSet
 #define DSL_DRV_VRX_InternalMsgSend            MEI_InternalMsgSend
 #define DSL_DRV_VRX_InternalNfcEnable          MEI_InternalNfcEnable
@@ -721,6 +811,26 @@ DSL_Error_t DSL_DRV_VRX_CamExceptionHandle(
 DSL_Error_t DSL_DRV_VRX_CamFsmUpdate(
    DSL_Context_t *pContext);
 
+#ifdef INCLUDE_DSL_CPE_FAST_RESTART
+/**
+   This function checks whether the next training can be started without a
+   firmware reload. This is the case if the running firmware is still the one
+   of the last download and if its xDSL mode, port mode and features match the
+   ones required for the next training.
+
+   \param pContext     Pointer to dsl cpe library context structure, [I]
+   \param pFastRestart DSL_TRUE if the loaded firmware can be kept, [O]
+
+   \return
+   Return values are defined within the DSL_Error_t definition
+   - DSL_SUCCESS in case of success
+   - DSL_ERROR if operation failed
+*/
+DSL_Error_t DSL_DRV_VRX_FastRestartCheck(
+   DSL_Context_t *pContext,
+   DSL_boolean_t *pFastRestart);
+#endif /* INCLUDE_DSL_CPE_FAST_RESTART*/
+
 /**
    This function returns VDSL2 actual bandplan/profile information.
 
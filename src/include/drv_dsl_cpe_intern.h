@@ -77,12 +77,16 @@ typedef struct DSL_OpenContext
    DSL_BF_ResourceActivationType_t nResourceActivationMask;
    /** CEOC instance specific data */
 #ifdef INCLUDE_DSL_CEOC
-   /** CEOC FIFO for the SNMP protocol*/
+   /** CEOC FIFO for the SNMP protocol, the elements are pointers to the
+       shared message buffers*/
    DSL_FIFO *rxSnmpFifo;
    /** Rx FIFO buffer for the SNMP protocol*/
    DSL_uint8_t *rxSnmpFifoBuf;
    /** Event access mutex */
    DSL_DRV_Mutex_t rxSnmpFifoMutex;
+   /** Number of SNMP messages dropped for this instance because the Rx FIFO
+       was full*/
+   DSL_uint32_t nRxSnmpDropped;
 #endif /** #ifdef INCLUDE_DSL_CEOC*/
 } DSL_OpenContext_t;
 
@@ -186,6 +190,79 @@ typedef struct
 #endif /* #if defined(INCLUDE_DSL_FILTER_DETECTION)*/
 } DSL_ShowtimeMeasurement_t;
 
+/**
+   Control data of a per line binary trace ring buffer (message trace and
+   tracepoints). Each entry starts with its sequence number, which is written
+   only after the entry data is complete, so the ring can be read without
+   blocking the writers. Writers reserve the next sequence number with an
+   atomic fetch-add and never block each other.
+   The binary traces do not depend on the debug prints and are also available
+   if 'DSL_DEBUG_DISABLE' is set.
+*/
+typedef struct
+{
+   /** Trace enable flag */
+   DSL_boolean_t bEnable;
+   /** Sequence number of the next entry to write */
+   volatile DSL_uint32_t nWrSeq;
+} DSL_DBG_RingCtrl_t;
+
+/**
+   Per line ring buffer of the binary device message trace.
+*/
+typedef struct
+{
+   /** Ring control data */
+   DSL_DBG_RingCtrl_t ctrl;
+   /** Trace entries, the stored sequence number is incremented by one so
+       zero marks an entry which is empty or in progress */
+   DSL_DBG_MsgTraceEntry_t entry[DSL_DBG_MSG_TRACE_RING_SIZE];
+} DSL_DBG_MsgTraceRing_t;
+
+/**
+   Per line ring buffer of the driver tracepoints.
+*/
+typedef struct
+{
+   /** Ring control data */
+   DSL_DBG_RingCtrl_t ctrl;
+   /** Trace entries, the stored sequence number is incremented by one so
+       zero marks an entry which is empty or in progress */
+   DSL_DBG_TraceEntry_t entry[DSL_DBG_TRACE_RING_SIZE];
+} DSL_DBG_TraceRing_t;
+
+/**
+   Per line device message statistics.
+   The table is only written by the message handling while the device
+   (bspMutex) is locked, so no additional locking is needed. A slot is in use
+   as soon as its nSent counter is non zero, slots are never freed except by
+   a reset of the whole table.
+*/
+typedef struct
+{
+   /** Time of the last reset [ms] */
+   DSL_uint32_t nResetTime;
+   /** Number of messages which did not fit into the table */
+   DSL_uint32_t nOverflow;
+   /** Statistics per message ID, open addressing by message ID */
+   DSL_MsgStatisticsEntry_t entry[DSL_MSG_STATISTICS_ENTRIES_MAX];
+} DSL_MsgStatisticsTable_t;
+
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+/**
+   Firmware download state of the master port of a dual-line device.
+*/
+typedef enum
+{
+   /** No firmware download expected */
+   DSL_DRV_FW_DOWNLOAD_IDLE = 0,
+   /** Firmware requested by the autoboot, download not started yet */
+   DSL_DRV_FW_DOWNLOAD_REQUESTED = 1,
+   /** Firmware download ongoing */
+   DSL_DRV_FW_DOWNLOAD_PENDING = 2
+} DSL_DRV_FwDownloadState_t;
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
+
 /**
    The driver context contains global information.
 */
@@ -430,6 +507,7 @@ struct DSL_Context
    DSL_G997_DeltShowtimeData_t *DELT_SHOWTIME;
    #endif
 #endif /* #ifdef INCLUDE_DSL_DELT*/
+
    /** Internal used decoded values derived from xSTE octets */
    /** Current mode */
    DSL_xDslMode_t nXDslMode;
@@ -462,6 +540,8 @@ struct DSL_Context
 
 #if defined(INCLUDE_DSL_CEOC)
    DSL_void_t *CEOC;
+   /** SNMP receive statistics of the line */
+   DSL_G997_SnmpStatisticsData_t snmpStats;
 #endif /** #if defined(INCLUDE_DSL_CEOC)*/
 
 #if defined(INCLUDE_DSL_PM)
@@ -548,6 +628,46 @@ struct DSL_Context
    DSL_boolean_t  bFwEventRcvd;
    DSL_Error_t    nFwEventLastReadErr;
    DSL_LineStateValue_t nFwEventLineState;
+
+   /** Binary device message trace */
+   DSL_DBG_MsgTraceRing_t msgTrace;
+   /** Driver tracepoints */
+   DSL_DBG_TraceRing_t trace;
+
+   /** Device message statistics */
+   DSL_MsgStatisticsTable_t msgStats;
+
+   /** Bring-up time stamps of the line */
+   DSL_BringUpTimingData_t bringUpTiming;
+   /** Number of showtime entries of the line since the driver start */
+   DSL_uint32_t nShowtimeEpoch;
+   /** Autoboot restart statistics */
+   DSL_RestartStatisticsData_t restartStats;
+   /** Time of the first restart which waits for showtime [ms], 0 if none */
+   DSL_uint32_t nRestartStartTime;
+   /** The last restart is already counted as fast or full restart */
+   DSL_boolean_t bRestartCounted;
+   /** The last restart keeps the loaded firmware */
+   DSL_boolean_t bFastRestart;
+   /** Fast restart did not reach the link activation yet */
+   DSL_boolean_t bFastRestartPending;
+   /** Mappings of the 1st and 2nd firmware binary of a zero-copy firmware
+       download (refer to \ref DSL_DRV_UserBufferMap). They are only set while
+       DSL_DRV_AutobootLoadFirmware downloads mapped user buffers, the device
+       layer writes the image chunk by chunk from the mapping then. */
+   DSL_void_t *pFwMap;
+   DSL_void_t *pFwMap2;
+#ifdef INCLUDE_DSL_CPE_COORDINATED_BRINGUP
+   /** Signals firmware download and autoboot state progress of the line */
+   DSL_DRV_Event_t bringUpEvent;
+   /** Protects nFwDownloadState and nFwDownloadImageId */
+   DSL_DRV_Mutex_t bringUpMutex;
+   /** Firmware download state of the master port */
+   DSL_DRV_FwDownloadState_t nFwDownloadState;
+   /** Cache ID (refer to \ref DSL_DRV_FwCacheIdGet) of the image of the last
+       successful firmware download of the master port, 0 if none */
+   DSL_uint32_t nFwDownloadImageId;
+#endif /* INCLUDE_DSL_CPE_COORDINATED_BRINGUP*/
 };
 
 #define DSL_EVENT2MASK(evt) ((DSL_uint32_t)(0x1 << ((DSL_uint32_t)evt)))
@@ -1475,6 +1595,203 @@ DSL_Error_t DSL_DRV_DBG_ModuleLevelGet(
 #endif
 #endif
 
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_DBG_MSG_TRACE_CONFIG_SET
+
+   \note CLI Debug functions should be not generated automatically
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_DBG_MsgTraceConfigSet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_DBG_MsgTraceConfig_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_DBG_MSG_TRACE_CONFIG_GET
+
+   \note CLI Debug functions should be not generated automatically
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_DBG_MsgTraceConfigGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_MsgTraceConfig_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_DBG_MSG_TRACE_GET
+
+   \note CLI Debug functions should be not generated automatically
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_DBG_MsgTraceGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_MsgTrace_t *pData
+);
+#endif
+
+/**
+   Stores a device message in the binary message trace of the line.
+
+   \param pContext Pointer to dsl cpe library context structure, [I]
+   \param nDir     Message direction, [I]
+   \param nClass   Message classifier, [I]
+   \param nMsgId   Message ID, [I]
+   \param pData    Message data starting with the two header words, [I]
+   \param nSize    Message size [bytes], [I]
+*/
+#ifndef SWIG
+DSL_void_t DSL_DRV_DBG_MsgTraceRecord(
+   DSL_Context_t *pContext,
+   const DSL_DBG_MsgTraceDir_t nDir,
+   const DSL_uint16_t nClass,
+   const DSL_uint16_t nMsgId,
+   const DSL_uint8_t *pData,
+   const DSL_uint16_t nSize);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_DBG_TRACE_CONFIG_SET
+
+   \note CLI Debug functions should be not generated automatically
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_DBG_TraceConfigSet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_DBG_TraceConfig_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_DBG_TRACE_CONFIG_GET
+
+   \note CLI Debug functions should be not generated automatically
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_DBG_TraceConfigGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_TraceConfig_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_DBG_TRACE_GET
+
+   \note CLI Debug functions should be not generated automatically
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_DBG_TraceGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_DBG_Trace_t *pData
+);
+#endif
+
+/**
+   Stores a tracepoint hit in the tracepoint ring buffer of the line.
+   Should be called by means of \ref DSL_DRV_DBG_TRACE only.
+
+   \param pContext Pointer to dsl cpe library context structure, [I]
+   \param nPoint   Tracepoint, [I]
+   \param nResult  Result value, [I]
+   \param nArg0    First argument, [I]
+   \param nArg1    Second argument, [I]
+   \param nArg2    Third argument, [I]
+   \param nArg3    Fourth argument, [I]
+*/
+#ifndef SWIG
+DSL_void_t DSL_DRV_DBG_TraceRecord(
+   DSL_Context_t *pContext,
+   const DSL_DBG_TracePoint_t nPoint,
+   const DSL_int32_t nResult,
+   const DSL_uint32_t nArg0,
+   const DSL_uint32_t nArg1,
+   const DSL_uint32_t nArg2,
+   const DSL_uint32_t nArg3);
+#endif
+
+/**
+   Returns the time elapsed since the given monotonic time stamp as returned
+   by DSL_DRV_TimeNSecGet() [ns].
+   The value saturates at 0xFFFFFFFF (about 4.3 s).
+
+   \param nSec     Seconds part of the time stamp, [I]
+   \param nNSec    Nanoseconds part of the time stamp, [I]
+
+   \return
+   Elapsed time [ns]
+*/
+#ifndef SWIG
+DSL_uint32_t DSL_DRV_ElapsedTimeNSecGet(
+   const DSL_uint32_t nSec,
+   const DSL_uint32_t nNSec);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_MSG_STATISTICS_GET
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_MsgStatisticsGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_MsgStatistics_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_MSG_STATISTICS_RESET
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_MsgStatisticsReset(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_MsgStatisticsReset_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_BRINGUP_TIMING_GET
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_BringUpTimingGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_BringUpTiming_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_RESTART_STATISTICS_GET
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_RestartStatisticsGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_RestartStatistics_t *pData
+);
+#endif
+
+/**
+   Records a tracepoint hit if the tracepoints of the line are enabled.
+*/
+#define DSL_DRV_DBG_TRACE(pContext, nPoint, nResult, nArg0, nArg1, nArg2, nArg3) \
+   do { \
+      if ((pContext)->trace.ctrl.bEnable == DSL_TRUE) \
+      { \
+         DSL_DRV_DBG_TraceRecord(pContext, nPoint, (DSL_int32_t)(nResult), \
+            (DSL_uint32_t)(nArg0), (DSL_uint32_t)(nArg1), \
+            (DSL_uint32_t)(nArg2), (DSL_uint32_t)(nArg3)); \
+      } \
+   } while (0)
+/** Checks whether the tracepoints of the line are enabled */
+#define DSL_DRV_DBG_TRACE_ENABLED(pContext) ((pContext)->trace.ctrl.bEnable == DSL_TRUE)
+
 #ifdef INCLUDE_DSL_CPE_DEBUG_LOGGER_SUPPORT
 /**
    For a detailed description please refer to the equivalent ioctl
@@ -1750,7 +2067,7 @@ DSL_Error_t DSL_DRV_IoctlHandle(
    DSL_Context_t *pContext,
    DSL_boolean_t bIsInKernel,
    DSL_uint_t nCommand,
-   DSL_uint32_t nArg
+   DSL_ulong_t nArg
 );
 #endif
 
@@ -2057,6 +2374,129 @@ DSL_Error_t DSL_DRV_OnTimeoutEvent(
       (nErrCode = _DSL_SET_ERROR_CODE(nRetCode, nErrCode))
 #endif
 
+/** Size of the (stack) bounce buffer through which firmware images are
+    hashed and compared chunk by chunk*/
+#define DSL_DRV_FW_CACHE_CHUNK_SIZE    256
+
+/**
+   Entry of the firmware image cache. The cache holds one kernel copy of each
+   firmware binary which is shared by all lines and firmware reloads.
+*/
+typedef struct DSL_DRV_FwCacheEntry
+{
+   /** Next entry of the cache list*/
+   struct DSL_DRV_FwCacheEntry *pNext;
+   /** FNV-1a hash of the image*/
+   DSL_uint32_t nHash;
+   /** Size of the image*/
+   DSL_uint32_t nSize;
+   /** Number of users of the image, the entry is freed on the last release*/
+   DSL_uint32_t nRefCount;
+   /** Unique ID of the entry, never reused for another image*/
+   DSL_uint32_t nId;
+   /** Kernel copy of the image*/
+   DSL_uint8_t *pData;
+} DSL_DRV_FwCacheEntry_t;
+
+/**
+   Initializes the firmware image cache, called once on the driver start.
+*/
+DSL_void_t DSL_DRV_FwCacheInit(DSL_void_t);
+
+/**
+   Takes the reference time of the bring-up time stamps, called once on the
+   driver start.
+*/
+DSL_void_t DSL_DRV_BringUpInit(DSL_void_t);
+
+/**
+   Returns the time since the driver start.
+
+   \return
+   Time since the driver start [ms], at least 1 to distinguish a taken time
+   stamp from an unused one
+*/
+DSL_uint32_t DSL_DRV_BringUpTimeGet(DSL_void_t);
+
+/** Takes a bring-up time stamp of the line on the first occurrence only.
+    The time stamps are protected by the data mutex as they are read by
+    \ref DSL_FIO_BRINGUP_TIMING_GET. */
+#define DSL_DRV_BRINGUP_TIMESTAMP(ctx, field) \
+   DSL_DRV_BRINGUP_TIMESTAMP_SET(ctx, field, DSL_DRV_BringUpTimeGet())
+
+/** Sets a bring-up time value of the line on the first occurrence only*/
+#define DSL_DRV_BRINGUP_TIMESTAMP_SET(ctx, field, val) \
+   do \
+   { \
+      if (DSL_DRV_MUTEX_LOCK((ctx)->dataMutex) == 0) \
+      { \
+         if ((ctx)->bringUpTiming.field == 0) \
+         { \
+            (ctx)->bringUpTiming.field = (val); \
+         } \
+         DSL_DRV_MUTEX_UNLOCK((ctx)->dataMutex); \
+      } \
+   } while (0)
+
+/**
+   Returns a reference to the cached kernel copy of a firmware image.
+   The image is identified by its content. It is hashed and compared with the
+   cached copies chunk by chunk through a small bounce buffer, so reusing a
+   cached image allocates no memory. Only on a miss a new copy is allocated
+   and inserted.
+
+   \param pContext      Pointer to dsl library context structure, [I]
+   \param bIsInKernel   whether the image is already in the kernel space, [I]
+   \param pImage        firmware image, [I]
+   \param nSize         size of the firmware image, [I]
+   \param ppData        returns the cached copy, DSL_NULL if no image is
+                        specified, [O]
+
+   \return  Return values are defined within the \ref DSL_Error_t definition
+    - DSL_SUCCESS in case of success
+    - DSL_ERROR if operation failed
+*/
+DSL_Error_t DSL_DRV_FwCacheGet(
+   DSL_Context_t *pContext,
+   DSL_boolean_t bIsInKernel,
+   const DSL_uint8_t *pImage,
+   DSL_uint32_t nSize,
+   DSL_uint8_t **ppData);
+
+/**
+   Takes an additional reference to a cached firmware image.
+
+   \param pData   cached copy returned by \ref DSL_DRV_FwCacheGet, [I]
+
+   \return  Return values are defined within the \ref DSL_Error_t definition
+    - DSL_SUCCESS in case of success
+    - DSL_ERROR if the pointer is not part of the cache
+*/
+DSL_Error_t DSL_DRV_FwCacheRefGet(
+   const DSL_uint8_t *pData);
+
+/**
+   Releases a reference to a cached firmware image. The copy is freed with the
+   last reference. Pointers which are not part of the cache are ignored.
+
+   \param pData   cached copy returned by \ref DSL_DRV_FwCacheGet, [I]
+*/
+DSL_void_t DSL_DRV_FwCacheRelease(
+   const DSL_uint8_t *pData);
+
+/**
+   Returns the ID of a cached firmware image. The cache holds each image
+   content only once and IDs are never reused, so equal IDs mean equal
+   images even if the entry was freed and the memory reused meanwhile.
+
+   \param pData   cached copy returned by \ref DSL_DRV_FwCacheGet, [I]
+
+   \return
+   ID of the image, 0 if the pointer is not part of the cache
+*/
+DSL_uint32_t DSL_DRV_FwCacheIdGet(
+   const DSL_uint8_t *pData);
+
 /**
    Firmware download routine
 
@@ -2146,6 +2586,26 @@ DSL_Error_t DSL_DRV_EventQueue(
 );
 #endif
 
+/**
+   This function places an event into the FIFO of one instance and wakes up its
+   poll routine. The caller has to hold the Open Context list mutex.
+
+   \param pOpenContext  Pointer to the instance context [I]
+   \param pEvent        Pointer to event structure to be added to FIFO [I]
+   \param nDataSize     The size of event data [I]
+
+   \return
+   - DSL_TRUE if the event was queued
+   - DSL_FALSE if the instance does not accept the event or its FIFO is full
+*/
+#ifndef SWIG
+DSL_boolean_t DSL_DRV_OpenContextEventQueue(
+   DSL_IN DSL_OpenContext_t *pOpenContext,
+   DSL_IN DSL_EventStatusData_t *pEvent,
+   DSL_IN DSL_uint32_t nDataSize
+);
+#endif
+
 /**
    This function gets an event from upper layer software FIFO
 
@@ -20,10 +20,15 @@
 /** \addtogroup DRV_DSL_CPE_COMMON
  @{ */
 
-#define DSL_CEOC_RX_FIFO_ELEMENT_COUNT   (2)
+/** Number of SNMP messages an instance can queue. The FIFO elements are
+    pointers to the shared message buffers, see \ref DSL_CEOC_SnmpMsgBuf_t*/
+#define DSL_CEOC_RX_FIFO_ELEMENT_COUNT   (16)
 
 #define DSL_CEOC_THREAD_POLLING_CYCLE   (1000)
 
+/** Number of messages the Tx queue of a line can hold*/
+#define DSL_CEOC_TX_QUEUE_SIZE   (8)
+
 /** Defines number of retries to send the EOC message*/
 #define DSL_CEOC_MESSAGE_TX_RETRY_NUM   (10)
 
@@ -49,6 +54,21 @@ typedef struct
    DSL_DRV_Event_t waitEvent;
 } DSL_CEOC_Thread_t;
 
+/**
+   Element of the CEOC Tx queue
+*/
+typedef struct
+{
+   /** Protocol identifier of the message*/
+   DSL_uint16_t protIdent;
+   /** Sequence number returned to the application*/
+   DSL_uint32_t nSeqNum;
+   /** Time when the message was queued [ms]*/
+   DSL_uint32_t nQueueTime;
+   /** Message data*/
+   DSL_CEOC_Message_t msg;
+} DSL_CEOC_TxEntry_t;
+
 typedef struct
 {
    /** CEOC module initialization flag*/
@@ -57,6 +77,16 @@ typedef struct
    DSL_DRV_Mutex_t ceocMutex;
    /** CEOC module task*/
    DSL_CEOC_Thread_t ceocThread;
+   /** Tx queue mutex, protects the queue and the Tx status*/
+   DSL_DRV_Mutex_t txMutex;
+   /** Tx queue, drained by the CEOC module task*/
+   DSL_FIFO txFifo;
+   /** Tx queue buffer*/
+   DSL_CEOC_TxEntry_t txFifoBuf[DSL_CEOC_TX_QUEUE_SIZE];
+   /** Sequence number of the last queued message*/
+   DSL_uint32_t nTxSeqNum;
+   /** Tx queue status and statistics*/
+   DSL_G997_SnmpTxStatusData_t txStatus;
 #ifdef INCLUDE_DSL_CEOC_INTERNAL_API
    /** Internal API CEOC module mutex*/
    DSL_DRV_Mutex_t ceocInternMutex;
@@ -70,6 +100,19 @@ typedef struct
 #endif /* defined(INCLUDE_DSL_CPE_API_VRX)*/
 } DSL_CEOC_Context_t;
 
+/**
+   Received SNMP message. One buffer is allocated per message and shared by the
+   Rx SNMP FIFOs of all instances, each FIFO slot holds a reference to it.
+*/
+typedef struct
+{
+   /** Number of FIFO slots which reference the buffer, only changed with
+       DSL_DRV_ATOMIC_FETCH_ADD*/
+   DSL_uint32_t nRefCount;
+   /** Message data*/
+   DSL_CEOC_Message_t msg;
+} DSL_CEOC_SnmpMsgBuf_t;
+
 
 #ifndef SWIG
 /**
@@ -125,6 +168,51 @@ DSL_Error_t DSL_CEOC_FifoMessageRead(
    DSL_Context_t *pContext,
    DSL_uint16_t protIdent,
    DSL_CEOC_Message_t *pMsg);
+
+/**
+   Queues a message for transmission by the CEOC module task.
+
+   \param pContext  Pointer to dsl library context structure, [I]
+   \param protIdent Protocol identifier of the message, [I]
+   \param pMsg      Message to be sent, [I]
+   \param pSeqNum   Returns the sequence number of the message, [O]
+
+   \return  Return values are defined within the \ref DSL_Error_t definition
+    - DSL_SUCCESS in case of success
+    - DSL_ERR_CEOC_TX_QUEUE_FULL if the Tx queue is full
+    - or any other defined specific error code
+*/
+DSL_Error_t DSL_CEOC_MessageQueue(
+   DSL_Context_t *pContext,
+   DSL_uint16_t protIdent,
+   DSL_CEOC_Message_t *pMsg,
+   DSL_uint32_t *pSeqNum);
+
+/**
+   Returns the state and the statistics of the Tx queue.
+
+   \param pContext Pointer to dsl library context structure, [I]
+   \param pData    Returns the Tx queue status, [O]
+
+   \return  Return values are defined within the \ref DSL_Error_t definition
+    - DSL_SUCCESS in case of success
+    - or any other defined specific error code
+*/
+DSL_Error_t DSL_CEOC_TxStatusGet(
+   DSL_Context_t *pContext,
+   DSL_G997_SnmpTxStatusData_t *pData);
+
+/**
+   Releases the references to the SNMP messages which are still queued in the
+   Rx SNMP FIFO of an instance. The caller has to hold the rxSnmpFifoMutex of
+   the instance.
+
+   \param pOpenCtx Pointer to the instance context, [I]
+   \param pContext Pointer to dsl library context structure, [I]
+*/
+DSL_void_t DSL_CEOC_FifoSnmpFlush(
+   DSL_OpenContext_t *pOpenCtx,
+   DSL_Context_t *pContext);
 #endif
 
 /** @} DRV_DSL_CPE_COMMON */
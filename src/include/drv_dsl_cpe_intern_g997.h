@@ -435,6 +435,37 @@ DSL_Error_t DSL_DRV_G997_SnmpMessageReceive(
    DSL_IN  DSL_Context_t *pContext,
    DSL_OUT DSL_G997_Snmp_t *pData);
 #endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_SNMP_STATISTICS_GET
+*/
+#ifndef SWIG_TMP
+DSL_Error_t DSL_DRV_G997_SnmpStatisticsGet(
+   DSL_OpenContext_t *pOpenCtx,
+   DSL_IN  DSL_Context_t *pContext,
+   DSL_OUT DSL_G997_SnmpStatistics_t *pData);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_SNMP_MESSAGE_QUEUE
+*/
+#ifndef SWIG_TMP
+DSL_Error_t DSL_DRV_G997_SnmpMessageQueue(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_SnmpQueue_t *pData);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_SNMP_TX_STATUS_GET
+*/
+#ifndef SWIG_TMP
+DSL_Error_t DSL_DRV_G997_SnmpTxStatusGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_OUT DSL_G997_SnmpTxStatus_t *pData);
+#endif
 #endif /** #if defined(INCLUDE_DSL_CEOC)*/
 
 /** \file
@@ -730,6 +761,58 @@ DSL_Error_t DSL_DRV_G997_SnrAllocationNscGet(
    DSL_IN_OUT DSL_G997_SnrAllocationNsc_t *pData
 );
 #endif
+
+/**
+   Complete per subcarrier table which is currently read by
+   \ref DSL_FIO_G997_PER_TONE_EXPORT (or by
+   \ref DSL_FIO_G997_PER_TONE_WINDOW_GET for tables which are not read by tone
+   range)
+*/
+typedef struct DSL_G997_PerToneSnapshot
+{
+   /** Table type */
+   DSL_G997_PerToneType_t nType;
+   /** Direction of the table */
+   DSL_AccessDir_t nDirection;
+   /** DELT data type of the table */
+   DSL_DeltDataType_t nDeltDataType;
+   /** Data of the table, the type selects the valid member */
+   union
+   {
+      DSL_G997_BitAllocationNsc_t bits;
+      DSL_G997_GainAllocationNsc_t gains;
+      DSL_G997_SnrAllocationNsc_t snr;
+#ifdef INCLUDE_DSL_DELT
+      DSL_G997_DeltHlog_t hlog;
+      DSL_G997_DeltQln_t qln;
+      DSL_G997_DeltSnr_t deltSnr;
+      DSL_G997_DeltHlin_t hlin;
+#endif /* INCLUDE_DSL_DELT*/
+   } table;
+} DSL_G997_PerToneSnapshot_t;
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_PER_TONE_WINDOW_GET
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_G997_PerToneWindowGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_PerToneWindow_t *pData
+);
+#endif
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_G997_PER_TONE_EXPORT
+*/
+#ifndef SWIG
+DSL_Error_t DSL_DRV_G997_PerToneExport(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_G997_PerToneExport_t *pData
+);
+#endif
+
 #endif /* INCLUDE_DSL_G997_PER_TONE*/
 
 #ifdef INCLUDE_DSL_G997_ALARM
@@ -919,6 +1002,80 @@ DSL_Error_t DSL_DRV_G997_DeltFreeResources(
    DSL_IN_OUT DSL_G997_DeltFreeResources_t *pData
 );
 #endif
+
+/**
+   Buffer types of the DELT buffer pool
+*/
+typedef enum
+{
+   /** Diagnostic data, \ref DSL_G997_DeltData_t */
+   DSL_G997_DELT_POOL_DIAG = 0,
+   /** Showtime data, DSL_G997_DeltShowtimeData_t (VRX only) */
+   DSL_G997_DELT_POOL_SHOWTIME = 1,
+   /** Delimiter only */
+   DSL_G997_DELT_POOL_LAST = 2
+} DSL_G997_DeltPoolType_t;
+
+/**
+   Usage statistics of one buffer type of the DELT buffer pool
+*/
+typedef struct
+{
+   /** Size of one buffer [byte], 0 if the type is not supported */
+   DSL_uint32_t nSlabSize;
+   /** Number of allocated buffers */
+   DSL_uint32_t nSlabs;
+   /** Number of buffers which are used by a line */
+   DSL_uint32_t nInUse;
+   /** Maximum number of buffers which were used at the same time */
+   DSL_uint32_t nInUseMax;
+} DSL_G997_DeltPoolStatistics_t;
+
+/**
+   Initializes the DELT buffer pool shared by all lines, called once on the
+   driver start.
+*/
+DSL_void_t DSL_DRV_G997_DeltPoolInit(DSL_void_t);
+
+/**
+   Frees all buffers of the DELT buffer pool, called once on the driver
+   unload after all lines have released their buffers.
+*/
+DSL_void_t DSL_DRV_G997_DeltPoolCleanup(DSL_void_t);
+
+/**
+   Takes a DELT buffer from the pool. A new buffer is only allocated if the
+   pool contains no free one. The buffer content is undefined.
+
+   \param pContext Pointer to dsl cpe library context structure, [I]
+   \param nType    Buffer type, [I]
+
+   \return
+   Pointer to the buffer or DSL_NULL if no memory is available
+*/
+DSL_void_t* DSL_DRV_G997_DeltBufferGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN DSL_G997_DeltPoolType_t nType);
+
+/**
+   Returns a DELT buffer to the pool.
+
+   \param nType   Buffer type, [I]
+   \param pBuffer Buffer taken with \ref DSL_DRV_G997_DeltBufferGet, [I]
+*/
+DSL_void_t DSL_DRV_G997_DeltBufferRelease(
+   DSL_IN DSL_G997_DeltPoolType_t nType,
+   DSL_IN DSL_void_t *pBuffer);
+
+/**
+   Returns the usage statistics of the DELT buffer pool.
+
+   \param nType  Buffer type, [I]
+   \param pStats Usage statistics, [O]
+*/
+DSL_void_t DSL_DRV_G997_DeltPoolStatisticsGet(
+   DSL_IN DSL_G997_DeltPoolType_t nType,
+   DSL_OUT DSL_G997_DeltPoolStatistics_t *pStats);
 #endif /* INCLUDE_DSL_DELT*/
 
 #ifdef INCLUDE_DSL_CPE_API_VRX
@@ -48,11 +48,23 @@ typedef enum DSL_MIB_ADSL_Thresholds
    DSL_MIB_THRESHOLD_ATUC_FECS_FLAG               = 0x8000  /* BIT 15 */
 } DSL_MIB_ADSL_Thresholds_t;
 
+#if defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)
+/** ADSL MIB interval table row cache, defined within the MIB module */
+struct DSL_MIB_ADSL_RowCache;
+#endif /* defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)*/
+
 /** ADSL Mib context structure */
 typedef struct DSL_MIB_ADSL_Context
 {
    /** thresholds bit-field */
    DSL_MIB_ADSL_Thresholds_t nThresholds;
+#if defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)
+   /** Interval table rows which are kept for
+       \ref DSL_FIO_MIB_ADSL_TABLE_GET, allocated on first access */
+   struct DSL_MIB_ADSL_RowCache *pRowCache;
+   /** Mutex for the row cache access */
+   DSL_DRV_Mutex_t rowCacheMutex;
+#endif /* defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)*/
 } DSL_MIB_ADSL_Context_t;
 
 #endif
@@ -79,7 +91,7 @@ DSL_Error_t DSL_DRV_MIB_IoctlHandle
    DSL_Context_t *pContext,
    DSL_boolean_t bIsInKernel,
    DSL_uint_t nCommand,
-   DSL_uint32_t nArg
+   DSL_ulong_t nArg
 );
 
 #endif
@@ -104,6 +116,22 @@ DSL_Error_t DSL_DRV_MIB_ModuleInit
 );
 #endif
 
+/**
+   Cleanup routine for MIB module, releases the memory of the interval table
+   row cache
+
+   \param pContext Pointer to dsl library context structure, [I]
+
+   \ingroup DRV_DSL_CPE_INIT
+*/
+
+#ifndef SWIG
+DSL_void_t DSL_DRV_MIB_ModuleCleanup
+(
+   DSL_Context_t *pContext
+);
+#endif
+
 /** @} DRV_DSL_CPE_ADSL_MIB */
 
 #ifdef __cplusplus
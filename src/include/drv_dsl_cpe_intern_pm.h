@@ -42,6 +42,24 @@ DSL_Error_t DSL_DRV_PM_ConfigGet(
 #endif /* INCLUDE_DSL_CONFIG_GET*/
 #endif /* INCLUDE_DSL_CPE_PM_CONFIG*/
 
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_PM_STATISTICS_GET
+*/
+DSL_Error_t DSL_DRV_PM_StatisticsGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_PM_Statistics_t *pData
+);
+
+/**
+   For a detailed description please refer to the equivalent ioctl
+   \ref DSL_FIO_PM_GROUP_COUNTERS_GET
+*/
+DSL_Error_t DSL_DRV_PM_GroupCountersGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_PM_GroupCounters_t *pData
+);
+
 /**
    Initialization routine for PM module
 
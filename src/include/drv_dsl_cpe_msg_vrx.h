@@ -62,6 +62,159 @@ DSL_Error_t DSL_DRV_VRX_SendMessage(
    const DSL_uint16_t nLenAck,
    DSL_uint8_t *pDataAck);
 
+#ifdef INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE
+/**
+   This function starts a configuration write. Until its end the payloads of
+   all sent configuration messages are recorded, and messages which are
+   unchanged since the last complete configuration write within the current
+   firmware session are not sent again. A skipped message returns the
+   acknowledge recorded when it was last sent.
+
+   \note As every firmware download drops the recorded payloads, messages are
+         only skipped if the autoboot restarts without a firmware reload,
+         which requires INCLUDE_DSL_CPE_FAST_RESTART
+         (--enable-fast-restart).
+
+   \param pContext Pointer to dsl cpe drive context structure, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ConfigWriteStart(
+   DSL_Context_t *pContext);
+
+/**
+   This function ends a configuration write.
+
+   \param pContext Pointer to dsl cpe drive context structure, [I]
+   \param nResult  Result of the configuration write. In case of errors the
+                   recorded payloads are dropped and the next configuration
+                   write sends all messages again, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ConfigWriteEnd(
+   DSL_Context_t *pContext,
+   const DSL_Error_t nResult);
+
+/**
+   This function drops the recorded configuration payloads. It has to be
+   called whenever the firmware might lose its configuration, i.e. on a
+   firmware download or device reset, on a firmware failure which is
+   recovered by a restart, on a power down and on a full restart.
+
+   \param pContext Pointer to dsl cpe drive context structure, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ConfigWriteInvalidate(
+   DSL_Context_t *pContext);
+#endif /* INCLUDE_DSL_CPE_CONFIG_DELTA_WRITE*/
+
+/**
+   This function unpacks per tone data which the firmware delivers as pairs
+   of 8 bit values within 16 bit words (VRX_SNR, VRX_QLN_NE,
+   VRX_BAT_TableEntry_t) into a linear per tone array.
+
+   \param pDest  Pointer to the first destination tone, [O]
+   \param pSrc   Pointer to the first received pair entry, [I]
+   \param nPairs Number of pair entries to unpack, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ToneDataPairsUnpack(
+   DSL_uint8_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nPairs);
+
+/**
+   This function returns the sum of per tone values, for example the number of
+   bits per symbol of a bit allocation table.
+
+   \param pSrc Pointer to the first tone, [I]
+   \param nNum Number of tones, [I]
+
+   \return
+   Sum of the values
+*/
+DSL_uint32_t DSL_DRV_VRX_ToneDataSum(
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum);
+
+/**
+   This function converts Q8.8 coded SNR values [dB] into the API coding
+   (SNR[dB]+32)*2 (see chapter 7.5.1.20.4 of G.997.1). Values which are not
+   measured (Q88_NOVALUE) are returned as 255.
+
+   \param pDest Pointer to the first destination tone, [O]
+   \param pSrc  Pointer to the first Q8.8 value (16 bit words in host byte
+                order, no alignment required), [I]
+   \param nNum  Number of tones, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ToneSnrQ88Convert(
+   DSL_uint8_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum);
+
+/**
+   This function averages per tone values over groups of subcarriers. As soon
+   as one value of a group is invalid (255) the whole group is invalid.
+   Source and destination may be the same array.
+
+   \param pDest      Pointer to the first destination group, [O]
+   \param pSrc       Pointer to the first tone, [I]
+   \param nGroups    Number of complete groups, [I]
+   \param nGroupSize Number of tones per group, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ToneGroupAverage(
+   DSL_uint8_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nGroups,
+   const DSL_uint8_t nGroupSize);
+
+/**
+   This function returns the minimum, maximum and mean value of per tone
+   values (SNR, QLN, BAT). Invalid values (255) are not taken into account.
+   If no value is valid, all results are 255.
+
+   \param pSrc  Pointer to the first tone, [I]
+   \param nNum  Number of tones, [I]
+   \param pMin  Minimum of the valid values, [O]
+   \param pMax  Maximum of the valid values, [O]
+   \param pMean Mean of the valid values, rounded down, [O]
+
+   \return
+   Number of valid values
+*/
+DSL_uint16_t DSL_DRV_VRX_ToneStatsGet(
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum,
+   DSL_uint8_t *pMin,
+   DSL_uint8_t *pMax,
+   DSL_uint8_t *pMean);
+
+/** Result of the per tone dB conversions for invalid values */
+#define DSL_VRX_TONE_DB_INVALID   ((DSL_int16_t)0x8000)
+
+/**
+   This function converts Hlog values in the API coding (m, see chapter
+   7.5.1.26.6 of G.997.1) into 0.1 dB, that is 60 - m. Invalid values (1023)
+   are returned as DSL_VRX_TONE_DB_INVALID.
+
+   \param pDest Pointer to the first destination tone [0.1 dB], [O]
+   \param pSrc  Pointer to the first Hlog value, [I]
+   \param nNum  Number of tones, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ToneHlogToDb(
+   DSL_int16_t *pDest,
+   const DSL_uint16_t *pSrc,
+   const DSL_uint16_t nNum);
+
+/**
+   This function converts QLN values in the API coding (n, see chapter
+   7.5.1.27.3 of G.997.1) into 0.1 dBm/Hz, that is -230 - 5*n. Invalid values
+   (255) are returned as DSL_VRX_TONE_DB_INVALID.
+
+   \param pDest Pointer to the first destination tone [0.1 dBm/Hz], [O]
+   \param pSrc  Pointer to the first QLN value, [I]
+   \param nNum  Number of tones, [I]
+*/
+DSL_void_t DSL_DRV_VRX_ToneQlnToDb(
+   DSL_int16_t *pDest,
+   const DSL_uint8_t *pSrc,
+   const DSL_uint16_t nNum);
+
 DSL_Error_t DSL_DRV_VRX_ChReadMessage(
    DSL_Context_t *pContext,
    IOCTL_MEI_message_t *pMsg);
@@ -230,6 +383,18 @@ DSL_Error_t DSL_DRV_VRX_SendMsgQlnGet(
 #endif /* INCLUDE_DSL_DELT*/
 
 #ifdef INCLUDE_DSL_G997_PER_TONE
+/**
+   Converts a gain from Q8.8 dB to Q3.13 linear as reported in the gain
+   allocation table. Inputs below -14dB and above +6dB are limited, the
+   special value 0x8000 returns 0.
+
+   \param s_gain_db  Gain in Q8.8 dB, [I]
+
+   \return
+   Gain in Q3.13 linear
+*/
+DSL_int16_t DSL_DRV_VRX_G997_Q8_8dB_to_Q3_13Linear(DSL_int16_t s_gain_db);
+
 /**
    Retrieve the current gain allocation table
    by evaluation of the bit allocation table.
@@ -250,6 +415,31 @@ DSL_Error_t DSL_DRV_VRX_GainAllocationTableGet(
    DSL_IN DSL_Context_t *pContext,
    const DSL_AccessDir_t nDirection,
    DSL_IN_OUT DSL_G997_NSCData16_t *pData);
+
+/**
+   Retrieve the tones nFirstTone ... nFirstTone + nNumTones - 1 of a VDSL
+   showtime per subcarrier table (bit, gain or SNR allocation, Hlog or QLN).
+   Only the messages for the requested tones are sent, tones outside of the
+   used bands are returned as 0.
+
+   \param pContext - Pointer to DSL library context structure, [I]
+   \param nType      Table to read, [I]
+   \param nDirection Specifies the direction (upstream/downstream) to which
+                     the function will apply. [I]
+   \param pData      Window to read, returns the table size, the number of
+                     returned tones and the tones within pNSCData, [IO]
+
+   \return
+   Return values are defined within the DSL_Error_t definition
+   - DSL_SUCCESS in case of success
+   - DSL_ERR_NOT_SUPPORTED if the table is not read by tone range
+   - DSL_ERROR if operation failed
+*/
+DSL_Error_t DSL_DRV_VRX_ToneRangeGet(
+   DSL_Context_t *pContext,
+   const DSL_G997_PerToneType_t nType,
+   const DSL_AccessDir_t nDirection,
+   DSL_G997_PerToneWindowData_t *pData);
 #endif /* INCLUDE_DSL_G997_PER_TONE*/
 
 #ifdef INCLUDE_DSL_G997_PER_TONE
@@ -23,6 +23,8 @@
 #ifdef __LINUX__
 #ifdef __KERNEL__
 #include "drv_dsl_cpe_os_linux.h"
+#elif defined(DSL_CPE_SIMULATOR_DRIVER)
+#include "drv_dsl_cpe_os_sim.h"
 #else
 #error "This file could not be included from the user space application sources"
 #endif
@@ -46,7 +48,7 @@
 # define SYS_DBG_MSG
 # define SYS_DBG_LOCAL
 #else
-# if defined(__LINUX__)
+# if defined(__LINUX__) && defined(__KERNEL__)
 #  define SYS_DBG_PRN   KERN_ERR
 #  define SYS_DBG_ERR   KERN_ERR
 #  define SYS_DBG_WRN
@@ -63,6 +65,32 @@
 
 #define DSL_DRV_MemSet(Ptr, val, nSz)     memset(Ptr, val, nSz)
 
+/* Memory barriers used for the lock-free data publishing. The OS specific
+   header maps them to the SMP barriers, otherwise only the compiler is
+   prevented from reordering the accesses. */
+#ifndef DSL_DRV_SMP_WMB
+# if defined(__GNUC__)
+#  define DSL_DRV_SMP_WMB()        __asm__ __volatile__("" : : : "memory")
+#  define DSL_DRV_SMP_RMB()        __asm__ __volatile__("" : : : "memory")
+# else
+#  define DSL_DRV_SMP_WMB()
+#  define DSL_DRV_SMP_RMB()
+# endif
+#endif /* #ifndef DSL_DRV_SMP_WMB*/
+
+/* Atomic operations on 32 bit values, both return the value before the
+   operation. Used for the lock-free trace ring reservation and statistics. */
+#ifndef DSL_DRV_ATOMIC_FETCH_ADD
+# if defined(__GNUC__)
+#  define DSL_DRV_ATOMIC_FETCH_ADD(pVal, nAdd) \
+      ((DSL_uint32_t)__sync_fetch_and_add((pVal), (nAdd)))
+#  define DSL_DRV_ATOMIC_CMPXCHG(pVal, nOld, nNew) \
+      ((DSL_uint32_t)__sync_val_compare_and_swap((pVal), (nOld), (nNew)))
+# else
+#  error "DSL_DRV_ATOMIC_* have to be defined by the OS specific header"
+# endif
+#endif /* #ifndef DSL_DRV_ATOMIC_FETCH_ADD*/
+
 /**
    This function is a special implementation to realize both printing to the
    standard output (console) or writing the data to the callback function
@@ -154,6 +182,91 @@ DSL_void_t* DSL_IoctlMemCpyTo
 
 #endif /* SWIG */
 
+/** Maximum size of a memory block mapped with \ref DSL_DRV_UserBufferMap,
+    well above the size of the firmware images it is used for [bytes] */
+#define DSL_DRV_USER_BUFFER_MAP_SIZE_MAX  (16 * 1024 * 1024)
+
+/**
+   This function makes a memory block from user/kernel space accessible to
+   the kernel without copying it. The pages of a user space block are pinned
+   until the block is unmapped with \ref DSL_DRV_UserBufferUnmap. No kernel
+   mapping of the whole block is created, the block is accessed chunk by
+   chunk with \ref DSL_DRV_UserBufferChunkMap.
+   Blocks larger than \ref DSL_DRV_USER_BUFFER_MAP_SIZE_MAX are rejected.
+
+   \param bIsInKernel whether the memory block is already in the kernel space, [I]
+   \param pSrc        Source address, [I]
+   \param nSize       Memory block size, [I]
+
+   \return
+   handle of the mapping, DSL_NULL in case of an error
+*/
+#ifndef SWIG
+
+DSL_void_t* DSL_DRV_UserBufferMap
+(
+   DSL_boolean_t bIsInKernel,
+   DSL_void_t    *pSrc,
+   DSL_DRV_size_t    nSize
+);
+
+#endif /* SWIG */
+
+/**
+   This function maps one chunk of a memory block of \ref DSL_DRV_UserBufferMap
+   into the kernel space. The mapped chunk may be smaller than requested, a
+   chunk of a pinned user space block ends at the next page boundary at the
+   latest. Each chunk has to be released
+   with \ref DSL_DRV_UserBufferChunkUnmap before the next one is mapped.
+
+   \param pHandle     Handle of the mapping, [I]
+   \param nOffset     Offset of the chunk within the memory block, [I]
+   \param pnSize      Requested chunk size, returns the mapped size, [I/O]
+
+   \return
+   kernel address of the chunk, DSL_NULL in case of an error
+*/
+#ifndef SWIG
+
+DSL_void_t* DSL_DRV_UserBufferChunkMap
+(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset,
+   DSL_DRV_size_t    *pnSize
+);
+
+#endif /* SWIG */
+
+/**
+   This function releases a chunk mapping of \ref DSL_DRV_UserBufferChunkMap.
+
+   \param pHandle     Handle of the mapping, [I]
+   \param nOffset     Offset of the chunk within the memory block, [I]
+*/
+#ifndef SWIG
+
+DSL_void_t DSL_DRV_UserBufferChunkUnmap
+(
+   DSL_void_t    *pHandle,
+   DSL_DRV_size_t    nOffset
+);
+
+#endif /* SWIG */
+
+/**
+   This function releases a memory block mapping of \ref DSL_DRV_UserBufferMap.
+
+   \param pHandle     Handle of the mapping, [I]
+*/
+#ifndef SWIG
+
+DSL_void_t DSL_DRV_UserBufferUnmap
+(
+   DSL_void_t    *pHandle
+);
+
+#endif /* SWIG */
+
 /**
    This function allocates a memory, resulting block may be non-continuous
    in the physical memory.
@@ -223,9 +223,9 @@ typedef int (*DSL_DRV_KERNEL_THREAD_StartRoutine)(void *);
 typedef struct DSL_DRV_ThreadParams_s
 {
    /** user argument 1 */
-   DSL_uint32_t   nArg1;
+   DSL_ulong_t    nArg1;
    /** user argument 2 */
-   DSL_uint32_t   nArg2;
+   DSL_ulong_t    nArg2;
    /** name of the thread/task */
    DSL_char_t     pName[DSL_DRV_THREAD_NAME_LEN];
 
@@ -269,8 +269,8 @@ DSL_int32_t DSL_DRV_ThreadInit(
                DSL_DRV_ThreadFunction_t pThreadFunction,
                DSL_uint32_t   nStackSize,
                DSL_uint32_t   nPriority,
-               DSL_uint32_t   nArg1,
-               DSL_uint32_t   nArg2);
+               DSL_ulong_t    nArg1,
+               DSL_ulong_t    nArg2);
 
 /**
    Define the function proto type for "DSL_DRV_ThreadShutdown"
@@ -294,6 +294,11 @@ DSL_int32_t DSL_DRV_ThreadShutdown(
 */
 DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset);
 
+/**
+   Define the function proto type for "DSL_DRV_TimeNSecGet"
+*/
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec);
+
 void spin_lock_irqsave(spinlock_t* , DSL_uint32_t);
 
 void spin_unlock_irqrestore(spinlock_t* , DSL_uint32_t);
@@ -59,6 +59,13 @@
 #include <linux/smp.h>
 #endif
 
+#if defined(INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS) && !defined(DSL_DEBUG_DISABLE)
+#if (LINUX_VERSION_CODE < KERNEL_VERSION(4,3,0))
+   #error "Debug static keys are supported for kernel versions >= 4.3.0 only!"
+#endif
+#include <linux/jump_label.h>
+#endif /* INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS && !DSL_DEBUG_DISABLE*/
+
 #ifdef INCLUDE_DSL_CPE_API_IFXOS_SUPPORT
 /** IFXOS includes*/
 #include "ifxos_common.h"
@@ -170,6 +177,7 @@ extern DSL_uint8_t g_MaxEntieties;
 extern DSL_uint8_t g_Bonding;
 
 DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset);
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec);
 #ifndef INCLUDE_DSL_CPE_API_IFXOS_SUPPORT
 DSL_uint32_t DSL_DRV_ElapsedTimeMSecGet(DSL_uint32_t refTime_ms);
 
@@ -278,6 +286,8 @@ static inline int dsl_mutex_lock(struct mutex *mutex)
 #define DSL_IsTimeNull(t)                    ((t) == 0)
 #define DSL_DRV_TimeSecGet(t)                (t)
 #define DSL_Le2Cpu(le)                       le16_to_cpu(le)
+#define DSL_DRV_SMP_WMB()                    smp_wmb()
+#define DSL_DRV_SMP_RMB()                    smp_rmb()
 
 #if (LINUX_VERSION_CODE < KERNEL_VERSION(2,6,0))
    #define DSL_DRV_OS_ModUseCountIncrement() MOD_INC_USE_COUNT
@@ -293,9 +303,9 @@ typedef int (*DSL_DRV_KERNEL_THREAD_StartRoutine)(void *);
 typedef struct DSL_DRV_ThreadParams_s
 {
    /** user argument 1 */
-   DSL_uint32_t   nArg1;
+   DSL_ulong_t    nArg1;
    /** user argument 2 */
-   DSL_uint32_t   nArg2;
+   DSL_ulong_t    nArg2;
    /** name of the thread/task */
    DSL_char_t     pName[DSL_DRV_THREAD_NAME_LEN];
 
@@ -337,8 +347,8 @@ DSL_int32_t DSL_DRV_ThreadInit(
                DSL_DRV_ThreadFunction_t pThreadFunction,
                DSL_uint32_t   nStackSize,
                DSL_uint32_t   nPriority,
-               DSL_uint32_t   nArg1,
-               DSL_uint32_t   nArg2);
+               DSL_ulong_t    nArg1,
+               DSL_ulong_t    nArg2);
 
 DSL_int32_t DSL_DRV_ThreadShutdown(
                DSL_DRV_ThreadCtrl_t *pThrCntrl,
@@ -27,6 +27,8 @@
 #include "ifxos_select.h"
 #include "ifxos_mutex.h"
 
+#include <time.h>
+
 #include "xapi.h"    // for  xtm_wkafter
 
 #ifndef DSL_DRV_STACKSIZE
@@ -52,6 +54,7 @@ typedef DSL_int_t (*DSL_ThreadFunc_t)(DSL_void_t *pArg);
 
 DSL_uint32_t DSL_DRV_GetTime(DSL_uint32_t nOffset);
 DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset);
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec);
 
 #define _IOC_TYPE(x)                      (((x)>>8) & 0xFF)
 
@@ -0,0 +1,331 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+#ifndef _DRV_DSL_CPE_OS_SIM_H
+#define _DRV_DSL_CPE_OS_SIM_H
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+/** \file
+   Linux user space port of the driver, used to run the OS independent core
+   against the simulated VRx device (see 'drv_dsl_cpe_sim_vrx.h').
+   All OS services are mapped to POSIX threads.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <endian.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/ioctl.h>
+
+#ifndef __LINUX__
+#define __LINUX__
+#endif /*__LINUX__*/
+
+/* The debug static keys are based on kernel jump labels*/
+#undef INCLUDE_DSL_CPE_DEBUG_STATIC_KEYS
+
+/* The name of this device */
+#define DRV_DSL_CPE_API_DEV_NAME "dsl_cpe_api"
+
+#ifndef DSL_DRV_STACKSIZE
+#define DSL_DRV_STACKSIZE (65536)
+#endif
+
+#ifndef DSL_DRV_PRIORITY
+#define DSL_DRV_PRIORITY  64
+#endif
+
+/**
+   Definition of the plattform endianess.
+*/
+#define DSL_LITTLE_ENDIAN  0x1234
+#define DSL_BIG_ENDIAN     0x4321
+
+#if (__BYTE_ORDER == __LITTLE_ENDIAN)
+   #define DSL_BYTE_ORDER             DSL_LITTLE_ENDIAN
+#elif (__BYTE_ORDER == __BIG_ENDIAN)
+   #define DSL_BYTE_ORDER             DSL_BIG_ENDIAN
+#else
+#error "Unknown Byteorder !!!"
+#endif
+
+/** Thread name length */
+#define DSL_DRV_THREAD_NAME_LEN 16
+
+#define DSL_DRV_THREAD_DELETE_WAIT_FOREVER     0xFFFFFFF
+
+/** Internal poll time for check thread end */
+#define DSL_DRV_THREAD_DOWN_WAIT_POLL_MS       10
+
+/** Wait time of DSL_DRV_EventWait to wait without timeout */
+#define DSL_DRV_EVENT_WAIT_FOREVER             0xFFFFFFFF
+
+extern DSL_uint8_t g_MaxDeviceNumber;
+extern DSL_uint8_t g_LinesPerDevice;
+extern DSL_uint8_t g_ChannelsPerLine;
+
+extern DSL_uint8_t g_MaxEntieties;
+
+DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset);
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec);
+DSL_uint32_t DSL_DRV_ElapsedTimeMSecGet(DSL_uint32_t refTime_ms);
+DSL_void_t DSL_DRV_MSecSleep(DSL_uint32_t msec);
+
+/* operating system types */
+typedef size_t                   DSL_DRV_size_t;
+typedef ssize_t                  DSL_ssize_t;
+typedef DSL_uint32_t             DSL_DRV_TimeVal_t;
+
+typedef pthread_mutex_t          DSL_DRV_Mutex_t;
+
+/**
+   Event object. In difference to a kernel wait queue a wake up is remembered
+   until the next wait, so no wake up is lost between checking the condition
+   and going to sleep.
+*/
+typedef struct
+{
+   /** protects the signal state */
+   pthread_mutex_t   mutex;
+   /** signalled on wake up */
+   pthread_cond_t    cond;
+   /** wake up is pending */
+   DSL_boolean_t     bSignaled;
+} DSL_DRV_Event_t;
+
+typedef DSL_DRV_Event_t          DSL_DRV_WaitQueue_t;
+
+/**
+   Initializes an event object.
+
+   \param pEvent  Event object, [I]
+*/
+DSL_void_t DSL_DRV_EventInit(DSL_DRV_Event_t *pEvent);
+
+/**
+   Waits until the event object is woken up or the timeout expires.
+
+   \param pEvent     Event object, [I]
+   \param nTimeout   Timeout [ms], DSL_DRV_EVENT_WAIT_FOREVER to wait without
+                     timeout, [I]
+
+   \return
+   0 if the event was woken up, -1 if the timeout expired
+*/
+DSL_int_t DSL_DRV_EventWait(DSL_DRV_Event_t *pEvent, DSL_uint32_t nTimeout);
+
+/**
+   Wakes up the waiter of the event object.
+
+   \param pEvent  Event object, [I]
+*/
+DSL_void_t DSL_DRV_EventWakeUp(DSL_DRV_Event_t *pEvent);
+
+#define DSL_DRV_SIGNAL_PENDING               0
+
+#define DSL_DRV_Malloc(nSize)                malloc(nSize)
+#define DSL_DRV_MemFree(pPtr)                free(pPtr)
+#define DSL_DRV_PMalloc(nSize)               malloc(nSize)
+#define DSL_DRV_PFree(pPtr)                  free(pPtr)
+#define DSL_DRV_MUTEX_INIT(id)               pthread_mutex_init(&(id), DSL_NULL)
+#define DSL_DRV_MUTEX_LOCK(id)               pthread_mutex_lock(&(id))
+#define DSL_DRV_MUTEX_UNLOCK(id)             pthread_mutex_unlock(&(id))
+#define DSL_DRV_INIT_WAKELIST(name,queue)    DSL_DRV_EventInit(&(queue))
+#define DSL_DRV_WAKEUP_WAKELIST(queue)       DSL_DRV_EventWakeUp(&(queue))
+#define DSL_DRV_INIT_EVENT(name,ev)          DSL_DRV_EventInit(&(ev))
+/* wait for an event, timeout is measured in ms */
+#define DSL_DRV_WAIT_EVENT_TIMEOUT(ev,t)     DSL_DRV_EventWait(&(ev), (t))
+#define DSL_DRV_WAIT_EVENT(ev)               DSL_DRV_EventWait(&(ev), DSL_DRV_EVENT_WAIT_FOREVER)
+#define DSL_DRV_WAKEUP_EVENT(ev)             DSL_DRV_EventWakeUp(&(ev))
+#define DSL_DRV_TimeMSecGet()                DSL_DRV_ElapsedTimeMSecGet(0)
+#define DSL_WAIT(ms)                         DSL_DRV_MSecSleep(ms)
+
+#define DSL_IsTimeNull(t)                    ((t) == 0)
+#define DSL_DRV_TimeSecGet(t)                (t)
+#define DSL_Le2Cpu(le)                       le16toh(le)
+#define DSL_DRV_SMP_WMB()                    __sync_synchronize()
+#define DSL_DRV_SMP_RMB()                    __sync_synchronize()
+
+#define DSL_DRV_OS_ModUseCountIncrement()
+#define DSL_DRV_OS_ModUseCountDecrement()
+
+/*
+   Kernel semaphore, used directly by the PM module for the direction
+   mutexes
+*/
+struct semaphore
+{
+   sem_t sem;
+};
+
+#define sema_init(s,n)                       sem_init(&(s)->sem, 0, (n))
+#define down_interruptible(s)                sem_wait(&(s)->sem)
+#define up(s)                                sem_post(&(s)->sem)
+
+typedef struct DSL_DRV_ThreadParams_s
+{
+   /** user argument 1 */
+   DSL_ulong_t    nArg1;
+   /** user argument 2 */
+   DSL_ulong_t    nArg2;
+   /** name of the thread/task */
+   DSL_char_t     pName[DSL_DRV_THREAD_NAME_LEN];
+
+   /** control - signal the run state */
+   volatile DSL_boolean_t  bRunning;
+   /** control - set to shutdown the thread */
+   volatile DSL_boolean_t  bShutDown;
+} DSL_DRV_ThreadParams_t;
+
+typedef DSL_int_t (*DSL_DRV_ThreadFunction_t)(DSL_DRV_ThreadParams_t *);
+
+typedef struct
+{
+   /** Contains the user and thread control parameters */
+   DSL_DRV_ThreadParams_t    thrParams;
+
+   /** Points to the thread start routine */
+   DSL_DRV_ThreadFunction_t  pThrFct;
+
+   /** POSIX thread ID */
+   pthread_t               tid;
+
+   /** requested thread priority, not used */
+   DSL_int32_t             nPriority;
+
+   /** flag indicates that the structure is initialized */
+   DSL_boolean_t           bValid;
+
+} DSL_DRV_ThreadCtrl_t;
+
+typedef DSL_int_t (*DSL_ThreadFunc_t)(DSL_void_t *pArg);
+
+DSL_int32_t DSL_DRV_ThreadInit(
+               DSL_DRV_ThreadCtrl_t *pThrCntrl,
+               DSL_char_t     *pName,
+               DSL_DRV_ThreadFunction_t pThreadFunction,
+               DSL_uint32_t   nStackSize,
+               DSL_uint32_t   nPriority,
+               DSL_ulong_t    nArg1,
+               DSL_ulong_t    nArg2);
+
+DSL_int32_t DSL_DRV_ThreadShutdown(
+               DSL_DRV_ThreadCtrl_t *pThrCntrl,
+               DSL_uint32_t       waitTime_ms);
+
+#define DSL_DRV_THREAD(a, b, c, d)              DSL_DRV_ThreadInit((a), (b), (c), DSL_DRV_STACKSIZE, DSL_DRV_PRIORITY, (d), 0)
+#define DSL_DRV_WAIT_COMPLETION(a)              DSL_DRV_ThreadShutdown((a), 3000)
+#define DSL_DRV_THREAD_INIT_VALID(P_THREAD_ID)  (((P_THREAD_ID)) ? (((P_THREAD_ID)->bValid == DSL_TRUE) ? DSL_TRUE : DSL_FALSE) : DSL_FALSE)
+#define DSL_DRV_THREAD_DELETE(a, b)             ((void)0)
+
+#define DSL_DRV_CRLF "\n"
+
+/*
+   Entry points of the simulation build, they replace the module init/exit
+   functions and the file operations of the kernel driver.
+*/
+
+/**
+   Initializes the driver, replaces the module init of the kernel driver.
+   The simulated device is set up before, see DSL_DRV_SIM_VRX_Init.
+   The device layout is taken from the simulated device unless
+   g_MaxDeviceNumber, g_LinesPerDevice and g_ChannelsPerLine are set before.
+
+   \return
+   0 in case of success, -1 otherwise
+*/
+DSL_int_t DSL_DRV_SIM_ModuleInit(DSL_void_t);
+
+/**
+   Releases all driver resources, replaces the module exit of the kernel
+   driver.
+*/
+DSL_void_t DSL_DRV_SIM_ModuleCleanup(DSL_void_t);
+
+/**
+   Opens an instance of the given line, replaces open() of the device node.
+
+   \param nNum    Line number, [I]
+
+   \return
+   instance handle, DSL_NULL in case of an error
+*/
+DSL_void_t* DSL_DRV_SIM_Open(DSL_int_t nNum);
+
+/**
+   Closes an instance, replaces close() of the device node.
+
+   \param pHandle Instance handle of DSL_DRV_SIM_Open, [I]
+
+   \return
+   0 in case of success, negative error code otherwise
+*/
+DSL_int_t DSL_DRV_SIM_Close(DSL_void_t *pHandle);
+
+/**
+   Executes an ioctl, replaces ioctl() of the device node.
+   The argument is accessed directly, there is a single address space.
+
+   \param pHandle  Instance handle of DSL_DRV_SIM_Open, [I]
+   \param nCommand The ioctl command, [I]
+   \param nArg     The ioctl argument, [I/O]
+
+   \return
+   0 or a positive value in case of success, the negative DSL CPE API error
+   code as converted by DSL_DRV_ErrorToOS otherwise
+*/
+DSL_int_t DSL_DRV_SIM_Ioctl(
+   DSL_void_t *pHandle,
+   DSL_uint_t nCommand,
+   DSL_ulong_t nArg);
+
+/**
+   Writes a firmware image, replaces write() of the device node.
+
+   \param pHandle Instance handle of DSL_DRV_SIM_Open, [I]
+   \param pBuf    Firmware image, [I]
+   \param nSize   Size of the firmware image, [I]
+
+   \return
+   number of bytes written, negative error code in case of an error
+*/
+DSL_ssize_t DSL_DRV_SIM_Write(
+   DSL_void_t *pHandle,
+   const DSL_char_t *pBuf,
+   DSL_DRV_size_t nSize);
+
+/**
+   Waits for an event of the instance, replaces poll() of the device node.
+
+   \param pHandle  Instance handle of DSL_DRV_SIM_Open, [I]
+   \param nTimeout Timeout [ms], DSL_DRV_EVENT_WAIT_FOREVER to wait without
+                   timeout, [I]
+
+   \return
+   1 if an event is available, 0 if the timeout expired, -1 in case of an
+   error
+*/
+DSL_int_t DSL_DRV_SIM_Poll(DSL_void_t *pHandle, DSL_uint32_t nTimeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DRV_DSL_CPE_OS_SIM_H */
@@ -27,6 +27,8 @@
 #include "ifxos_select.h"
 #include "ifxos_mutex.h"
 
+#include <time.h>
+
 #ifndef DSL_DRV_STACKSIZE
 #define DSL_DRV_STACKSIZE (8192)
 #endif
@@ -53,6 +55,7 @@ typedef IFXOS_drvSelectOSArg_t   DSL_DRV_SelectOsArg_t;
 typedef IFXOS_drvSelectTable_t   DSL_DRV_SelectTable_t;
 
 DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset);
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec);
 
 #define _IOC_TYPE(x)                      (((x)>>8) & 0xFF)
 
@@ -95,6 +95,10 @@ typedef IFXOS_drvSelectQueue_t   DSL_DRV_WaitQueue_t;
 #define DSL_DRV_WAKEUP_EVENT(ev)             IFXOS_EventWakeUp(&(ev));
 #define DSL_DRV_ElapsedTimeMSecGet(t)        IFXOS_ElapsedTimeMSecGet(t)
 #define DSL_DRV_TimeMSecGet()                IFXOS_ElapsedTimeMSecGet(0)
+#define DSL_DRV_ATOMIC_FETCH_ADD(pVal, nAdd) \
+   ((DSL_uint32_t)InterlockedExchangeAdd((volatile LONG*)(pVal), (LONG)(nAdd)))
+#define DSL_DRV_ATOMIC_CMPXCHG(pVal, nOld, nNew) \
+   ((DSL_uint32_t)InterlockedCompareExchange((volatile LONG*)(pVal), (LONG)(nNew), (LONG)(nOld)))
 #define DSL_WAIT(ms)                         IFXOS_MSecSleep(ms)
 #define DSL_DRV_MSecSleep(msec)              IFXOS_MSecSleep(msec)
 
@@ -122,6 +126,7 @@ typedef IFXOS_ThreadCtrl_t       DSL_DRV_ThreadCtrl_t;
    System Time Get
 */
 DSL_uint32_t DSL_DRV_SysTimeGet(DSL_uint32_t nOffset);
+DSL_void_t DSL_DRV_TimeNSecGet(DSL_uint32_t *pSec, DSL_uint32_t *pNSec);
 
 /*
    DSL CPE API driver Device Create
@@ -152,6 +152,14 @@
 
 #define DSL_PM_COUNTER_FE_POLLING_FACTOR   (10)
 
+/** Maximum adaptive polling factor, applied to the basic poll cycle of a
+    line without any counter activity*/
+#define DSL_PM_ADAPTIVE_POLLING_MAX_FACTOR   (16)
+
+/** Current 15-min counters level (percent of the configured threshold) which
+    forces the basic poll cycle in the adaptive polling mode*/
+#define DSL_PM_ADAPTIVE_POLLING_THRESHOLD_LEVEL   (75)
+
 /** number of seconds in the 15 minutes interval. */
 #define DSL_PM_15MIN   (900)
 
@@ -175,6 +183,29 @@
 /** Helper macro for PM context retrieving from \ref DSL_Context_t structure. */
 #define DSL_DRV_PM_CONTEXT(X)   ((DSL_PM_Context*)((X)->PM))
 
+/**
+   Helper macro to translate a pointer into the working PM counters (pCounters)
+   of the context ctx to the same location within the published counters
+   snapshot pPub.
+*/
+#define DSL_DRV_PM_PUB_PTR(ctx, pPub, ptr) \
+   ((DSL_void_t*)((DSL_uint8_t*)(pPub) + \
+   ((DSL_uint8_t*)(ptr) - (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(ctx)->pCounters))))
+
+/**
+   Size of the blocks [bytes] which are compared and copied separately when
+   the PM counters are published, only the changed ones are written.
+*/
+#define DSL_PM_PUB_BLOCK_SIZE    (128)
+
+/**
+   Helper macro to get the current interval failures published together with
+   the counters snapshot pPub of the context ctx.
+*/
+#define DSL_DRV_PM_PUB_CURR_FAILURES(ctx, pPub) \
+   (DSL_DRV_PM_CONTEXT(ctx)->nPubCurrFailures[ \
+      ((pPub) == DSL_DRV_PM_CONTEXT(ctx)->pCountersPub[1]) ? 1 : 0])
+
 #define DSL_DRV_PM_INTERVAL_FAILURE_SET(x,failure)   ((x) |= (failure))
 #define DSL_DRV_PM_INTERVAL_FAILURE_CLR(x,failure)   ((x) &= ((DSL_pmBF_IntervalFailures_t)(~(failure))))
 
@@ -1383,6 +1414,73 @@ typedef enum
    DSL_PM_FWMODE_ADSL = 1
 } DSL_PM_FwMode_t;
 
+/**
+   Records of the bonding group counters, refer to
+   \ref DSL_PM_GroupCountersAllData_t
+*/
+typedef enum
+{
+   DSL_PM_GROUP_REC_CURR_15MIN = 0,
+   DSL_PM_GROUP_REC_PREV_15MIN = 1,
+   DSL_PM_GROUP_REC_CURR_1DAY = 2,
+   DSL_PM_GROUP_REC_PREV_1DAY = 3,
+   DSL_PM_GROUP_REC_TOTAL = 4,
+   DSL_PM_GROUP_REC_SHOWTIME = 5,
+   DSL_PM_GROUP_REC_LAST = 6
+} DSL_PM_GroupRecord_t;
+
+/**
+   Line counters contributed to the bonding group counters
+*/
+typedef enum
+{
+   DSL_PM_GROUP_CONTRIB_15MIN = 0,
+   DSL_PM_GROUP_CONTRIB_1DAY = 1,
+   DSL_PM_GROUP_CONTRIB_TOTAL = 2,
+   DSL_PM_GROUP_CONTRIB_SHOWTIME = 3,
+   DSL_PM_GROUP_CONTRIB_LAST = 4
+} DSL_PM_GroupContribution_t;
+
+/**
+   Per line data of the bonding group counters
+*/
+typedef struct
+{
+   /** Line 15-min and 1-day interval numbers of the last update*/
+   DSL_uint32_t nLineInterval[2];
+   /** Group 15-min and 1-day interval numbers the current line intervals
+       are accumulated into*/
+   DSL_uint32_t nGroupInterval[2];
+   /** Values already added to the group counters, per direction*/
+   DSL_PM_GroupCountersData_t contrib[2][DSL_PM_GROUP_CONTRIB_LAST];
+} DSL_PM_GroupLineData_t;
+
+/** Number of lines of a bonding pair*/
+#define DSL_PM_GROUP_LINES    (2)
+/** Number of bonding pairs, lines 2n and 2n+1 form pair n*/
+#define DSL_PM_GROUP_NUMBER \
+   ((DSL_DRV_MAX_SUPPORTED_ENTITIES + DSL_PM_GROUP_LINES - 1) / DSL_PM_GROUP_LINES)
+
+/**
+   Bonding group counters, shared by the lines of one bonding pair
+*/
+typedef struct
+{
+   /** Group data mutex*/
+   DSL_DRV_Mutex_t groupMutex;
+   /** Mask of the member lines*/
+   DSL_uint32_t nMemberMask;
+   /** Current group 15-min and 1-day interval numbers*/
+   DSL_uint32_t nInterval[2];
+   /** Number of line updates which were dropped because the line interval
+       did not belong to any of the group records anymore*/
+   DSL_uint32_t nDroppedUpdates;
+   /** Aggregated counters, per direction*/
+   DSL_PM_GroupCountersData_t rec[2][DSL_PM_GROUP_REC_LAST];
+   /** Member line data, indexed by the line number within the pair*/
+   DSL_PM_GroupLineData_t line[DSL_PM_GROUP_LINES];
+} DSL_PM_GroupContext_t;
+
 typedef struct
 {
    /** thread control structure */
@@ -1391,6 +1489,11 @@ typedef struct
    DSL_boolean_t bRun;
    /** Pm module thread poll time, msec*/
    DSL_uint32_t nThreadPollTime;
+   /** Adaptive polling factor applied to the basic thread poll cycle*/
+   DSL_uint32_t nBackoffFactor;
+   /** Sum of the current counters seen with the last adaptive polling update,
+       used to detect counter activity*/
+   DSL_uint32_t nActivitySignature;
    /** PM module */
    DSL_DRV_Event_t pmEvent;
 } DSL_PM_Thread_t;
@@ -1593,6 +1696,32 @@ typedef struct
    DSL_PM_CountersData_t *pCounters;
    /** PM module counters for save/restore functionality*/
    DSL_PM_CountersDump_t *pCountersDump;
+   /** Published PM module counters snapshots. The PM threads copy pCounters
+       into the unpublished buffer each tick and flip nPubIdx, readers access
+       the published buffer without taking any PM module mutex*/
+   DSL_PM_CountersData_t *pCountersPub[2];
+   /** Index of the currently published counters snapshot*/
+   volatile DSL_uint32_t nPubIdx;
+   /** Snapshot update sequence numbers, odd while the buffer is written*/
+   volatile DSL_uint32_t nPubSeq[2];
+   /** Current interval failures of the published counters snapshots*/
+   DSL_pmBF_IntervalFailures_t nPubCurrFailures[2];
+   /** History change number, incremented on every history interval update
+       and history reset*/
+   DSL_uint32_t nHistoryChangeNum;
+   /** PM module timing statistics, all fields are updated with atomic
+       operations without any lock*/
+   DSL_PM_StatisticsData_t statistics;
+   /** Line contributes to the counters of its bonding group. Only changed
+       with the group mutex locked, it might be read without it to skip the
+       group update of lines which are not bonded*/
+   volatile DSL_boolean_t bGroupMember;
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   /** Number of 15-min intervals elapsed since the PM module start*/
+   DSL_uint32_t n15MinIntervalNum;
+   /** Number of 1-day intervals elapsed since the PM module start*/
+   DSL_uint32_t n1DayIntervalNum;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
 } DSL_PM_Context;
 
 /**
@@ -1600,6 +1729,19 @@ typedef struct
 */
 DSL_int_t DSL_DRV_PM_ThreadNe(DSL_DRV_ThreadParams_t *param);
 
+/**
+   One processing cycle of the PM module Near-End thread: counters update,
+   sync time, history and publication of the counters
+
+   \param pContext Pointer to dsl library context structure, [I]
+
+   \return  Return values are defined within the \ref DSL_Error_t definition
+    - DSL_SUCCESS in case of success
+    - DSL_ERROR if the thread has to be stopped
+*/
+DSL_Error_t DSL_DRV_PM_ThreadNeCycle(
+   DSL_Context_t *pContext);
+
 /**
    PM module Far-End thread
 */
@@ -1621,6 +1763,84 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
    const DSL_XTUDir_t nDirection,
    DSL_boolean_t bLock);
 
+/**
+   Locks the common PM module mutex (pmMutex) and adds the wait time to the
+   lock wait statistics. The mutex is unlocked with DSL_DRV_MUTEX_UNLOCK.
+
+   \param pContext Pointer to dsl library context structure, [I]
+
+   \return
+   0 if the mutex was locked, the result of DSL_DRV_MUTEX_LOCK otherwise
+*/
+DSL_int_t DSL_DRV_PM_MutexLock(
+   DSL_Context_t *pContext);
+
+/**
+   Function to publish a consistent copy of the PM module counters for the
+   lock-free readers
+*/
+DSL_Error_t DSL_DRV_PM_CountersPublish(
+   DSL_Context_t *pContext);
+
+/**
+   Function to get the last published PM module counters snapshot.
+   The returned sequence number has to be passed to
+   \ref DSL_DRV_PM_PublishedCountersRetry after the data was read.
+*/
+DSL_PM_CountersData_t* DSL_DRV_PM_PublishedCountersGet(
+   DSL_Context_t *pContext,
+   DSL_uint32_t *pSeq);
+
+/**
+   Function to check whether the snapshot was republished while it was read,
+   returns DSL_TRUE if the read has to be repeated
+*/
+DSL_boolean_t DSL_DRV_PM_PublishedCountersRetry(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_uint32_t nSeq);
+
+/**
+   Reader function called by \ref DSL_DRV_PM_PublishedRead for the published
+   PM counters snapshot pPub. It might be called again for a newer snapshot,
+   so it has to (re)initialize all of its output data.
+*/
+typedef DSL_Error_t (*DSL_DRV_PM_PubReadFunc_t)(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg);
+
+/**
+   Function to read the published PM counters snapshot with the reader
+   function pReadFunc. The reader is repeated as long as the snapshot was
+   republished meanwhile, so its return value (also an error) always belongs
+   to a consistent snapshot.
+
+   \param pContext  Pointer to dsl library context structure, [I]
+   \param pReadFunc Reader function, [I]
+   \param pArg      Argument passed to the reader function, [I/O]
+
+   \return
+   Return value of the reader function for the consistent snapshot
+*/
+DSL_Error_t DSL_DRV_PM_PublishedRead(
+   DSL_Context_t *pContext,
+   DSL_DRV_PM_PubReadFunc_t pReadFunc,
+   DSL_void_t *pArg);
+
+/**
+   Function to get the history change number. It is read under the PM module
+   mutex which also serializes the history updates, so it matches the history
+   data read by the PM API functions. The number changes whenever a history
+   interval was closed or the history was reset, data derived from the
+   history is unchanged as long as the number stays the same.
+   DSL_WRN_INCOMPLETE_RETURN_VALUES is returned as long as the PM data is not
+   valid, the history data read in this state is not final.
+*/
+DSL_Error_t DSL_DRV_PM_HistoryChangeNumGet(
+   DSL_Context_t *pContext,
+   DSL_uint32_t *pChangeNum);
+
 /**
   Lock PM module processing
 */
@@ -1662,6 +1882,50 @@ DSL_Error_t DSL_DRV_PM_HistoryItemIdxGet(
    DSL_uint32_t histInterval,
    DSL_int_t *pIdx);
 
+/** Function to get history fill level of a published snapshot history*/
+DSL_Error_t DSL_DRV_PM_PubHistoryFillLevelGet(
+   DSL_Context_t *pContext,
+   DSL_pmHistory_t *hist,
+   DSL_uint32_t *pFillLevel);
+
+/** Function to get history interval Index of a published snapshot history*/
+DSL_Error_t DSL_DRV_PM_PubHistoryItemIdxGet(
+   DSL_Context_t *pContext,
+   DSL_pmHistory_t *hist,
+   DSL_uint32_t histInterval,
+   DSL_int_t *pIdx);
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+/**
+   Function to get the next existing 15-min history interval of an endpoint
+   from the published counters snapshot. The search starts after nInterval
+   (0 to get the first one) and uses the history fill level and the invalid
+   intervals history, *pNextInterval is set to 0 if no interval was found.
+   If bValidOnly is set intervals with invalid data are skipped.
+*/
+DSL_Error_t DSL_DRV_PM_History15MinNextGet(
+   DSL_Context_t *pContext,
+   DSL_PM_EpType_t EpType,
+   DSL_XTUDir_t nDirection,
+   DSL_boolean_t bValidOnly,
+   DSL_uint32_t nInterval,
+   DSL_uint32_t *pNextInterval);
+
+#ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
+/**
+   Function to get the history statistics (number of previous and of previous
+   invalid intervals) from the published counters snapshot.
+   pHist and pInvalidHist point to the history and the invalid intervals
+   history within the working counters (pCounters).
+*/
+DSL_Error_t DSL_DRV_PM_HistoryStatsGet(
+   DSL_Context_t *pContext,
+   DSL_pmHistory_t *pHist,
+   DSL_pmBF_IntervalFailures_t *pInvalidHist,
+   DSL_PM_HistoryStatsData_t *pData);
+#endif /* INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS*/
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
 /** Function to update all PM module history values*/
 DSL_Error_t DSL_DRV_PM_HistoryUpdate(DSL_Context_t *pContext);
 #endif /** #if defined(INCLUDE_DSL_CPE_PM_HISTORY) || defined(INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS)*/
@@ -1841,6 +2105,117 @@ DSL_Error_t DSL_DRV_PM_FwPollingStop(
 DSL_Error_t DSL_DRV_PM_Resume(
    DSL_Context_t *pContext);
 
+/** Function to restart the adaptive PM polling on the showtime entry*/
+DSL_Error_t DSL_DRV_PM_ShowtimeEntryNotify(
+   DSL_Context_t *pContext);
+
+/** Function to initialize the bonding group counters, called once on the
+    driver start*/
+DSL_void_t DSL_DRV_PM_GroupInit(DSL_void_t);
+
+/** Function to add the latest line counters to the bonding group counters*/
+DSL_Error_t DSL_DRV_PM_GroupUpdate(
+   DSL_Context_t *pContext);
+
+/** Function to remove the line counters from the bonding group counters*/
+DSL_Error_t DSL_DRV_PM_GroupLeave(
+   DSL_Context_t *pContext);
+
+/** Function to copy the bonding group counters of the given direction*/
+DSL_Error_t DSL_DRV_PM_GroupCountersCopy(
+   DSL_Context_t *pContext,
+   const DSL_XTUDir_t nDirection,
+   DSL_PM_GroupCountersAllData_t *pData);
+
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+/**
+   Function to evaluate the threshold crossing of the channel counters.
+
+   \param pCounters   channel counters of one interval, [I]
+   \param pThresholds channel thresholds of the same interval, [I]
+
+   \return
+   Threshold crossing indication bitmask, refer to \ref DSL_PM_BF_ChannelThresholdCrossing_t
+*/
+DSL_uint32_t DSL_DRV_PM_ChannelThresholdsCrossingEval(
+   const DSL_PM_ChannelData_t *pCounters,
+   const DSL_PM_ChannelData_t *pThresholds);
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+/**
+   Function to evaluate the threshold crossing of the line sec counters.
+
+   \param pCounters   line sec counters of one interval, [I]
+   \param pThresholds line sec thresholds of the same interval, [I]
+
+   \return
+   Threshold crossing indication bitmask, refer to \ref DSL_PM_BF_LineThresholdCrossing_t
+*/
+DSL_uint32_t DSL_DRV_PM_LineSecThresholdsCrossingEval(
+   const DSL_PM_LineSecData_t *pCounters,
+   const DSL_PM_LineSecData_t *pThresholds);
+
+/**
+   Function to evaluate the threshold crossing of the line init counters.
+
+   \param pCounters   line init counters of one interval, [I]
+   \param pThresholds line init thresholds of the same interval, [I]
+
+   \return
+   Threshold crossing indication bitmask, refer to \ref DSL_PM_BF_LineThresholdCrossing_t
+*/
+DSL_uint32_t DSL_DRV_PM_LineInitThresholdsCrossingEval(
+   const DSL_PM_LineInitData_t *pCounters,
+   const DSL_PM_LineInitData_t *pThresholds);
+
+#ifdef INCLUDE_DSL_ADSL_MIB
+/**
+   Function to map the line sec threshold crossing indications to the ADSL
+   MIB threshold flags of the given direction.
+
+   \param nDirection Near-end (ATU-R) or far-end (ATU-C) flags, [I]
+   \param nInd       Line threshold crossing indication bitmask, [I]
+
+   \return
+   ADSL MIB threshold flags, refer to DSL_MIB_ADSL_Thresholds_t
+*/
+DSL_uint32_t DSL_DRV_PM_LineSecMibThresholdsGet(
+   const DSL_XTUDir_t nDirection,
+   const DSL_uint32_t nInd);
+#endif /* INCLUDE_DSL_ADSL_MIB*/
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+/**
+   Function to evaluate the threshold crossing of the data path counters.
+
+   \param pCounters   data path counters of one interval, [I]
+   \param pThresholds data path thresholds of the same interval, [I]
+
+   \return
+   Threshold crossing indication bitmask, refer to \ref DSL_PM_BF_DataPathThresholdCrossing_t
+*/
+DSL_uint32_t DSL_DRV_PM_DataPathThresholdsCrossingEval(
+   const DSL_PM_DataPathData_t *pCounters,
+   const DSL_PM_DataPathData_t *pThresholds);
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+/**
+   Function to evaluate the threshold crossing of the ReTx counters.
+
+   \param pCounters   ReTx counters of one interval, [I]
+   \param pThresholds ReTx thresholds of the same interval, [I]
+
+   \return
+   Threshold crossing indication bitmask, refer to \ref DSL_PM_BF_ReTxThresholdCrossing_t
+*/
+DSL_uint32_t DSL_DRV_PM_ReTxThresholdsCrossingEval(
+   const DSL_PM_ReTxData_t *pCounters,
+   const DSL_PM_ReTxData_t *pThresholds);
+#endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
+
 #ifdef INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS
 DSL_Error_t DSL_DRV_PM_InternalCountersGet(
    DSL_Context_t *pContext,
@@ -0,0 +1,249 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+#ifndef _DRV_DSL_CPE_SIM_VRX_H
+#define _DRV_DSL_CPE_SIM_VRX_H
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+/** \file
+   Simulated VRx device for the user space build (see 'drv_dsl_cpe_os_sim.h').
+   It replaces the MEI CPE driver interface and answers all firmware messages
+   with canned acknowledges. The answers, their latency and the returned
+   errors can be configured per message ID by rules, either from the calling
+   application or from a script file.
+*/
+
+/** \addtogroup DRV_DSL_DEVICE
+ @{ */
+
+/** Maximum number of simulated lines */
+#define DSL_DRV_SIM_VRX_LINES_MAX         2
+/** Maximum number of message rules */
+#define DSL_DRV_SIM_VRX_RULES_MAX         32
+/** Maximum payload size of a canned acknowledge or notification [bytes] */
+#define DSL_DRV_SIM_VRX_PAYLOAD_MAX       256
+/** Number of pending notifications per line */
+#define DSL_DRV_SIM_VRX_NFC_FIFO_SIZE     16
+
+/** Rule applies to all lines */
+#define DSL_DRV_SIM_VRX_LINE_ANY          0xFFFF
+/** Rule applies to all message IDs */
+#define DSL_DRV_SIM_VRX_MSG_ID_ANY        0xFFFFFFFF
+
+/** Environment variable which names the script loaded by
+    DSL_DRV_SIM_VRX_Init */
+#define DSL_DRV_SIM_VRX_SCRIPT_ENV        "DSL_SIM_VRX_SCRIPT"
+
+/**
+   Rule for the answer of a firmware message.
+   Messages without a matching rule get an immediate positive acknowledge
+   with the message ID of the command and a zero filled payload.
+*/
+typedef struct
+{
+   /** Line number, DSL_DRV_SIM_VRX_LINE_ANY for all lines */
+   DSL_uint16_t nLine;
+   /** Message ID, DSL_DRV_SIM_VRX_MSG_ID_ANY for all messages */
+   DSL_uint32_t nMsgId;
+   /** Latency of the answer [us] */
+   DSL_uint32_t nLatency;
+   /** MEI return code of the message exchange, 0 for a positive
+       acknowledge. Any other value fails the exchange and is returned in
+       the ioctl return code (for example -e_MEI_ERR_DEV_NEG_RESP) */
+   DSL_int32_t nRetCode;
+   /** Function op code of a negative acknowledge, reported in bits 8..15
+       of the acknowledge classifier */
+   DSL_uint8_t nFctOpCode;
+   /** Number of messages the rule applies to, 0 for unlimited */
+   DSL_uint32_t nCount;
+   /** Size of the canned acknowledge payload [bytes], 0 to use a zero
+       filled payload of the requested size */
+   DSL_uint32_t nAckSize;
+   /** Canned acknowledge payload */
+   DSL_uint8_t ackPayload[DSL_DRV_SIM_VRX_PAYLOAD_MAX];
+} DSL_DRV_SIM_VRX_Rule_t;
+
+/**
+   Statistics of a simulated line.
+*/
+typedef struct
+{
+   /** Number of messages sent */
+   DSL_uint32_t nMsgSend;
+   /** Number of messages answered with an error */
+   DSL_uint32_t nMsgError;
+   /** Sum of the simulated latencies [us] */
+   DSL_uint32_t nLatencyTotal;
+   /** Number of notifications read */
+   DSL_uint32_t nNfcRead;
+   /** Number of notifications dropped because of a full FIFO */
+   DSL_uint32_t nNfcLost;
+   /** Number of firmware downloads */
+   DSL_uint32_t nFwDownload;
+   /** Number of firmware chunks written */
+   DSL_uint32_t nFwChunk;
+   /** Number of Clear EOC frames written */
+   DSL_uint32_t nCeocFrameWr;
+} DSL_DRV_SIM_VRX_Statistics_t;
+
+/**
+   Initializes the simulated device and loads the script named by the
+   environment variable \ref DSL_DRV_SIM_VRX_SCRIPT_ENV, if set.
+   It is called by DSL_DRV_SIM_ModuleInit, rules and notifications of the
+   application have to be added afterwards. The device layout is kept.
+
+   \return
+   - DSL_SUCCESS (0) in case of success
+   - DSL_ERROR (-1) if the script could not be loaded
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_Init(DSL_void_t);
+
+/**
+   Releases the simulated device, all rules and pending notifications are
+   discarded.
+*/
+DSL_void_t DSL_DRV_SIM_VRX_Cleanup(DSL_void_t);
+
+/**
+   Returns the device layout of the simulation, 1 device with 1 line and 1
+   channel by default.
+
+   \param pDevices   Number of devices, [O]
+   \param pLines     Number of lines per device, [O]
+   \param pChannels  Number of channels per line, [O]
+*/
+DSL_void_t DSL_DRV_SIM_VRX_DevLayoutGet(
+   DSL_uint32_t *pDevices,
+   DSL_uint32_t *pLines,
+   DSL_uint32_t *pChannels);
+
+/**
+   Sets the device layout of the simulation.
+
+   \param nDevices   Number of devices, [I]
+   \param nLines     Number of lines per device, [I]
+   \param nChannels  Number of channels per line, [I]
+*/
+DSL_void_t DSL_DRV_SIM_VRX_DevLayoutSet(
+   DSL_uint32_t nDevices,
+   DSL_uint32_t nLines,
+   DSL_uint32_t nChannels);
+
+/**
+   Adds a message rule. Rules are checked in the order they were added, the
+   first matching rule applies.
+
+   \param pRule   Rule, [I]
+
+   \return
+   - DSL_SUCCESS (0) in case of success
+   - DSL_ERR_MEMORY if the rule table is full
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_RuleAdd(const DSL_DRV_SIM_VRX_Rule_t *pRule);
+
+/**
+   Removes all message rules.
+*/
+DSL_void_t DSL_DRV_SIM_VRX_RulesClear(DSL_void_t);
+
+/**
+   Loads a script of message rules. Each line holds one command, '#' starts
+   a comment:
+
+   layout <devices> <lines> <channels>
+   rule <line|*> <msgId|*> <latency us> <retCode> <fctOpCode> <count> [ack bytes]
+
+   Numbers are accepted in decimal or with '0x' prefix in hex, the
+   acknowledge bytes are always given in hex.
+
+   \param pFileName  Script file name, [I]
+
+   \return
+   - DSL_SUCCESS (0) in case of success
+   - DSL_ERR_FILE_OPEN if the file could not be opened
+   - DSL_ERR_INVALID_PARAMETER in case of a syntax error
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_ScriptLoad(const DSL_char_t *pFileName);
+
+/**
+   Queues a notification of the firmware and signals it to the registered
+   NFC callback, as the MEI driver does on an interrupt.
+
+   \param nLine     Line number, [I]
+   \param nMsgId    Message ID of the notification, [I]
+   \param pPayload  Payload of the notification, [I]
+   \param nSize     Payload size [bytes], [I]
+
+   \return
+   - DSL_SUCCESS (0) in case of success
+   - DSL_ERR_INVALID_PARAMETER for an invalid line or size
+   - DSL_ERR_MEMORY if the notification FIFO is full
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_NfcInject(
+   DSL_uint16_t nLine,
+   DSL_uint32_t nMsgId,
+   const DSL_uint8_t *pPayload,
+   DSL_uint32_t nSize);
+
+/**
+   Returns the statistics of a simulated line.
+
+   \param nLine   Line number, [I]
+   \param pStats  Statistics, [O]
+
+   \return
+   - DSL_SUCCESS (0) in case of success
+   - DSL_ERR_INVALID_PARAMETER for an invalid line
+*/
+DSL_Error_t DSL_DRV_SIM_VRX_StatisticsGet(
+   DSL_uint16_t nLine,
+   DSL_DRV_SIM_VRX_Statistics_t *pStats);
+
+/**
+   Resets the statistics of all simulated lines.
+*/
+DSL_void_t DSL_DRV_SIM_VRX_StatisticsReset(DSL_void_t);
+
+/*
+   Replacement of the MEI CPE driver interface, see 'drv_mei_cpe_api_intern.h'
+   for a description.
+*/
+int DSL_DRV_VRX_InternalDevOpen(unsigned short nLineNum, MEI_DYN_CNTRL_T **ppMeiDynCntrl);
+int DSL_DRV_VRX_InternalDevClose(MEI_DYN_CNTRL_T *pMeiDynCntrl);
+int DSL_DRV_VRX_InternalInitDevice(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_devInit_t *pInitDev);
+int DSL_DRV_VRX_InternalDrvVersionGet(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_drvVersion_t *pArgDrvVersion);
+int DSL_DRV_VRX_InternalDevReset(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_reset_t *pArgRstArgs, int rstSrc);
+int DSL_DRV_VRX_InternalRequestConfig(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_reqCfg_t *pArgDrvCfg);
+int DSL_DRV_VRX_InternalFirmwareDownload(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_fwDownLoad_t *pArgFwDl);
+int DSL_DRV_VRX_InternalFirmwareChunkDownload(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_fwChunkDownLoad_t *pArgFwDl);
+int DSL_DRV_VRX_InternalFwModeCtrlSet(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_FwModeCtrlSet_t *pArgFwModeCtrl);
+int DSL_DRV_VRX_InternalMsgSend(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_messageSend_t *pUserMsgs);
+int DSL_DRV_VRX_InternalNfcEnable(MEI_DYN_CNTRL_T *pMeiDynCntrl);
+int DSL_DRV_VRX_InternalNfcMsgRead(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_message_t *pUserMsg);
+int DSL_DRV_VRX_InternalDebugLevelSet(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_dbgLevel_t *pArgDbgLevel);
+int DSL_DRV_VRX_InternalNfcCallBackDataSet(MEI_DYN_CNTRL_T *pMeiDynCntrl, void *pNfcCallBack, void *pNfcCallBackData);
+
+/*
+   MEI CPE driver functions used outside of the VRx device layer (Clear EOC)
+   are served by the simulated device as well.
+*/
+#define MEI_InternalRequestConfig      DSL_DRV_VRX_InternalRequestConfig
+#define MEI_InternalNfcMsgRead         DSL_DRV_VRX_InternalNfcMsgRead
+
+/** @} DRV_DSL_DEVICE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DRV_DSL_CPE_SIM_VRX_H */
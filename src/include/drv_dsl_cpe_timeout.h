@@ -36,6 +36,10 @@ struct DSL_TimeoutElement_s
    /**
       Pointer to next element */
    DSL_TimeoutElement_t *pNext;
+   /**
+      Identifier of the element which is returned as timeout ID, unequal
+      to 0 */
+   DSL_uint32_t nId;
    /**
       Marks whether the element is valid (DSL_TRUE) or not (DSL_FALSE) */
    DSL_boolean_t bValid;
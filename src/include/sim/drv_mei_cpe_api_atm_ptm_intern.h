@@ -0,0 +1,22 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+#ifndef _DRV_MEI_CPE_API_ATM_PTM_INTERN_H
+#define _DRV_MEI_CPE_API_ATM_PTM_INTERN_H
+
+/** \file
+   ATM/PTM part of the internal MEI CPE driver interface for the user space
+   simulation library. The showtime signals are declared together with the
+   rest of the reduced interface in 'drv_mei_cpe_api_intern.h'.
+*/
+
+#include "drv_mei_cpe_api_intern.h"
+
+#endif /* _DRV_MEI_CPE_API_ATM_PTM_INTERN_H */
@@ -0,0 +1,299 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+#ifndef _DRV_MEI_CPE_API_INTERN_H
+#define _DRV_MEI_CPE_API_INTERN_H
+
+#ifdef __cplusplus
+   extern "C" {
+#endif
+
+/** \file
+   Reduced copy of the internal interface of the MEI CPE driver for the user
+   space simulation library (see 'drv_dsl_cpe_sim_vrx.h'). It holds only the
+   types, constants and functions used by the VRx device layer, so the
+   simulation builds without the MEI CPE driver and IFXOS sources.
+   The layout of the structures follows the MEI CPE driver, but the
+   simulation is not binary compatible with it.
+*/
+
+/** \addtogroup DRV_DSL_DEVICE
+ @{ */
+
+#ifndef IFX_TRUE
+/** IFXOS boolean true */
+#define IFX_TRUE     1
+/** IFXOS boolean false */
+#define IFX_FALSE    0
+#endif
+
+#ifndef _IFX_TYPES_H
+/** IFXOS 16 bit unsigned integer */
+typedef unsigned short IFX_uint16_t;
+/** IFXOS 32 bit signed integer */
+typedef int IFX_int32_t;
+#endif
+
+/** Control block of an internal MEI device instance, only used as handle */
+typedef struct MEI_dyn_cntrl_s MEI_DYN_CNTRL_T;
+
+/** Hardware reset of all blocks */
+#define MEI_IOCTL_HW_RST_MASK_ALL      0xFFFFFFFF
+/** Message control: modem message */
+#define MEI_MSG_CTRL_MODEM_MSG         0
+
+/** Debug modules */
+enum
+{
+   e_MEI_DBGMOD_MEI_MSG_DUMP_API,
+   e_MEI_DBGMOD_MEI_DRV,
+   e_MEI_DBGMOD_MEI_NOTIFICATIONS
+};
+
+/** Debug levels */
+enum
+{
+   MEI_DBG_LEVEL_LOW = 1,
+   MEI_DBG_LEVEL_NORMAL,
+   MEI_DBG_LEVEL_HIGH,
+   MEI_DBG_LEVEL_OFF
+};
+
+/** Error codes, returned negative */
+enum
+{
+   e_MEI_ERR_OP_FAILED = 1,
+   e_MEI_ERR_INVAL_STATE,
+   e_MEI_ERR_DEV_NO_RESP,
+   e_MEI_ERR_DEV_NEG_RESP,
+   e_MEI_ERR_DEV_INVAL_RESP,
+   e_MEI_ERR_DEV_BUSY,
+   e_MEI_ERR_ALREADY_DONE,
+   e_MEI_ERR_INVAL_FW_IMAGE,
+   e_MEI_ERR_OPTIMIZED_FW_DL_FAILED
+};
+
+/** Multi line, xDSL and reset modes */
+enum
+{
+   e_MEI_MULTI_LINEMODE_SINGLE,
+   e_MEI_MULTI_LINEMODE_DUAL,
+   e_MEI_XDSLMODE_ADSL,
+   e_MEI_XDSLMODE_VDSL,
+   e_MEI_RESET
+};
+
+/** Common ioctl header */
+typedef struct
+{
+   /** Return code of the operation */
+   int retCode;
+} IOCTL_MEI_ioctl_t;
+
+/** Message */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int msgId;
+   unsigned int msgClassifier;
+   unsigned int msgCtrl;
+   unsigned char *pPayload;
+   unsigned int paylSize_byte;
+} IOCTL_MEI_message_t;
+
+/** Message exchange, command and acknowledge */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   IOCTL_MEI_message_t write_msg;
+   IOCTL_MEI_message_t ack_msg;
+} IOCTL_MEI_messageSend_t;
+
+/** Debug level setting */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int valLevel;
+   unsigned int eDbgModule;
+} IOCTL_MEI_dbgLevel_t;
+
+/** Driver configuration */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int bootMode;
+   unsigned int currDrvState;
+   unsigned int currModemFsmState;
+   unsigned int devNum;
+   unsigned int phyBaseAddr;
+   unsigned int usedIRQ;
+} IOCTL_MEI_reqCfg_t;
+
+/** Device init */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int meiBaseAddr;
+   unsigned int usedIRQ;
+} IOCTL_MEI_devInit_t;
+
+/** Firmware download */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned char *pFwImage;
+   unsigned int size_byte;
+} IOCTL_MEI_fwDownLoad_t;
+
+/** The firmware binary may be downloaded in chunks, see
+    \ref IOCTL_MEI_fwChunkDownLoad_t */
+#define MEI_SUPPORT_FW_CHUNK_DOWNLOAD
+
+/** Firmware download in chunks. The chunks are passed in ascending order,
+    the download starts with the chunk at offset 0 and completes with the
+    chunk which ends at the image size. */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned char *pFwChunk;
+   unsigned int size_byte;
+   unsigned int offset_byte;
+   unsigned int image_size_byte;
+} IOCTL_MEI_fwChunkDownLoad_t;
+
+/** Device reset */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int rstMode;
+   unsigned int rstSelMask;
+} IOCTL_MEI_reset_t;
+
+/** Features of the loaded firmware */
+typedef struct
+{
+   unsigned int eFirmwareXdslModes;
+   unsigned int nPlatformId;
+} IOCTL_MEI_firmwareFeatures_t;
+
+/** Firmware mode control */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   int bMultiLineModeLock;
+   int bXdslModeLock;
+   unsigned int eMultiLineModeCurrent;
+   unsigned int eMultiLineModePreferred;
+   unsigned int eXdslModeCurrent;
+   unsigned int eXdslModePreferred;
+   IOCTL_MEI_firmwareFeatures_t firmwareFeatures;
+} IOCTL_MEI_FwModeCtrlSet_t;
+
+/** Driver version */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   char *pVersionStr;
+   unsigned int strSize;
+} IOCTL_MEI_drvVersion_t;
+
+/** Showtime entry signal towards the ATM/PTM driver */
+typedef struct
+{
+   unsigned int rate_fast;
+   unsigned int rate_intl;
+} MEI_XTM_ShowtimeEnter_t;
+
+/** Showtime exit signal towards the ATM/PTM driver */
+typedef struct
+{
+   int dummy;
+} MEI_XTM_ShowtimeExit_t;
+
+/** Clear EOC operation modes */
+enum
+{
+   /** Frames are handled by the MEI driver */
+   MEI_CEOC_OPERATION_MODE_AUTO = 0,
+   /** Frames are handled by the application */
+   MEI_CEOC_OPERATION_MODE_TRANSPARENT = 1
+};
+
+/** Clear EOC init */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+} IOCTL_MEI_CEOC_init_t;
+
+/** Clear EOC control */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int opMode;
+} IOCTL_MEI_CEOC_cntrl_t;
+
+/** Clear EOC frame */
+typedef struct
+{
+   IOCTL_MEI_ioctl_t ictl;
+   unsigned int protIdent;
+   unsigned int dataSize_byte;
+   unsigned char *pEocData;
+} IOCTL_MEI_CEOC_frame_t;
+
+/*
+   Former VRX names of the MEI CPE driver interface, still used by the Clear
+   EOC device layer 'drv_dsl_cpe_vrx_ceoc.c'.
+*/
+#define VRX_DYN_CNTRL_T                MEI_DYN_CNTRL_T
+#define IOCTL_VRX_reqCfg_t             IOCTL_MEI_reqCfg_t
+#define IOCTL_VRX_message_t            IOCTL_MEI_message_t
+#define IOCTL_VRX_CEOC_init_t          IOCTL_MEI_CEOC_init_t
+#define IOCTL_VRX_CEOC_cntrl_t         IOCTL_MEI_CEOC_cntrl_t
+#define IOCTL_VRX_CEOC_frame_t         IOCTL_MEI_CEOC_frame_t
+#define VRX_CEOC_OPERATION_MODE_AUTO   MEI_CEOC_OPERATION_MODE_AUTO
+#define e_VRX_ERR_INVAL_STATE          e_MEI_ERR_INVAL_STATE
+#define VRX_InternalRequestConfig      MEI_InternalRequestConfig
+#define VRX_InternalNfcMsgRead         MEI_InternalNfcMsgRead
+#define VRX_InternalCEocInit           MEI_InternalCEocInit
+#define VRX_InternalCEocCntrl          MEI_InternalCEocCntrl
+#define VRX_InternalCEocFrameWr        MEI_InternalCEocFrameWr
+
+/*
+   Internal interface functions, mapped onto the simulated device by
+   'drv_dsl_cpe_device_vrx.h'.
+*/
+int MEI_InternalDevOpen(unsigned short nLineNum, MEI_DYN_CNTRL_T **ppMeiDynCntrl);
+int MEI_InternalDevClose(MEI_DYN_CNTRL_T *pMeiDynCntrl);
+int MEI_InternalInitDevice(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_devInit_t *pInitDev);
+int MEI_InternalDrvVersionGet(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_drvVersion_t *pArgDrvVersion);
+int MEI_InternalDevReset(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_reset_t *pArgRstArgs, int rstSrc);
+int MEI_InternalRequestConfig(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_reqCfg_t *pArgDrvCfg);
+int MEI_InternalFirmwareDownload(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_fwDownLoad_t *pArgFwDl);
+int MEI_InternalFirmwareChunkDownload(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_fwChunkDownLoad_t *pArgFwDl);
+int MEI_InternalFwModeCtrlSet(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_FwModeCtrlSet_t *pArgFwModeCtrl);
+int MEI_InternalMsgSend(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_messageSend_t *pUserMsgs);
+int MEI_InternalNfcEnable(MEI_DYN_CNTRL_T *pMeiDynCntrl);
+int MEI_InternalNfcMsgRead(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_message_t *pUserMsg);
+int MEI_InternalDebugLevelSet(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_dbgLevel_t *pArgDbgLevel);
+int MEI_InternalNfcCallBackDataSet(MEI_DYN_CNTRL_T *pMeiDynCntrl, void *pNfcCallBack, void *pNfcCallBackData);
+int MEI_InternalCEocInit(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_CEOC_init_t *pArgCEocInit);
+int MEI_InternalCEocCntrl(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_CEOC_cntrl_t *pArgCEocCntrl);
+int MEI_InternalCEocFrameWr(MEI_DYN_CNTRL_T *pMeiDynCntrl, IOCTL_MEI_CEOC_frame_t *pArgCEocFrame);
+int MEI_InternalXtmSwhowtimeEntrySignal(MEI_DYN_CNTRL_T *pMeiDynCntrl, MEI_XTM_ShowtimeEnter_t *pArgXtm);
+int MEI_InternalXtmSwhowtimeExitSignal(MEI_DYN_CNTRL_T *pMeiDynCntrl, MEI_XTM_ShowtimeExit_t *pArgXtm);
+
+/** @} DRV_DSL_DEVICE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DRV_MEI_CPE_API_INTERN_H */
@@ -45,6 +45,27 @@ static DSL_adslLineAlarmExtConfProfilePrivEntry_t alarmExtConfProfile =
    {"No name", 1 };
 #endif
 
+#if defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)
+/** Cached rows of one interval table */
+typedef struct
+{
+   /** Published PM history change number the rows belong to */
+   DSL_uint32_t nHistoryChangeNum;
+   /** Table index (channel number for the channel tables) of the rows */
+   DSL_int_t ifIndex;
+   /** Bit field of the cached rows, bit n is set for interval number n+1 */
+   DSL_uint32_t nCached[(ADSL_MIB_TABLE_ROWS_MAX + 31) / 32];
+   /** Rows, read with all parameter flags of the table set */
+   adslMibTableRows_t rows;
+} DSL_MIB_ADSL_TableCache_t;
+
+/** Interval table row cache of a line */
+struct DSL_MIB_ADSL_RowCache
+{
+   DSL_MIB_ADSL_TableCache_t table[ADSL_MIB_TABLE_LAST];
+};
+#endif /* defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)*/
+
 static DSL_Error_t DSL_DRV_MIB_ADSL_IoctlHandleHelperCall
 (
    DSL_Context_t *pContext,
@@ -93,6 +114,10 @@ DSL_char_t* DSL_DBG_ADSL_IoctlName(DSL_uint_t nIoctlCode)
       return "DSL_FIO_MIB_ADSL_LINE_ALARM_CONF_PROFILE_ENTRY_SET";
    case DSL_FIO_MIB_ADSL_TRAPS_GET:
       return "DSL_FIO_MIB_ADSL_TRAPS_GET";
+   case DSL_FIO_MIB_ADSL_TABLE_GET:
+      return "DSL_FIO_MIB_ADSL_TABLE_GET";
+   case DSL_FIO_MIB_ADSL_TABLE_NEXT_INDEX_GET:
+      return "DSL_FIO_MIB_ADSL_TABLE_NEXT_INDEX_GET";
 #ifdef INCLUDE_ADSL_MIB_RFC3440
    case DSL_FIO_MIB_ADSL_LINE_EXT_ENTRY_GET:
       return "DSL_FIO_MIB_ADSL_LINE_EXT_ENTRY_GET";
@@ -2147,6 +2172,333 @@ DSL_Error_t DSL_DRV_MIB_ADSL_AturChanIntervalEntryGet(
 #endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
 #endif /* #ifdef INCLUDE_DSL_PM*/
 
+#if defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)
+/*
+   Returns all parameter flags of the given table, 0 if the table is not
+   supported by the current configuration
+*/
+static DSL_uint32_t DSL_DRV_MIB_ADSL_TableFlagsAllGet(
+   adslMibTable_t nTable)
+{
+   switch (nTable)
+   {
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+   case ADSL_ATUC_INTVL_TABLE:
+      return (((DSL_uint32_t)(ATUC_INTVL_VALID_DATA_FLAG)) - 1) | ATUC_INTVL_VALID_DATA_FLAG;
+   case ADSL_ATUR_INTVL_TABLE:
+      return (((DSL_uint32_t)(ATUR_INTVL_VALID_DATA_FLAG)) - 1) | ATUR_INTVL_VALID_DATA_FLAG;
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+   case ADSL_ATUC_CHAN_INTVL_TABLE:
+      return (((DSL_uint32_t)(ATUC_CHAN_INTVL_VALID_DATA_FLAG)) - 1) | ATUC_CHAN_INTVL_VALID_DATA_FLAG;
+   case ADSL_ATUR_CHAN_INTVL_TABLE:
+      return (((DSL_uint32_t)(ATUR_CHAN_INTVL_VALID_DATA_FLAG)) - 1) | ATUR_CHAN_INTVL_VALID_DATA_FLAG;
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+   default:
+      return 0;
+   }
+}
+
+/*
+   Returns the row nRow of the given table together with its size and the
+   location of its flags
+*/
+static DSL_void_t* DSL_DRV_MIB_ADSL_TableRowGet(
+   adslMibTable_t nTable,
+   adslMibTableRows_t *pRows,
+   DSL_uint32_t nRow,
+   DSL_uint32_t *pRowSize,
+   DSL_uint8_t **ppFlags)
+{
+   switch (nTable)
+   {
+   case ADSL_ATUC_INTVL_TABLE:
+      *pRowSize = sizeof(adslAtucIntvlInfo_t);
+      *ppFlags = &(pRows->atucIntvl[nRow].flags);
+      return &(pRows->atucIntvl[nRow]);
+   case ADSL_ATUR_INTVL_TABLE:
+      *pRowSize = sizeof(adslAturIntvlInfo_t);
+      *ppFlags = &(pRows->aturIntvl[nRow].flags);
+      return &(pRows->aturIntvl[nRow]);
+   case ADSL_ATUC_CHAN_INTVL_TABLE:
+      *pRowSize = sizeof(adslAtucChanIntvlInfo_t);
+      *ppFlags = &(pRows->atucChanIntvl[nRow].flags);
+      return &(pRows->atucChanIntvl[nRow]);
+   case ADSL_ATUR_CHAN_INTVL_TABLE:
+   default:
+      *pRowSize = sizeof(adslAturChanIntvlInfo_t);
+      *ppFlags = &(pRows->aturChanIntvl[nRow].flags);
+      return &(pRows->aturChanIntvl[nRow]);
+   }
+}
+
+/*
+   Reads the row of the given interval from the PM module, all parameter
+   flags of the table are requested
+*/
+static DSL_Error_t DSL_DRV_MIB_ADSL_TableRowRead(
+   DSL_Context_t *pContext,
+   adslMibTable_t nTable,
+   DSL_int_t ifIndex,
+   DSL_int_t nInterval,
+   adslMibTableRows_t *pRows,
+   DSL_uint32_t nRow)
+{
+   DSL_Error_t nErrCode = DSL_ERR_NOT_SUPPORTED;
+   DSL_uint8_t nFlagsAll = (DSL_uint8_t)DSL_DRV_MIB_ADSL_TableFlagsAllGet(nTable);
+
+   switch (nTable)
+   {
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+   case ADSL_ATUC_INTVL_TABLE:
+      pRows->atucIntvl[nRow].ifIndex        = ifIndex;
+      pRows->atucIntvl[nRow].IntervalNumber = nInterval;
+      pRows->atucIntvl[nRow].flags          = nFlagsAll;
+      nErrCode = DSL_DRV_MIB_ADSL_IntervalEntryGet(
+                    pContext, DSL_FAR_END, &(pRows->atucIntvl[nRow]));
+      break;
+
+   case ADSL_ATUR_INTVL_TABLE:
+      pRows->aturIntvl[nRow].ifIndex        = ifIndex;
+      pRows->aturIntvl[nRow].IntervalNumber = nInterval;
+      pRows->aturIntvl[nRow].flags          = nFlagsAll;
+      nErrCode = DSL_DRV_MIB_ADSL_IntervalEntryGet(
+                    pContext, DSL_NEAR_END, &(pRows->aturIntvl[nRow]));
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+   case ADSL_ATUC_CHAN_INTVL_TABLE:
+      pRows->atucChanIntvl[nRow].ifIndex        = ifIndex;
+      pRows->atucChanIntvl[nRow].IntervalNumber = nInterval;
+      pRows->atucChanIntvl[nRow].flags          = nFlagsAll;
+      nErrCode = DSL_DRV_MIB_ADSL_ChanIntervalEntryGet(
+                    pContext, DSL_FAR_END, &(pRows->atucChanIntvl[nRow]));
+      break;
+
+   case ADSL_ATUR_CHAN_INTVL_TABLE:
+      pRows->aturChanIntvl[nRow].ifIndex        = ifIndex;
+      pRows->aturChanIntvl[nRow].IntervalNumber = nInterval;
+      pRows->aturChanIntvl[nRow].flags          = nFlagsAll;
+      nErrCode = DSL_DRV_MIB_ADSL_ChanIntervalEntryGet(
+                    pContext, DSL_NEAR_END, &(pRows->aturChanIntvl[nRow]));
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+
+   default:
+      break;
+   }
+
+   return nErrCode;
+}
+
+static DSL_Error_t DSL_DRV_MIB_ADSL_TableGet(
+   DSL_Context_t *pContext,
+   adslMibTableBulk_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS, nRetCode = DSL_SUCCESS;
+   DSL_uint32_t nFlagsAll = 0, nChangeNum = 0, nChangeNumEnd = 0;
+   DSL_uint32_t nRow = 0, nRowSize = 0;
+   DSL_uint8_t *pSrcFlags = DSL_NULL, *pDstFlags = DSL_NULL;
+   DSL_void_t *pSrc = DSL_NULL, *pDst = DSL_NULL;
+   DSL_boolean_t bCacheable = DSL_FALSE, bIncomplete = DSL_FALSE;
+   DSL_MIB_ADSL_TableCache_t *pCache = DSL_NULL;
+
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG"DSL: IN - "
+      "DSL_DRV_MIB_ADSL_TableGet"DSL_DRV_CRLF));
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   pData->nNumRows = 0;
+
+   if (((DSL_uint32_t)pData->nTable >= ADSL_MIB_TABLE_LAST) ||
+       (pData->nFirstInterval < 1) ||
+       (pData->nFirstInterval > ADSL_MIB_TABLE_ROWS_MAX))
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   nFlagsAll = DSL_DRV_MIB_ADSL_TableFlagsAllGet(pData->nTable);
+   if ((nFlagsAll == 0) || (pData->flags == 0))
+   {
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   /* Rows are only kept while the PM history is unchanged*/
+   nErrCode = DSL_DRV_PM_HistoryChangeNumGet(pContext, &nChangeNum);
+   if (nErrCode < DSL_SUCCESS)
+   {
+      return nErrCode;
+   }
+   bCacheable = (nErrCode == DSL_SUCCESS) ? DSL_TRUE : DSL_FALSE;
+
+   if (DSL_DRV_MUTEX_LOCK(pContext->MibAdslCtx.rowCacheMutex))
+   {
+      DSL_DEBUG( DSL_DBG_ERR, (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - "
+         "Couldn't lock MIB row cache mutex!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   if (pContext->MibAdslCtx.pRowCache == DSL_NULL)
+   {
+      pContext->MibAdslCtx.pRowCache =
+         (struct DSL_MIB_ADSL_RowCache*)DSL_DRV_VMalloc(
+            sizeof(struct DSL_MIB_ADSL_RowCache));
+      if (pContext->MibAdslCtx.pRowCache == DSL_NULL)
+      {
+         DSL_DRV_MUTEX_UNLOCK(pContext->MibAdslCtx.rowCacheMutex);
+         return DSL_ERR_MEMORY;
+      }
+      memset(pContext->MibAdslCtx.pRowCache, 0,
+         sizeof(struct DSL_MIB_ADSL_RowCache));
+   }
+
+   pCache = &(pContext->MibAdslCtx.pRowCache->table[pData->nTable]);
+
+   if ((bCacheable == DSL_FALSE) || (pCache->nHistoryChangeNum != nChangeNum) ||
+       (pCache->ifIndex != pData->ifIndex))
+   {
+      memset(pCache->nCached, 0, sizeof(pCache->nCached));
+      pCache->nHistoryChangeNum = nChangeNum;
+      pCache->ifIndex = pData->ifIndex;
+   }
+
+   for (nRow = (DSL_uint32_t)(pData->nFirstInterval - 1);
+        nRow < ADSL_MIB_TABLE_ROWS_MAX; nRow++)
+   {
+      if (!(pCache->nCached[nRow / 32] & (1U << (nRow % 32))))
+      {
+         nRetCode = DSL_DRV_MIB_ADSL_TableRowRead(pContext, pData->nTable,
+            pData->ifIndex, (DSL_int_t)(nRow + 1), &(pCache->rows), nRow);
+         if (nRetCode < DSL_SUCCESS)
+         {
+            /* Interval not (yet) available*/
+            break;
+         }
+
+         if (bCacheable == DSL_TRUE)
+         {
+            pCache->nCached[nRow / 32] |= (1U << (nRow % 32));
+         }
+      }
+
+      pSrc = DSL_DRV_MIB_ADSL_TableRowGet(pData->nTable, &(pCache->rows),
+                nRow, &nRowSize, &pSrcFlags);
+      pDst = DSL_DRV_MIB_ADSL_TableRowGet(pData->nTable, &(pData->rows),
+                pData->nNumRows, &nRowSize, &pDstFlags);
+
+      memcpy(pDst, pSrc, nRowSize);
+      /* Report the requested parameters which were not handled*/
+      *pDstFlags = (DSL_uint8_t)(pData->flags & (*pSrcFlags | ~nFlagsAll));
+      if (*pDstFlags != 0)
+      {
+         bIncomplete = DSL_TRUE;
+      }
+
+      pData->nNumRows++;
+   }
+
+   /* Drop rows which might have been read across a history update*/
+   if ((DSL_DRV_PM_HistoryChangeNumGet(pContext, &nChangeNumEnd) != DSL_SUCCESS) ||
+       (nChangeNumEnd != nChangeNum))
+   {
+      memset(pCache->nCached, 0, sizeof(pCache->nCached));
+   }
+
+   DSL_DRV_MUTEX_UNLOCK(pContext->MibAdslCtx.rowCacheMutex);
+
+   if (pData->nNumRows == 0)
+   {
+      nErrCode = DSL_ERROR;
+   }
+   else if (pData->flags & ~nFlagsAll)
+   {
+      nErrCode = DSL_WRN_INCONSISTENT_ADSL_MIB_FLAGS;
+   }
+   else if (bIncomplete == DSL_TRUE)
+   {
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+   }
+   else
+   {
+      nErrCode = DSL_SUCCESS;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL: OUT - DSL_DRV_MIB_ADSL_TableGet, "
+      "nRows(%u), nReturn(%d)"DSL_DRV_CRLF, pData->nNumRows, nErrCode));
+
+   return nErrCode;
+}
+
+static DSL_Error_t DSL_DRV_MIB_ADSL_TableNextIndexGet(
+   DSL_Context_t *pContext,
+   adslMibTableNextIndex_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_EpType_t nEpType = DSL_PM_COUNTER_NA;
+   DSL_XTUDir_t nDirection = DSL_NEAR_END;
+   DSL_uint32_t nNext = 0;
+
+   DSL_DEBUG(DSL_DBG_MSG, (pContext, SYS_DBG_MSG"DSL: IN - "
+      "DSL_DRV_MIB_ADSL_TableNextIndexGet"DSL_DRV_CRLF));
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   if ((pData->IntervalNumber < 0) ||
+       (pData->IntervalNumber > ADSL_MIB_TABLE_ROWS_MAX))
+   {
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   switch (pData->nTable)
+   {
+   case ADSL_ATUC_INTVL_TABLE:
+      nEpType = DSL_PM_COUNTER_LINE_SEC;
+      nDirection = DSL_FAR_END;
+      break;
+   case ADSL_ATUR_INTVL_TABLE:
+      nEpType = DSL_PM_COUNTER_LINE_SEC;
+      nDirection = DSL_NEAR_END;
+      break;
+   case ADSL_ATUC_CHAN_INTVL_TABLE:
+      nEpType = DSL_PM_COUNTER_CHANNEL;
+      nDirection = DSL_FAR_END;
+      break;
+   case ADSL_ATUR_CHAN_INTVL_TABLE:
+      nEpType = DSL_PM_COUNTER_CHANNEL;
+      nDirection = DSL_NEAR_END;
+      break;
+   default:
+      return DSL_ERR_INVALID_PARAMETER;
+   }
+
+   /* Tables which are not included in the current configuration*/
+   if (DSL_DRV_MIB_ADSL_TableFlagsAllGet(pData->nTable) == 0)
+   {
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   nErrCode = DSL_DRV_PM_History15MinNextGet(pContext, nEpType, nDirection,
+                 pData->bValidOnly, (DSL_uint32_t)pData->IntervalNumber, &nNext);
+
+   if (nErrCode >= DSL_SUCCESS)
+   {
+      pData->IntervalNumber = (nNext <= ADSL_MIB_TABLE_ROWS_MAX) ?
+         (DSL_int_t)nNext : 0;
+   }
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL: OUT - DSL_DRV_MIB_ADSL_TableNextIndexGet, "
+      "nReturn(%d)"DSL_DRV_CRLF, nErrCode));
+
+   return nErrCode;
+}
+#endif /* defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)*/
+
 #ifdef INCLUDE_DSL_G997_ALARM
 static DSL_Error_t DSL_DRV_MIB_ADSL_LineAlarmDataRateGet(
    DSL_Context_t *pContext,
@@ -3672,21 +4024,12 @@ DSL_Error_t DSL_DRV_MIB_IoctlHandle(
    DSL_Context_t *pContext,
    DSL_boolean_t bIsInKernel,
    DSL_uint_t nCommand,
-   DSL_uint32_t nArg)
+   DSL_ulong_t nArg)
 {
    DSL_Error_t nErrCode = DSL_ERROR;
-   DSL_IOCTL_MIB_arg_t *pIOCTL_arg = DSL_NULL;
    DSL_uint8_t xtseCfg[DSL_G997_NUM_XTSE_OCTETS] = {0};
    DSL_uint8_t xtseCurr[DSL_G997_NUM_XTSE_OCTETS] = {0};
 
-   pIOCTL_arg = (DSL_IOCTL_MIB_arg_t*)DSL_DRV_VMalloc(sizeof(DSL_IOCTL_MIB_arg_t));
-   if(pIOCTL_arg == DSL_NULL)
-   {
-      DSL_IoctlMemCpyTo( bIsInKernel, (DSL_void_t*)nArg, &nErrCode,
-         sizeof(DSL_Error_t));
-      return nErrCode;
-   }
-
    DSL_DEBUG(DSL_DBG_MSG, (DSL_NULL, SYS_DBG_MSG"DSL: DSL_DRV_MIB_IoctlHandle: Call %d - "
       "(%s)"DSL_DRV_CRLF, nCommand, DSL_DBG_ADSL_IoctlName(nCommand)));
 
@@ -3791,6 +4134,22 @@ DSL_Error_t DSL_DRV_MIB_IoctlHandle(
       break;
 #endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
 #endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   case DSL_FIO_MIB_ADSL_TABLE_GET:
+      nErrCode = DSL_DRV_MIB_ADSL_IoctlHandleHelperCall(pContext, bIsInKernel,
+         DSL_IOCTL_HELPER_GET,
+         (DSL_DRV_IoctlHandlerHelperFunc_t)DSL_DRV_MIB_ADSL_TableGet,
+         (DSL_void_t*) nArg, sizeof(adslMibTableBulk_t));
+      break;
+
+   case DSL_FIO_MIB_ADSL_TABLE_NEXT_INDEX_GET:
+      nErrCode = DSL_DRV_MIB_ADSL_IoctlHandleHelperCall(pContext, bIsInKernel,
+         DSL_IOCTL_HELPER_GET,
+         (DSL_DRV_IoctlHandlerHelperFunc_t)DSL_DRV_MIB_ADSL_TableNextIndexGet,
+         (DSL_void_t*) nArg, sizeof(adslMibTableNextIndex_t));
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
 #endif /* INCLUDE_DSL_PM*/
 
    case DSL_FIO_MIB_ADSL_LINE_ALARM_CONF_PROFILE_ENTRY_GET:
@@ -3934,8 +4293,6 @@ DSL_Error_t DSL_DRV_MIB_IoctlHandle(
       }
    }
 
-   DSL_DRV_VFree(pIOCTL_arg);
-
    DSL_DEBUG(DSL_DBG_MSG, (DSL_NULL, SYS_DBG_MSG"DSL_DRV_MIB_IoctlHandle - "
       "return(from %d - %s) %d"DSL_DRV_CRLF, nCommand, DSL_DBG_ADSL_IoctlName(nCommand),
       nErrCode));
@@ -3962,6 +4319,22 @@ DSL_Error_t DSL_DRV_MIB_ModuleInit(
    return nErrCode;
 }
 
+/**
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_mib.h'
+*/
+DSL_void_t DSL_DRV_MIB_ModuleCleanup(
+   DSL_Context_t *pContext)
+{
+#if defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)
+   if (pContext->MibAdslCtx.pRowCache != DSL_NULL)
+   {
+      DSL_DRV_VFree(pContext->MibAdslCtx.pRowCache);
+      pContext->MibAdslCtx.pRowCache = DSL_NULL;
+   }
+#endif /* defined(INCLUDE_DSL_PM) && defined(INCLUDE_DSL_CPE_PM_HISTORY)*/
+}
+
 /** @} DRV_DSL_CPE_ADSL_MIB */
 
 #ifdef __cplusplus
@@ -69,7 +69,7 @@ DSL_Error_t DSL_DRV_PM_ConfigSet(
    }
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -101,9 +101,17 @@ DSL_Error_t DSL_DRV_PM_ConfigSet(
          DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.nBasicUpdateCycle * DSL_PM_MSEC;
    }
 
+   /* Restart adaptive polling with the basic poll cycle*/
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.nBackoffFactor = 1;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.nBackoffFactor = 1;
+
    /* Unlock PM module Mutex*/
    DSL_DRV_MUTEX_UNLOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
 
+   /* Wake up PM threads, they might wait for an extended poll cycle*/
+   DSL_DRV_WAKEUP_EVENT(DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.pmEvent);
+   DSL_DRV_WAKEUP_EVENT(DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.pmEvent);
+
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_ConfigGet, retCode=%d"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
@@ -148,6 +156,92 @@ DSL_Error_t DSL_DRV_PM_ConfigGet(
 #endif /* INCLUDE_DSL_CONFIG_GET*/
 #endif /* INCLUDE_DSL_CPE_PM_CONFIG*/
 
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_StatisticsGet(
+   DSL_Context_t *pContext,
+   DSL_PM_Statistics_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t *pStat, *pOut, nVal, nOld, i;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_StatisticsGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
+
+   /* The statistics consist of 32 bit words only which are updated with
+      atomic operations. Each word is read and, on request, reset atomically
+      so no sample is lost by a concurrent update*/
+   pStat = (DSL_uint32_t*)&(DSL_DRV_PM_CONTEXT(pContext)->statistics);
+   pOut  = (DSL_uint32_t*)&(pData->data);
+
+   for (i = 0; i < sizeof(DSL_PM_StatisticsData_t) / sizeof(DSL_uint32_t); i++)
+   {
+      nVal = pStat[i];
+      if (pData->bReset)
+      {
+         while ((nOld = DSL_DRV_ATOMIC_CMPXCHG(&pStat[i], nVal, 0)) != nVal)
+         {
+            nVal = nOld;
+         }
+      }
+      pOut[i] = nVal;
+   }
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_StatisticsGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_GroupCountersGet(
+   DSL_Context_t *pContext,
+   DSL_PM_GroupCounters_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_DIRECTION(pData->nDirection);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_GroupCountersGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
+
+   nErrCode = DSL_DRV_PM_GroupCountersCopy(
+                 pContext, pData->nDirection, &(pData->data));
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_GroupCountersGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
@@ -196,6 +290,7 @@ DSL_Error_t DSL_DRV_PM_Start(
    if (DSL_DRV_PM_CONTEXT(pContext)->pCounters == DSL_NULL)
    {
       DSL_DRV_MemFree(pContext->PM);
+      pContext->PM = DSL_NULL;
 
       DSL_DEBUG(DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: PM_Start: no memory for PM counters!"
@@ -211,6 +306,7 @@ DSL_Error_t DSL_DRV_PM_Start(
    {
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCounters);
       DSL_DRV_MemFree(pContext->PM);
+      pContext->PM = DSL_NULL;
 
       DSL_DEBUG(DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: PM_Start: no memory for PM dump counters!"
@@ -219,6 +315,26 @@ DSL_Error_t DSL_DRV_PM_Start(
    }
    DSL_DRV_MemSet(DSL_DRV_PM_CONTEXT(pContext)->pCountersDump, 0x0, sizeof(DSL_PM_CountersDump_t));
 
+   /* Create published PM counters snapshots (both buffers in one block)*/
+   DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0] =
+      (DSL_PM_CountersData_t*)DSL_DRV_Malloc(2 * sizeof(DSL_PM_CountersData_t));
+   if (DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0] == DSL_NULL)
+   {
+      DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCounters);
+      DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersDump);
+      DSL_DRV_MemFree(pContext->PM);
+      pContext->PM = DSL_NULL;
+
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: PM_Start: no memory for published PM counters!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERROR;
+   }
+   DSL_DRV_MemSet(DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0], 0x0,
+      2 * sizeof(DSL_PM_CountersData_t));
+   DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[1] =
+      DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0] + 1;
+
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
    /* Set PM module line state information*/
    DSL_DRV_PM_CONTEXT(pContext)->nLineState     = DSL_LINESTATE_NOT_INITIALIZED;
@@ -234,6 +350,7 @@ DSL_Error_t DSL_DRV_PM_Start(
    DSL_DRV_MUTEX_INIT(DSL_DRV_PM_CONTEXT(pContext)->pmNeAccessMutex);
    /* init PM module Far-End access mutex */
    DSL_DRV_MUTEX_INIT(DSL_DRV_PM_CONTEXT(pContext)->pmFeAccessMutex);
+   /* init PM module statistics mutex */
 
    /* Enable PM Near-End polling*/
    DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.bNePollingOff = DSL_FALSE;
@@ -245,6 +362,8 @@ DSL_Error_t DSL_DRV_PM_Start(
    DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.nFeUpdateCycleFactor = 3;
    /* Set default FE L2 poll cycle factor (applies to L2 mode)*/
    DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.nFeUpdateCycleFactorL2 = 10;
+   /* Use fixed poll cycles by default*/
+   DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.bAdaptivePollingOn = DSL_FALSE;
 
    /* Set Current FE polling Factor*/
    DSL_DRV_PM_CONTEXT(pContext)->nFeRequestCycle =
@@ -510,7 +629,9 @@ DSL_Error_t DSL_DRV_PM_Start(
    {
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCounters);
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersDump);
+      DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0]);
       DSL_DRV_MemFree(pContext->PM);
+      pContext->PM = DSL_NULL;
 
       DSL_DEBUG(DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM module device specific init failed!"
@@ -518,39 +639,52 @@ DSL_Error_t DSL_DRV_PM_Start(
       return DSL_ERROR;
    }
 
+   /* Publish initial counters for the readers*/
+   DSL_DRV_PM_CountersPublish(pContext);
+
    DSL_DRV_PM_CONTEXT(pContext)->bInit = DSL_TRUE;
 
    /*
       Init PM module threads
    */
-   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.bRun = DSL_FALSE;
+   /* The run flag is set here and not by the thread, the thread might not be
+      scheduled before the check below or before a stop request*/
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.bRun = DSL_TRUE;
    DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.nThreadPollTime =
       DSL_DRV_PM_CONTEXT(pContext)->nPmTick;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.nBackoffFactor = 1;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.nActivitySignature = 0;
    DSL_DRV_INIT_EVENT("pmev_ne", DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.pmEvent);
 
    /* Start PM module Near-End thread*/
    nErrCode = (DSL_Error_t)DSL_DRV_THREAD(&DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.Control,
-                 "pmex_ne", DSL_DRV_PM_ThreadNe, (DSL_uint32_t)pContext);
+                 "pmex_ne", DSL_DRV_PM_ThreadNe, (DSL_ulong_t)pContext);
 
    if( nErrCode != DSL_SUCCESS )
    {
+      DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.bRun = DSL_FALSE;
+
       DSL_DEBUG(DSL_DBG_MSG,
          (pContext, SYS_DBG_MSG"DSL[%02d]: ERROR - PM module NE thread start failed, retCode(%d)!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
    }
 
-   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.bRun = DSL_FALSE;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.bRun = DSL_TRUE;
    DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.nThreadPollTime =
       DSL_DRV_PM_CONTEXT(pContext)->nPmTick *
       DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.nFeUpdateCycleFactor;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.nBackoffFactor = 1;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.nActivitySignature = 0;
    DSL_DRV_INIT_EVENT("pmev_fe", DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.pmEvent);
 
    /* Start PM module Far-End thread*/
    nErrCode = (DSL_Error_t)DSL_DRV_THREAD(&DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.Control,
-                 "pmex_fe", DSL_DRV_PM_ThreadFe, (DSL_uint32_t)pContext);
+                 "pmex_fe", DSL_DRV_PM_ThreadFe, (DSL_ulong_t)pContext);
 
    if( nErrCode != DSL_SUCCESS )
    {
+      DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.bRun = DSL_FALSE;
+
       DSL_DEBUG(DSL_DBG_MSG,
          (pContext, SYS_DBG_MSG"DSL[%02d]: ERROR - PM module FE thread start failed, retCode(%d)!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
@@ -566,7 +700,11 @@ DSL_Error_t DSL_DRV_PM_Start(
 
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCounters);
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersDump);
+      DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0]);
       DSL_DRV_MemFree(pContext->PM);
+      pContext->PM = DSL_NULL;
+
+      return DSL_ERROR;
    }
 
    DSL_DEBUG(DSL_DBG_MSG,
@@ -628,7 +766,7 @@ DSL_Error_t DSL_DRV_PM_Stop(
       DSL_DRV_WAIT_COMPLETION(&DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.Control);
 
       DSL_DEBUG(DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: PM Far-End thread has stopped... (%lu)"
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM Far-End thread has stopped... (%u)"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
    }
 
@@ -648,10 +786,13 @@ DSL_Error_t DSL_DRV_PM_Stop(
       DSL_DRV_WAIT_COMPLETION(&DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.Control);
 
       DSL_DEBUG(DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: PM Near-End thread has stopped... (%lu)"
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM Near-End thread has stopped... (%u)"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
    }
 
+   /* Remove the line counters from the bonding group counters*/
+   DSL_DRV_PM_GroupLeave(pContext);
+
    if (DSL_DRV_PM_CONTEXT(pContext)->pCounters != DSL_NULL)
    {
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCounters);
@@ -662,11 +803,17 @@ DSL_Error_t DSL_DRV_PM_Stop(
       DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersDump);
    }
 
+   if (DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0] != DSL_NULL)
+   {
+      DSL_DRV_MemFree(DSL_DRV_PM_CONTEXT(pContext)->pCountersPub[0]);
+   }
+
    /* Free PM Module resources*/
    DSL_DRV_MemFree(pContext->PM);
+   pContext->PM = DSL_NULL;
 
    DSL_DEBUG(DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: PM module has stopped... (%lu)"
+      (pContext, SYS_DBG_MSG"DSL[%02d]: PM module has stopped... (%u)"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext), DSL_DRV_TimeMSecGet()));
 
    return nErrCode;
@@ -812,7 +959,7 @@ DSL_Error_t DSL_DRV_PM_15MinElapsedExtTrigger(
    }
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -889,7 +1036,7 @@ DSL_Error_t DSL_DRV_PM_ElapsedTimeReset(
    }
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -958,7 +1105,7 @@ DSL_Error_t DSL_DRV_PM_SyncModeSet(
    }
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -1031,7 +1178,7 @@ DSL_Error_t DSL_DRV_PM_SyncModeGet(
 
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -1098,7 +1245,7 @@ DSL_Error_t DSL_DRV_PM_BurninModeSet(
    }
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_MSG"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -1158,8 +1305,6 @@ DSL_Error_t DSL_DRV_PM_ChannelHistoryStats15MinGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -1177,65 +1322,10 @@ DSL_Error_t DSL_DRV_PM_ChannelHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -1258,8 +1348,6 @@ DSL_Error_t DSL_DRV_PM_ChannelHistoryStats1DayGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -1277,65 +1365,10 @@ DSL_Error_t DSL_DRV_PM_ChannelHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -1893,13 +1926,15 @@ DSL_Error_t DSL_DRV_PM_ChannelThresholds1DayGet(
 
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+   Reads the counters of DSL_DRV_PM_ChannelCountersShowtimeGet
+   from the published counters snapshot pPub.
 */
-DSL_Error_t DSL_DRV_PM_ChannelCountersShowtimeGet(
+static DSL_Error_t DSL_DRV_PM_ChannelCountersShowtimeRead(
    DSL_Context_t *pContext,
-   DSL_PM_ChannelCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_ChannelCounters_t *pCounters = (DSL_PM_ChannelCounters_t*)pArg;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -1907,165 +1942,97 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersShowtimeGet(
    DSL_pmBF_IntervalFailures_t nCurrFailures;
    DSL_PM_ChannelData_t *pChCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ChannelCountersShowtimeGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ChannelData_t));
-
-   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
-   {
-      DSL_DEBUG(DSL_DBG_WRN,
-         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      pCounters->interval.bValid       = DSL_FALSE;
-      pCounters->interval.nElapsedTime = 0;
-      pCounters->interval.nNumber      = 0;
-
-      return DSL_WRN_PM_NO_SHOWTIME_DATA;
-   }
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
 
    /* Clear the output structure*/
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ChannelData_t));
    pCounters->interval.nElapsedTime = 0;
    pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
    pCounters->interval.bValid = DSL_TRUE;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME()), &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get History Item Index*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->channelCounters.nShowtimeTimeHist[histIdx];
+
+      pChCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_COUNTERS_SHOWTIME(histIdx,pCounters->nChannel,pCounters->nDirection));
+
+      if (pChCounters != DSL_NULL)
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
+         pCounters->data.nFEC            += pChCounters->nFEC;
+         pCounters->data.nCodeViolations += pChCounters->nCodeViolations;
       }
-
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+      else
       {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            break;
-         }
-
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.nShowtimeTimeHist[histIdx];
-
-         pChCounters =
-            DSL_DRV_PM_PTR_CHANNEL_COUNTERS_SHOWTIME(histIdx,pCounters->nChannel,pCounters->nDirection);
-
-         if (pChCounters != DSL_NULL)
-         {
-            pCounters->data.nFEC            += pChCounters->nFEC;
-            pCounters->data.nCodeViolations += pChCounters->nCodeViolations;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERR_INTERNAL;
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-            break;
-         }
+         nErrCode = DSL_ERR_INTERNAL;
 
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->channelCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
+         break;
       }
 
-      break;
-   }
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
-
-   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
-   {
-      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+      pCounters->interval.bValid  &= (
+         ((pPub->channelCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
    }
 
-   DSL_DEBUG( DSL_DBG_MSG, (pContext,
-      SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_ChannelCountersShowtimeGet, retCode=%d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
-
    return nErrCode;
 }
 
-
-#if defined (INCLUDE_DSL_CPE_PM_CHANNEL_EXT_COUNTERS)
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
 */
-DSL_Error_t DSL_DRV_PM_ChannelCountersExtShowtimeGet(
+DSL_Error_t DSL_DRV_PM_ChannelCountersShowtimeGet(
    DSL_Context_t *pContext,
-   DSL_PM_ChannelCountersExt_t *pCounters)
+   DSL_PM_ChannelCounters_t *pCounters)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
-   DSL_int_t histIdx = -1;
-   DSL_uint32_t histFillLevel = 0, histInv = 0;
-   DSL_pmBF_IntervalFailures_t nCurrFailures;
-   DSL_PM_ChannelDataExt_t *pChCounters;
 
    DSL_CHECK_POINTER(pContext, pCounters);
    DSL_CHECK_ERR_CODE();
@@ -2077,7 +2044,7 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersExtShowtimeGet(
    DSL_CHECK_ERR_CODE();
 
    DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ChannelCountersExtShowtimeGet"
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ChannelCountersShowtimeGet"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
    /* Check if the PM module is ready*/
@@ -2086,12 +2053,7 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersExtShowtimeGet(
       return DSL_ERROR;
    }
 
-   /* Get Interval Failures mask*/
-   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
-      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
-      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
-
-   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ChannelDataExt_t));
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ChannelData_t));
 
    if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
    {
@@ -2106,97 +2068,167 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersExtShowtimeGet(
       return DSL_WRN_PM_NO_SHOWTIME_DATA;
    }
 
-   /* Clear the output structure*/
-   pCounters->interval.nElapsedTime = 0;
-   pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-   pCounters->interval.bValid = DSL_TRUE;
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_ChannelCountersShowtimeRead, pCounters);
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
+   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   {
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+   }
+
+   DSL_DEBUG( DSL_DBG_MSG, (pContext,
+      SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_ChannelCountersShowtimeGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+
+#if defined (INCLUDE_DSL_CPE_PM_CHANNEL_EXT_COUNTERS)
+/*
+   Reads the counters of DSL_DRV_PM_ChannelCountersExtShowtimeGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_ChannelCountersExtShowtimeRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
+{
+   DSL_PM_ChannelCountersExt_t *pCounters = (DSL_PM_ChannelCountersExt_t*)pArg;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
+   DSL_int_t histIdx = -1;
+   DSL_uint32_t histFillLevel = 0, histInv = 0;
+   DSL_pmBF_IntervalFailures_t nCurrFailures;
+   DSL_PM_ChannelDataExt_t *pChCounters;
+
+   /* Get Interval Failures mask*/
+   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
+
+   /* Clear the output structure*/
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ChannelDataExt_t));
+   pCounters->interval.nElapsedTime = 0;
+   pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+   pCounters->interval.bValid = DSL_TRUE;
+
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME()), &histFillLevel);
+
+   if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get History Item Index*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->channelCounters.nShowtimeTimeHist[histIdx];
+
+      pChCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_COUNTERS_SHOWTIME_EXT(histIdx,pCounters->nChannel));
+
+      if (pChCounters != DSL_NULL)
+      {
+         pCounters->data.nSuperFrame     += pChCounters->nSuperFrame;
+      }
+      else
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         nErrCode = DSL_ERR_INTERNAL;
+
          break;
       }
 
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      pCounters->interval.bValid  &= (
+         ((pPub->channelCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
+   }
 
-            break;
-         }
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_ChannelCountersExtShowtimeGet(
+   DSL_Context_t *pContext,
+   DSL_PM_ChannelCountersExt_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.nShowtimeTimeHist[histIdx];
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         pChCounters =
-            DSL_DRV_PM_PTR_CHANNEL_COUNTERS_SHOWTIME_EXT(histIdx,pCounters->nChannel);
+   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
+   DSL_CHECK_ERR_CODE();
 
-         if (pChCounters != DSL_NULL)
-         {
-            pCounters->data.nSuperFrame     += pChCounters->nSuperFrame;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-            nErrCode = DSL_ERR_INTERNAL;
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ChannelCountersExtShowtimeGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-            break;
-         }
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
 
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->channelCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ChannelDataExt_t));
 
-      break;
+   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      pCounters->interval.bValid       = DSL_FALSE;
+      pCounters->interval.nElapsedTime = 0;
+      pCounters->interval.nNumber      = 0;
+
+      return DSL_WRN_PM_NO_SHOWTIME_DATA;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_ChannelCountersExtShowtimeRead, pCounters);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -2228,8 +2260,6 @@ DSL_Error_t DSL_DRV_PM_DataPathHistoryStats15MinGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -2247,65 +2277,10 @@ DSL_Error_t DSL_DRV_PM_DataPathHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_15MIN(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_15MIN(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n15minInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_DATAPATH_HISTORY_15MIN(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n15minInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -2328,8 +2303,6 @@ DSL_Error_t DSL_DRV_PM_DataPathHistoryStats1DayGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -2344,65 +2317,10 @@ DSL_Error_t DSL_DRV_PM_DataPathHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_1DAY(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_1DAY(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n1dayInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_DATAPATH_HISTORY_1DAY(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n1dayInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -2897,13 +2815,15 @@ DSL_Error_t DSL_DRV_PM_DataPathThresholds1DayGet(
 
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+   Reads the counters of DSL_DRV_PM_DataPathCountersShowtimeGet
+   from the published counters snapshot pPub.
 */
-DSL_Error_t DSL_DRV_PM_DataPathCountersShowtimeGet(
+static DSL_Error_t DSL_DRV_PM_DataPathCountersShowtimeRead(
    DSL_Context_t *pContext,
-   DSL_PM_DataPathCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_DataPathCounters_t *pCounters = (DSL_PM_DataPathCounters_t*)pArg;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -2911,145 +2831,142 @@ DSL_Error_t DSL_DRV_PM_DataPathCountersShowtimeGet(
    DSL_pmBF_IntervalFailures_t nCurrFailures;
    DSL_PM_DataPathData_t *pDpCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_DataPathCounters15MinGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_DataPathData_t));
-
-   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
-   {
-      DSL_DEBUG(DSL_DBG_WRN,
-         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      pCounters->interval.bValid       = DSL_FALSE;
-      pCounters->interval.nElapsedTime = 0;
-      pCounters->interval.nNumber      = 0;
-
-      return DSL_WRN_PM_NO_SHOWTIME_DATA;
-   }
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
 
    /* Clear the output structure*/
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_DataPathData_t));
    pCounters->interval.nElapsedTime = 0;
    pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
    pCounters->interval.bValid = DSL_TRUE;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_HISTORY_SHOWTIME()), &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get history item index for the specified interval*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->dataPathCounters.nShowtimeTimeHist[histIdx];
+
+      pDpCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_COUNTERS_SHOWTIME(histIdx,pCounters->nChannel,pCounters->nDirection));
+
+      if( pDpCounters != DSL_NULL )
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
+         pCounters->data.nCRC_P            += pDpCounters->nCRC_P;
+         pCounters->data.nCRCP_P           += pDpCounters->nCRCP_P;
+         pCounters->data.nCV_P             += pDpCounters->nCV_P;
+         pCounters->data.nCVP_P            += pDpCounters->nCVP_P;
+         pCounters->data.nHEC              += pDpCounters->nHEC;
+         pCounters->data.nIBE              += pDpCounters->nIBE;
+         pCounters->data.nTotalCells       += pDpCounters->nTotalCells;
+         pCounters->data.nUserTotalCells   += pDpCounters->nUserTotalCells;
+         pCounters->data.nTxUserTotalCells += pDpCounters->nTxUserTotalCells;
+         pCounters->data.nTxIBE            += pDpCounters->nTxIBE;
       }
-
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+      else
       {
-         /* Get history item index for the specified interval*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-            break;
-         }
+         nErrCode = DSL_ERR_INTERNAL;
 
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.nShowtimeTimeHist[histIdx];
+         break;
+      }
 
-         pDpCounters =
-            DSL_DRV_PM_PTR_DATAPATH_COUNTERS_SHOWTIME(histIdx,pCounters->nChannel,pCounters->nDirection);
+      pCounters->interval.bValid  &= (
+         ((pPub->dataPathCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
+   }
 
-         if( pDpCounters != DSL_NULL )
-         {
-            pCounters->data.nCRC_P            += pDpCounters->nCRC_P;
-            pCounters->data.nCRCP_P           += pDpCounters->nCRCP_P;
-            pCounters->data.nCV_P             += pDpCounters->nCV_P;
-            pCounters->data.nCVP_P            += pDpCounters->nCVP_P;
-            pCounters->data.nHEC              += pDpCounters->nHEC;
-            pCounters->data.nIBE              += pDpCounters->nIBE;
-            pCounters->data.nTotalCells       += pDpCounters->nTotalCells;
-            pCounters->data.nUserTotalCells   += pDpCounters->nUserTotalCells;
-            pCounters->data.nTxUserTotalCells += pDpCounters->nTxUserTotalCells;
-            pCounters->data.nTxIBE            += pDpCounters->nTxIBE;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   return nErrCode;
+}
 
-            nErrCode = DSL_ERR_INTERNAL;
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_DataPathCountersShowtimeGet(
+   DSL_Context_t *pContext,
+   DSL_PM_DataPathCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-            break;
-         }
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->dataPathCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
+   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
+   DSL_CHECK_ERR_CODE();
 
-      break;
-   }
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_DataPathCounters15MinGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
+
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_DataPathData_t));
+
+   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      pCounters->interval.bValid       = DSL_FALSE;
+      pCounters->interval.nElapsedTime = 0;
+      pCounters->interval.nNumber      = 0;
+
+      return DSL_WRN_PM_NO_SHOWTIME_DATA;
+   }
+
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_DataPathCountersShowtimeRead, pCounters);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -3098,8 +3015,6 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureHistoryStats15MinGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -3117,65 +3032,10 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_15MIN(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_15MIN(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n15minInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_15MIN(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n15minInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -3198,8 +3058,6 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureHistoryStats1DayGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -3214,65 +3072,10 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_1DAY(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_1DAY(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n1dayInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_1DAY(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n1dayInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -3402,13 +3205,15 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureCountersTotalGet(
 
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+   Reads the counters of DSL_DRV_PM_DataPathFailureCountersShowtimeGet
+   from the published counters snapshot pPub.
 */
-DSL_Error_t DSL_DRV_PM_DataPathFailureCountersShowtimeGet(
+static DSL_Error_t DSL_DRV_PM_DataPathFailureCountersShowtimeRead(
    DSL_Context_t *pContext,
-   DSL_PM_DataPathFailureCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_DataPathFailureCounters_t *pCounters = (DSL_PM_DataPathFailureCounters_t*)pArg;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -3416,137 +3221,134 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureCountersShowtimeGet(
    DSL_pmBF_IntervalFailures_t nCurrFailures;
    DSL_PM_DataPathFailureData_t *pDpCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_DataPathFailureCountersShowtimeGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_DataPathFailureData_t));
-
-   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
-   {
-      DSL_DEBUG(DSL_DBG_WRN,
-         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      pCounters->interval.bValid       = DSL_FALSE;
-      pCounters->interval.nElapsedTime = 0;
-      pCounters->interval.nNumber      = 0;
-
-      return DSL_WRN_PM_NO_SHOWTIME_DATA;
-   }
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
 
    /* Clear the output structure*/
+   DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_DataPathFailureData_t));
    pCounters->interval.nElapsedTime = 0;
    pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
    pCounters->interval.bValid = DSL_TRUE;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_SHOWTIME()), &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get history item index for the specified interval*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->dataPathFailureCounters.nShowtimeTimeHist[histIdx];
+
+      pDpCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_COUNTERS_SHOWTIME(histIdx,pCounters->nChannel,pCounters->nDirection));
+
+      if( pDpCounters != DSL_NULL )
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
+         pCounters->data.nNCD += pDpCounters->nNCD;
+         pCounters->data.nLCD += pDpCounters->nLCD;
+      }
+      else
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         nErrCode = DSL_ERR_INTERNAL;
+
          break;
       }
 
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
-      {
-         /* Get history item index for the specified interval*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      pCounters->interval.bValid  &= (
+         ((pPub->dataPathFailureCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
+   }
 
-            break;
-         }
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_DataPathFailureCountersShowtimeGet(
+   DSL_Context_t *pContext,
+   DSL_PM_DataPathFailureCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.nShowtimeTimeHist[histIdx];
+   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
+   DSL_CHECK_ERR_CODE();
 
-         pDpCounters =
-            DSL_DRV_PM_PTR_DATAPATH_FAILURE_COUNTERS_SHOWTIME(histIdx,pCounters->nChannel,pCounters->nDirection);
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-         if( pDpCounters != DSL_NULL )
-         {
-            pCounters->data.nNCD += pDpCounters->nNCD;
-            pCounters->data.nLCD += pDpCounters->nLCD;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_DataPathFailureCountersShowtimeGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-            nErrCode = DSL_ERR_INTERNAL;
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
 
-            break;
-         }
+   DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_DataPathFailureData_t));
 
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->dataPathFailureCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
+   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      break;
+      pCounters->interval.bValid       = DSL_FALSE;
+      pCounters->interval.nElapsedTime = 0;
+      pCounters->interval.nNumber      = 0;
+
+      return DSL_WRN_PM_NO_SHOWTIME_DATA;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_DataPathFailureCountersShowtimeRead, pCounters);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -3578,8 +3380,6 @@ DSL_Error_t DSL_DRV_PM_LineSecHistoryStats15MinGet(
    DSL_PM_HistoryStatsDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -3597,65 +3397,10 @@ DSL_Error_t DSL_DRV_PM_LineSecHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n15minInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n15minInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -3678,8 +3423,6 @@ DSL_Error_t DSL_DRV_PM_LineSecHistoryStats1DayGet(
    DSL_PM_HistoryStatsDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -3697,65 +3440,10 @@ DSL_Error_t DSL_DRV_PM_LineSecHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_1DAY(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_1DAY(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n1dayInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_LINE_SEC_HISTORY_1DAY(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n1dayInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -4188,13 +3876,15 @@ DSL_Error_t DSL_DRV_PM_LineSecCountersTotalGet(
 
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+   Reads the counters of DSL_DRV_PM_LineSecCountersShowtimeGet
+   from the published counters snapshot pPub.
 */
-DSL_Error_t DSL_DRV_PM_LineSecCountersShowtimeGet(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_PM_LineSecCounters_t *pCounters)
+static DSL_Error_t DSL_DRV_PM_LineSecCountersShowtimeRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_LineSecCounters_t *pCounters = (DSL_PM_LineSecCounters_t*)pArg;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -4202,138 +3892,135 @@ DSL_Error_t DSL_DRV_PM_LineSecCountersShowtimeGet(
    DSL_pmBF_IntervalFailures_t nCurrFailures;
    DSL_PM_LineSecData_t *pLineCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_LineSecCountersShowtimeGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_LineSecData_t));
-
-   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
-   {
-      DSL_DEBUG(DSL_DBG_WRN,
-         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      pCounters->interval.bValid       = DSL_FALSE;
-      pCounters->interval.nElapsedTime = 0;
-      pCounters->interval.nNumber      = 0;
-
-      return DSL_WRN_PM_NO_SHOWTIME_DATA;
-   }
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
 
    /* Clear the output structure*/
+   DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_LineSecData_t));
    pCounters->interval.nElapsedTime = 0;
    pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
    pCounters->interval.bValid = DSL_TRUE;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   /* Get history fill level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_SHOWTIME()), &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get history fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get history item index*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->lineSecCounters.nShowtimeTimeHist[histIdx];
+
+      pLineCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_SHOWTIME(histIdx, pCounters->nDirection));
+
+      if( pLineCounters != DSL_NULL )
+      {
+         pCounters->data.nES   += pLineCounters->nES;
+         pCounters->data.nLOFS += pLineCounters->nLOFS;
+         pCounters->data.nLOSS += pLineCounters->nLOSS;
+         pCounters->data.nSES  += pLineCounters->nSES;
+         pCounters->data.nUAS  += pLineCounters->nUAS;
+         pCounters->data.nFECS += pLineCounters->nFECS;
+      }
+      else
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         nErrCode = DSL_ERR_INTERNAL;
+
          break;
       }
 
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
-      {
-         /* Get history item index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      pCounters->interval.bValid  &= (
+         ((pPub->lineSecCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
+   }
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_LineSecCountersShowtimeGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_PM_LineSecCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-            break;
-         }
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.nShowtimeTimeHist[histIdx];
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-         pLineCounters =
-            DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_SHOWTIME(histIdx, pCounters->nDirection);
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_LineSecCountersShowtimeGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         if( pLineCounters != DSL_NULL )
-         {
-            pCounters->data.nES   += pLineCounters->nES;
-            pCounters->data.nLOFS += pLineCounters->nLOFS;
-            pCounters->data.nLOSS += pLineCounters->nLOSS;
-            pCounters->data.nSES  += pLineCounters->nSES;
-            pCounters->data.nUAS  += pLineCounters->nUAS;
-            pCounters->data.nFECS += pLineCounters->nFECS;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
 
-            nErrCode = DSL_ERR_INTERNAL;
+   DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_LineSecData_t));
 
-            break;
-         }
+   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->lineSecCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
+      pCounters->interval.bValid       = DSL_FALSE;
+      pCounters->interval.nElapsedTime = 0;
+      pCounters->interval.nNumber      = 0;
 
-      break;
+      return DSL_WRN_PM_NO_SHOWTIME_DATA;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_LineSecCountersShowtimeRead, pCounters);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -4367,6 +4054,8 @@ DSL_Error_t DSL_DRV_PM_LineInitHistoryStats15MinGet(
    DSL_PM_HistoryStats_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_CountersData_t *pPub = DSL_NULL;
+   DSL_uint32_t nPubSeq = 0;
    DSL_uint32_t histFillLevel = 0;
 
    DSL_CHECK_POINTER(pContext, pStats);
@@ -4382,8 +4071,13 @@ DSL_Error_t DSL_DRV_PM_LineInitHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-      pContext, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_15MIN(), &histFillLevel);
+   /* Get the last published PM counters, the single history field read
+      needs no consistency check*/
+   pPub = DSL_DRV_PM_PublishedCountersGet(pContext, &nPubSeq);
+
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+      pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_15MIN()),
+      &histFillLevel);
 
    if( nErrCode != DSL_SUCCESS )
    {
@@ -4414,6 +4108,8 @@ DSL_Error_t DSL_DRV_PM_LineInitHistoryStats1DayGet(
    DSL_PM_HistoryStats_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_CountersData_t *pPub = DSL_NULL;
+   DSL_uint32_t nPubSeq = 0;
    DSL_uint32_t histFillLevel = 0;
 
    DSL_CHECK_POINTER(pContext, pStats);
@@ -4429,8 +4125,13 @@ DSL_Error_t DSL_DRV_PM_LineInitHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-      pContext, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_1DAY(), &histFillLevel);
+   /* Get the last published PM counters, the single history field read
+      needs no consistency check*/
+   pPub = DSL_DRV_PM_PublishedCountersGet(pContext, &nPubSeq);
+
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+      pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_1DAY()),
+      &histFillLevel);
 
    if( nErrCode != DSL_SUCCESS )
    {
@@ -4832,136 +4533,133 @@ DSL_Error_t DSL_DRV_PM_LineInitCountersTotalGet(
 
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+   Reads the counters of DSL_DRV_PM_LineInitCountersShowtimeGet
+   from the published counters snapshot pPub.
 */
-DSL_Error_t DSL_DRV_PM_LineInitCountersShowtimeGet(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_IN_OUT DSL_PM_LineInitCounters_t *pCounters)
+static DSL_Error_t DSL_DRV_PM_LineInitCountersShowtimeRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_LineInitCounters_t *pCounters = (DSL_PM_LineInitCounters_t*)pArg;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_int_t histIdx = -1;
    DSL_uint32_t histFillLevel = 0, histInv = 0;
    DSL_PM_LineInitData_t *pLineCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_LineInitCounters15MinGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Clear the output structure*/
    pCounters->interval.nElapsedTime = 0;
    pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
    pCounters->interval.bValid = DSL_TRUE;
    DSL_DRV_MemSet(&(pCounters->data), 0x0, sizeof(DSL_PM_LineInitData_t));
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
+   /* Get history fill level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_SHOWTIME()), &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get history fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      pCounters->interval.bValid       = DSL_FALSE;
+      pCounters->interval.nElapsedTime = 0;
+      pCounters->interval.nNumber      = 0;
+
+      nErrCode = DSL_WRN_PM_NO_SHOWTIME_DATA;
+      return nErrCode;
+   }
+
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get history item index*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->lineInitCounters.nShowtimeTimeHist[histIdx];
+
+      pLineCounters = DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_COUNTERS_SHOWTIME(histIdx));
+
+      if( pLineCounters != DSL_NULL )
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
+         pCounters->data.nFullInits        += pLineCounters->nFullInits;
+         pCounters->data.nFailedFullInits  += pLineCounters->nFailedFullInits;
+         pCounters->data.nShortInits       += pLineCounters->nShortInits;
+         pCounters->data.nFailedShortInits += pLineCounters->nFailedShortInits;
       }
-
-      if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+      else
       {
-         DSL_DEBUG(DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         pCounters->interval.bValid       = DSL_FALSE;
-         pCounters->interval.nElapsedTime = 0;
-         pCounters->interval.nNumber      = 0;
+         nErrCode = DSL_ERR_INTERNAL;
 
-         nErrCode = DSL_WRN_PM_NO_SHOWTIME_DATA;
          break;
       }
 
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
-      {
-         /* Get history item index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            break;
-         }
-
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineInitCounters.nShowtimeTimeHist[histIdx];
-
-         pLineCounters = DSL_DRV_PM_PTR_LINE_INIT_COUNTERS_SHOWTIME(histIdx);
+      pCounters->interval.bValid  &= (
+         (pPub->lineInitCounters.nShowtimeInvalidHist[histIdx] &
+            DSL_PM_INTERVAL_FAILURE_NOT_COMPLETE) == 0 ? DSL_TRUE : DSL_FALSE);
+   }
 
-         if( pLineCounters != DSL_NULL )
-         {
-            pCounters->data.nFullInits        += pLineCounters->nFullInits;
-            pCounters->data.nFailedFullInits  += pLineCounters->nFailedFullInits;
-            pCounters->data.nShortInits       += pLineCounters->nShortInits;
-            pCounters->data.nFailedShortInits += pLineCounters->nFailedShortInits;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   return nErrCode;
+}
 
-            nErrCode = DSL_ERR_INTERNAL;
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_LineInitCountersShowtimeGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_IN_OUT DSL_PM_LineInitCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-            break;
-         }
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         pCounters->interval.bValid  &= (
-            (DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->lineInitCounters.nShowtimeInvalidHist[histIdx] &
-               DSL_PM_INTERVAL_FAILURE_NOT_COMPLETE) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_LineInitCounters15MinGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      break;
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_LineInitCountersShowtimeRead, pCounters);
 
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_LineInitCountersShowtimeGet, retCode=%d"
@@ -4987,8 +4685,6 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeHistoryStats15MinGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -5006,65 +4702,10 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_15MIN(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_15MIN(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n15minInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_15MIN(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n15minInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -5087,8 +4728,6 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeHistoryStats1DayGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -5103,65 +4742,10 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_1DAY(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_1DAY(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n1dayInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_1DAY(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n1dayInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -5266,30 +4850,131 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersTotalGet(
    /* Fill Total Counters elapsed time*/
    pCounters->total.nElapsedTime = DSL_DRV_PM_CONTEXT(pContext)->nPmTotalElapsedTime/DSL_PM_MSEC;
 
-   pLfCounters = DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_TOTAL(pCounters->nDirection);
+   pLfCounters = DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_TOTAL(pCounters->nDirection);
+
+   /* Get Total Data Path Counters data*/
+   nErrCode = DSL_DRV_PM_InternalCountersGet(
+              pContext, (DSL_void_t*)&(pCounters->data), (DSL_void_t*)pLfCounters,
+              sizeof(DSL_PM_LineEventShowtimeData_t), pCounters->nDirection);
+
+   pCounters->total.bValid = nErrCode == DSL_SUCCESS ? DSL_TRUE : DSL_FALSE;
+
+   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   {
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+   }
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_LineEventShowtimeCountersTotalGet, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+#endif /* INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
+/*
+   Reads the counters of DSL_DRV_PM_LineEventShowtimeCountersShowtimeGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersShowtimeRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
+{
+   DSL_PM_LineEventShowtimeCounters_t *pCounters = (DSL_PM_LineEventShowtimeCounters_t*)pArg;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
+   DSL_int_t histIdx = -1;
+   DSL_uint32_t histFillLevel = 0, histInv = 0;
+   DSL_pmBF_IntervalFailures_t nCurrFailures;
+   DSL_PM_LineEventShowtimeData_t *pLfCounters;
+
+   /* Get Interval Failures mask*/
+   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
+
+   /* Clear the output structure*/
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_LineEventShowtimeData_t));
+   pCounters->interval.nElapsedTime = 0;
+   pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+   pCounters->interval.bValid = DSL_TRUE;
+
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_SHOWTIME()), &histFillLevel);
+
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
+   }
+
+   if( pCounters->nHistoryInterval > histFillLevel )
+   {
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
+
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get history item index for the specified interval*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         break;
+      }
+
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->lineEventShowtimeCounters.nShowtimeTimeHist[histIdx];
+
+      pLfCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_SHOWTIME(histIdx, pCounters->nDirection));
+
+      if( pLfCounters != DSL_NULL )
+      {
+         pCounters->data.nLOF += pLfCounters->nLOF;
+         pCounters->data.nLOS += pLfCounters->nLOS;
+         pCounters->data.nLPR += pLfCounters->nLPR;
+         pCounters->data.nLOM += pLfCounters->nLOM;
+      }
+      else
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-   /* Get Total Data Path Counters data*/
-   nErrCode = DSL_DRV_PM_InternalCountersGet(
-              pContext, (DSL_void_t*)&(pCounters->data), (DSL_void_t*)pLfCounters,
-              sizeof(DSL_PM_LineEventShowtimeData_t), pCounters->nDirection);
+         nErrCode = DSL_ERR_INTERNAL;
 
-   pCounters->total.bValid = nErrCode == DSL_SUCCESS ? DSL_TRUE : DSL_FALSE;
+         break;
+      }
 
-   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
-   {
-      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+      pCounters->interval.bValid  &= (
+         ((pPub->lineEventShowtimeCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
    }
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_LineEventShowtimeCountersTotalGet, retCode=%d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
-
    return nErrCode;
 }
 
-#endif /* INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS*/
-
-#ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
@@ -5299,11 +4984,6 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersShowtimeGet(
    DSL_PM_LineEventShowtimeCounters_t *pCounters)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
-   DSL_int_t histIdx = -1;
-   DSL_uint32_t histFillLevel = 0, histInv = 0;
-   DSL_pmBF_IntervalFailures_t nCurrFailures;
-   DSL_PM_LineEventShowtimeData_t *pLfCounters;
 
    DSL_CHECK_POINTER(pContext, pCounters);
    DSL_CHECK_ERR_CODE();
@@ -5321,11 +5001,6 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersShowtimeGet(
       return DSL_ERROR;
    }
 
-   /* Get Interval Failures mask*/
-   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
-      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
-      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
-
    DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_LineEventShowtimeData_t));
 
    if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
@@ -5341,100 +5016,8 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersShowtimeGet(
       return DSL_WRN_PM_NO_SHOWTIME_DATA;
    }
 
-   /* Clear the output structure*/
-   pCounters->interval.nElapsedTime = 0;
-   pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-   pCounters->interval.bValid = DSL_TRUE;
-
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
-   {
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_SHOWTIME(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
-      }
-
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
-      {
-         /* Get history item index for the specified interval*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            break;
-         }
-
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.nShowtimeTimeHist[histIdx];
-
-         pLfCounters =
-            DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_SHOWTIME(histIdx, pCounters->nDirection);
-
-         if( pLfCounters != DSL_NULL )
-         {
-            pCounters->data.nLOF += pLfCounters->nLOF;
-            pCounters->data.nLOS += pLfCounters->nLOS;
-            pCounters->data.nLPR += pLfCounters->nLPR;
-            pCounters->data.nLOM += pLfCounters->nLOM;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERR_INTERNAL;
-
-            break;
-         }
-
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->lineEventShowtimeCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
-
-      break;
-   }
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_LineEventShowtimeCountersShowtimeRead, pCounters);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -5466,8 +5049,6 @@ DSL_Error_t DSL_DRV_PM_ReTxHistoryStats15MinGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -5485,65 +5066,10 @@ DSL_Error_t DSL_DRV_PM_ReTxHistoryStats15MinGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_RETX_HISTORY_15MIN(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_RETX_HISTORY_15MIN(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n15minInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_RETX_HISTORY_15MIN(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n15minInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -5566,8 +5092,6 @@ DSL_Error_t DSL_DRV_PM_ReTxHistoryStats1DayGet(
    DSL_PM_HistoryStatsChDir_t *pStats)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_uint32_t histFillLevel = 0, histInv = 0, prevInvIntervals = 0;
-   DSL_int_t histIdx = -1;
 
    DSL_CHECK_POINTER(pContext, pStats);
    DSL_CHECK_ERR_CODE();
@@ -5585,65 +5109,10 @@ DSL_Error_t DSL_DRV_PM_ReTxHistoryStats1DayGet(
       return DSL_ERROR;
    }
 
-   /* Lock PM module NE access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM access mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      /* Get Hisory fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-         pContext, DSL_DRV_PM_PTR_RETX_HISTORY_1DAY(), &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      /* Set the number of previous intervals*/
-      pStats->data.nPrevIvs = histFillLevel;
-
-      for( histInv = 1; histInv <= histFillLevel; histInv++ )
-      {
-         /* Get History Item Index*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_RETX_HISTORY_1DAY(),
-                       histInv, &histIdx);
-
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-            nErrCode = DSL_ERROR;
-            break;
-         }
-
-         prevInvIntervals +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n1dayInvalidHist[histIdx] != 0 ?
-            1 : 0;
-      }
-
-      break;
-   }
-
-   /* Set the number of previous invalid intervals*/
-   pStats->data.nPrevInvalidIvs = prevInvIntervals;
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pStats->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_HistoryStatsGet(pContext,
+      DSL_DRV_PM_PTR_RETX_HISTORY_1DAY(),
+      DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n1dayInvalidHist,
+      &(pStats->data));
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -6069,13 +5538,15 @@ DSL_Error_t DSL_DRV_PM_ReTxThresholds1DayGet(
 
 #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
 /*
-   For a detailed description of the function, its arguments and return value
-   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+   Reads the counters of DSL_DRV_PM_ReTxCountersShowtimeGet
+   from the published counters snapshot pPub.
 */
-DSL_Error_t DSL_DRV_PM_ReTxCountersShowtimeGet(
+static DSL_Error_t DSL_DRV_PM_ReTxCountersShowtimeRead(
    DSL_Context_t *pContext,
-   DSL_PM_ReTxCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_ReTxCounters_t *pCounters = (DSL_PM_ReTxCounters_t*)pArg;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -6083,139 +5554,137 @@ DSL_Error_t DSL_DRV_PM_ReTxCountersShowtimeGet(
    DSL_pmBF_IntervalFailures_t nCurrFailures;
    DSL_PM_ReTxData_t *pReTxCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ReTxCountersShowtimeGet"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ReTxData_t));
-   pCounters->data.nEftrMin = DSL_PM_COUNTER_EFTR_MIN_MAX_VALUE;
-
-   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
-   {
-      DSL_DEBUG(DSL_DBG_WRN,
-         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-      pCounters->interval.bValid       = DSL_FALSE;
-      pCounters->interval.nElapsedTime = 0;
-      pCounters->interval.nNumber      = 0;
-
-      return DSL_WRN_PM_NO_SHOWTIME_DATA;
-   }
+   nCurrFailures = pCounters->nHistoryInterval == 0 ?
+      DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+      DSL_PM_INTERVAL_FAILURE_CLEANED;
 
    /* Clear the output structure*/
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ReTxData_t));
+   pCounters->data.nEftrMin = DSL_PM_COUNTER_EFTR_MIN_MAX_VALUE;
    pCounters->interval.nElapsedTime = 0;
    pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
    pCounters->interval.bValid = DSL_TRUE;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_HISTORY_SHOWTIME()), &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-      DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, DSL_DRV_PM_PTR_RETX_HISTORY_SHOWTIME(), &histFillLevel);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
+   for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
+   {
+      /* Get history item index for the specified interval*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_HISTORY_SHOWTIME()),
+                    histInv, &histIdx);
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
       {
          DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
             DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
          break;
       }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
+      /* Set Showtime Elapsed time*/
+      pCounters->interval.nElapsedTime +=
+         pPub->reTxCounters.nShowtimeTimeHist[histIdx];
+
+      pReTxCounters =
+         DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_COUNTERS_SHOWTIME(histIdx, pCounters->nDirection));
+
+      if( pReTxCounters != DSL_NULL )
       {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
+         if (pCounters->data.nEftrMin > pReTxCounters->nEftrMin)
+         {
+            pCounters->data.nEftrMin = pReTxCounters->nEftrMin;
+         }
+         pCounters->data.nErrorFreeBits += pReTxCounters->nErrorFreeBits;
+         pCounters->data.nLeftr += pReTxCounters->nLeftr;
+      }
+      else
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         nErrCode = DSL_ERR_INTERNAL;
+
          break;
       }
 
-      for( histInv = 0; histInv <= pCounters->nHistoryInterval; histInv++ )
-      {
-         /* Get history item index for the specified interval*/
-         nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                       pContext, DSL_DRV_PM_PTR_RETX_HISTORY_SHOWTIME(),
-                       histInv, &histIdx);
-         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      pCounters->interval.bValid  &= (
+         ((pPub->reTxCounters.nShowtimeInvalidHist[histIdx] |
+            nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
+   }
 
-            break;
-         }
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
+*/
+DSL_Error_t DSL_DRV_PM_ReTxCountersShowtimeGet(
+   DSL_Context_t *pContext,
+   DSL_PM_ReTxCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
 
-         /* Set Showtime Elapsed time*/
-         pCounters->interval.nElapsedTime +=
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.nShowtimeTimeHist[histIdx];
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         pReTxCounters =
-            DSL_DRV_PM_PTR_RETX_COUNTERS_SHOWTIME(histIdx, pCounters->nDirection);
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-         if( pReTxCounters != DSL_NULL )
-         {
-            if (pCounters->data.nEftrMin > pReTxCounters->nEftrMin)
-            {
-               pCounters->data.nEftrMin = pReTxCounters->nEftrMin;
-            }
-            pCounters->data.nErrorFreeBits += pReTxCounters->nErrorFreeBits;
-            pCounters->data.nLeftr += pReTxCounters->nLeftr;
-         }
-         else
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ReTxCountersShowtimeGet"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
 
-            nErrCode = DSL_ERR_INTERNAL;
+   DSL_DRV_MemSet( &(pCounters->data), 0x0, sizeof(DSL_PM_ReTxData_t));
+   pCounters->data.nEftrMin = DSL_PM_COUNTER_EFTR_MIN_MAX_VALUE;
 
-            break;
-         }
+   if( DSL_DRV_PM_CONTEXT(pContext)->bShowtimeProcessingStart == DSL_FALSE )
+   {
+      DSL_DEBUG(DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: No showtime data for the specified interval"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         pCounters->interval.bValid  &= (
-            ((DSL_DRV_PM_CONTEXT(pContext)->
-               pCounters->reTxCounters.nShowtimeInvalidHist[histIdx] |
-               nCurrFailures) & failuresMask) == 0 ? DSL_TRUE : DSL_FALSE);
-      }
+      pCounters->interval.bValid       = DSL_FALSE;
+      pCounters->interval.nElapsedTime = 0;
+      pCounters->interval.nNumber      = 0;
 
-      break;
+      return DSL_WRN_PM_NO_SHOWTIME_DATA;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_ReTxCountersShowtimeRead, pCounters);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
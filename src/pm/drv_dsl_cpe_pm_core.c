@@ -78,7 +78,7 @@ static DSL_Error_t DSL_DRV_PM_SyncTimeUpdate(
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -448,7 +448,7 @@ static DSL_Error_t DSL_DRV_PM_SyncTimeUpdate(
 #endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -491,16 +491,271 @@ static DSL_Error_t DSL_DRV_PM_SyncTimeUpdate(
    return nErrCode;
 }
 
+/*
+   Adds a time sample [nsec] to the given timing histogram. Each field is
+   updated with an atomic operation, so samples can be added concurrently
+   without any lock.
+*/
+static DSL_void_t DSL_DRV_PM_TimingSampleAdd(
+   DSL_PM_TimingHistogram_t *pHist,
+   DSL_uint32_t nTime)
+{
+   DSL_uint32_t nBin = 0, nOld, nMax;
+
+   while ((nBin < (DSL_PM_TIMING_HISTOGRAM_BINS - 1)) && ((nTime >> 10) >> nBin))
+   {
+      nBin++;
+   }
+
+   DSL_DRV_ATOMIC_FETCH_ADD(&(pHist->nCount), 1);
+   DSL_DRV_ATOMIC_FETCH_ADD(&(pHist->nBin[nBin]), 1);
+
+   /* Carry into the upper word of the sum on the overflow of the lower one*/
+   nOld = DSL_DRV_ATOMIC_FETCH_ADD(&(pHist->nSumLow), nTime);
+   if ((DSL_uint32_t)(nOld + nTime) < nOld)
+   {
+      DSL_DRV_ATOMIC_FETCH_ADD(&(pHist->nSumHigh), 1);
+   }
+
+   nMax = pHist->nMax;
+   while (nTime > nMax)
+   {
+      nOld = DSL_DRV_ATOMIC_CMPXCHG(&(pHist->nMax), nMax, nTime);
+      if (nOld == nMax)
+      {
+         break;
+      }
+      nMax = nOld;
+   }
+}
+
+/*
+   Adds the wait time [nsec] of a PM module lock to the timing statistics.
+*/
+static DSL_void_t DSL_DRV_PM_LockWaitAdd(
+   DSL_Context_t *pContext,
+   DSL_PM_LockType_t nLock,
+   DSL_uint32_t nTime)
+{
+   DSL_DRV_PM_TimingSampleAdd(
+      &(DSL_DRV_PM_CONTEXT(pContext)->statistics.lockWait[nLock]), nTime);
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_int_t DSL_DRV_PM_MutexLock(
+   DSL_Context_t *pContext)
+{
+   DSL_uint32_t nStartSec = 0, nStartNSec = 0;
+   DSL_int_t nRet;
+
+   DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
+
+   nRet = DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
+   if (nRet == 0)
+   {
+      DSL_DRV_PM_LockWaitAdd(pContext, DSL_PM_LOCK_COMMON,
+         DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
+   }
+
+   return nRet;
+}
+
+/*
+   Checks if the current counter value reached the adaptive polling level of
+   the given threshold but did not cross it yet.
+*/
+static DSL_boolean_t DSL_DRV_PM_AdaptiveThresholdNear(
+   DSL_uint32_t nCounter,
+   DSL_uint32_t nThreshold)
+{
+   DSL_uint32_t nMargin;
+
+   if ((nThreshold == 0) || (nCounter > nThreshold))
+   {
+      return DSL_FALSE;
+   }
+
+   nMargin = (nThreshold / 100) * (100 - DSL_PM_ADAPTIVE_POLLING_THRESHOLD_LEVEL) +
+             ((nThreshold % 100) * (100 - DSL_PM_ADAPTIVE_POLLING_THRESHOLD_LEVEL)) / 100;
+
+   return (nThreshold - nCounter <= nMargin) ? DSL_TRUE : DSL_FALSE;
+}
+
+/*
+   Updates the adaptive polling factor of the PM thread for the given direction.
+   The basic poll cycle is used as long as the current counters are changing or
+   one of the current 15-min counters is close to its threshold, otherwise the
+   poll cycle is doubled up to DSL_PM_ADAPTIVE_POLLING_MAX_FACTOR.
+   Has to be called by the direction specific PM thread after the counters update.
+*/
+static DSL_Error_t DSL_DRV_PM_AdaptivePollingUpdate(
+   DSL_Context_t *pContext,
+   const DSL_XTUDir_t nDirection)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_Thread_t *pPmThread;
+   DSL_PM_LineSecData_t *pSecCounters;
+   DSL_uint32_t nSignature = 0;
+   DSL_boolean_t bActive = DSL_FALSE;
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+   DSL_uint8_t nChannel;
+   DSL_PM_ChannelData_t *pChCounters;
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+#if defined(INCLUDE_DSL_CPE_PM_LINE_THRESHOLDS) || \
+    defined(INCLUDE_DSL_CPE_PM_CHANNEL_THRESHOLDS)
+   DSL_int_t hist15minIdx = -1;
+#endif
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
+   DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
+   DSL_CHECK_ATU_DIRECTION(nDirection);
+   DSL_CHECK_ERR_CODE();
+
+   if (!DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.bAdaptivePollingOn)
+   {
+      return DSL_SUCCESS;
+   }
+
+   pPmThread = nDirection == DSL_NEAR_END ?
+      &(DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe) :
+      &(DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe);
+
+   /* Build a signature of the current counters, any change indicates
+      counter activity since the last update*/
+   pSecCounters = DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_CURR(nDirection);
+   nSignature = pSecCounters->nES + pSecCounters->nSES + pSecCounters->nLOSS +
+                pSecCounters->nUAS + pSecCounters->nLOFS + pSecCounters->nFECS;
+
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+   for (nChannel = 0; nChannel < DSL_CHANNELS_PER_LINE; nChannel++)
+   {
+      pChCounters = DSL_DRV_PM_PTR_CHANNEL_COUNTERS_CURR(nChannel, nDirection);
+      nSignature += pChCounters->nCodeViolations + pChCounters->nFEC;
+   }
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+
+   if (nSignature != pPmThread->nActivitySignature)
+   {
+      bActive = DSL_TRUE;
+   }
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+#if defined(INCLUDE_DSL_CPE_PM_LINE_THRESHOLDS) && defined(INCLUDE_DSL_CPE_PM_LINE_COUNTERS)
+   /* Check the current 15-min line sec counters against the thresholds*/
+   if (!bActive)
+   {
+      DSL_PM_LineSecData_t *pThresholds =
+         DSL_DRV_PM_PTR_LINE_SEC_THRESHOLD_15MIN(nDirection);
+
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN(),
+                    0, &hist15minIdx);
+
+      if ((nErrCode == DSL_SUCCESS) && (hist15minIdx >= 0))
+      {
+         pSecCounters = DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_15MIN(hist15minIdx, nDirection);
+
+         if (DSL_DRV_PM_AdaptiveThresholdNear(pSecCounters->nES, pThresholds->nES) ||
+             DSL_DRV_PM_AdaptiveThresholdNear(pSecCounters->nSES, pThresholds->nSES) ||
+             DSL_DRV_PM_AdaptiveThresholdNear(pSecCounters->nLOSS, pThresholds->nLOSS) ||
+             DSL_DRV_PM_AdaptiveThresholdNear(pSecCounters->nUAS, pThresholds->nUAS) ||
+             DSL_DRV_PM_AdaptiveThresholdNear(pSecCounters->nLOFS, pThresholds->nLOFS) ||
+             DSL_DRV_PM_AdaptiveThresholdNear(pSecCounters->nFECS, pThresholds->nFECS))
+         {
+            bActive = DSL_TRUE;
+         }
+      }
+   }
+#endif /* defined(INCLUDE_DSL_CPE_PM_LINE_THRESHOLDS) && defined(INCLUDE_DSL_CPE_PM_LINE_COUNTERS)*/
+
+#if defined(INCLUDE_DSL_CPE_PM_CHANNEL_THRESHOLDS) && defined(INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS)
+   /* Check the current 15-min channel counters against the thresholds*/
+   if (!bActive)
+   {
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN(),
+                    0, &hist15minIdx);
+
+      for (nChannel = 0; (nErrCode == DSL_SUCCESS) && (hist15minIdx >= 0) &&
+           (nChannel < DSL_CHANNELS_PER_LINE); nChannel++)
+      {
+         DSL_PM_ChannelData_t *pThresholds =
+            DSL_DRV_PM_PTR_CHANNEL_THRESHOLD_15MIN(nChannel, nDirection);
+
+         pChCounters = DSL_DRV_PM_PTR_CHANNEL_COUNTERS_15MIN(hist15minIdx, nChannel, nDirection);
+
+         if (DSL_DRV_PM_AdaptiveThresholdNear(pChCounters->nCodeViolations,
+                pThresholds->nCodeViolations) ||
+             DSL_DRV_PM_AdaptiveThresholdNear(pChCounters->nFEC, pThresholds->nFEC))
+         {
+            bActive = DSL_TRUE;
+            break;
+         }
+      }
+   }
+#endif /* defined(INCLUDE_DSL_CPE_PM_CHANNEL_THRESHOLDS) && defined(INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS)*/
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
+   /* Lock PM module Mutex*/
+   if( DSL_DRV_PM_MutexLock(pContext) )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   pPmThread->nActivitySignature = nSignature;
+
+   if (bActive)
+   {
+      pPmThread->nBackoffFactor = 1;
+   }
+   else if (pPmThread->nBackoffFactor < DSL_PM_ADAPTIVE_POLLING_MAX_FACTOR)
+   {
+      pPmThread->nBackoffFactor <<= 1;
+   }
+
+   if (pPmThread->nBackoffFactor > DSL_PM_ADAPTIVE_POLLING_MAX_FACTOR)
+   {
+      pPmThread->nBackoffFactor = DSL_PM_ADAPTIVE_POLLING_MAX_FACTOR;
+   }
+
+   /* Unlock PM module Mutex*/
+   DSL_DRV_MUTEX_UNLOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
+
+   DSL_DEBUG(DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: PM %s adaptive poll factor %u (%s)"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext),
+      nDirection == DSL_NEAR_END ? "NE" : "FE", pPmThread->nBackoffFactor,
+      bActive ? "active" : "idle"));
+
+   return DSL_SUCCESS;
+}
 
 static DSL_Error_t DSL_DRV_PM_PollCycleUpdate(
    DSL_Context_t *pContext,
    const DSL_XTUDir_t nDirection,
    DSL_uint32_t nStartTime,
-   DSL_uint32_t nStopTime)
+   DSL_uint32_t nStopTime,
+   DSL_uint32_t nTickTime)
 {
+   DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_uint32_t msecTimeFrame;
    DSL_uint32_t nPollFactor;
+   DSL_uint32_t nPollCycle;
    DSL_PM_Thread_t *pPmThread;
+   DSL_PM_DirStatisticsData_t *pStatistics;
+   DSL_boolean_t bAdaptive = DSL_FALSE;
+   DSL_LineStateValue_t nLineState = DSL_LINESTATE_UNKNOWN;
+   DSL_G997_PowerManagementStatusData_t powerMgmtStatus = {DSL_G997_PMS_NA};
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   DSL_uint32_t nTimeLeft = 0;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
 
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_PollCycleUpdate"
@@ -511,8 +766,19 @@ static DSL_Error_t DSL_DRV_PM_PollCycleUpdate(
       return DSL_ERROR;
    }
 
+   /* Get current line state*/
+   DSL_CTX_READ_SCALAR(pContext, nErrCode, nLineState, nLineState);
+   /* Get Power Management Status*/
+   DSL_CTX_READ(pContext, nErrCode, powerMgmtStatus, powerMgmtStatus);
+
+   if (nErrCode != DSL_SUCCESS)
+   {
+      /* keep the current poll time if the line state is not known*/
+      return nErrCode;
+   }
+
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -523,14 +789,47 @@ static DSL_Error_t DSL_DRV_PM_PollCycleUpdate(
    if( nDirection == DSL_NEAR_END )
    {
       pPmThread   = &(DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe);
+      pStatistics = &(DSL_DRV_PM_CONTEXT(pContext)->statistics.ne);
       nPollFactor = 1;
    }
    else
    {
       pPmThread =  &(DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe);
+      pStatistics = &(DSL_DRV_PM_CONTEXT(pContext)->statistics.fe);
       nPollFactor = DSL_DRV_PM_CONTEXT(pContext)->nFeRequestCycle;
    }
 
+   nPollCycle = DSL_DRV_PM_CONTEXT(pContext)->nPmTick * nPollFactor;
+
+   bAdaptive = DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.bAdaptivePollingOn;
+#if defined (INCLUDE_DSL_CPE_PM_HISTORY) && defined(INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS)
+   /* Fixed poll cycles are used in the Burnin Mode*/
+   if (DSL_DRV_PM_CONTEXT(pContext)->bBurninModeActive)
+   {
+      bAdaptive = DSL_FALSE;
+   }
+#endif /* defined (INCLUDE_DSL_CPE_PM_HISTORY) && defined(INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS)*/
+
+   if (bAdaptive)
+   {
+      if (((nLineState != DSL_LINESTATE_SHOWTIME_TC_SYNC) &&
+           (nLineState != DSL_LINESTATE_SHOWTIME_NO_SYNC)) ||
+          (powerMgmtStatus.nPowerManagementStatus == DSL_G997_PMS_L3))
+      {
+         /* No FW polling required, wake up for the interval processing only.
+            The PM threads are woken up on the showtime entry*/
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+         nPollCycle = DSL_DRV_PM_CONTEXT(pContext)->nPm15Min * DSL_PM_MSEC;
+#else
+         nPollCycle *= DSL_PM_ADAPTIVE_POLLING_MAX_FACTOR;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+      }
+      else
+      {
+         nPollCycle *= pPmThread->nBackoffFactor;
+      }
+   }
+
    if( nStopTime < nStartTime )
    {
       /* System time has been changed*/
@@ -544,7 +843,13 @@ static DSL_Error_t DSL_DRV_PM_PollCycleUpdate(
          (pContext, SYS_DBG_MSG"DSL[%02d]: PM processing time frame (%u msec)"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext), msecTimeFrame));
 
-      if( msecTimeFrame > DSL_DRV_PM_CONTEXT(pContext)->nPmTick * nPollFactor )
+      DSL_DRV_PM_TimingSampleAdd(&(pStatistics->tick), nTickTime);
+      if( msecTimeFrame > nPollCycle )
+      {
+         DSL_DRV_ATOMIC_FETCH_ADD(&(pStatistics->nOverrunTicks), 1);
+      }
+
+      if( msecTimeFrame > nPollCycle )
       {
          DSL_DEBUG(DSL_DBG_WRN,
             (pContext, SYS_DBG_WRN"DSL[%02d]: PM %s processing out of Poll Cycle!"
@@ -554,10 +859,53 @@ static DSL_Error_t DSL_DRV_PM_PollCycleUpdate(
       }
       else
       {
-         pPmThread->nThreadPollTime =
-            DSL_DRV_PM_CONTEXT(pContext)->nPmTick * nPollFactor - msecTimeFrame;
+         pPmThread->nThreadPollTime = nPollCycle - msecTimeFrame;
+      }
+   }
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   /* Extended poll cycles shall not exceed the current 15-min interval.
+      The external sync mode is not time based, the basic cycle is used here*/
+   if (bAdaptive)
+   {
+      switch(DSL_DRV_PM_CONTEXT(pContext)->syncMode)
+      {
+      case DSL_PM_SYNC_MODE_FREE:
+         /* Current 15-min time in msec*/
+         if (DSL_DRV_PM_CONTEXT(pContext)->nPm15Min * DSL_PM_MSEC >
+             DSL_DRV_PM_CONTEXT(pContext)->nCurr15MinTime)
+         {
+            nTimeLeft = DSL_DRV_PM_CONTEXT(pContext)->nPm15Min * DSL_PM_MSEC -
+               DSL_DRV_PM_CONTEXT(pContext)->nCurr15MinTime;
+         }
+         break;
+
+      case DSL_PM_SYNC_MODE_SYS_TIME:
+         /* Current 15-min time in sec*/
+         if (DSL_DRV_PM_CONTEXT(pContext)->nPm15Min >
+             DSL_DRV_PM_CONTEXT(pContext)->nCurr15MinTime)
+         {
+            nTimeLeft = (DSL_DRV_PM_CONTEXT(pContext)->nPm15Min -
+               DSL_DRV_PM_CONTEXT(pContext)->nCurr15MinTime) * DSL_PM_MSEC;
+         }
+         break;
+
+      default:
+         nTimeLeft = DSL_DRV_PM_CONTEXT(pContext)->nPmTick * nPollFactor;
+         break;
+      }
+
+      if (nTimeLeft < 10)
+      {
+         nTimeLeft = 10; /* msec*/
+      }
+
+      if (pPmThread->nThreadPollTime > nTimeLeft)
+      {
+         pPmThread->nThreadPollTime = nTimeLeft;
       }
    }
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
 
    /* Unlock PM module Mutex*/
    DSL_DRV_MUTEX_UNLOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
@@ -581,7 +929,7 @@ static DSL_Error_t DSL_DRV_PM_FePollFactorUpdate(
    DSL_CTX_READ(pContext, nErrCode, powerMgmtStatus, powerMgmtStatus);
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -646,7 +994,7 @@ static DSL_Error_t DSL_DRV_PM_IntervalValidityStatusUpdate(
 #endif /* defined (INCLUDE_DSL_CPE_API_DANUBE)*/
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -772,12 +1120,108 @@ static DSL_Error_t DSL_DRV_PM_IntervalValidityStatusUpdate(
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
 */
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_Error_t DSL_DRV_PM_ThreadNeCycle(
+   DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t startTime, stopTime, nStartSec = 0, nStartNSec = 0;
+
+   /* Get Start Time*/
+   startTime = DSL_DRV_PM_TIME_GET();
+   DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
+
+   /* Lock PM module NE mutex*/
+   nErrCode = DSL_DRV_PM_DirectionMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End mutex lock failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
+   }
+
+   /* Update PM counters for the Near-End direction*/
+   nErrCode = DSL_DRV_PM_CountersUpdate(
+      pContext, DSL_NEAR_END, DSL_TRUE, DSL_TRUE, DSL_TRUE, DSL_TRUE);
+
+   /* Unlock PM module NE mutex*/
+   DSL_DRV_PM_DirectionMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+
+   /* Check Update status, Reboot on Error*/
+   if( nErrCode < DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM NE counters update failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      /* Restart Autoboot*/
+      nErrCode =  DSL_DRV_AutobootStateSet(
+         pContext, DSL_AUTOBOOTSTATE_RESTART, DSL_AUTOBOOT_RESTART_POLL_TIME);
+
+      if( nErrCode != DSL_SUCCESS )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot state set failed!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      }
+   }
+
+   /* Update Sync Time*/
+   nErrCode = DSL_DRV_PM_SyncTimeUpdate(pContext);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Sync Time update failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
+   }
+
+#if defined(INCLUDE_DSL_CPE_PM_HISTORY) || defined(INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS)
+   /* Update Interval validity status*/
+   DSL_DRV_PM_IntervalValidityStatusUpdate(pContext);
+
+   /* Update history for all counters*/
+   nErrCode = DSL_DRV_PM_HistoryUpdate(pContext);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG(DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM NE history update failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
+   }
+#endif /* #if defined(INCLUDE_DSL_CPE_PM_HISTORY) || defined(INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS)*/
+
+   /* Update adaptive poll factor according to the counters activity*/
+   DSL_DRV_PM_AdaptivePollingUpdate(pContext, DSL_NEAR_END);
+
+   /* Publish updated counters for the readers*/
+   DSL_DRV_PM_CountersPublish(pContext);
+
+   /* Add the line counters to the bonding group counters*/
+   DSL_DRV_PM_GroupUpdate(pContext);
+
+   /* Get Stop Time*/
+   stopTime = DSL_DRV_PM_TIME_GET();
+
+   /* Update PM thread poll cycle*/
+   DSL_DRV_PM_PollCycleUpdate(pContext, DSL_NEAR_END, startTime, stopTime,
+      DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
+
+   return nErrCode;
+}
+
 DSL_int_t DSL_DRV_PM_ThreadNe(DSL_DRV_ThreadParams_t *param)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_int_t nOsRet = 0;
    DSL_Context_t *pContext = (DSL_Context_t*)param->nArg1;
-   DSL_uint32_t startTime, stopTime;
 
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ThreadNe"
@@ -797,8 +1241,6 @@ DSL_int_t DSL_DRV_PM_ThreadNe(DSL_DRV_ThreadParams_t *param)
       return -1;
    }
 
-   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.bRun = DSL_TRUE;
-
    DSL_DEBUG(DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: PM Near-End thread started"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
@@ -814,79 +1256,10 @@ DSL_int_t DSL_DRV_PM_ThreadNe(DSL_DRV_ThreadParams_t *param)
       if (DSL_DRV_SIGNAL_PENDING)
          break;
 
-      /* Get Start Time*/
-      startTime = DSL_DRV_PM_TIME_GET();
-
-      /* Lock PM module NE mutex*/
-      nErrCode = DSL_DRV_PM_DirectionMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End mutex lock failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
+      nErrCode = DSL_DRV_PM_ThreadNeCycle(pContext);
+      if (nErrCode != DSL_SUCCESS)
          break;
-      }
-
-      /* Update PM counters for the Near-End direction*/
-      nErrCode = DSL_DRV_PM_CountersUpdate(
-         pContext, DSL_NEAR_END, DSL_TRUE, DSL_TRUE, DSL_TRUE, DSL_TRUE);
-
-      /* Unlock PM module NE mutex*/
-      DSL_DRV_PM_DirectionMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
-
-      /* Check Update status, Reboot on Error*/
-      if( nErrCode < DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM NE counters update failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         /* Restart Autoboot*/
-         nErrCode =  DSL_DRV_AutobootStateSet(
-            pContext, DSL_AUTOBOOTSTATE_RESTART, DSL_AUTOBOOT_RESTART_POLL_TIME);
-
-         if( nErrCode != DSL_SUCCESS )
-         {
-            DSL_DEBUG( DSL_DBG_ERR,
-               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Autoboot state set failed!"
-               DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         }
-      }
-
-      /* Update Sync Time*/
-      nErrCode = DSL_DRV_PM_SyncTimeUpdate(pContext);
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Sync Time update failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-#if defined(INCLUDE_DSL_CPE_PM_HISTORY) || defined(INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS)
-      /* Update Interval validity status*/
-      DSL_DRV_PM_IntervalValidityStatusUpdate(pContext);
-
-      /* Update history for all counters*/
-      nErrCode = DSL_DRV_PM_HistoryUpdate(pContext);
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG(DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM NE history update failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-#endif /* #if defined(INCLUDE_DSL_CPE_PM_HISTORY) || defined(INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS)*/
-
-      /* Get Stop Time*/
-      stopTime = DSL_DRV_PM_TIME_GET();
-
-      /* Update PM thread poll cycle*/
-      DSL_DRV_PM_PollCycleUpdate(pContext, DSL_NEAR_END, startTime, stopTime);
-   }
+   }
 
    /* Clear PM module bRun flag*/
    DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.bRun = DSL_FALSE;
@@ -905,7 +1278,7 @@ DSL_int_t DSL_DRV_PM_ThreadFe(DSL_DRV_ThreadParams_t *param)
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_int_t nOsRet = 0;
    DSL_Context_t *pContext = (DSL_Context_t*)param->nArg1;
-   DSL_uint32_t startTime, stopTime;
+   DSL_uint32_t startTime, stopTime, nStartSec = 0, nStartNSec = 0;
 
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_ThreadFe"
@@ -925,8 +1298,6 @@ DSL_int_t DSL_DRV_PM_ThreadFe(DSL_DRV_ThreadParams_t *param)
       return -1;
    }
 
-   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.bRun = DSL_TRUE;
-
    DSL_DEBUG(DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: PM Far-End thread started"
       DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
@@ -942,6 +1313,7 @@ DSL_int_t DSL_DRV_PM_ThreadFe(DSL_DRV_ThreadParams_t *param)
 
       /* Get Start Time*/
       startTime = DSL_DRV_PM_TIME_GET();
+      DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
 
       /* Lock PM module FE mutex*/
       nErrCode = DSL_DRV_PM_DirectionMutexControl(pContext, DSL_FAR_END, DSL_TRUE);
@@ -980,6 +1352,15 @@ DSL_int_t DSL_DRV_PM_ThreadFe(DSL_DRV_ThreadParams_t *param)
          }
       }
 
+      /* Update adaptive poll factor according to the counters activity*/
+      DSL_DRV_PM_AdaptivePollingUpdate(pContext, DSL_FAR_END);
+
+      /* Publish updated counters for the readers*/
+      DSL_DRV_PM_CountersPublish(pContext);
+
+      /* Add the line counters to the bonding group counters*/
+      DSL_DRV_PM_GroupUpdate(pContext);
+
       /* Get Stop Time*/
       stopTime = DSL_DRV_PM_TIME_GET();
 
@@ -987,7 +1368,8 @@ DSL_int_t DSL_DRV_PM_ThreadFe(DSL_DRV_ThreadParams_t *param)
       DSL_DRV_PM_FePollFactorUpdate(pContext);
 
       /* Update PM thread poll cycle*/
-      DSL_DRV_PM_PollCycleUpdate(pContext, DSL_FAR_END, startTime, stopTime);
+      DSL_DRV_PM_PollCycleUpdate(pContext, DSL_FAR_END, startTime, stopTime,
+         DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
    }
 
    /* Clear PM module bRun flag*/
@@ -1008,6 +1390,7 @@ DSL_Error_t DSL_DRV_PM_DirectionMutexControl(
    DSL_boolean_t bLock)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t nStartSec = 0, nStartNSec = 0;
 
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_DirectionMutexControl,(nDirection=%d,%s)"
@@ -1022,6 +1405,7 @@ DSL_Error_t DSL_DRV_PM_DirectionMutexControl(
    {
       if( bLock )
       {
+         DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
          if(down_interruptible(&(DSL_DRV_PM_CONTEXT(pContext)->pmNeMutex)))
          {
             DSL_DEBUG( DSL_DBG_ERR,
@@ -1030,6 +1414,11 @@ DSL_Error_t DSL_DRV_PM_DirectionMutexControl(
 
             nErrCode = DSL_ERR_SEMAPHORE_GET;
          }
+         else
+         {
+            DSL_DRV_PM_LockWaitAdd(pContext, DSL_PM_LOCK_NE_DIRECTION,
+               DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
+         }
       }
       else
       {
@@ -1041,6 +1430,7 @@ DSL_Error_t DSL_DRV_PM_DirectionMutexControl(
    {
       if( bLock )
       {
+         DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
          if(down_interruptible(&(DSL_DRV_PM_CONTEXT(pContext)->pmFeMutex)))
          {
             DSL_DEBUG( DSL_DBG_ERR,
@@ -1049,6 +1439,11 @@ DSL_Error_t DSL_DRV_PM_DirectionMutexControl(
 
             nErrCode = DSL_ERR_SEMAPHORE_GET;
          }
+         else
+         {
+            DSL_DRV_PM_LockWaitAdd(pContext, DSL_PM_LOCK_FE_DIRECTION,
+               DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
+         }
       }
       else
       {
@@ -1070,6 +1465,7 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
    DSL_boolean_t bLock)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t nStartSec = 0, nStartNSec = 0;
 
    DSL_DEBUG( DSL_DBG_MSG,
       (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_AccessMutexControl,(nDirection=%d,%s)"
@@ -1084,6 +1480,7 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
    {
       if( bLock )
       {
+         DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
          if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmNeAccessMutex) )
          {
             DSL_DEBUG( DSL_DBG_ERR,
@@ -1092,6 +1489,11 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
 
             nErrCode = DSL_ERR_SEMAPHORE_GET;
          }
+         else
+         {
+            DSL_DRV_PM_LockWaitAdd(pContext, DSL_PM_LOCK_NE_ACCESS,
+               DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
+         }
       }
       else
       {
@@ -1103,6 +1505,7 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
    {
       if( bLock )
       {
+         DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
          if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmFeAccessMutex) )
          {
             DSL_DEBUG( DSL_DBG_ERR,
@@ -1111,6 +1514,11 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
 
             nErrCode = DSL_ERR_SEMAPHORE_GET;
          }
+         else
+         {
+            DSL_DRV_PM_LockWaitAdd(pContext, DSL_PM_LOCK_FE_ACCESS,
+               DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec));
+         }
       }
       else
       {
@@ -1126,146 +1534,836 @@ DSL_Error_t DSL_DRV_PM_AccessMutexControl(
    return nErrCode;
 }
 
-DSL_Error_t DSL_DRV_PM_Lock(DSL_Context_t *pContext)
+DSL_Error_t DSL_DRV_PM_CountersPublish(
+   DSL_Context_t *pContext)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_Context *pPmContext = DSL_NULL;
+   DSL_uint32_t nIdx = 0, nOffset = 0, nBlockSize = 0;
+   DSL_uint8_t *pSrc = DSL_NULL, *pDst = DSL_NULL;
 
    DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
    DSL_CHECK_ERR_CODE();
 
-   DSL_DEBUG( DSL_DBG_MSG,(pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_Lock"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   pPmContext = DSL_DRV_PM_CONTEXT(pContext);
 
-   if( !(DSL_DRV_PM_CONTEXT(pContext)->bPmLock) )
+   if ((pPmContext->pCounters == DSL_NULL) ||
+       (pPmContext->pCountersPub[0] == DSL_NULL) ||
+       (pPmContext->pCountersPub[1] == DSL_NULL))
    {
-      /* Lock PM module Near-End Mutex*/
-      if(down_interruptible(&(DSL_DRV_PM_CONTEXT(pContext)->pmNeMutex)))
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM NE mutex!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         return DSL_ERR_SEMAPHORE_GET;
-      }
-      /* Lock PM module Near-End Mutex*/
-      if( down_interruptible(&(DSL_DRV_PM_CONTEXT(pContext)->pmFeMutex)) )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM FE mutex!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERR_INTERNAL;
+   }
 
-         return DSL_ERR_SEMAPHORE_GET;
-      }
+   /* Lock PM module NE access mutex*/
+   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Near-End access mutex lock failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      /* Set bPmLock flag*/
-      DSL_DRV_PM_CONTEXT(pContext)->bPmLock = DSL_TRUE;
+      return nErrCode;
+   }
 
-      DSL_DEBUG( DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: PM locked successfully"
+   /* Lock PM module FE access mutex*/
+   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_FAR_END, DSL_TRUE);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM Far-End access mutex lock failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      /* Unlock PM module NE access mutex*/
+      DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+
+      return nErrCode;
    }
-   else
+
+   /* Fill the buffer which is currently not visible for the readers*/
+   nIdx = pPmContext->nPubIdx ^ 1;
+
+   /* Odd sequence number marks the buffer as being updated*/
+   pPmContext->nPubSeq[nIdx]++;
+   DSL_DRV_SMP_WMB();
+
+   /* Only the blocks which changed since this buffer was written the last
+      time are copied. Between two publications the current records change
+      but the history records (most of the counters data) stay the same,
+      comparing needs no dirty tracking in all of the counters updates*/
+   pSrc = (DSL_uint8_t*)pPmContext->pCounters;
+   pDst = (DSL_uint8_t*)pPmContext->pCountersPub[nIdx];
+
+   for (nOffset = 0; nOffset < sizeof(DSL_PM_CountersData_t);
+        nOffset += nBlockSize)
    {
-      DSL_DEBUG( DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: PM module already locked"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      nBlockSize = sizeof(DSL_PM_CountersData_t) - nOffset;
+      if (nBlockSize > DSL_PM_PUB_BLOCK_SIZE)
+      {
+         nBlockSize = DSL_PM_PUB_BLOCK_SIZE;
+      }
+
+      if (memcmp(pDst + nOffset, pSrc + nOffset, nBlockSize) != 0)
+      {
+         memcpy(pDst + nOffset, pSrc + nOffset, nBlockSize);
+      }
    }
+   pPmContext->nPubCurrFailures[nIdx] = pPmContext->nCurrFailures;
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_Lock, retCode=%d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   DSL_DRV_SMP_WMB();
+   pPmContext->nPubSeq[nIdx]++;
+   DSL_DRV_SMP_WMB();
+
+   /* Flip the published snapshot*/
+   pPmContext->nPubIdx = nIdx;
+
+   /* Unlock PM module FE access mutex*/
+   DSL_DRV_PM_AccessMutexControl(pContext, DSL_FAR_END, DSL_FALSE);
+
+   /* Unlock PM module NE access mutex*/
+   DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
 
    return nErrCode;
 }
 
-DSL_Error_t DSL_DRV_PM_UnLock(DSL_Context_t *pContext)
+DSL_PM_CountersData_t* DSL_DRV_PM_PublishedCountersGet(
+   DSL_Context_t *pContext,
+   DSL_uint32_t *pSeq)
+{
+   DSL_PM_Context *pPmContext = DSL_DRV_PM_CONTEXT(pContext);
+   DSL_uint32_t nIdx = 0;
+
+   /* The published buffer is only written if the writer already flipped
+      to the other one, re-read the index in this case*/
+   do
+   {
+      nIdx = pPmContext->nPubIdx;
+      DSL_DRV_SMP_RMB();
+      *pSeq = pPmContext->nPubSeq[nIdx];
+      DSL_DRV_SMP_RMB();
+   } while (*pSeq & 0x1);
+
+   return pPmContext->pCountersPub[nIdx];
+}
+
+DSL_boolean_t DSL_DRV_PM_PublishedCountersRetry(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_uint32_t nSeq)
+{
+   DSL_PM_Context *pPmContext = DSL_DRV_PM_CONTEXT(pContext);
+   DSL_uint32_t nIdx = (pPub == pPmContext->pCountersPub[0]) ? 0 : 1;
+
+   DSL_DRV_SMP_RMB();
+
+   return (pPmContext->nPubSeq[nIdx] != nSeq) ? DSL_TRUE : DSL_FALSE;
+}
+
+DSL_Error_t DSL_DRV_PM_PublishedRead(
+   DSL_Context_t *pContext,
+   DSL_DRV_PM_PubReadFunc_t pReadFunc,
+   DSL_void_t *pArg)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_CountersData_t *pPub = DSL_NULL;
+   DSL_uint32_t nPubSeq = 0;
 
-   DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
+   DSL_CHECK_POINTER(pContext, pReadFunc);
    DSL_CHECK_ERR_CODE();
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_UnLock"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   if( DSL_DRV_PM_CONTEXT(pContext)->bPmLock )
+   /* The result of a torn read is not used, also an error might be caused by
+      data which was modified while it was read*/
+   do
    {
-      /* Unlock PM module NE Mutex*/
-      up(&(DSL_DRV_PM_CONTEXT(pContext)->pmNeMutex));
+      pPub = DSL_DRV_PM_PublishedCountersGet(pContext, &nPubSeq);
 
-      /* Unlock PM module FE Mutex*/
-      up(&(DSL_DRV_PM_CONTEXT(pContext)->pmFeMutex));
+      nErrCode = pReadFunc(pContext, pPub, pArg);
+   } while (DSL_DRV_PM_PublishedCountersRetry(pContext, pPub, nPubSeq));
 
-      /* Clear bPmLock flag*/
-      DSL_DRV_PM_CONTEXT(pContext)->bPmLock = DSL_FALSE;
+   return nErrCode;
+}
 
-      DSL_DEBUG( DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: PM unlocked successfully"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-   }
-   else
+/** History interval reader arguments*/
+typedef struct
+{
+   /** History interval type*/
+   DSL_PM_HistIntervalType_t intervalType;
+   /** Endpoint specific counters structure*/
+   DSL_void_t *pCounters;
+} DSL_PM_HistIntervalReadArg_t;
+
+/** Bonding group counters, one per bonding pair*/
+static DSL_PM_GroupContext_t g_PmGroup[DSL_PM_GROUP_NUMBER];
+
+/** Returns the bonding group of the given line*/
+#define DSL_DRV_PM_GROUP_GET(nLine)    (&g_PmGroup[(nLine) / DSL_PM_GROUP_LINES])
+
+/*
+   Adds the difference between the new and the already contributed line
+   values to the group values. pGroup might be DSL_NULL if the line values
+   do not belong to any of the group records anymore.
+*/
+static DSL_void_t DSL_DRV_PM_GroupValuesApply(
+   DSL_uint32_t *pGroup,
+   DSL_uint32_t *pContrib,
+   const DSL_uint32_t *pNew,
+   DSL_uint32_t nNum)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < nNum; i++)
    {
-      DSL_DEBUG( DSL_DBG_MSG,
-         (pContext, SYS_DBG_MSG"DSL[%02d]: PM already unlocked"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      if (pGroup != DSL_NULL)
+      {
+         pGroup[i] += pNew[i] - pContrib[i];
+      }
+      pContrib[i] = pNew[i];
    }
+}
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_UnLock, retCode=%d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+/** Applies one counter family of the line to the group counters*/
+#define DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, family, pNew) \
+   DSL_DRV_PM_GroupValuesApply( \
+      (pGroup) != DSL_NULL ? (DSL_uint32_t*)&((pGroup)->family) : DSL_NULL, \
+      (DSL_uint32_t*)&((pContrib)->family), (const DSL_uint32_t*)(pNew), \
+      sizeof((pContrib)->family) / sizeof(DSL_uint32_t))
 
-   return nErrCode;
+/*
+   Returns the group record the given line contribution belongs to or
+   DSL_NULL if the line is out of the group intervals.
+*/
+static DSL_PM_GroupCountersData_t* DSL_DRV_PM_GroupRecordGet(
+   DSL_PM_GroupContext_t *pGroup,
+   DSL_PM_GroupLineData_t *pLine,
+   DSL_uint32_t nDir,
+   DSL_PM_GroupContribution_t nContrib)
+{
+   DSL_uint32_t nType = (nContrib == DSL_PM_GROUP_CONTRIB_15MIN) ? 0 : 1;
+   DSL_PM_GroupRecord_t nCurr = (nType == 0) ?
+      DSL_PM_GROUP_REC_CURR_15MIN : DSL_PM_GROUP_REC_CURR_1DAY;
+
+   switch (nContrib)
+   {
+   case DSL_PM_GROUP_CONTRIB_15MIN:
+   case DSL_PM_GROUP_CONTRIB_1DAY:
+      if (pLine->nGroupInterval[nType] == pGroup->nInterval[nType])
+      {
+         return &(pGroup->rec[nDir][nCurr]);
+      }
+      else if (pLine->nGroupInterval[nType] + 1 == pGroup->nInterval[nType])
+      {
+         /* Previous record follows the current one*/
+         return &(pGroup->rec[nDir][nCurr + 1]);
+      }
+      return DSL_NULL;
+
+   case DSL_PM_GROUP_CONTRIB_TOTAL:
+      return &(pGroup->rec[nDir][DSL_PM_GROUP_REC_TOTAL]);
+
+   case DSL_PM_GROUP_CONTRIB_SHOWTIME:
+      return &(pGroup->rec[nDir][DSL_PM_GROUP_REC_SHOWTIME]);
+
+   default:
+      return DSL_NULL;
+   }
 }
 
-static DSL_Error_t DSL_DRV_PM_EpDataGet(
+/*
+   Applies the current line counters of one interval type and direction to
+   the group counters. Counters not included in the current configuration
+   are skipped. The PM module access mutexes have to be locked.
+*/
+static DSL_Error_t DSL_DRV_PM_GroupContributionApply(
    DSL_Context_t *pContext,
-   DSL_PM_EpData_t *pEpData)
+   const DSL_XTUDir_t nDirection,
+   DSL_PM_GroupContribution_t nContrib,
+   DSL_PM_GroupCountersData_t *pGroup,
+   DSL_PM_GroupCountersData_t *pContrib)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_int_t nIdx = 0;
 
-   DSL_CHECK_POINTER(pContext, pEpData);
-   DSL_CHECK_ERR_CODE();
-
-   switch (pEpData->epType)
+   switch (nContrib)
    {
-#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
-   case DSL_PM_COUNTER_CHANNEL:
-      #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-      pEpData->pRec15min         =
-         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.rec15min);
-      pEpData->pHist15min        = DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN();
-      pEpData->nRecNum15min      = DSL_PM_CHANNEL_15MIN_RECORDS_NUM;
-      pEpData->p15minInvalidHist =
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minInvalidHist;
-      pEpData->pRec1day          =
-         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.rec1day);
-      pEpData->pHist1day         = DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY();
-      pEpData->nRecNum1day       = DSL_PM_CHANNEL_1DAY_RECORDS_NUM;
-      pEpData->p1dayInvalidHist  =
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayInvalidHist;
-      #endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
-      #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
-      pEpData->pRecShowtime      =
-         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.recShowtime);
-      pEpData->pHistShowtime     = DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME();
-      pEpData->nRecNumShowtime   = DSL_PM_CHANNEL_SHOWTIME_RECORDS_NUM;
-      pEpData->pShowtimeInvalidHist =
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.nShowtimeInvalidHist;
-      #endif /* INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS*/
-      #ifdef INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS
-      pEpData->pRecTotal         =
-         (DSL_uint8_t*)&(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.recTotal);
-      #endif /* INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS*/
-      pEpData->nEpRecElementSize = (DSL_uint32_t)sizeof(DSL_pmChannelData_t);
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   case DSL_PM_GROUP_CONTRIB_15MIN:
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, lineSec,
+         DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_15MIN(nIdx, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_15MIN(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, dataPath,
+         DSL_DRV_PM_PTR_DATAPATH_COUNTERS_15MIN(nIdx, 0, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_RETX_HISTORY_15MIN(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, reTx,
+         DSL_DRV_PM_PTR_RETX_COUNTERS_15MIN(nIdx, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
       break;
-#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
 
+   case DSL_PM_GROUP_CONTRIB_1DAY:
 #ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
-   case DSL_PM_COUNTER_LINE_SEC:
-      #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-      pEpData->pRec15min         =
-         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.rec15min);
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_1DAY(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, lineSec,
+         DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_1DAY(nIdx, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_1DAY(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, dataPath,
+         DSL_DRV_PM_PTR_DATAPATH_COUNTERS_1DAY(nIdx, 0, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_RETX_HISTORY_1DAY(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, reTx,
+         DSL_DRV_PM_PTR_RETX_COUNTERS_1DAY(nIdx, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
+#ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
+   case DSL_PM_GROUP_CONTRIB_SHOWTIME:
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_SHOWTIME(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, lineSec,
+         DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_SHOWTIME(nIdx, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_DATAPATH_HISTORY_SHOWTIME(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, dataPath,
+         DSL_DRV_PM_PTR_DATAPATH_COUNTERS_SHOWTIME(nIdx, 0, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
+                    pContext, DSL_DRV_PM_PTR_RETX_HISTORY_SHOWTIME(), 0, &nIdx);
+      if (nErrCode != DSL_SUCCESS)
+      {
+         break;
+      }
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, reTx,
+         DSL_DRV_PM_PTR_RETX_COUNTERS_SHOWTIME(nIdx, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS
+   case DSL_PM_GROUP_CONTRIB_TOTAL:
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, lineSec,
+         DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_TOTAL(nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, dataPath,
+         DSL_DRV_PM_PTR_DATAPATH_COUNTERS_TOTAL(0, nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS*/
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+      DSL_DRV_PM_GROUP_VALUES_APPLY(pGroup, pContrib, reTx,
+         DSL_DRV_PM_PTR_RETX_COUNTERS_TOTAL(nDirection));
+#endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS*/
+
+   default:
+      break;
+   }
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_void_t DSL_DRV_PM_GroupInit(DSL_void_t)
+{
+   DSL_uint32_t nGroup;
+
+   memset(g_PmGroup, 0x0, sizeof(g_PmGroup));
+
+   for (nGroup = 0; nGroup < DSL_PM_GROUP_NUMBER; nGroup++)
+   {
+      DSL_DRV_MUTEX_INIT(g_PmGroup[nGroup].groupMutex);
+   }
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_Error_t DSL_DRV_PM_GroupUpdate(
+   DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_GroupContext_t *pGroup;
+   DSL_PM_GroupCountersData_t *pRec;
+   DSL_PM_GroupLineData_t *pLine;
+   DSL_uint32_t nLine, nDir, nContrib;
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   DSL_uint32_t nLineInterval[2], nType;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
+   if (DSL_DRV_PM_CONTEXT(pContext) == DSL_NULL)
+   {
+      return DSL_ERROR;
+   }
+
+   /* Nothing to do without bonding, the group mutex is not taken at all*/
+   if (!DSL_DRV_BONDING_ENABLED)
+   {
+      return DSL_SUCCESS;
+   }
+
+   nLine = DSL_DEV_NUM(pContext);
+   if (nLine >= DSL_DRV_MAX_SUPPORTED_ENTITIES)
+   {
+      return DSL_ERROR;
+   }
+
+   /* Only lines of an enabled bonding group are aggregated*/
+   if (!DSL_DRV_BondingEnableCheck(pContext))
+   {
+      return DSL_DRV_PM_GroupLeave(pContext);
+   }
+
+   /* Lock PM module NE access mutex*/
+   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      return nErrCode;
+   }
+
+   /* Lock PM module FE access mutex*/
+   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_FAR_END, DSL_TRUE);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+      return nErrCode;
+   }
+
+   pGroup = DSL_DRV_PM_GROUP_GET(nLine);
+
+   /* Lock PM group mutex*/
+   if( DSL_DRV_MUTEX_LOCK(pGroup->groupMutex) )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM group mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      DSL_DRV_PM_AccessMutexControl(pContext, DSL_FAR_END, DSL_FALSE);
+      DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   pLine = &(pGroup->line[nLine % DSL_PM_GROUP_LINES]);
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   nLineInterval[0] = DSL_DRV_PM_CONTEXT(pContext)->n15MinIntervalNum;
+   nLineInterval[1] = DSL_DRV_PM_CONTEXT(pContext)->n1DayIntervalNum;
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
+   if (!(pGroup->nMemberMask & (1 << nLine)))
+   {
+      /* New member line, its counters are added to the current records*/
+      memset(pLine, 0x0, sizeof(DSL_PM_GroupLineData_t));
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+      for (nType = 0; nType < 2; nType++)
+      {
+         pLine->nLineInterval[nType]  = nLineInterval[nType];
+         pLine->nGroupInterval[nType] = pGroup->nInterval[nType];
+      }
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+      pGroup->nMemberMask |= (1 << nLine);
+      DSL_DRV_PM_CONTEXT(pContext)->bGroupMember = DSL_TRUE;
+
+      DSL_DEBUG(DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM group member added (mask=0x%x)"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pGroup->nMemberMask));
+   }
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+   /* Align the interval boundaries. The first line entering a new interval
+      starts the new group interval, the counters of the lines which did not
+      reach the boundary yet are still added to the previous one*/
+   for (nType = 0; nType < 2; nType++)
+   {
+      if (nLineInterval[nType] == pLine->nLineInterval[nType])
+      {
+         continue;
+      }
+
+      pLine->nLineInterval[nType] = nLineInterval[nType];
+
+      if (pLine->nGroupInterval[nType] == pGroup->nInterval[nType])
+      {
+         pGroup->nInterval[nType]++;
+
+         for (nDir = 0; nDir < 2; nDir++)
+         {
+            nContrib = (nType == 0) ?
+               DSL_PM_GROUP_REC_CURR_15MIN : DSL_PM_GROUP_REC_CURR_1DAY;
+            pGroup->rec[nDir][nContrib + 1] = pGroup->rec[nDir][nContrib];
+            memset(&(pGroup->rec[nDir][nContrib]), 0x0,
+               sizeof(DSL_PM_GroupCountersData_t));
+         }
+      }
+
+      pLine->nGroupInterval[nType] = pGroup->nInterval[nType];
+
+      /* The line counters of the new interval start from zero*/
+      for (nDir = 0; nDir < 2; nDir++)
+      {
+         memset(&(pLine->contrib[nDir][nType == 0 ?
+            DSL_PM_GROUP_CONTRIB_15MIN : DSL_PM_GROUP_CONTRIB_1DAY]), 0x0,
+            sizeof(DSL_PM_GroupCountersData_t));
+      }
+   }
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
+   for (nDir = 0; (nDir < 2) && (nErrCode == DSL_SUCCESS); nDir++)
+   {
+      for (nContrib = 0; nContrib < DSL_PM_GROUP_CONTRIB_LAST; nContrib++)
+      {
+         pRec = DSL_DRV_PM_GroupRecordGet(pGroup, pLine, nDir,
+                   (DSL_PM_GroupContribution_t)nContrib);
+         if (pRec == DSL_NULL)
+         {
+            /* Line is more than one interval behind the group, its values
+               are only taken over as the new contribution base*/
+            pGroup->nDroppedUpdates++;
+         }
+
+         nErrCode = DSL_DRV_PM_GroupContributionApply(
+            pContext, (DSL_XTUDir_t)nDir, (DSL_PM_GroupContribution_t)nContrib,
+            pRec, &(pLine->contrib[nDir][nContrib]));
+         if (nErrCode != DSL_SUCCESS)
+         {
+            DSL_DEBUG( DSL_DBG_ERR,
+               (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM group counters "
+               "update failed!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+            break;
+         }
+      }
+   }
+
+   /* Unlock PM group mutex*/
+   DSL_DRV_MUTEX_UNLOCK(pGroup->groupMutex);
+
+   /* Unlock PM module FE access mutex*/
+   DSL_DRV_PM_AccessMutexControl(pContext, DSL_FAR_END, DSL_FALSE);
+
+   /* Unlock PM module NE access mutex*/
+   DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+
+   return nErrCode;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_Error_t DSL_DRV_PM_GroupLeave(
+   DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_GroupContext_t *pGroup;
+   DSL_PM_GroupLineData_t *pLine;
+   DSL_PM_GroupCountersData_t zeroData;
+   DSL_uint32_t nLine, nDir, nContrib;
+
+   DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
+   DSL_CHECK_ERR_CODE();
+
+   /* Skip the group mutex for lines which are not bonded*/
+   if (DSL_DRV_PM_CONTEXT(pContext)->bGroupMember != DSL_TRUE)
+   {
+      return DSL_SUCCESS;
+   }
+
+   nLine = DSL_DEV_NUM(pContext);
+   if (nLine >= DSL_DRV_MAX_SUPPORTED_ENTITIES)
+   {
+      return DSL_ERROR;
+   }
+
+   pGroup = DSL_DRV_PM_GROUP_GET(nLine);
+
+   /* Lock PM group mutex*/
+   if( DSL_DRV_MUTEX_LOCK(pGroup->groupMutex) )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM group mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   if (pGroup->nMemberMask & (1 << nLine))
+   {
+      pLine = &(pGroup->line[nLine % DSL_PM_GROUP_LINES]);
+      memset(&zeroData, 0x0, sizeof(DSL_PM_GroupCountersData_t));
+
+      /* Remove the line counters from the group records*/
+      for (nDir = 0; nDir < 2; nDir++)
+      {
+         for (nContrib = 0; nContrib < DSL_PM_GROUP_CONTRIB_LAST; nContrib++)
+         {
+            DSL_DRV_PM_GroupValuesApply(
+               (DSL_uint32_t*)DSL_DRV_PM_GroupRecordGet(pGroup, pLine, nDir,
+                  (DSL_PM_GroupContribution_t)nContrib),
+               (DSL_uint32_t*)&(pLine->contrib[nDir][nContrib]),
+               (const DSL_uint32_t*)&zeroData,
+               sizeof(DSL_PM_GroupCountersData_t) / sizeof(DSL_uint32_t));
+         }
+      }
+
+      pGroup->nMemberMask &= ~(1 << nLine);
+
+      DSL_DEBUG(DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM group member removed (mask=0x%x)"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pGroup->nMemberMask));
+   }
+   DSL_DRV_PM_CONTEXT(pContext)->bGroupMember = DSL_FALSE;
+
+   /* Unlock PM group mutex*/
+   DSL_DRV_MUTEX_UNLOCK(pGroup->groupMutex);
+
+   return DSL_SUCCESS;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_Error_t DSL_DRV_PM_GroupCountersCopy(
+   DSL_Context_t *pContext,
+   const DSL_XTUDir_t nDirection,
+   DSL_PM_GroupCountersAllData_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_GroupContext_t *pGroup;
+   DSL_PM_GroupCountersData_t *pRec;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   if (DSL_DEV_NUM(pContext) >= DSL_DRV_MAX_SUPPORTED_ENTITIES)
+   {
+      return DSL_ERROR;
+   }
+
+   pGroup = DSL_DRV_PM_GROUP_GET(DSL_DEV_NUM(pContext));
+
+   /* Lock PM group mutex*/
+   if( DSL_DRV_MUTEX_LOCK(pGroup->groupMutex) )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM group mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   pRec = pGroup->rec[nDirection == DSL_NEAR_END ? 0 : 1];
+
+   pData->nMemberMask     = pGroup->nMemberMask;
+   pData->n15MinInterval  = pGroup->nInterval[0];
+   pData->n1DayInterval   = pGroup->nInterval[1];
+   pData->nDroppedUpdates = pGroup->nDroppedUpdates;
+   pData->curr15Min = pRec[DSL_PM_GROUP_REC_CURR_15MIN];
+   pData->prev15Min = pRec[DSL_PM_GROUP_REC_PREV_15MIN];
+   pData->curr1Day  = pRec[DSL_PM_GROUP_REC_CURR_1DAY];
+   pData->prev1Day  = pRec[DSL_PM_GROUP_REC_PREV_1DAY];
+   pData->total     = pRec[DSL_PM_GROUP_REC_TOTAL];
+   pData->showtime  = pRec[DSL_PM_GROUP_REC_SHOWTIME];
+
+   /* Unlock PM group mutex*/
+   DSL_DRV_MUTEX_UNLOCK(pGroup->groupMutex);
+
+   return DSL_SUCCESS;
+}
+
+DSL_Error_t DSL_DRV_PM_Lock(DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG( DSL_DBG_MSG,(pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_Lock"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   if( !(DSL_DRV_PM_CONTEXT(pContext)->bPmLock) )
+   {
+      /* Lock PM module Near-End Mutex*/
+      if(down_interruptible(&(DSL_DRV_PM_CONTEXT(pContext)->pmNeMutex)))
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM NE mutex!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         return DSL_ERR_SEMAPHORE_GET;
+      }
+      /* Lock PM module Near-End Mutex*/
+      if( down_interruptible(&(DSL_DRV_PM_CONTEXT(pContext)->pmFeMutex)) )
+      {
+         DSL_DEBUG( DSL_DBG_ERR,
+            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM FE mutex!"
+            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+         return DSL_ERR_SEMAPHORE_GET;
+      }
+
+      /* Set bPmLock flag*/
+      DSL_DRV_PM_CONTEXT(pContext)->bPmLock = DSL_TRUE;
+
+      DSL_DEBUG( DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM locked successfully"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM module already locked"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_Lock, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_DRV_PM_UnLock(DSL_Context_t *pContext)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
+   DSL_CHECK_ERR_CODE();
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_UnLock"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+   if( DSL_DRV_PM_CONTEXT(pContext)->bPmLock )
+   {
+      /* Unlock PM module NE Mutex*/
+      up(&(DSL_DRV_PM_CONTEXT(pContext)->pmNeMutex));
+
+      /* Unlock PM module FE Mutex*/
+      up(&(DSL_DRV_PM_CONTEXT(pContext)->pmFeMutex));
+
+      /* Clear bPmLock flag*/
+      DSL_DRV_PM_CONTEXT(pContext)->bPmLock = DSL_FALSE;
+
+      /* Counters could be reset or restored while locked, publish them*/
+      DSL_DRV_PM_CountersPublish(pContext);
+
+      DSL_DEBUG( DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM unlocked successfully"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_MSG,
+         (pContext, SYS_DBG_MSG"DSL[%02d]: PM already unlocked"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_UnLock, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+static DSL_Error_t DSL_DRV_PM_EpDataGet(
+   DSL_Context_t *pContext,
+   DSL_PM_EpData_t *pEpData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, pEpData);
+   DSL_CHECK_ERR_CODE();
+
+   switch (pEpData->epType)
+   {
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+   case DSL_PM_COUNTER_CHANNEL:
+      #ifdef INCLUDE_DSL_CPE_PM_HISTORY
+      pEpData->pRec15min         =
+         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.rec15min);
+      pEpData->pHist15min        = DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN();
+      pEpData->nRecNum15min      = DSL_PM_CHANNEL_15MIN_RECORDS_NUM;
+      pEpData->p15minInvalidHist =
+         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minInvalidHist;
+      pEpData->pRec1day          =
+         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.rec1day);
+      pEpData->pHist1day         = DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY();
+      pEpData->nRecNum1day       = DSL_PM_CHANNEL_1DAY_RECORDS_NUM;
+      pEpData->p1dayInvalidHist  =
+         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayInvalidHist;
+      #endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+      #ifdef INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS
+      pEpData->pRecShowtime      =
+         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.recShowtime);
+      pEpData->pHistShowtime     = DSL_DRV_PM_PTR_CHANNEL_HISTORY_SHOWTIME();
+      pEpData->nRecNumShowtime   = DSL_PM_CHANNEL_SHOWTIME_RECORDS_NUM;
+      pEpData->pShowtimeInvalidHist =
+         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.nShowtimeInvalidHist;
+      #endif /* INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS*/
+      #ifdef INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS
+      pEpData->pRecTotal         =
+         (DSL_uint8_t*)&(DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.recTotal);
+      #endif /* INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS*/
+      pEpData->nEpRecElementSize = (DSL_uint32_t)sizeof(DSL_pmChannelData_t);
+      break;
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+   case DSL_PM_COUNTER_LINE_SEC:
+      #ifdef INCLUDE_DSL_CPE_PM_HISTORY
+      pEpData->pRec15min         =
+         (DSL_uint8_t*)(DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.rec15min);
       pEpData->pHist15min        = DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN();
       pEpData->nRecNum15min      = DSL_PM_LINE_15MIN_RECORDS_NUM;
       pEpData->p15minInvalidHist =
@@ -1487,7 +2585,7 @@ DSL_Error_t DSL_DRV_PM_HistoryDelete(
    DSL_CHECK_ERR_CODE();
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -1499,6 +2597,8 @@ DSL_Error_t DSL_DRV_PM_HistoryDelete(
    hist->curItem  = 0;
    hist->itemsNum = 1;
 
+   DSL_DRV_PM_CONTEXT(pContext)->nHistoryChangeNum++;
+
    /* Unlock PM module Mutex*/
    DSL_DRV_MUTEX_UNLOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
 
@@ -1521,7 +2621,7 @@ DSL_Error_t DSL_DRV_PM_HistoryCurItemUpdate(
    DSL_CHECK_ERR_CODE();
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,(pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - "
          "Couldn't lock PM mutex!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
@@ -1531,9 +2631,49 @@ DSL_Error_t DSL_DRV_PM_HistoryCurItemUpdate(
 
    hist->curItem = (hist->curItem < (hist->historySize-1)) ? (hist->curItem + 1) : 0;
 
-   if( hist->itemsNum < hist->historySize )
+   if( hist->itemsNum < hist->historySize )
+   {
+      hist->itemsNum++;
+   }
+
+   DSL_DRV_PM_CONTEXT(pContext)->nHistoryChangeNum++;
+
+   /* Unlock PM module Mutex*/
+   DSL_DRV_MUTEX_UNLOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_DRV_PM_HistoryChangeNumGet(
+   DSL_Context_t *pContext,
+   DSL_uint32_t *pChangeNum)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_CTX_POINTER(pContext);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_POINTER(pContext, DSL_DRV_PM_CONTEXT(pContext));
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_POINTER(pContext, pChangeNum);
+   DSL_CHECK_ERR_CODE();
+
+   /* Lock PM module Mutex*/
+   if( DSL_DRV_PM_MutexLock(pContext) )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   *pChangeNum = DSL_DRV_PM_CONTEXT(pContext)->nHistoryChangeNum;
+
+   if (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE)
    {
-      hist->itemsNum++;
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
    }
 
    /* Unlock PM module Mutex*/
@@ -1562,7 +2702,7 @@ DSL_Error_t DSL_DRV_PM_HistoryFillLevelGet(
    DSL_CHECK_ERR_CODE();
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,(pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - "
          "Couldn't lock PM mutex!"DSL_DRV_CRLF,
@@ -1600,7 +2740,7 @@ DSL_Error_t DSL_DRV_PM_HistoryItemIdxGet(
    DSL_CHECK_ERR_CODE();
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,(pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - "
          "Couldn't lock PM mutex!"DSL_DRV_CRLF,
@@ -1630,6 +2770,237 @@ DSL_Error_t DSL_DRV_PM_HistoryItemIdxGet(
    return nErrCode;
 }
 
+DSL_Error_t DSL_DRV_PM_PubHistoryFillLevelGet(
+   DSL_Context_t *pContext,
+   DSL_pmHistory_t *hist,
+   DSL_uint32_t *pFillLevel)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, hist);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_POINTER(pContext, pFillLevel);
+   DSL_CHECK_ERR_CODE();
+
+   /* Published history is not modified, no PM module mutex needed*/
+   *pFillLevel = hist->itemsNum ? hist->itemsNum - 1 : 0;
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_DRV_PM_PubHistoryItemIdxGet(
+   DSL_Context_t *pContext,
+   DSL_pmHistory_t *hist,
+   DSL_uint32_t histInterval,
+   DSL_int_t *pIdx)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   DSL_CHECK_POINTER(pContext, hist);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_POINTER(pContext, pIdx);
+   DSL_CHECK_ERR_CODE();
+
+   if((histInterval > hist->historySize) || (hist->historySize == 0) ||
+      (hist->curItem >= hist->historySize))
+   {
+      DSL_DEBUG(DSL_DBG_ERR, (DSL_NULL,
+         SYS_DBG_ERR"DSL[%02d]: PMHistory_GetItem: invalid history item number (%u of %u)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), histInterval, hist->historySize));
+
+      return DSL_ERROR;
+   }
+
+   *pIdx = (DSL_int_t)((hist->historySize+hist->curItem-histInterval)
+      % (hist->historySize));
+
+   return nErrCode;
+}
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+#ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
+/** History statistics reader arguments*/
+typedef struct
+{
+   /** History within the working counters*/
+   DSL_pmHistory_t *pHist;
+   /** Invalid intervals history within the working counters*/
+   DSL_pmBF_IntervalFailures_t *pInvalidHist;
+   /** History statistics*/
+   DSL_PM_HistoryStatsData_t *pData;
+} DSL_PM_HistoryStatsArg_t;
+
+/*
+   Counts the previous and the previous invalid intervals of the history
+   within the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_HistoryStatsRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistoryStatsArg_t *pStatsArg = (DSL_PM_HistoryStatsArg_t*)pArg;
+   DSL_pmHistory_t *pHist = DSL_NULL;
+   DSL_pmBF_IntervalFailures_t *pInvalidHist = DSL_NULL;
+   DSL_uint32_t histFillLevel = 0, histInv = 0;
+   DSL_int_t histIdx = -1;
+
+   pHist = DSL_DRV_PM_PUB_PTR(pContext, pPub, pStatsArg->pHist);
+   pInvalidHist = DSL_DRV_PM_PUB_PTR(pContext, pPub, pStatsArg->pInvalidHist);
+
+   pStatsArg->pData->nPrevIvs = 0;
+   pStatsArg->pData->nPrevInvalidIvs = 0;
+
+   /* Get Hisory fill level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(pContext, pHist, &histFillLevel);
+   if( nErrCode != DSL_SUCCESS )
+   {
+      return nErrCode;
+   }
+
+   /* Set the number of previous intervals*/
+   pStatsArg->pData->nPrevIvs = histFillLevel;
+
+   for( histInv = 1; histInv <= histFillLevel; histInv++ )
+   {
+      /* Get History Item Index*/
+      nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                    pContext, pHist, histInv, &histIdx);
+
+      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+      {
+         return DSL_ERROR;
+      }
+
+      pStatsArg->pData->nPrevInvalidIvs += pInvalidHist[histIdx] != 0 ? 1 : 0;
+   }
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_DRV_PM_HistoryStatsGet(
+   DSL_Context_t *pContext,
+   DSL_pmHistory_t *pHist,
+   DSL_pmBF_IntervalFailures_t *pInvalidHist,
+   DSL_PM_HistoryStatsData_t *pData)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistoryStatsArg_t StatsArg;
+
+   DSL_CHECK_POINTER(pContext, pData);
+   DSL_CHECK_ERR_CODE();
+
+   StatsArg.pHist        = pHist;
+   StatsArg.pInvalidHist = pInvalidHist;
+   StatsArg.pData        = pData;
+
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_HistoryStatsRead, &StatsArg);
+
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history statistics get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   }
+
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS*/
+
+DSL_Error_t DSL_DRV_PM_History15MinNextGet(
+   DSL_Context_t *pContext,
+   DSL_PM_EpType_t EpType,
+   DSL_XTUDir_t nDirection,
+   DSL_boolean_t bValidOnly,
+   DSL_uint32_t nInterval,
+   DSL_uint32_t *pNextInterval)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_EpData_t EpData;
+   DSL_PM_CountersData_t *pPub = DSL_NULL;
+   DSL_uint32_t nPubSeq = 0, histFillLevel = 0, histInv = 0;
+   DSL_int_t histIdx = -1;
+   DSL_pmHistory_t *pHist = DSL_NULL;
+   DSL_pmBF_IntervalFailures_t *pInvalidHist = DSL_NULL;
+   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
+
+   DSL_CHECK_POINTER(pContext, pNextInterval);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_ATU_DIRECTION(nDirection);
+   DSL_CHECK_ERR_CODE();
+
+   *pNextInterval = 0;
+
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
+
+   memset(&EpData, 0, sizeof(DSL_PM_EpData_t));
+   EpData.epType = EpType;
+
+   nErrCode = DSL_DRV_PM_EpDataGet(pContext, &EpData);
+   if ((nErrCode != DSL_SUCCESS) || (EpData.pHist15min == DSL_NULL) ||
+       (EpData.p15minInvalidHist == DSL_NULL))
+   {
+      return DSL_ERR_NOT_SUPPORTED;
+   }
+
+   /* Get Interval Failures mask*/
+   failuresMask = nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+
+   do
+   {
+      /* Get the last published PM counters*/
+      pPub = DSL_DRV_PM_PublishedCountersGet(pContext, &nPubSeq);
+
+      pHist = DSL_DRV_PM_PUB_PTR(pContext, pPub, EpData.pHist15min);
+      pInvalidHist = DSL_DRV_PM_PUB_PTR(pContext, pPub, EpData.p15minInvalidHist);
+      *pNextInterval = 0;
+
+      nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                    pContext, pHist, &histFillLevel);
+      if( nErrCode != DSL_SUCCESS )
+      {
+         continue;
+      }
+
+      for( histInv = nInterval + 1; histInv <= histFillLevel; histInv++ )
+      {
+         if (bValidOnly == DSL_FALSE)
+         {
+            *pNextInterval = histInv;
+            break;
+         }
+
+         nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                       pContext, pHist, histInv, &histIdx);
+         if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+         {
+            nErrCode = DSL_ERROR;
+            break;
+         }
+
+         if ((pInvalidHist[histIdx] & failuresMask) == 0)
+         {
+            *pNextInterval = histInv;
+            break;
+         }
+      }
+   } while (DSL_DRV_PM_PublishedCountersRetry(pContext, pPub, nPubSeq));
+
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+
 static DSL_Error_t DSL_DRV_PM_HistoryEpUpdate(
    DSL_Context_t *pContext,
    DSL_PM_HistoryType_t HistoryType,
@@ -1905,6 +3276,8 @@ DSL_Error_t DSL_DRV_PM_HistoryUpdate(DSL_Context_t *pContext)
 
       /* Reset b15minElapsed flag*/
       DSL_DRV_PM_CONTEXT(pContext)->b15minElapsed = DSL_FALSE;
+      /* Count the elapsed intervals for the bonding group alignment*/
+      DSL_DRV_PM_CONTEXT(pContext)->n15MinIntervalNum++;
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
       nErrCode = DSL_DRV_PM_HistoryEpUpdate(
                     pContext, DSL_PM_HISTORY_15MIN, DSL_PM_COUNTER_CHANNEL);
@@ -2002,6 +3375,8 @@ DSL_Error_t DSL_DRV_PM_HistoryUpdate(DSL_Context_t *pContext)
 
       /* Reset b1dayElapsed flag*/
       DSL_DRV_PM_CONTEXT(pContext)->b1dayElapsed = DSL_FALSE;
+      /* Count the elapsed intervals for the bonding group alignment*/
+      DSL_DRV_PM_CONTEXT(pContext)->n1DayIntervalNum++;
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
       nErrCode = DSL_DRV_PM_HistoryEpUpdate(
                     pContext, DSL_PM_HISTORY_1DAY, DSL_PM_COUNTER_CHANNEL);
@@ -2135,21 +3510,19 @@ DSL_Error_t DSL_DRV_PM_InternalCountersGet(
    DSL_XTUDir_t nDirection)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      return nErrCode;
-   }
+   DSL_PM_CountersData_t *pPub = DSL_NULL;
+   DSL_uint32_t nPubSeq = 0;
 
    if (pTo && pFrom)
    {
-      /* Copy Counters data*/
-      memcpy(pTo, pFrom, nSize);
+      do
+      {
+         /* Get the last published PM counters*/
+         pPub = DSL_DRV_PM_PublishedCountersGet(pContext, &nPubSeq);
+
+         /* Copy Counters data*/
+         memcpy(pTo, DSL_DRV_PM_PUB_PTR(pContext, pPub, pFrom), nSize);
+      } while (DSL_DRV_PM_PublishedCountersRetry(pContext, pPub, nPubSeq));
    }
    else
    {
@@ -2159,9 +3532,6 @@ DSL_Error_t DSL_DRV_PM_InternalCountersGet(
       nErrCode = DSL_ERR_INTERNAL;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, nDirection, DSL_FALSE);
-
    return nErrCode;
 }
 #endif /* INCLUDE_DSL_CPE_PM_TOTAL_COUNTERS*/
@@ -2384,10 +3754,63 @@ DSL_Error_t DSL_DRV_PM_CountersReset(
    return nErrCode;
 }
 
+#if defined(INCLUDE_DSL_CPE_PM_HISTORY) && defined(INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS)
+#if defined(INCLUDE_DSL_CPE_PM_CHANNEL_THRESHOLDS) || \
+    defined(INCLUDE_DSL_CPE_PM_LINE_THRESHOLDS) || \
+    defined(INCLUDE_DSL_CPE_PM_DATA_PATH_THRESHOLDS) || \
+    defined(INCLUDE_DSL_CPE_PM_RETX_THRESHOLDS)
+/*
+   Function to update the stored 15-min and 1-day interval threshold
+   indications with the current crossing bitmasks.
+   Returns DSL_TRUE if at least one indication bit is newly set since the last
+   check.
+*/
+static DSL_boolean_t DSL_DRV_PM_ThresholdsCrossingUpdate(
+   const DSL_uint32_t n15mEvtInd,
+   const DSL_uint32_t n1dEvtInd,
+   DSL_uint32_t *p15mInd,
+   DSL_uint32_t *p1dInd)
+{
+   DSL_uint32_t nNewBits;
+
+   nNewBits = (n15mEvtInd & ~(*p15mInd)) | (n1dEvtInd & ~(*p1dInd));
+
+   *p15mInd = n15mEvtInd;
+   *p1dInd  = n1dEvtInd;
+
+   return nNewBits ? DSL_TRUE : DSL_FALSE;
+}
+#endif /* defined(INCLUDE_DSL_CPE_PM_CHANNEL_THRESHOLDS) || ...*/
+#endif /* defined(INCLUDE_DSL_CPE_PM_HISTORY) && defined(INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS)*/
+
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_uint32_t DSL_DRV_PM_ChannelThresholdsCrossingEval(
+   const DSL_PM_ChannelData_t *pCounters,
+   const DSL_PM_ChannelData_t *pThresholds)
+{
+   DSL_uint32_t nInd = DSL_PM_CHANNELTHRESHCROSS_EMPTY;
+
+   if( pCounters->nFEC > pThresholds->nFEC )
+   {
+      nInd |= DSL_PM_CHANNELTHRESHCROSS_FEC;
+   }
+
+   if( pCounters->nCodeViolations > pThresholds->nCodeViolations )
+   {
+      nInd |= DSL_PM_CHANNELTHRESHCROSS_CV;
+   }
+
+   return nInd;
+}
+
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_THRESHOLDS
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
 #ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
+
 /* Function to check the Channel Counters thresholds crossing for 15-min and 1-day
     interval counters. Appropriate event will be generated on the thresholds crossing
     condition*/
@@ -2400,11 +3823,7 @@ static DSL_Error_t DSL_DRV_PM_ChannelCountersThresholdsCrossingCheck(
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_PM_ChannelThresholdCrossing_t channelThresholdCrossing;
-   DSL_uint8_t i = 0;
-   DSL_uint32_t *pEvtThresholdInd, *pThresholdInd;
    DSL_pmChannelThresholdCrossingData_t *pInd ;
-   DSL_PM_ChannelData_t *pThresholds;
-   DSL_PM_ChannelData_t *pCounters = DSL_NULL;
    DSL_boolean_t bEvent = DSL_FALSE;
 
    DSL_CHECK_CTX_POINTER(pContext);
@@ -2425,41 +3844,17 @@ static DSL_Error_t DSL_DRV_PM_ChannelCountersThresholdsCrossingCheck(
 
    pInd = DSL_DRV_PM_PTR_CHANNEL_THRESHOLD_IND(nChannel, nDirection);
 
-   channelThresholdCrossing.n15Min = DSL_PM_CHANNELTHRESHCROSS_EMPTY;
-   channelThresholdCrossing.n1Day  = DSL_PM_CHANNELTHRESHCROSS_EMPTY;
-
-   for (i = 0; i < 2; i++)
-   {
-      if (i == 0)
-      {
-         pEvtThresholdInd = &(channelThresholdCrossing.n15Min);
-         pThresholdInd    = &(pInd->n15Min);
-         pThresholds      = DSL_DRV_PM_PTR_CHANNEL_THRESHOLD_15MIN(nChannel, nDirection);
-         pCounters        = p15mCounters;
-      }
-      else
-      {
-         pEvtThresholdInd = &(channelThresholdCrossing.n1Day);
-         pThresholdInd    = &(pInd->n1Day);
-         pThresholds      = DSL_DRV_PM_PTR_CHANNEL_THRESHOLD_1DAY(nChannel, nDirection);
-         pCounters        = p1dCounters;
-      }
-
-      if( pCounters->nFEC > pThresholds->nFEC)
-         *pEvtThresholdInd |= DSL_PM_CHANNELTHRESHCROSS_FEC;
+   /* Check 15-min and 1-day interval thresholds*/
+   channelThresholdCrossing.n15Min = DSL_DRV_PM_ChannelThresholdsCrossingEval(
+      p15mCounters, DSL_DRV_PM_PTR_CHANNEL_THRESHOLD_15MIN(nChannel, nDirection));
+   channelThresholdCrossing.n1Day  = DSL_DRV_PM_ChannelThresholdsCrossingEval(
+      p1dCounters, DSL_DRV_PM_PTR_CHANNEL_THRESHOLD_1DAY(nChannel, nDirection));
 
-      if( pCounters->nCodeViolations > pThresholds->nCodeViolations )
-         *pEvtThresholdInd |= DSL_PM_CHANNELTHRESHCROSS_CV;
+   bEvent = DSL_DRV_PM_ThresholdsCrossingUpdate(
+               channelThresholdCrossing.n15Min, channelThresholdCrossing.n1Day,
+               &(pInd->n15Min), &(pInd->n1Day));
 
-      /* Check if new threshold crossing occured since the last check*/
-      if( *pEvtThresholdInd != *pThresholdInd )
-      {
-         *pThresholdInd = *pEvtThresholdInd;
-         bEvent = DSL_TRUE;
-      }
-   }
-
-   /* Check if at least one threshold crossing occured*/
+   /* Check if at least one new threshold crossing occured*/
    if (bEvent)
    {
       /* Get current PM module time*/
@@ -2803,11 +4198,18 @@ static DSL_Error_t DSL_DRV_PM_ChannelCountersUpdate(
 }
 
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-DSL_Error_t DSL_DRV_PM_ChannelCountersHistoryIntervalGet(
+/*
+   Reads the counters of DSL_DRV_PM_ChannelCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_ChannelCountersHistoryIntervalRead(
    DSL_Context_t *pContext,
-   DSL_PM_HistIntervalType_t intervalType,
-   DSL_PM_ChannelCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_ChannelCounters_t *pCounters = (DSL_PM_ChannelCounters_t*)pReadArg->pCounters;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -2815,6 +4217,94 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersHistoryIntervalGet(
    DSL_pmHistory_t *pHist = DSL_NULL;
    DSL_PM_ChannelData_t *pChCounters;
 
+   /* Get Interval Failures mask*/
+   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY());
+
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
+
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return nErrCode;
+   }
+
+   if( pCounters->nHistoryInterval > histFillLevel )
+   {
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
+
+   /* Get History Item Index*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
+
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERROR;
+   }
+
+   /* Set Elapsed time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->channelCounters.n15minTimeHist[histIdx] :
+      pPub->channelCounters.n1dayTimeHist[histIdx];
+
+   pChCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_COUNTERS_15MIN(histIdx,pCounters->nChannel,pCounters->nDirection)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_COUNTERS_1DAY(histIdx,pCounters->nChannel,pCounters->nDirection));
+
+   if (pChCounters != DSL_NULL)
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
+
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->channelCounters.n15minInvalidHist[histIdx] :
+         pPub->channelCounters.n1dayInvalidHist[histIdx];
+
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pChCounters, sizeof(DSL_PM_ChannelData_t));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      nErrCode = DSL_ERR_INTERNAL;
+   }
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_DRV_PM_ChannelCountersHistoryIntervalGet(
+   DSL_Context_t *pContext,
+   DSL_PM_HistIntervalType_t intervalType,
+   DSL_PM_ChannelCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
+
    DSL_CHECK_POINTER(pContext, pCounters);
    DSL_CHECK_ERR_CODE();
 
@@ -2837,111 +4327,121 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersHistoryIntervalGet(
       return DSL_ERROR;
    }
 
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
+
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_ChannelCountersHistoryIntervalRead, &ReadArg);
+
+   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   {
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+   }
+
+   return nErrCode;
+}
+
+#if defined (INCLUDE_DSL_CPE_PM_CHANNEL_EXT_COUNTERS)
+/*
+   Reads the counters of DSL_DRV_PM_ChannelCountersExtHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_ChannelCountersExtHistoryIntervalRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
+{
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_ChannelCountersExt_t *pCounters = (DSL_PM_ChannelCountersExt_t*)pReadArg->pCounters;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
+   DSL_int_t histIdx = -1;
+   DSL_uint32_t histFillLevel = 0;
+   DSL_pmHistory_t *pHist = DSL_NULL;
+   DSL_PM_ChannelDataExt_t *pChCounters;
+
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY());
+
+   /* Get History Fill Level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-      (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
       return nErrCode;
    }
 
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY();
-
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         break;
-      }
-
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
-      }
-
-      /* Get History Item Index*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   /* Get History Item Index*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
 
-      /* Set Elapsed time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayTimeHist[histIdx];
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERROR;
+   }
 
-      pChCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_CHANNEL_COUNTERS_15MIN(histIdx,pCounters->nChannel,pCounters->nDirection) :
-         DSL_DRV_PM_PTR_CHANNEL_COUNTERS_1DAY(histIdx,pCounters->nChannel,pCounters->nDirection);
+   /* Set Elapsed time*/
+   pCounters->interval.nElapsedTime =
+      intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->channelCounters.n15minTimeHist[histIdx] :
+      pPub->channelCounters.n1dayTimeHist[histIdx];
 
-      if (pChCounters != DSL_NULL)
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+   pChCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_COUNTERS_15MIN_EXT(histIdx,pCounters->nChannel)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_CHANNEL_COUNTERS_1DAY_EXT(histIdx,pCounters->nChannel));
 
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
+   if (pChCounters != DSL_NULL)
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayInvalidHist[histIdx];
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pChCounters, sizeof(DSL_PM_ChannelData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->channelCounters.n15minInvalidHist[histIdx] :
+         pPub->channelCounters.n1dayInvalidHist[histIdx];
 
-      break;
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pChCounters, sizeof(DSL_PM_ChannelDataExt_t));
    }
-
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
-
-   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   else
    {
-      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      nErrCode = DSL_ERR_INTERNAL;
    }
 
    return nErrCode;
 }
 
-#if defined (INCLUDE_DSL_CPE_PM_CHANNEL_EXT_COUNTERS)
 /*
    For a detailed description of the function, its arguments and return value
    please refer to the description in the header file 'drv_dsl_cpe_intern_pm.h'
@@ -2952,11 +4452,7 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersExtHistoryIntervalGet(
    DSL_PM_ChannelCountersExt_t *pCounters)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
-   DSL_int_t histIdx = -1;
-   DSL_uint32_t histFillLevel = 0;
-   DSL_pmHistory_t *pHist = DSL_NULL;
-   DSL_PM_ChannelDataExt_t *pChCounters;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
 
    DSL_CHECK_POINTER(pContext, pCounters);
    DSL_CHECK_ERR_CODE();
@@ -2980,101 +4476,11 @@ DSL_Error_t DSL_DRV_PM_ChannelCountersExtHistoryIntervalGet(
       return DSL_ERROR;
    }
 
-   /* Get Interval Failures mask*/
-   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
-      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
-      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
-
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-      return nErrCode;
-   }
-
-   while(1)
-   {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_CHANNEL_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_CHANNEL_HISTORY_1DAY();
-
-      /* Get History Fill Level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         break;
-      }
-
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
-      }
-
-      /* Get History Item Index*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
-
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index error!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         nErrCode = DSL_ERROR;
-         break;
-      }
-
-      /* Set Elapsed time*/
-      pCounters->interval.nElapsedTime =
-         intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayTimeHist[histIdx];
-
-      pChCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_CHANNEL_COUNTERS_15MIN_EXT(histIdx,pCounters->nChannel) :
-         DSL_DRV_PM_PTR_CHANNEL_COUNTERS_1DAY_EXT(histIdx,pCounters->nChannel);
-
-      if (pChCounters != DSL_NULL)
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
-
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
-
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->channelCounters.n1dayInvalidHist[histIdx];
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pChCounters, sizeof(DSL_PM_ChannelDataExt_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-         nErrCode = DSL_ERR_INTERNAL;
-      }
-
-      break;
-   }
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_ChannelCountersExtHistoryIntervalRead, &ReadArg);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -3146,6 +4552,130 @@ static DSL_Error_t DSL_DRV_PM_LineInitCountersCurrentGet(
 #endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
 
 #ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_uint32_t DSL_DRV_PM_LineSecThresholdsCrossingEval(
+   const DSL_PM_LineSecData_t *pCounters,
+   const DSL_PM_LineSecData_t *pThresholds)
+{
+   DSL_uint32_t nInd = DSL_PM_LINETHRESHCROSS_EMPTY;
+
+   if( pCounters->nES > pThresholds->nES )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_ES;
+   }
+
+   if( pCounters->nLOFS > pThresholds->nLOFS )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_LOFS;
+   }
+
+   if( pCounters->nLOSS > pThresholds->nLOSS )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_LOSS;
+   }
+
+   if( pCounters->nSES > pThresholds->nSES )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_SES;
+   }
+
+   if( pCounters->nUAS > pThresholds->nUAS )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_UAS;
+   }
+
+   if( pCounters->nFECS > pThresholds->nFECS )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_FECS;
+   }
+
+   return nInd;
+}
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_uint32_t DSL_DRV_PM_LineInitThresholdsCrossingEval(
+   const DSL_PM_LineInitData_t *pCounters,
+   const DSL_PM_LineInitData_t *pThresholds)
+{
+   DSL_uint32_t nInd = DSL_PM_LINETHRESHCROSS_EMPTY;
+
+   if( pCounters->nFailedFullInits > pThresholds->nFailedFullInits )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_FIFAIL;
+   }
+
+   if( pCounters->nFailedShortInits > pThresholds->nFailedShortInits )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_SIFAIL;
+   }
+
+   if( pCounters->nFullInits > pThresholds->nFullInits )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_FI;
+   }
+
+   if( pCounters->nShortInits > pThresholds->nShortInits )
+   {
+      nInd |= DSL_PM_LINETHRESHCROSS_SI;
+   }
+
+   return nInd;
+}
+
+#ifdef INCLUDE_DSL_ADSL_MIB
+/* Line Sec threshold crossing to MIB threshold flags mapping*/
+static const struct
+{
+   DSL_uint32_t nBit;
+   DSL_MIB_ADSL_Thresholds_t nMibFlagNe;
+   DSL_MIB_ADSL_Thresholds_t nMibFlagFe;
+} DSL_DRV_PM_LineSecMibThresholdTable[] =
+{
+   {DSL_PM_LINETHRESHCROSS_ES,   DSL_MIB_THRESHOLD_ATUR_ESS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_ESS_FLAG},
+   {DSL_PM_LINETHRESHCROSS_LOFS, DSL_MIB_THRESHOLD_ATUR_LOFS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_LOFS_FLAG},
+   {DSL_PM_LINETHRESHCROSS_LOSS, DSL_MIB_THRESHOLD_ATUR_LOSS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_LOSS_FLAG},
+   {DSL_PM_LINETHRESHCROSS_SES,  DSL_MIB_THRESHOLD_ATUR_15MIN_SESL_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_15MIN_SESL_FLAG},
+   {DSL_PM_LINETHRESHCROSS_UAS,  DSL_MIB_THRESHOLD_ATUR_15MIN_UASL_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_15MIN_UASL_FLAG},
+   {DSL_PM_LINETHRESHCROSS_FECS, DSL_MIB_THRESHOLD_ATUR_FECS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_FECS_FLAG}
+};
+
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_uint32_t DSL_DRV_PM_LineSecMibThresholdsGet(
+   const DSL_XTUDir_t nDirection,
+   const DSL_uint32_t nInd)
+{
+   DSL_uint32_t nMibThresholds = DSL_MIB_TRAPS_NOTHING;
+   DSL_uint32_t i;
+
+   for (i = 0; i < DSL_ARRAY_LENGTH(DSL_DRV_PM_LineSecMibThresholdTable); i++)
+   {
+      if (nInd & DSL_DRV_PM_LineSecMibThresholdTable[i].nBit)
+      {
+         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
+            DSL_DRV_PM_LineSecMibThresholdTable[i].nMibFlagNe :
+            DSL_DRV_PM_LineSecMibThresholdTable[i].nMibFlagFe;
+      }
+   }
+
+   return nMibThresholds;
+}
+#endif /* INCLUDE_DSL_ADSL_MIB*/
+
 #ifdef INCLUDE_DSL_CPE_PM_LINE_THRESHOLDS
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
 #ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
@@ -3160,12 +4690,8 @@ static DSL_Error_t DSL_DRV_PM_LineSecCountersThresholdsCrossingCheck(
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_PM_LineThresholdCrossing_t lineThresholdCrossing;
-   DSL_uint32_t *pEvtThresholdInd, *pThresholdInd;
    DSL_pmLineThresholdCrossingData_t *pInd ;
-   DSL_PM_LineSecData_t *pLineSecThresholds;
-   DSL_PM_LineSecData_t *pLineSecCounters;
    DSL_boolean_t bEvent = DSL_FALSE;
-   DSL_uint8_t i = 0;
 #ifdef INCLUDE_DSL_ADSL_MIB
    DSL_MIB_ADSL_Thresholds_t nMibThresholds = DSL_MIB_TRAPS_NOTHING,
                              nCurrMibThresholds = DSL_MIB_TRAPS_NOTHING;
@@ -3189,98 +4715,29 @@ static DSL_Error_t DSL_DRV_PM_LineSecCountersThresholdsCrossingCheck(
 
    pInd = DSL_DRV_PM_PTR_LINE_SEC_THRESHOLD_IND(nDirection);
 
-   lineThresholdCrossing.n15Min = DSL_PM_LINETHRESHCROSS_EMPTY;
-   lineThresholdCrossing.n1Day  = DSL_PM_LINETHRESHCROSS_EMPTY;
-
-   for (i = 0; i< 2; i++)
-   {
-      if( i != 0 )
-      {
-         pEvtThresholdInd    = &(lineThresholdCrossing.n15Min);
-         pThresholdInd       = &(pInd->n15Min);
-         pLineSecThresholds  = DSL_DRV_PM_PTR_LINE_SEC_THRESHOLD_15MIN(nDirection);
-       pLineSecCounters    = p15mLineSecCounters;
-      }
-      else
-      {
-         pEvtThresholdInd    = &(lineThresholdCrossing.n1Day);
-         pThresholdInd       = &(pInd->n1Day);
-         pLineSecThresholds  = DSL_DRV_PM_PTR_LINE_SEC_THRESHOLD_1DAY(nDirection);
-       pLineSecCounters    = p1dLineSecCounters;
-      }
-
-      if( pLineSecCounters->nES > pLineSecThresholds->nES )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_ES;
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
-            DSL_MIB_THRESHOLD_ATUR_ESS_FLAG : DSL_MIB_THRESHOLD_ATUC_ESS_FLAG;
-         #endif
-      }
-
-      if( pLineSecCounters->nLOFS > pLineSecThresholds->nLOFS )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_LOFS;
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
-            DSL_MIB_THRESHOLD_ATUR_LOFS_FLAG : DSL_MIB_THRESHOLD_ATUC_LOFS_FLAG;
-         #endif
-      }
-
-      if( pLineSecCounters->nLOSS > pLineSecThresholds->nLOSS )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_LOSS;
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
-            DSL_MIB_THRESHOLD_ATUR_LOSS_FLAG : DSL_MIB_THRESHOLD_ATUC_LOSS_FLAG;
-         #endif
-      }
-
-      if( pLineSecCounters->nSES > pLineSecThresholds->nSES )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_SES;
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
-            DSL_MIB_THRESHOLD_ATUR_15MIN_SESL_FLAG :
-            DSL_MIB_THRESHOLD_ATUC_15MIN_SESL_FLAG;
-         #endif
-      }
-
-      if( pLineSecCounters->nUAS > pLineSecThresholds->nUAS )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_UAS;
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
-            DSL_MIB_THRESHOLD_ATUR_15MIN_UASL_FLAG :
-            DSL_MIB_THRESHOLD_ATUC_15MIN_UASL_FLAG;
-         #endif
-      }
-
-      if( pLineSecCounters->nFECS > pLineSecThresholds->nFECS )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_FECS;
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= (nDirection == DSL_NEAR_END) ?
-            DSL_MIB_THRESHOLD_ATUR_FECS_FLAG : DSL_MIB_THRESHOLD_ATUC_FECS_FLAG;
-         #endif
-      }
+   /* Check 15-min and 1-day interval thresholds*/
+   lineThresholdCrossing.n15Min = DSL_DRV_PM_LineSecThresholdsCrossingEval(
+      p15mLineSecCounters, DSL_DRV_PM_PTR_LINE_SEC_THRESHOLD_15MIN(nDirection));
+   lineThresholdCrossing.n1Day  = DSL_DRV_PM_LineSecThresholdsCrossingEval(
+      p1dLineSecCounters, DSL_DRV_PM_PTR_LINE_SEC_THRESHOLD_1DAY(nDirection));
 
-      /* Check if new threshold crossing occured since the last check*/
-      if( *pEvtThresholdInd != *pThresholdInd )
-      {
-         *pThresholdInd = *pEvtThresholdInd;
-       bEvent = DSL_TRUE;
-      }
-   }
+   bEvent = DSL_DRV_PM_ThresholdsCrossingUpdate(
+               lineThresholdCrossing.n15Min, lineThresholdCrossing.n1Day,
+               &(pInd->n15Min), &(pInd->n1Day));
 
    #ifdef INCLUDE_DSL_ADSL_MIB
+   /* Map crossed thresholds of both intervals to the MIB threshold flags*/
+   nMibThresholds = (DSL_MIB_ADSL_Thresholds_t)
+      DSL_DRV_PM_LineSecMibThresholdsGet(nDirection,
+         lineThresholdCrossing.n15Min | lineThresholdCrossing.n1Day);
+
    DSL_CTX_READ_SCALAR(pContext, nErrCode, MibAdslCtx.nThresholds,
       nCurrMibThresholds);
    DSL_CTX_WRITE_SCALAR(pContext, nErrCode, MibAdslCtx.nThresholds,
       nMibThresholds | nCurrMibThresholds);
    #endif
 
-   /* Check if at least one threshold crossing occured*/
+   /* Check if at least one new threshold crossing occured*/
    if (bEvent)
    {
       /* Get current PM module time*/
@@ -3312,12 +4769,8 @@ static DSL_Error_t DSL_DRV_PM_LineInitCountersThresholdsCrossingCheck(
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_PM_LineThresholdCrossing_t lineThresholdCrossing;
-   DSL_uint32_t *pEvtThresholdInd, *pThresholdInd;
    DSL_pmLineThresholdCrossingData_t *pInd ;
-   DSL_PM_LineInitData_t *pLineInitThresholds;
-   DSL_PM_LineInitData_t *pLineInitCounters;
    DSL_boolean_t bEvent = DSL_FALSE;
-   DSL_uint8_t i = 0;
 #ifdef INCLUDE_DSL_ADSL_MIB
    DSL_MIB_ADSL_Thresholds_t nMibThresholds = DSL_MIB_TRAPS_NOTHING,
                              nCurrMibThresholds = DSL_MIB_TRAPS_NOTHING;
@@ -3336,69 +4789,35 @@ static DSL_Error_t DSL_DRV_PM_LineInitCountersThresholdsCrossingCheck(
    DSL_CHECK_ERR_CODE();
 
    DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_LineInitCountersThresholdsCrossingCheck"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-   pInd = DSL_DRV_PM_PTR_LINE_INIT_THRESHOLD_IND(nDirection);
-
-   lineThresholdCrossing.n15Min = DSL_PM_LINETHRESHCROSS_EMPTY;
-   lineThresholdCrossing.n1Day  = DSL_PM_LINETHRESHCROSS_EMPTY;
-
-   for (i = 0; i< 2; i++)
-   {
-      if( i != 0 )
-      {
-         pEvtThresholdInd    = &(lineThresholdCrossing.n15Min);
-         pThresholdInd       = &(pInd->n15Min);
-         pLineInitThresholds = DSL_DRV_PM_PTR_LINE_INIT_THRESHOLD_15MIN();
-       pLineInitCounters   = p15mLineInitCounters;
-      }
-      else
-      {
-         pEvtThresholdInd    = &(lineThresholdCrossing.n1Day);
-         pThresholdInd       = &(pInd->n1Day);
-         pLineInitThresholds = DSL_DRV_PM_PTR_LINE_INIT_THRESHOLD_1DAY();
-       pLineInitCounters   = p1dLineInitCounters;
-      }
-
-      if( pLineInitCounters->nFailedFullInits > pLineInitThresholds->nFailedFullInits )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_FIFAIL;
-      }
+      (pContext, SYS_DBG_MSG"DSL[%02d]: IN - DSL_DRV_PM_LineInitCountersThresholdsCrossingCheck"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      if( pLineInitCounters->nFailedShortInits >
-         pLineInitThresholds->nFailedShortInits )
-      {
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_SIFAIL;
-      }
+   pInd = DSL_DRV_PM_PTR_LINE_INIT_THRESHOLD_IND(nDirection);
 
-      if( pLineInitCounters->nFullInits > pLineInitThresholds->nFullInits )
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_FI;
+   /* Check 15-min and 1-day interval thresholds*/
+   lineThresholdCrossing.n15Min = DSL_DRV_PM_LineInitThresholdsCrossingEval(
+      p15mLineInitCounters, DSL_DRV_PM_PTR_LINE_INIT_THRESHOLD_15MIN());
+   lineThresholdCrossing.n1Day  = DSL_DRV_PM_LineInitThresholdsCrossingEval(
+      p1dLineInitCounters, DSL_DRV_PM_PTR_LINE_INIT_THRESHOLD_1DAY());
 
-      if( pLineInitCounters->nShortInits > pLineInitThresholds->nShortInits )
-      {
-         #ifdef INCLUDE_DSL_ADSL_MIB
-         nMibThresholds |= DSL_MIB_THRESHOLD_ATUC_15MIN_FAILED_FASTR_FLAG;
-         #endif
-         *pEvtThresholdInd |= DSL_PM_LINETHRESHCROSS_SI;
-      }
+   bEvent = DSL_DRV_PM_ThresholdsCrossingUpdate(
+               lineThresholdCrossing.n15Min, lineThresholdCrossing.n1Day,
+               &(pInd->n15Min), &(pInd->n1Day));
 
-      /* Check if new threshold crossing occured since the last check*/
-      if( *pEvtThresholdInd != *pThresholdInd )
-      {
-         *pThresholdInd = *pEvtThresholdInd;
-       bEvent = DSL_TRUE;
-      }
+   #ifdef INCLUDE_DSL_ADSL_MIB
+   if ((lineThresholdCrossing.n15Min | lineThresholdCrossing.n1Day) &
+       DSL_PM_LINETHRESHCROSS_SI)
+   {
+      nMibThresholds |= DSL_MIB_THRESHOLD_ATUC_15MIN_FAILED_FASTR_FLAG;
    }
 
-   #ifdef INCLUDE_DSL_ADSL_MIB
    DSL_CTX_READ_SCALAR(pContext, nErrCode, MibAdslCtx.nThresholds,
       nCurrMibThresholds);
    DSL_CTX_WRITE_SCALAR(pContext, nErrCode, MibAdslCtx.nThresholds,
       nMibThresholds | nCurrMibThresholds);
    #endif
 
-   /* Check if at least one threshold crossing occured*/
+   /* Check if at least one new threshold crossing occured*/
    if (bEvent)
    {
       /* Get current PM module time*/
@@ -3668,7 +5087,7 @@ static DSL_Error_t DSL_DRV_PM_LineSecCountersUpdate(
 
 #ifndef DSL_CPE_PM_SECOND_IMPLEMENTATION
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,(pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - "
          "Couldn't lock PM mutex!"DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
@@ -3985,11 +5404,18 @@ static DSL_Error_t DSL_DRV_PM_LineInitCountersUpdate(
 
 #ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-DSL_Error_t DSL_DRV_PM_LineSecCountersHistoryIntervalGet(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_PM_HistIntervalType_t intervalType,
-   DSL_IN_OUT DSL_PM_LineSecCounters_t *pCounters)
+/*
+   Reads the counters of DSL_DRV_PM_LineSecCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_LineSecCountersHistoryIntervalRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_LineSecCounters_t *pCounters = (DSL_PM_LineSecCounters_t*)pReadArg->pCounters;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -3997,124 +5423,121 @@ DSL_Error_t DSL_DRV_PM_LineSecCountersHistoryIntervalGet(
    DSL_pmHistory_t *pHist = DSL_NULL;
    DSL_PM_LineSecData_t *pLineCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   /* Check selected interval Type*/
-   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
-       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
-   {
-      return DSL_ERROR;
-   }
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_HISTORY_1DAY());
+
+   /* Get history fill level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_LINE_SEC_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_LINE_SEC_HISTORY_1DAY();
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      /* Get history fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
+   /* Get history item index*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
 
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         break;
-      }
+      return DSL_ERROR;
+   }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   /* Set Elapsed time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->lineSecCounters.n15minTimeHist[histIdx] :
+      pPub->lineSecCounters.n1dayTimeHist[histIdx];
 
-      /* Get history item index*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
+   pLineCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_15MIN(histIdx, pCounters->nDirection)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_1DAY(histIdx, pCounters->nDirection));
 
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   if( pLineCounters != DSL_NULL )
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
 
-      /* Set Elapsed time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n1dayTimeHist[histIdx];
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->lineSecCounters.n15minInvalidHist[histIdx] :
+         pPub->lineSecCounters.n1dayInvalidHist[histIdx];
 
-      pLineCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_15MIN(histIdx, pCounters->nDirection) :
-         DSL_DRV_PM_PTR_LINE_SEC_COUNTERS_1DAY(histIdx, pCounters->nDirection);
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pLineCounters, sizeof(DSL_PM_LineSecData_t));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      if( pLineCounters != DSL_NULL )
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+      nErrCode = DSL_ERR_INTERNAL;
+   }
 
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
+   return nErrCode;
+}
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineSecCounters.n1dayInvalidHist[histIdx];
+DSL_Error_t DSL_DRV_PM_LineSecCountersHistoryIntervalGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_PM_HistIntervalType_t intervalType,
+   DSL_IN_OUT DSL_PM_LineSecCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pLineCounters, sizeof(DSL_PM_LineSecData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-      break;
+   /* Check selected interval Type*/
+   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
+       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   {
+      return DSL_ERROR;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
+
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
+
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_LineSecCountersHistoryIntervalRead, &ReadArg);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -4132,124 +5555,127 @@ DSL_Error_t DSL_DRV_PM_LineSecCountersHistoryIntervalGet(
    return nErrCode;
 }
 
-DSL_Error_t DSL_DRV_PM_LineInitCountersHistoryIntervalGet(
-   DSL_IN DSL_Context_t *pContext,
-   DSL_PM_HistIntervalType_t intervalType,
-   DSL_IN_OUT DSL_PM_LineInitCounters_t *pCounters)
+/*
+   Reads the counters of DSL_DRV_PM_LineInitCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_LineInitCountersHistoryIntervalRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_LineInitCounters_t *pCounters = (DSL_PM_LineInitCounters_t*)pReadArg->pCounters;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_int_t histIdx = -1;
    DSL_uint32_t histFillLevel = 0;
    DSL_pmHistory_t *pHist = DSL_NULL;
    DSL_PM_LineInitData_t *pLineCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   /* Check selected interval Type*/
-   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
-       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
-   {
-      return DSL_ERROR;
-   }
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_HISTORY_1DAY());
 
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
+   /* Get history fill level*/
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_TRUE);
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_LINE_INIT_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_LINE_INIT_HISTORY_1DAY();
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-      /* Get history fill level*/
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
+   /* Get history item index*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
 
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-         break;
-      }
+      return DSL_ERROR;
+   }
 
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   /* Set Elapsed time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->lineInitCounters.n15minTimeHist[histIdx] :
+      pPub->lineInitCounters.n1dayTimeHist[histIdx];
 
-      /* Get history item index*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
+   pLineCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_COUNTERS_15MIN(histIdx)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_INIT_COUNTERS_1DAY(histIdx));
 
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   if( pLineCounters != DSL_NULL )
+   {
+      DSL_pmBF_IntervalFailures_t nHistFailures;
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->lineInitCounters.n15minInvalidHist[histIdx] :
+         pPub->lineInitCounters.n1dayInvalidHist[histIdx];
 
-      /* Set Elapsed time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineInitCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineInitCounters.n1dayTimeHist[histIdx];
+      pCounters->interval.bValid  =
+         (nHistFailures & DSL_PM_INTERVAL_FAILURE_NOT_COMPLETE) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pLineCounters, sizeof(DSL_PM_LineInitData_t));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      pLineCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_LINE_INIT_COUNTERS_15MIN(histIdx) :
-         DSL_DRV_PM_PTR_LINE_INIT_COUNTERS_1DAY(histIdx);
+      nErrCode = DSL_ERR_INTERNAL;
+   }
 
-      if( pLineCounters != DSL_NULL )
-      {
-         DSL_pmBF_IntervalFailures_t nHistFailures;
+   return nErrCode;
+}
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineInitCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineInitCounters.n1dayInvalidHist[histIdx];
+DSL_Error_t DSL_DRV_PM_LineInitCountersHistoryIntervalGet(
+   DSL_IN DSL_Context_t *pContext,
+   DSL_PM_HistIntervalType_t intervalType,
+   DSL_IN_OUT DSL_PM_LineInitCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
 
-         pCounters->interval.bValid  =
-            (nHistFailures & DSL_PM_INTERVAL_FAILURE_NOT_COMPLETE) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pLineCounters, sizeof(DSL_PM_LineInitData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+   /* Check selected interval Type*/
+   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
+       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   {
+      return DSL_ERROR;
+   }
 
-      break;
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
    }
 
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, DSL_NEAR_END, DSL_FALSE);
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
+
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_LineInitCountersHistoryIntervalRead, &ReadArg);
 
    return nErrCode;
 }
@@ -4441,11 +5867,18 @@ static DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersUpdate(
 }
 
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersHistoryIntervalGet(
+/*
+   Reads the counters of DSL_DRV_PM_LineEventShowtimeCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersHistoryIntervalRead(
    DSL_Context_t *pContext,
-   DSL_PM_HistIntervalType_t intervalType,
-   DSL_PM_LineEventShowtimeCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_LineEventShowtimeCounters_t *pCounters = (DSL_PM_LineEventShowtimeCounters_t*)pReadArg->pCounters;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -4453,138 +5886,200 @@ DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersHistoryIntervalGet(
    DSL_pmHistory_t *pHist = DSL_NULL;
    DSL_PM_LineEventShowtimeData_t *pLfCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
+   /* Get Interval Failures mask*/
+   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_1DAY());
 
-   /* Check selected interval Type*/
-   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
-       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
+
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
+   }
+
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+
       return DSL_ERROR;
    }
 
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
+   /* Get history item index for the specified interval*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
+
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
    {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
       return DSL_ERROR;
    }
 
-   /* Get Interval Failures mask*/
-   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
-      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
-      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+   /* Set Elapsed Time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->lineEventShowtimeCounters.n15minTimeHist[histIdx] :
+      pPub->lineEventShowtimeCounters.n1dayTimeHist[histIdx];
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
+   pLfCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_15MIN(histIdx,pCounters->nDirection)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_1DAY(histIdx,pCounters->nDirection));
+
+   if( pLfCounters != DSL_NULL )
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
+
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->lineEventShowtimeCounters.n15minInvalidHist[histIdx] :
+         pPub->lineEventShowtimeCounters.n1dayInvalidHist[histIdx];
+
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pLfCounters, sizeof(DSL_PM_LineEventShowtimeData_t));
+   }
+   else
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      return nErrCode;
+      nErrCode = DSL_ERR_INTERNAL;
+   }
+
+   return nErrCode;
+}
+
+DSL_Error_t DSL_DRV_PM_LineEventShowtimeCountersHistoryIntervalGet(
+   DSL_Context_t *pContext,
+   DSL_PM_HistIntervalType_t intervalType,
+   DSL_PM_LineEventShowtimeCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
+
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
+
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
+
+   /* Check selected interval Type*/
+   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
+       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   {
+      return DSL_ERROR;
    }
 
-   while(1)
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
    {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_HISTORY_1DAY();
-
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERROR;
+   }
 
-         break;
-      }
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
 
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_LineEventShowtimeCountersHistoryIntervalRead, &ReadArg);
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   {
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+   }
 
-      /* Get history item index for the specified interval*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+#endif /* INCLUDE_DSL_CPE_PM_LINE_EVENT_SHOWTIME_COUNTERS*/
 
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_uint32_t DSL_DRV_PM_DataPathThresholdsCrossingEval(
+   const DSL_PM_DataPathData_t *pCounters,
+   const DSL_PM_DataPathData_t *pThresholds)
+{
+   DSL_uint32_t nInd = DSL_PM_DATAPATHTHRESHCROSS_EMPTY;
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   if( pCounters->nCRC_P > pThresholds->nCRC_P )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_CRC_P;
+   }
 
-      /* Set Elapsed Time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n1dayTimeHist[histIdx];
+   if( pCounters->nCRCP_P > pThresholds->nCRCP_P )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_CRCP_P;
+   }
 
-      pLfCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_15MIN(histIdx,pCounters->nDirection) :
-         DSL_DRV_PM_PTR_LINE_EVENT_SHOWTIME_COUNTERS_1DAY(histIdx,pCounters->nDirection);
+   if( pCounters->nCV_P > pThresholds->nCV_P )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_CV_P;
+   }
 
-      if( pLfCounters != DSL_NULL )
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+   if( pCounters->nCVP_P > pThresholds->nCVP_P )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_CVP_P;
+   }
 
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
+   if( pCounters->nHEC > pThresholds->nHEC )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_HEC;
+   }
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->lineEventShowtimeCounters.n1dayInvalidHist[histIdx];
+   if( pCounters->nIBE > pThresholds->nIBE )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_IBE;
+   }
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pLfCounters, sizeof(DSL_PM_LineEventShowtimeData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   if( pCounters->nTotalCells > pThresholds->nTotalCells )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_TOTALCELL;
+   }
 
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+   if( pCounters->nUserTotalCells > pThresholds->nUserTotalCells )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_USERCELL;
+   }
 
-      break;
+   if( pCounters->nTxUserTotalCells > pThresholds->nTxUserTotalCells )
+   {
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_TX_USER_TOTALCELL;
    }
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
 
-   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   if( pCounters->nTxIBE > pThresholds->nTxIBE )
    {
-      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+      nInd |= DSL_PM_DATAPATHTHRESHCROSS_TX_IBE;
    }
 
-   return nErrCode;
+   return nInd;
 }
-#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
-#endif /* INCLUDE_DSL_CPE_PM_LINE_EVENT_SHOWTIME_COUNTERS*/
 
-#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
 #ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_THRESHOLDS
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
 #ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
+
 /* Function to check the Data Path Counters thresholds crossing for 15-min or 1-day
     interval counters. Appropriate event will be generated on the thresholds crossing
     condition*/
@@ -4597,12 +6092,8 @@ static DSL_Error_t DSL_DRV_PM_DataPathCountersThresholdsCrossingCheck(
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_PM_DataPathThresholdCrossing_t dataPathThresholdCrossing;
-   DSL_uint32_t *pEvtThresholdInd, *pThresholdInd;
    DSL_pmDataPathThresholdCrossingData_t *pInd ;
-   DSL_PM_DataPathData_t *pThresholds;
-   DSL_PM_DataPathData_t *pCounters = DSL_NULL;
    DSL_boolean_t bEvent = DSL_FALSE;
-   DSL_uint8_t i = 0;
 
    DSL_CHECK_CTX_POINTER(pContext);
    DSL_CHECK_ERR_CODE();
@@ -4622,75 +6113,17 @@ static DSL_Error_t DSL_DRV_PM_DataPathCountersThresholdsCrossingCheck(
 
    pInd = DSL_DRV_PM_PTR_DATAPATH_THRESHOLD_IND(nChannel, nDirection);
 
-   dataPathThresholdCrossing.n15Min = DSL_PM_DATAPATHTHRESHCROSS_EMPTY;
-   dataPathThresholdCrossing.n1Day  = DSL_PM_DATAPATHTHRESHCROSS_EMPTY;
-
-   for (i = 0; i < 2; i++)
-   {
-      if (i == 0)
-      {
-         pEvtThresholdInd = &(dataPathThresholdCrossing.n15Min);
-         pThresholdInd    = &(pInd->n15Min);
-         pThresholds      = DSL_DRV_PM_PTR_DATAPATH_THRESHOLD_15MIN(nChannel, nDirection);
-         pCounters        = p15mCounters;
-      }
-      else
-      {
-         pEvtThresholdInd = &(dataPathThresholdCrossing.n1Day);
-         pThresholdInd    = &(pInd->n1Day);
-         pThresholds      = DSL_DRV_PM_PTR_DATAPATH_THRESHOLD_1DAY(nChannel, nDirection);
-         pCounters        = p1dCounters;
-      }
-
-      /* Check for nCRC_P threshold crossing*/
-      if( pCounters->nCRC_P > pThresholds->nCRC_P )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_CRC_P;
-
-      /* Check for nCRCP_P threshold crossing*/
-      if( pCounters->nCRCP_P > pThresholds->nCRCP_P)
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_CRCP_P;
-
-      /* Check for nCV_P threshold crossing*/
-      if( pCounters->nCV_P > pThresholds->nCV_P )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_CV_P;
-
-      /* Check for nCVP_P threshold crossing*/
-      if( pCounters->nCVP_P > pThresholds->nCVP_P )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_CVP_P;
-
-      /* Check for nHEC threshold crossing*/
-      if( pCounters->nHEC > pThresholds->nHEC )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_HEC;
-
-      /* Check for nIBE threshold crossing*/
-      if( pCounters->nIBE > pThresholds->nIBE )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_IBE;
-
-      /* Check for nTotalCells threshold crossing*/
-      if( pCounters->nTotalCells > pThresholds->nTotalCells )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_TOTALCELL;
-
-      /* Check for nUserTotalCells threshold crossing*/
-      if( pCounters->nUserTotalCells > pThresholds->nUserTotalCells )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_USERCELL;
+   /* Check 15-min and 1-day interval thresholds*/
+   dataPathThresholdCrossing.n15Min = DSL_DRV_PM_DataPathThresholdsCrossingEval(
+      p15mCounters, DSL_DRV_PM_PTR_DATAPATH_THRESHOLD_15MIN(nChannel, nDirection));
+   dataPathThresholdCrossing.n1Day  = DSL_DRV_PM_DataPathThresholdsCrossingEval(
+      p1dCounters, DSL_DRV_PM_PTR_DATAPATH_THRESHOLD_1DAY(nChannel, nDirection));
 
-      /* Check for nTxUserTotalCells threshold crossing*/
-      if( pCounters->nTxUserTotalCells > pThresholds->nTxUserTotalCells )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_TX_USER_TOTALCELL;
+   bEvent = DSL_DRV_PM_ThresholdsCrossingUpdate(
+               dataPathThresholdCrossing.n15Min, dataPathThresholdCrossing.n1Day,
+               &(pInd->n15Min), &(pInd->n1Day));
 
-      /* Check for nTxIBE threshold crossing*/
-      if( pCounters->nTxIBE > pThresholds->nTxIBE )
-         *pEvtThresholdInd |= DSL_PM_DATAPATHTHRESHCROSS_TX_IBE;
-
-      /* Check if new threshold crossing occured since the last check*/
-      if( *pEvtThresholdInd != *pThresholdInd )
-      {
-         *pThresholdInd = *pEvtThresholdInd;
-         bEvent = DSL_TRUE;
-      }
-   }
-
-   /* Check if at least one threshold crossing occured*/
+   /* Check if at least one new threshold crossing occured*/
    if (bEvent)
    {
       /* Get current PM module time*/
@@ -5037,11 +6470,18 @@ static DSL_Error_t DSL_DRV_PM_DataPathCountersUpdate(
 }
 
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-DSL_Error_t DSL_DRV_PM_DataPathCountersHistoryIntervalGet(
+/*
+   Reads the counters of DSL_DRV_PM_DataPathCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_DataPathCountersHistoryIntervalRead(
    DSL_Context_t *pContext,
-   DSL_PM_HistIntervalType_t intervalType,
-   DSL_PM_DataPathCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_DataPathCounters_t *pCounters = (DSL_PM_DataPathCounters_t*)pReadArg->pCounters;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -5049,126 +6489,124 @@ DSL_Error_t DSL_DRV_PM_DataPathCountersHistoryIntervalGet(
    DSL_pmHistory_t *pHist = DSL_NULL;
    DSL_PM_DataPathData_t *pDpCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
+   /* Get Interval Failures mask*/
+   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
-   DSL_CHECK_ERR_CODE();
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_HISTORY_1DAY());
 
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
 
-   /* Check selected interval Type*/
-   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
-       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   if( nErrCode != DSL_SUCCESS )
    {
-      return DSL_ERROR;
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
    }
 
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+
       return DSL_ERROR;
    }
 
-   /* Get Interval Failures mask*/
-   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
-      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
-      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+   /* Get history item index for the specified interval*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      return nErrCode;
+      return DSL_ERROR;
    }
 
-   while(1)
-   {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_DATAPATH_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_DATAPATH_HISTORY_1DAY();
-
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
+   /* Set Elapsed Time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->dataPathCounters.n15minTimeHist[histIdx] :
+      pPub->dataPathCounters.n1dayTimeHist[histIdx];
 
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   pDpCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_COUNTERS_15MIN(histIdx,pCounters->nChannel,pCounters->nDirection)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_COUNTERS_1DAY(histIdx,pCounters->nChannel,pCounters->nDirection));
 
-         break;
-      }
+   if( pDpCounters != DSL_NULL )
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
 
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->dataPathCounters.n15minInvalidHist[histIdx] :
+         pPub->dataPathCounters.n1dayInvalidHist[histIdx];
 
-      /* Get history item index for the specified interval*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pDpCounters, sizeof(DSL_PM_DataPathData_t));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      nErrCode = DSL_ERR_INTERNAL;
+   }
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   return nErrCode;
+}
 
-      /* Set Elapsed Time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n1dayTimeHist[histIdx];
+DSL_Error_t DSL_DRV_PM_DataPathCountersHistoryIntervalGet(
+   DSL_Context_t *pContext,
+   DSL_PM_HistIntervalType_t intervalType,
+   DSL_PM_DataPathCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
 
-      pDpCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_DATAPATH_COUNTERS_15MIN(histIdx,pCounters->nChannel,pCounters->nDirection) :
-         DSL_DRV_PM_PTR_DATAPATH_COUNTERS_1DAY(histIdx,pCounters->nChannel,pCounters->nDirection);
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-      if( pDpCounters != DSL_NULL )
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+   DSL_CHECK_CHANNEL_RANGE(pCounters->nChannel);
+   DSL_CHECK_ERR_CODE();
 
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathCounters.n1dayInvalidHist[histIdx];
+   /* Check selected interval Type*/
+   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
+       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   {
+      return DSL_ERROR;
+   }
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pDpCounters, sizeof(DSL_PM_DataPathData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
+   }
 
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
 
-      break;
-   }
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_DataPathCountersHistoryIntervalRead, &ReadArg);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -5333,25 +6771,123 @@ static DSL_Error_t DSL_DRV_PM_DataPathFailureCountersUpdate(
       pTotalCounters->nNCD += nAbsCounters.nNCD;
    }
 
-   DSL_DEBUG( DSL_DBG_MSG,
-      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_DataPathFailureCountersUpdate, retCode=%d"
-      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+   DSL_DEBUG( DSL_DBG_MSG,
+      (pContext, SYS_DBG_MSG"DSL[%02d]: OUT - DSL_DRV_PM_DataPathFailureCountersUpdate, retCode=%d"
+      DSL_DRV_CRLF, DSL_DEV_NUM(pContext), nErrCode));
+
+   return nErrCode;
+}
+
+#ifdef INCLUDE_DSL_CPE_PM_HISTORY
+/*
+   Reads the counters of DSL_DRV_PM_DataPathFailureCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_DataPathFailureCountersHistoryIntervalRead(
+   DSL_Context_t *pContext,
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
+{
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_DataPathFailureCounters_t *pCounters = (DSL_PM_DataPathFailureCounters_t*)pReadArg->pCounters;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
+   DSL_int_t histIdx = -1;
+   DSL_uint32_t histFillLevel = 0;
+   DSL_pmHistory_t *pHist = DSL_NULL;
+   DSL_PM_DataPathFailureData_t *pDpCounters;
+
+   /* Get Interval Failures mask*/
+   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
+      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
+      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
+
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_1DAY());
+
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
+
+   if( nErrCode != DSL_SUCCESS )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return nErrCode;
+   }
+
+   if( pCounters->nHistoryInterval > histFillLevel )
+   {
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+
+      return DSL_ERROR;
+   }
+
+   /* Get history item index for the specified interval*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
+
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      return DSL_ERROR;
+   }
+
+   /* Set Elapsed Time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->dataPathFailureCounters.n15minTimeHist[histIdx] :
+      pPub->dataPathFailureCounters.n1dayTimeHist[histIdx];
+
+   pDpCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_COUNTERS_15MIN(histIdx,pCounters->nChannel,pCounters->nDirection)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_DATAPATH_FAILURE_COUNTERS_1DAY(histIdx,pCounters->nChannel,pCounters->nDirection));
+
+   if( pDpCounters != DSL_NULL )
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
+
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->dataPathFailureCounters.n15minInvalidHist[histIdx] :
+         pPub->dataPathFailureCounters.n1dayInvalidHist[histIdx];
+
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pDpCounters, sizeof(DSL_PM_DataPathFailureData_t));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+
+      nErrCode = DSL_ERR_INTERNAL;
+   }
 
    return nErrCode;
 }
 
-#ifdef INCLUDE_DSL_CPE_PM_HISTORY
 DSL_Error_t DSL_DRV_PM_DataPathFailureCountersHistoryIntervalGet(
    DSL_Context_t *pContext,
    DSL_PM_HistIntervalType_t intervalType,
    DSL_PM_DataPathFailureCounters_t *pCounters)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
-   DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
-   DSL_int_t histIdx = -1;
-   DSL_uint32_t histFillLevel = 0;
-   DSL_pmHistory_t *pHist = DSL_NULL;
-   DSL_PM_DataPathFailureData_t *pDpCounters;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
 
    DSL_CHECK_POINTER(pContext, pCounters);
    DSL_CHECK_ERR_CODE();
@@ -5375,119 +6911,56 @@ DSL_Error_t DSL_DRV_PM_DataPathFailureCountersHistoryIntervalGet(
       return DSL_ERROR;
    }
 
-   /* Get Interval Failures mask*/
-   failuresMask = pCounters->nDirection == DSL_NEAR_END ?
-      DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
-      DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
-
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
-   if( nErrCode != DSL_SUCCESS )
-   {
-      DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
-         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
 
-      return nErrCode;
-   }
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_DataPathFailureCountersHistoryIntervalRead, &ReadArg);
 
-   while(1)
+   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_DATAPATH_FAILURE_HISTORY_1DAY();
-
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
-
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         break;
-      }
-
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
-
-         nErrCode = DSL_ERROR;
-         break;
-      }
-
-      /* Get history item index for the specified interval*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
-
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
-
-         nErrCode = DSL_ERROR;
-         break;
-      }
-
-      /* Set Elapsed Time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n1dayTimeHist[histIdx];
-
-      pDpCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_DATAPATH_FAILURE_COUNTERS_15MIN(histIdx,pCounters->nChannel,pCounters->nDirection) :
-         DSL_DRV_PM_PTR_DATAPATH_FAILURE_COUNTERS_1DAY(histIdx,pCounters->nChannel,pCounters->nDirection);
-
-      if( pDpCounters != DSL_NULL )
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
-
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
+      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+   }
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->dataPathFailureCounters.n1dayInvalidHist[histIdx];
+   return nErrCode;
+}
+#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_FAILURE_COUNTERS*/
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pDpCounters, sizeof(DSL_PM_DataPathFailureData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+/*
+   For a detailed description of the function, its arguments and return value
+   please refer to the description in the header file 'drv_dsl_cpe_pm_core.h'
+*/
+DSL_uint32_t DSL_DRV_PM_ReTxThresholdsCrossingEval(
+   const DSL_PM_ReTxData_t *pCounters,
+   const DSL_PM_ReTxData_t *pThresholds)
+{
+   DSL_uint32_t nInd = DSL_PM_RETXTHRESHCROSS_EMPTY;
 
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+   /* EFTR minimum is crossed if the counter falls below the threshold*/
+   if( pCounters->nEftrMin < pThresholds->nEftrMin )
+   {
+      nInd |= DSL_PM_RETXTHRESHCROSS_EFTR_MIN;
+   }
 
-      break;
+   if( pCounters->nErrorFreeBits > pThresholds->nErrorFreeBits )
+   {
+      nInd |= DSL_PM_RETXTHRESHCROSS_ERROR_FREE_BITS;
    }
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
 
-   if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
+   if( pCounters->nLeftr > pThresholds->nLeftr )
    {
-      nErrCode = DSL_WRN_INCOMPLETE_RETURN_VALUES;
+      nInd |= DSL_PM_RETXTHRESHCROSS_LEFTR;
    }
 
-   return nErrCode;
+   return nInd;
 }
-#endif /* INCLUDE_DSL_CPE_PM_HISTORY*/
-#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_FAILURE_COUNTERS*/
 
-#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
 #ifdef INCLUDE_DSL_CPE_PM_RETX_THRESHOLDS
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
 #ifdef INCLUDE_DSL_CPE_PM_OPTIONAL_PARAMETERS
+
 /* Function to check the ReTx Counters thresholds crossing for 15-min or 1-day
     interval counters. Appropriate event will be generated on the thresholds crossing
     condition*/
@@ -5499,12 +6972,8 @@ static DSL_Error_t DSL_DRV_PM_ReTxCountersThresholdsCrossingCheck(
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_PM_ReTxThresholdCrossing_t reTxThresholdCrossing;
-   DSL_uint32_t *pEvtThresholdInd, *pThresholdInd;
    DSL_pmReTxThresholdCrossingData_t *pInd ;
-   DSL_PM_ReTxData_t *pThresholds;
-   DSL_PM_ReTxData_t *pCounters = DSL_NULL;
    DSL_boolean_t bEvent = DSL_FALSE;
-   DSL_uint8_t i = 0;
 
    DSL_CHECK_CTX_POINTER(pContext);
    DSL_CHECK_ERR_CODE();
@@ -5524,49 +6993,17 @@ static DSL_Error_t DSL_DRV_PM_ReTxCountersThresholdsCrossingCheck(
 
    pInd = DSL_DRV_PM_PTR_RETX_THRESHOLD_IND(nDirection);
 
-   reTxThresholdCrossing.n15Min = DSL_PM_RETXTHRESHCROSS_EMPTY;
-   reTxThresholdCrossing.n1Day  = DSL_PM_RETXTHRESHCROSS_EMPTY;
-
-   for (i = 0; i < 2; i++)
-   {
-      if (i == 0)
-      {
-         pEvtThresholdInd = &(reTxThresholdCrossing.n15Min);
-         pThresholdInd    = &(pInd->n15Min);
-         pThresholds      = DSL_DRV_PM_PTR_RETX_THRESHOLD_15MIN(nDirection);
-         pCounters        = p15mCounters;
-      }
-      else
-      {
-         pEvtThresholdInd = &(reTxThresholdCrossing.n1Day);
-         pThresholdInd    = &(pInd->n1Day);
-         pThresholds      = DSL_DRV_PM_PTR_RETX_THRESHOLD_1DAY(nDirection);
-         pCounters        = p1dCounters;
-      }
-
-      /* Check for nEftrMin threshold crossing*/
-      if( pCounters->nEftrMin < pThresholds->nEftrMin )
-      {
-         *pEvtThresholdInd |= DSL_PM_RETXTHRESHCROSS_EFTR_MIN;
-      }
-
-      /* Check for nErrorFreeBits threshold crossing*/
-      if( pCounters->nErrorFreeBits > pThresholds->nErrorFreeBits )
-         *pEvtThresholdInd |= DSL_PM_RETXTHRESHCROSS_ERROR_FREE_BITS;
+   /* Check 15-min and 1-day interval thresholds*/
+   reTxThresholdCrossing.n15Min = DSL_DRV_PM_ReTxThresholdsCrossingEval(
+      p15mCounters, DSL_DRV_PM_PTR_RETX_THRESHOLD_15MIN(nDirection));
+   reTxThresholdCrossing.n1Day  = DSL_DRV_PM_ReTxThresholdsCrossingEval(
+      p1dCounters, DSL_DRV_PM_PTR_RETX_THRESHOLD_1DAY(nDirection));
 
-      /* Check for nLeftr threshold crossing*/
-      if( pCounters->nLeftr > pThresholds->nLeftr )
-         *pEvtThresholdInd |= DSL_PM_RETXTHRESHCROSS_LEFTR;
-
-      /* Check if new threshold crossing occured since the last check*/
-      if( *pEvtThresholdInd != *pThresholdInd )
-      {
-         *pThresholdInd = *pEvtThresholdInd;
-         bEvent = DSL_TRUE;
-      }
-   }
+   bEvent = DSL_DRV_PM_ThresholdsCrossingUpdate(
+               reTxThresholdCrossing.n15Min, reTxThresholdCrossing.n1Day,
+               &(pInd->n15Min), &(pInd->n1Day));
 
-   /* Check if at least one threshold crossing occured*/
+   /* Check if at least one new threshold crossing occured*/
    if (bEvent)
    {
       /* Get current PM module time*/
@@ -5816,11 +7253,18 @@ static DSL_Error_t DSL_DRV_PM_ReTxCountersUpdate(
 }
 
 #ifdef INCLUDE_DSL_CPE_PM_HISTORY
-DSL_Error_t DSL_DRV_PM_ReTxCountersHistoryIntervalGet(
+/*
+   Reads the counters of DSL_DRV_PM_ReTxCountersHistoryIntervalGet
+   from the published counters snapshot pPub.
+*/
+static DSL_Error_t DSL_DRV_PM_ReTxCountersHistoryIntervalRead(
    DSL_Context_t *pContext,
-   DSL_PM_HistIntervalType_t intervalType,
-   DSL_PM_ReTxCounters_t *pCounters)
+   DSL_PM_CountersData_t *pPub,
+   DSL_void_t *pArg)
 {
+   DSL_PM_HistIntervalReadArg_t *pReadArg = (DSL_PM_HistIntervalReadArg_t*)pArg;
+   DSL_PM_HistIntervalType_t intervalType = pReadArg->intervalType;
+   DSL_PM_ReTxCounters_t *pCounters = (DSL_PM_ReTxCounters_t*)pReadArg->pCounters;
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_pmBF_IntervalFailures_t failuresMask = DSL_PM_INTERVAL_FAILURE_CLEANED;
    DSL_int_t histIdx = -1;
@@ -5828,123 +7272,121 @@ DSL_Error_t DSL_DRV_PM_ReTxCountersHistoryIntervalGet(
    DSL_pmHistory_t *pHist = DSL_NULL;
    DSL_PM_ReTxData_t *pReTxCounters;
 
-   DSL_CHECK_POINTER(pContext, pCounters);
-   DSL_CHECK_ERR_CODE();
-
-   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
-   DSL_CHECK_ERR_CODE();
-
-   /* Check selected interval Type*/
-   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
-       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
-   {
-      return DSL_ERROR;
-   }
-
-   /* Check if the PM module is ready*/
-   if (!DSL_DRV_PM_IsPmReady(pContext))
-   {
-      return DSL_ERROR;
-   }
-
    /* Get Interval Failures mask*/
    failuresMask = pCounters->nDirection == DSL_NEAR_END ?
       DSL_DRV_PM_INTERVAL_FAILURES_NE_MASK :
       DSL_DRV_PM_INTERVAL_FAILURES_FE_MASK;
 
-   /* Lock PM module access mutex*/
-   nErrCode = DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_TRUE);
+   pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_HISTORY_15MIN()) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_HISTORY_1DAY());
+
+   nErrCode = DSL_DRV_PM_PubHistoryFillLevelGet(
+                 pContext, pHist, &histFillLevel);
+
    if( nErrCode != DSL_SUCCESS )
    {
       DSL_DEBUG( DSL_DBG_ERR,
-         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - PM direction mutex lock failed!"
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
          DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
       return nErrCode;
    }
 
-   while(1)
+   if( pCounters->nHistoryInterval > histFillLevel )
    {
-      pHist = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_RETX_HISTORY_15MIN() :
-         DSL_DRV_PM_PTR_RETX_HISTORY_1DAY();
+      DSL_DEBUG( DSL_DBG_WRN,
+         (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
 
-      nErrCode = DSL_DRV_PM_HistoryFillLevelGet(
-                    pContext, pHist, &histFillLevel);
+      return DSL_ERROR;
+   }
 
-      if( nErrCode != DSL_SUCCESS )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history fill level get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   /* Get history item index for the specified interval*/
+   nErrCode = DSL_DRV_PM_PubHistoryItemIdxGet(
+                 pContext, pHist,
+                 pCounters->nHistoryInterval, &histIdx);
 
-         break;
-      }
+   if( nErrCode != DSL_SUCCESS || histIdx < 0 )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      if( pCounters->nHistoryInterval > histFillLevel )
-      {
-         DSL_DEBUG( DSL_DBG_WRN,
-            (pContext, SYS_DBG_WRN"DSL[%02d]: ERROR - no history data for the specified interval(%d)!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext), pCounters->nHistoryInterval));
+      return DSL_ERROR;
+   }
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+   /* Set Elapsed Time*/
+   pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      pPub->reTxCounters.n15minTimeHist[histIdx] :
+      pPub->reTxCounters.n1dayTimeHist[histIdx];
 
-      /* Get history item index for the specified interval*/
-      nErrCode = DSL_DRV_PM_HistoryItemIdxGet(
-                    pContext, pHist,
-                    pCounters->nHistoryInterval, &histIdx);
+   pReTxCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_COUNTERS_15MIN(histIdx, pCounters->nDirection)) :
+      DSL_DRV_PM_PUB_PTR(pContext, pPub, DSL_DRV_PM_PTR_RETX_COUNTERS_1DAY(histIdx, pCounters->nDirection));
 
-      if( nErrCode != DSL_SUCCESS || histIdx < 0 )
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history index get failed!"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   if( pReTxCounters != DSL_NULL )
+   {
+      DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
 
-         nErrCode = DSL_ERROR;
-         break;
-      }
+      nCurrFailures = pCounters->nHistoryInterval == 0 ?
+         DSL_DRV_PM_PUB_CURR_FAILURES(pContext, pPub) :
+         DSL_PM_INTERVAL_FAILURE_CLEANED;
 
-      /* Set Elapsed Time*/
-      pCounters->interval.nElapsedTime = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n15minTimeHist[histIdx] :
-         DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n1dayTimeHist[histIdx];
+      nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
+         pPub->reTxCounters.n15minInvalidHist[histIdx] :
+         pPub->reTxCounters.n1dayInvalidHist[histIdx];
 
-      pReTxCounters = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-         DSL_DRV_PM_PTR_RETX_COUNTERS_15MIN(histIdx, pCounters->nDirection) :
-         DSL_DRV_PM_PTR_RETX_COUNTERS_1DAY(histIdx, pCounters->nDirection);
+      pCounters->interval.bValid  =
+         ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
+         DSL_TRUE : DSL_FALSE;
+      pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
+      memcpy(&(pCounters->data), pReTxCounters, sizeof(DSL_PM_ReTxData_t));
+   }
+   else
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
 
-      if( pReTxCounters != DSL_NULL )
-      {
-         DSL_pmBF_IntervalFailures_t nCurrFailures, nHistFailures;
+      nErrCode = DSL_ERR_INTERNAL;
+   }
 
-         nCurrFailures = pCounters->nHistoryInterval == 0 ? DSL_DRV_PM_CONTEXT(pContext)->nCurrFailures :
-            DSL_PM_INTERVAL_FAILURE_CLEANED;
+   return nErrCode;
+}
 
-         nHistFailures = intervalType == DSL_PM_HISTORY_INTERVAL_15MIN ?
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n15minInvalidHist[histIdx] :
-            DSL_DRV_PM_CONTEXT(pContext)->pCounters->reTxCounters.n1dayInvalidHist[histIdx];
+DSL_Error_t DSL_DRV_PM_ReTxCountersHistoryIntervalGet(
+   DSL_Context_t *pContext,
+   DSL_PM_HistIntervalType_t intervalType,
+   DSL_PM_ReTxCounters_t *pCounters)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_PM_HistIntervalReadArg_t ReadArg;
 
-         pCounters->interval.bValid  =
-            ((nHistFailures | nCurrFailures) & failuresMask) == 0 ?
-            DSL_TRUE : DSL_FALSE;
-         pCounters->interval.nNumber = (DSL_uint8_t)(pCounters->nHistoryInterval);
-         memcpy(&(pCounters->data), pReTxCounters, sizeof(DSL_PM_ReTxData_t));
-      }
-      else
-      {
-         DSL_DEBUG( DSL_DBG_ERR,
-            (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - history interval data pointer is NULL"
-            DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+   DSL_CHECK_POINTER(pContext, pCounters);
+   DSL_CHECK_ERR_CODE();
 
-         nErrCode = DSL_ERR_INTERNAL;
-      }
+   DSL_CHECK_ATU_DIRECTION(pCounters->nDirection);
+   DSL_CHECK_ERR_CODE();
 
-      break;
+   /* Check selected interval Type*/
+   if ((intervalType != DSL_PM_HISTORY_INTERVAL_15MIN) &&
+       (intervalType != DSL_PM_HISTORY_INTERVAL_1DAY))
+   {
+      return DSL_ERROR;
+   }
+
+   /* Check if the PM module is ready*/
+   if (!DSL_DRV_PM_IsPmReady(pContext))
+   {
+      return DSL_ERROR;
    }
-   /* Unlock PM module access mutex*/
-   DSL_DRV_PM_AccessMutexControl(pContext, pCounters->nDirection, DSL_FALSE);
+
+   ReadArg.intervalType = intervalType;
+   ReadArg.pCounters    = pCounters;
+
+   nErrCode = DSL_DRV_PM_PublishedRead(
+                 pContext, DSL_DRV_PM_ReTxCountersHistoryIntervalRead, &ReadArg);
 
    if ( (nErrCode == DSL_SUCCESS) && (DSL_DRV_PM_CONTEXT(pContext)->bPmDataValid != DSL_TRUE))
    {
@@ -5956,7 +7398,11 @@ DSL_Error_t DSL_DRV_PM_ReTxCountersHistoryIntervalGet(
 #endif /*  INCLUDE_DSL_CPE_PM_HISTORY*/
 #endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
 
-DSL_Error_t DSL_DRV_PM_CountersUpdate(
+/*
+   Does the work of DSL_DRV_PM_CountersUpdate(), which only adds the
+   tracepoints around it.
+*/
+static DSL_Error_t DSL_DRV_PM_CountersUpdateDo(
    DSL_Context_t *pContext,
    const DSL_XTUDir_t nDirection,
    DSL_boolean_t b15min, DSL_boolean_t b1day,
@@ -5965,6 +7411,10 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
    DSL_Error_t nErrCode = DSL_SUCCESS;
    DSL_uint8_t nChannel;
    DSL_boolean_t bFwPollingEnabled = DSL_TRUE;
+   DSL_boolean_t bFwRead = DSL_FALSE;
+   DSL_uint32_t nFwReadMask = 0, nStartSec = 0, nStartNSec = 0, nFamily;
+   DSL_uint32_t nFwReadTime[DSL_PM_FW_READ_LAST];
+   DSL_PM_DirStatisticsData_t *pStatistics = DSL_NULL;
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
    DSL_pmChannelData_t channelData;
 #endif /* #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
@@ -5997,6 +7447,9 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
    /* Reset Line Sec counters structure*/
    memset (&lineSecData, 0x0, sizeof(DSL_pmLineSecData_t));
 
+   /* Reset firmware read times*/
+   memset(nFwReadTime, 0x0, sizeof(nFwReadTime));
+
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
    /* Reset Channel counters structure*/
    memset(&channelData, 0x0, sizeof(DSL_pmChannelData_t));
@@ -6023,7 +7476,7 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
 #endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
 
    /* Lock PM module Mutex*/
-   if( DSL_DRV_MUTEX_LOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex) )
+   if( DSL_DRV_PM_MutexLock(pContext) )
    {
       DSL_DEBUG( DSL_DBG_ERR,
          (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
@@ -6047,7 +7500,10 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
    if( nDirection == DSL_NEAR_END )
    {
       /* Get current PM module Line Init counters*/
+      DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
       nErrCode = DSL_DRV_PM_LineInitCountersCurrentGet(pContext, &lineInitData);
+      nFwReadTime[DSL_PM_FW_READ_LINE_INIT] = DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+      nFwReadMask |= (1 << DSL_PM_FW_READ_LINE_INIT);
       if( nErrCode < DSL_SUCCESS )
       {
          DSL_DEBUG( DSL_DBG_ERR,
@@ -6064,8 +7520,12 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
    for( nChannel = 0; nChannel < DSL_CHANNELS_PER_LINE; nChannel++ )
    {
       /* Get current Data Path counters*/
+      DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
       nErrCode = DSL_DRV_PM_DataPathFailureCountersCurrentGet(
                     pContext, nChannel, nDirection, &dataPathFailureData[nChannel]);
+      nFwReadTime[DSL_PM_FW_READ_DATA_PATH_FAILURE] +=
+         DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+      nFwReadMask |= (1 << DSL_PM_FW_READ_DATA_PATH_FAILURE);
       if( nErrCode < DSL_SUCCESS )
       {
          DSL_DEBUG( DSL_DBG_ERR,
@@ -6083,10 +7543,16 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
 #endif /* INCLUDE_DSL_CPE_PM_SHOWTIME_COUNTERS*/
       )
    {
+      bFwRead = DSL_TRUE;
+
 #ifdef INCLUDE_DSL_CPE_PM_LINE_EVENT_SHOWTIME_COUNTERS
       /* Get current Line Event Showtime counters*/
+      DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
       nErrCode = DSL_DRV_PM_LineEventShowtimeCountersCurrentGet(
          pContext, nDirection, &lineEventShowtimeData);
+      nFwReadTime[DSL_PM_FW_READ_LINE_EVENT_SHOWTIME] =
+         DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+      nFwReadMask |= (1 << DSL_PM_FW_READ_LINE_EVENT_SHOWTIME);
       if( nErrCode < DSL_SUCCESS )
       {
          DSL_DEBUG( DSL_DBG_ERR,
@@ -6112,7 +7578,10 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
 #endif /* #ifdef INCLUDE_DSL_FE_EOC_COUNTERS*/
 
       /* Get current PM module Line Sec  counters*/
+      DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
       nErrCode = DSL_DRV_PM_LineSecCountersCurrentGet(pContext, nDirection, &lineSecData);
+      nFwReadTime[DSL_PM_FW_READ_LINE_SEC] = DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+      nFwReadMask |= (1 << DSL_PM_FW_READ_LINE_SEC);
       if( nErrCode < DSL_SUCCESS )
       {
          DSL_DEBUG( DSL_DBG_ERR,
@@ -6127,8 +7596,11 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
       {
 #ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
          /* Get current Channel counters*/
+         DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
          nErrCode = DSL_DRV_PM_ChannelCountersCurrentGet(
                        pContext, nChannel, nDirection, &channelData);
+         nFwReadTime[DSL_PM_FW_READ_CHANNEL] += DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+         nFwReadMask |= (1 << DSL_PM_FW_READ_CHANNEL);
          if( nErrCode < DSL_SUCCESS )
          {
             DSL_DEBUG( DSL_DBG_ERR,
@@ -6141,8 +7613,11 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
 
 #ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
          /* Get current Data Path counters*/
+         DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
          nErrCode = DSL_DRV_PM_DataPathCountersCurrentGet(
                        pContext, nChannel, nDirection, &dataPathData[nChannel]);
+         nFwReadTime[DSL_PM_FW_READ_DATA_PATH] += DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+         nFwReadMask |= (1 << DSL_PM_FW_READ_DATA_PATH);
          if( nErrCode < DSL_SUCCESS )
          {
             DSL_DEBUG( DSL_DBG_ERR,
@@ -6156,7 +7631,10 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
 #ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
       /* Get current PM module ReTx counters. Currently counters are available
          for the Near-End only*/
+      DSL_DRV_TimeNSecGet(&nStartSec, &nStartNSec);
       nErrCode = DSL_DRV_PM_ReTxCountersCurrentGet(pContext, nDirection, &reTxData);
+      nFwReadTime[DSL_PM_FW_READ_RETX] = DSL_DRV_ElapsedTimeNSecGet(nStartSec, nStartNSec);
+      nFwReadMask |= (1 << DSL_PM_FW_READ_RETX);
       if( nErrCode < DSL_SUCCESS )
       {
          DSL_DEBUG( DSL_DBG_ERR,
@@ -6183,6 +7661,25 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
       return nErrCode;
    }
 
+   /* Update firmware read statistics*/
+   pStatistics = (nDirection == DSL_NEAR_END) ?
+      &(DSL_DRV_PM_CONTEXT(pContext)->statistics.ne) :
+      &(DSL_DRV_PM_CONTEXT(pContext)->statistics.fe);
+
+   for (nFamily = 0; nFamily < DSL_PM_FW_READ_LAST; nFamily++)
+   {
+      if (nFwReadMask & (1 << nFamily))
+      {
+         DSL_DRV_PM_TimingSampleAdd(
+            &(pStatistics->fwRead[nFamily]), nFwReadTime[nFamily]);
+      }
+   }
+
+   if (!bFwRead)
+   {
+      DSL_DRV_ATOMIC_FETCH_ADD(&(pStatistics->nSkippedTicks), 1);
+   }
+
    while(1)
    {
 #ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
@@ -6311,6 +7808,32 @@ DSL_Error_t DSL_DRV_PM_CountersUpdate(
    return nErrCode;
 }
 
+DSL_Error_t DSL_DRV_PM_CountersUpdate(
+   DSL_Context_t *pContext,
+   const DSL_XTUDir_t nDirection,
+   DSL_boolean_t b15min, DSL_boolean_t b1day,
+   DSL_boolean_t bTotal, DSL_boolean_t bShowtime)
+{
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+
+   if (pContext == DSL_NULL)
+   {
+      return DSL_ERR_POINTER;
+   }
+
+   DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_PM_UPDATE_ENTRY, 0, nDirection,
+      (b15min ? 0x1 : 0) | (b1day ? 0x2 : 0) |
+      (bTotal ? 0x4 : 0) | (bShowtime ? 0x8 : 0), 0, 0);
+
+   nErrCode = DSL_DRV_PM_CountersUpdateDo(pContext, nDirection,
+                 b15min, b1day, bTotal, bShowtime);
+
+   DSL_DRV_DBG_TRACE(pContext, DSL_DBG_TRACE_PM_UPDATE_EXIT, nErrCode,
+      nDirection, 0, 0, 0);
+
+   return nErrCode;
+}
+
 DSL_Error_t DSL_DRV_PM_CountersSave(DSL_Context_t *pContext)
 {
    DSL_Error_t nErrCode = DSL_SUCCESS;
@@ -6774,6 +8297,43 @@ DSL_Error_t DSL_DRV_PM_Resume(
    return nErrCode;
 }
 
+DSL_Error_t DSL_DRV_PM_ShowtimeEntryNotify(
+   DSL_Context_t *pContext)
+{
+   if (DSL_DRV_PM_CONTEXT(pContext) == DSL_NULL)
+   {
+      return DSL_ERR_POINTER;
+   }
+
+   if (!DSL_DRV_PM_CONTEXT(pContext)->bInit ||
+       !DSL_DRV_PM_CONTEXT(pContext)->nPmConfig.bAdaptivePollingOn)
+   {
+      return DSL_SUCCESS;
+   }
+
+   /* Lock PM module Mutex*/
+   if( DSL_DRV_PM_MutexLock(pContext) )
+   {
+      DSL_DEBUG( DSL_DBG_ERR,
+         (pContext, SYS_DBG_ERR"DSL[%02d]: ERROR - Couldn't lock PM mutex!"
+         DSL_DRV_CRLF, DSL_DEV_NUM(pContext)));
+      return DSL_ERR_SEMAPHORE_GET;
+   }
+
+   /* Start the showtime with the basic poll cycle*/
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.nBackoffFactor = 1;
+   DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.nBackoffFactor = 1;
+
+   /* Unlock PM module Mutex*/
+   DSL_DRV_MUTEX_UNLOCK(DSL_DRV_PM_CONTEXT(pContext)->pmMutex);
+
+   /* Wake up PM threads, they might wait for the end of the current interval*/
+   DSL_DRV_WAKEUP_EVENT(DSL_DRV_PM_CONTEXT(pContext)->pmThreadNe.pmEvent);
+   DSL_DRV_WAKEUP_EVENT(DSL_DRV_PM_CONTEXT(pContext)->pmThreadFe.pmEvent);
+
+   return DSL_SUCCESS;
+}
+
 /** @} DRV_DSL_CPE_PM */
 
 #endif
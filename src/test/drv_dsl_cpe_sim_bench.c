@@ -0,0 +1,522 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+/** \file
+   Minimal driver program for the user space simulation library. It opens
+   one line of the simulated VRx device and measures the hot paths of the
+   driver: the ioctl path, the firmware message round trip, the event queue,
+   the timeout list, the autoboot state machine, the PM module tick, the
+   zero-copy firmware download and, if configured with --enable-dsl-ceoc,
+   the Clear EOC transmit path.
+
+   Usage: dsl_cpe_sim_bench [-n <iterations>] [-l <line>]
+
+   The simulated device is configured by the script named in the environment
+   variable DSL_SIM_VRX_SCRIPT, for example to add message latencies.
+*/
+
+#define DSL_INTERN
+
+#include "drv_dsl_cpe_api.h"
+#include "drv_dsl_cpe_api_ioctl.h"
+#include "drv_dsl_cpe_device_vrx.h"
+#include "drv_dsl_cpe_autoboot.h"
+#ifdef INCLUDE_DSL_PM
+#include "drv_dsl_cpe_intern_pm.h"
+#endif /* INCLUDE_DSL_PM*/
+#ifdef INCLUDE_DSL_CEOC
+#include "drv_dsl_cpe_intern_ceoc.h"
+#endif /* INCLUDE_DSL_CEOC*/
+
+#include <stdint.h>
+#include <getopt.h>
+
+/** Default number of calls per measurement */
+#define DSL_SIM_BENCH_ITERATIONS    100000
+
+/** Timeout of the timeout list entries [s], they never expire in the run */
+#define DSL_SIM_BENCH_TIMEOUT       3600
+
+/** Size of the firmware image of the zero-copy download [bytes] */
+#define DSL_SIM_BENCH_FW_SIZE       (256 * 1024)
+
+static uint64_t DSL_SIM_BENCH_NsecGet(DSL_void_t)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static DSL_void_t DSL_SIM_BENCH_Report(
+   const DSL_char_t *pName,
+   DSL_uint32_t nCalls,
+   DSL_uint32_t nErrors,
+   uint64_t nTime)
+{
+   printf("%-32s %10u calls %8u errors %10.1f ns/call" DSL_DRV_CRLF,
+      pName, nCalls, nErrors, nCalls ? (double)nTime / nCalls : 0.0);
+}
+
+static DSL_int_t DSL_SIM_BENCH_LineStateGet(
+   DSL_void_t *pHandle,
+   DSL_uint32_t nIterations)
+{
+   DSL_LineState_t lineState;
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      memset(&lineState, 0x00, sizeof(DSL_LineState_t));
+      if (DSL_DRV_SIM_Ioctl(pHandle, DSL_FIO_LINE_STATE_GET,
+             (DSL_ulong_t)&lineState) < 0)
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("DSL_FIO_LINE_STATE_GET", nIterations, nErrors,
+      DSL_SIM_BENCH_NsecGet() - nStart);
+
+   return nErrors ? -1 : 0;
+}
+
+static DSL_int_t DSL_SIM_BENCH_MessageSend(
+   DSL_Context_t *pContext,
+   DSL_uint16_t nLine,
+   DSL_uint32_t nIterations)
+{
+   ACK_ModemFSM_StateGet_t sAck;
+   DSL_DRV_SIM_VRX_Statistics_t stats;
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   DSL_DRV_SIM_VRX_StatisticsReset();
+
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      if (DSL_DRV_VRX_SendMsgModemFsmStateGet(pContext,
+             (DSL_uint8_t*)&sAck) != DSL_SUCCESS)
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("CMD_ModemFSM_StateGet", nIterations, nErrors,
+      DSL_SIM_BENCH_NsecGet() - nStart);
+
+   if (DSL_DRV_SIM_VRX_StatisticsGet(nLine, &stats) == DSL_SUCCESS)
+   {
+      printf("simulated device: %u messages, %u errors, %u us latency"
+         DSL_DRV_CRLF, stats.nMsgSend, stats.nMsgError, stats.nLatencyTotal);
+   }
+
+   return nErrors ? -1 : 0;
+}
+
+static DSL_int_t DSL_SIM_BENCH_MessageTrace(
+   DSL_Context_t *pContext,
+   DSL_uint32_t nIterations)
+{
+   ACK_ModemFSM_StateGet_t sAck;
+   DSL_DBG_MsgTrace_t msgTrace;
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   /* Binary message trace and tracepoints, independent of the debug level*/
+   pContext->msgTrace.ctrl.bEnable = DSL_TRUE;
+   pContext->trace.ctrl.bEnable    = DSL_TRUE;
+
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      if (DSL_DRV_VRX_SendMsgModemFsmStateGet(pContext,
+             (DSL_uint8_t*)&sAck) != DSL_SUCCESS)
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("CMD_ModemFSM_StateGet traced", nIterations,
+      nErrors, DSL_SIM_BENCH_NsecGet() - nStart);
+
+   pContext->msgTrace.ctrl.bEnable = DSL_FALSE;
+   pContext->trace.ctrl.bEnable    = DSL_FALSE;
+
+   /* Each message is traced with its acknowledge*/
+   memset(&msgTrace, 0x00, sizeof(msgTrace));
+   msgTrace.data.nStartSeq = 2 * nIterations - DSL_DBG_MSG_TRACE_READ_MAX;
+   if ((DSL_DRV_DBG_MsgTraceGet(pContext, &msgTrace) != DSL_SUCCESS) ||
+       (msgTrace.data.nEntries != DSL_DBG_MSG_TRACE_READ_MAX) ||
+       (msgTrace.data.entry[0].nDir != DSL_DBG_MSG_TRACE_TX) ||
+       (msgTrace.data.entry[1].nDir != DSL_DBG_MSG_TRACE_RX))
+   {
+      fprintf(stderr, "message trace: %u entries read" DSL_DRV_CRLF,
+         msgTrace.data.nEntries);
+      nErrors++;
+   }
+
+   return nErrors ? -1 : 0;
+}
+
+static DSL_int_t DSL_SIM_BENCH_EventQueue(
+   DSL_void_t *pHandle,
+   DSL_Context_t *pContext,
+   DSL_uint32_t nIterations)
+{
+   DSL_InstanceControl_t instanceCtrl;
+   DSL_EventStatusMask_t eventMask;
+   DSL_EventStatus_t eventStatus;
+   DSL_EventData_Union_t eventData, eventDataRx;
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   memset(&instanceCtrl, 0x00, sizeof(DSL_InstanceControl_t));
+   instanceCtrl.data.bEventActivation = DSL_TRUE;
+   if (DSL_DRV_SIM_Ioctl(pHandle, DSL_FIO_INSTANCE_CONTROL_SET,
+          (DSL_ulong_t)&instanceCtrl) < 0)
+   {
+      fprintf(stderr, "DSL_FIO_INSTANCE_CONTROL_SET failed" DSL_DRV_CRLF);
+      return -1;
+   }
+
+   /* All events are masked for a new instance*/
+   memset(&eventMask, 0x00, sizeof(DSL_EventStatusMask_t));
+   eventMask.data.nEventType = DSL_EVENT_S_LINE_STATE;
+   eventMask.data.bMask = DSL_FALSE;
+   if (DSL_DRV_SIM_Ioctl(pHandle, DSL_FIO_EVENT_STATUS_MASK_CONFIG_SET,
+          (DSL_ulong_t)&eventMask) < 0)
+   {
+      fprintf(stderr, "DSL_FIO_EVENT_STATUS_MASK_CONFIG_SET failed" DSL_DRV_CRLF);
+      return -1;
+   }
+
+   memset(&eventData, 0x00, sizeof(DSL_EventData_Union_t));
+   eventData.lineStateData.nLineState = DSL_LINESTATE_SHOWTIME_TC_SYNC;
+
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      if (DSL_DRV_EventGenerate(pContext, 0, DSL_ACCESSDIR_NA, DSL_NEAR_END,
+             DSL_EVENT_S_LINE_STATE, &eventData,
+             sizeof(DSL_LineStateData_t)) != DSL_SUCCESS)
+      {
+         nErrors++;
+         continue;
+      }
+
+      memset(&eventStatus, 0x00, sizeof(DSL_EventStatus_t));
+      eventStatus.data.pData = &eventDataRx;
+      if ((DSL_DRV_SIM_Ioctl(pHandle, DSL_FIO_EVENT_STATUS_GET,
+             (DSL_ulong_t)&eventStatus) < 0) ||
+          (eventStatus.data.nEventType != DSL_EVENT_S_LINE_STATE))
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("event generate/status get",
+      nIterations, nErrors, DSL_SIM_BENCH_NsecGet() - nStart);
+
+   instanceCtrl.data.bEventActivation = DSL_FALSE;
+   DSL_DRV_SIM_Ioctl(pHandle, DSL_FIO_INSTANCE_CONTROL_SET,
+      (DSL_ulong_t)&instanceCtrl);
+
+   return nErrors ? -1 : 0;
+}
+
+static DSL_int_t DSL_SIM_BENCH_TimeoutList(
+   DSL_Context_t *pContext,
+   DSL_uint32_t nIterations)
+{
+   DSL_uint32_t nTimeoutId[DSL_MAX_TIMEOUT_NUM];
+   DSL_uint32_t i, j, nErrors = 0;
+   uint64_t nStart;
+
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      /* Fill the list in reverse order of the expiry, each insertion is
+         sorted in front of the previous one*/
+      for (j = 0; j < DSL_MAX_TIMEOUT_NUM; j++)
+      {
+         nTimeoutId[j] = DSL_DRV_Timeout_AddEvent(pContext,
+            (DSL_int_t)DSL_TIMEOUTEVENT_RESERVED,
+            DSL_SIM_BENCH_TIMEOUT - j);
+         if (nTimeoutId[j] == 0)
+         {
+            nErrors++;
+         }
+      }
+
+      for (j = 0; j < DSL_MAX_TIMEOUT_NUM; j++)
+      {
+         if ((nTimeoutId[j] != 0) &&
+             (DSL_DRV_Timeout_RemoveEvent(pContext, nTimeoutId[j])
+                != DSL_SUCCESS))
+         {
+            nErrors++;
+         }
+      }
+   }
+   DSL_SIM_BENCH_Report("timeout add/remove", nIterations * DSL_MAX_TIMEOUT_NUM,
+      nErrors, DSL_SIM_BENCH_NsecGet() - nStart);
+
+   return nErrors ? -1 : 0;
+}
+
+static DSL_int_t DSL_SIM_BENCH_AutobootFsm(
+   DSL_Context_t *pContext,
+   DSL_uint32_t nIterations)
+{
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   /* Showtime handling polls the line state and the line failures from the
+      firmware, the autoboot thread is not running in this program*/
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      if ((DSL_DRV_AutobootStateSet(pContext, DSL_AUTOBOOTSTATE_SHOWTIME,
+              DSL_AUTOBOOT_SHOWTIME_POLL_TIME) != DSL_SUCCESS) ||
+          (DSL_DRV_AutobootStateCheck(pContext) < DSL_SUCCESS))
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("autoboot showtime state", nIterations, nErrors,
+      DSL_SIM_BENCH_NsecGet() - nStart);
+
+   DSL_DRV_AutobootStateSet(pContext, DSL_AUTOBOOTSTATE_DISABLED,
+      DSL_AUTOBOOT_IDLE_POLL_TIME);
+
+   return nErrors ? -1 : 0;
+}
+
+#ifdef INCLUDE_DSL_PM
+static DSL_int_t DSL_SIM_BENCH_PmTick(
+   DSL_Context_t *pContext,
+   DSL_uint32_t nIterations)
+{
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   if (DSL_DRV_PM_Start(pContext) != DSL_SUCCESS)
+   {
+      fprintf(stderr, "DSL_DRV_PM_Start failed" DSL_DRV_CRLF);
+      return -1;
+   }
+
+   /* The PM threads run as well but only wake up once per poll cycle*/
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      if (DSL_DRV_PM_ThreadNeCycle(pContext) != DSL_SUCCESS)
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("PM near-end cycle", nIterations, nErrors,
+      DSL_SIM_BENCH_NsecGet() - nStart);
+
+   /* The PM module is stopped by DSL_DRV_SIM_ModuleCleanup*/
+
+   return nErrors ? -1 : 0;
+}
+#endif /* INCLUDE_DSL_PM*/
+
+static DSL_int_t DSL_SIM_BENCH_FwDownloadMapped(
+   DSL_Context_t *pContext,
+   DSL_uint16_t nLine,
+   DSL_uint32_t nIterations)
+{
+   static DSL_uint8_t fwImage[DSL_SIM_BENCH_FW_SIZE];
+   DSL_DRV_SIM_VRX_Statistics_t stats;
+   DSL_int32_t nLoff, nOffset;
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   pContext->pFwMap = DSL_DRV_UserBufferMap(DSL_FALSE, fwImage,
+                         sizeof(fwImage));
+   if (pContext->pFwMap == DSL_NULL)
+   {
+      fprintf(stderr, "DSL_DRV_UserBufferMap failed" DSL_DRV_CRLF);
+      return -1;
+   }
+
+   pContext->pDevCtx->data.deviceCfg.nFwType = DSL_FW_REQUEST_ADSL;
+
+   DSL_DRV_SIM_VRX_StatisticsReset();
+
+   /* The image is written from the mapping, the download completes with the
+      firmware version read out*/
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      nLoff = nOffset = 0;
+      if (DSL_DRV_DEV_FwDownload(pContext, (DSL_char_t*)fwImage,
+             sizeof(fwImage), DSL_NULL, 0, &nLoff, &nOffset, DSL_TRUE,
+             DSL_TRUE) < DSL_SUCCESS)
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("zero-copy firmware download", nIterations, nErrors,
+      DSL_SIM_BENCH_NsecGet() - nStart);
+
+   DSL_DRV_UserBufferUnmap(pContext->pFwMap);
+   pContext->pFwMap = DSL_NULL;
+
+   if ((DSL_DRV_SIM_VRX_StatisticsGet(nLine, &stats) != DSL_SUCCESS) ||
+       (stats.nFwDownload != nIterations) || (stats.nFwChunk < nIterations))
+   {
+      fprintf(stderr, "firmware download: %u images, %u chunks" DSL_DRV_CRLF,
+         stats.nFwDownload, stats.nFwChunk);
+      nErrors++;
+   }
+
+   return nErrors ? -1 : 0;
+}
+
+#ifdef INCLUDE_DSL_CEOC
+static DSL_int_t DSL_SIM_BENCH_CeocSend(
+   DSL_Context_t *pContext,
+   DSL_uint16_t nLine,
+   DSL_uint32_t nIterations)
+{
+   DSL_CEOC_Message_t msg;
+   IOCTL_MEI_devInit_t devInit;
+   DSL_DRV_SIM_VRX_Statistics_t stats;
+   DSL_Error_t nErrCode = DSL_SUCCESS;
+   DSL_uint32_t i, nErrors = 0;
+   uint64_t nStart;
+
+   /* The device is initialized by DSL_FIO_INIT, which is not used here*/
+   memset(&devInit, 0x00, sizeof(IOCTL_MEI_devInit_t));
+   if (DSL_DRV_VRX_InternalInitDevice(
+          (MEI_DYN_CNTRL_T*)DSL_DEVICE_LOWHANDLE(pContext), &devInit) < 0)
+   {
+      fprintf(stderr, "device init failed" DSL_DRV_CRLF);
+      return -1;
+   }
+
+   if (DSL_CEOC_Start(pContext) != DSL_SUCCESS)
+   {
+      fprintf(stderr, "DSL_CEOC_Start failed" DSL_DRV_CRLF);
+      return -1;
+   }
+
+   /* Messages are only sent with a VDSL firmware in showtime, the firmware
+      features are set by the firmware download*/
+   pContext->pDevCtx->data.fwFeatures.nApplication = DSL_APP_VDSL_POTS;
+   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nLineState,
+      DSL_LINESTATE_SHOWTIME_TC_SYNC);
+
+   memset(&msg, 0x00, sizeof(DSL_CEOC_Message_t));
+   msg.length = 64;
+
+   DSL_DRV_SIM_VRX_StatisticsReset();
+
+   nStart = DSL_SIM_BENCH_NsecGet();
+   for (i = 0; i < nIterations; i++)
+   {
+      if (DSL_CEOC_MessageSend(pContext, DSL_CEOC_SNMP_PROTOCOL_ID, &msg)
+             != DSL_SUCCESS)
+      {
+         nErrors++;
+      }
+   }
+   DSL_SIM_BENCH_Report("Clear EOC message send", nIterations, nErrors,
+      DSL_SIM_BENCH_NsecGet() - nStart);
+
+   if (DSL_DRV_SIM_VRX_StatisticsGet(nLine, &stats) == DSL_SUCCESS)
+   {
+      printf("simulated device: %u Clear EOC frames" DSL_DRV_CRLF,
+         stats.nCeocFrameWr);
+   }
+
+   DSL_CTX_WRITE_SCALAR(pContext, nErrCode, nLineState, DSL_LINESTATE_IDLE);
+   pContext->pDevCtx->data.fwFeatures.nApplication = DSL_APP_UNKNOWN;
+
+   /* The CEOC module is stopped by DSL_DRV_SIM_ModuleCleanup*/
+
+   return (nErrors || nErrCode != DSL_SUCCESS) ? -1 : 0;
+}
+#endif /* INCLUDE_DSL_CEOC*/
+
+int main(int argc, char *argv[])
+{
+   DSL_uint32_t nIterations = DSL_SIM_BENCH_ITERATIONS;
+   DSL_int_t nLine = 0, nRet = 0, c;
+   DSL_void_t *pHandle;
+   DSL_Context_t *pContext;
+
+   while ((c = getopt(argc, argv, "n:l:")) != -1)
+   {
+      switch (c)
+      {
+      case 'n':
+         nIterations = (DSL_uint32_t)strtoul(optarg, DSL_NULL, 0);
+         break;
+      case 'l':
+         nLine = (DSL_int_t)strtol(optarg, DSL_NULL, 0);
+         break;
+      default:
+         fprintf(stderr, "usage: %s [-n <iterations>] [-l <line>]" DSL_DRV_CRLF,
+            argv[0]);
+         return 2;
+      }
+   }
+
+   if (DSL_DRV_SIM_ModuleInit() != 0)
+   {
+      fprintf(stderr, "DSL_DRV_SIM_ModuleInit failed" DSL_DRV_CRLF);
+      return 1;
+   }
+
+   pHandle = DSL_DRV_SIM_Open(nLine);
+   if (pHandle == DSL_NULL)
+   {
+      fprintf(stderr, "DSL_DRV_SIM_Open(%d) failed" DSL_DRV_CRLF, nLine);
+      DSL_DRV_SIM_ModuleCleanup();
+      return 1;
+   }
+
+   pContext = ((DSL_OpenContext_t*)pHandle)->pDevCtx->pContext;
+
+   if (DSL_SIM_BENCH_LineStateGet(pHandle, nIterations) < 0)
+      nRet = 1;
+   if (DSL_SIM_BENCH_MessageSend(pContext, (DSL_uint16_t)nLine, nIterations) < 0)
+      nRet = 1;
+   if (DSL_SIM_BENCH_MessageTrace(pContext, nIterations) < 0)
+      nRet = 1;
+   if (DSL_SIM_BENCH_EventQueue(pHandle, pContext, nIterations) < 0)
+      nRet = 1;
+   if (DSL_SIM_BENCH_TimeoutList(pContext, nIterations) < 0)
+      nRet = 1;
+   if (DSL_SIM_BENCH_AutobootFsm(pContext, nIterations) < 0)
+      nRet = 1;
+#ifdef INCLUDE_DSL_PM
+   if (DSL_SIM_BENCH_PmTick(pContext, nIterations) < 0)
+      nRet = 1;
+#endif /* INCLUDE_DSL_PM*/
+   if (DSL_SIM_BENCH_FwDownloadMapped(pContext, (DSL_uint16_t)nLine,
+          nIterations) < 0)
+      nRet = 1;
+#ifdef INCLUDE_DSL_CEOC
+   if (DSL_SIM_BENCH_CeocSend(pContext, (DSL_uint16_t)nLine, nIterations) < 0)
+      nRet = 1;
+#endif /* INCLUDE_DSL_CEOC*/
+
+   DSL_DRV_SIM_Close(pHandle);
+   DSL_DRV_SIM_ModuleCleanup();
+
+   return nRet;
+}
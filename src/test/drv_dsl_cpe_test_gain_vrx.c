@@ -0,0 +1,197 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+/** \file
+   Test of the Q8.8 dB to Q3.13 linear gain conversion of the VRx device
+   layer. All 65536 inputs are compared bit by bit with the former iterative
+   implementation, which is kept here as reference.
+
+   Usage: dsl_cpe_test_gain_vrx [-b <passes>]
+
+   With -b the throughput of both implementations is measured over the
+   given number of passes of all inputs.
+*/
+
+#define DSL_INTERN
+
+#include "drv_dsl_cpe_api.h"
+#include "drv_dsl_cpe_device_vrx.h"
+#include "drv_dsl_cpe_msg_vrx.h"
+
+#include <stdint.h>
+#include <getopt.h>
+
+/** Exit code of a skipped test (automake test driver) */
+#define DSL_TEST_SKIP   77
+
+#ifdef INCLUDE_DSL_G997_PER_TONE
+
+/* Former implementation, evaluates the polynomial for every input */
+static DSL_int16_t DSL_TEST_GainRef(DSL_int16_t s_gain_db)
+{
+   DSL_int32_t s_adj_factor = (1 << 14);   /* nominal adjustment factor*/
+   DSL_int32_t l_Acc, l_temp;
+
+   if ((DSL_uint16_t)s_gain_db == 0x8000)
+   {
+      l_Acc = 0;
+   }
+   else if (s_gain_db < -14<<8)
+   {
+      l_Acc = (DSL_int32_t) 1634;
+   }
+   else if (s_gain_db > 6<<8)
+   {
+      l_Acc = (DSL_int32_t) 16345;
+   }
+   else
+   {
+      if (s_gain_db > 3<<8)
+      {
+         while (s_gain_db > 3<<8)
+         {
+            s_gain_db -= 2<<8;
+            l_temp = (DSL_int32_t)(20626 * s_adj_factor);
+            s_adj_factor = (DSL_int16_t)(l_temp >> 14);
+         }
+      }
+      else if (s_gain_db < 256)
+      {
+         while (s_gain_db < 256)
+         {
+            s_gain_db += 2<<8;
+            l_temp = (DSL_int32_t)(13014 * s_adj_factor);
+            s_adj_factor = (DSL_int16_t)(l_temp >> 14);
+         }
+      }
+
+      l_Acc = (DSL_int32_t)(s_gain_db * s_gain_db);
+      l_Acc  = l_Acc  >> 5;
+      l_temp = l_Acc * 17500;
+      l_Acc  = l_temp >> 6;
+      l_temp = (DSL_int32_t)(29306 * s_gain_db);
+      l_Acc += l_temp;
+      l_Acc +=  67240537;
+      l_Acc  = (l_Acc + (1 << 12)) >> 13;
+
+      l_temp = l_Acc * s_adj_factor;
+      l_Acc  = (l_temp + (1 << 13)) >> 14;
+   }
+
+   return (DSL_int16_t)l_Acc;
+}
+
+static uint64_t DSL_TEST_NsecGet(DSL_void_t)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static DSL_int_t DSL_TEST_GainExact(DSL_void_t)
+{
+   DSL_uint32_t i, nErrors = 0;
+   DSL_int16_t nRef, nRes;
+
+   for (i = 0; i < 0x10000; i++)
+   {
+      nRef = DSL_TEST_GainRef((DSL_int16_t)i);
+      nRes = DSL_DRV_VRX_G997_Q8_8dB_to_Q3_13Linear((DSL_int16_t)i);
+
+      if (nRef != nRes)
+      {
+         if (nErrors < 10)
+         {
+            printf("input 0x%04X: expected %d, got %d" DSL_DRV_CRLF,
+               i, nRef, nRes);
+         }
+         nErrors++;
+      }
+   }
+
+   printf("gain conversion: %u of 65536 inputs differ" DSL_DRV_CRLF, nErrors);
+
+   return nErrors ? 1 : 0;
+}
+
+/** Conversion function, called through a pointer so that both
+    implementations are measured as out of line calls */
+typedef DSL_int16_t (*DSL_TEST_GainFct_t)(DSL_int16_t);
+
+static DSL_void_t DSL_TEST_GainBenchRun(
+   const DSL_char_t *pName,
+   DSL_TEST_GainFct_t pFct,
+   DSL_uint32_t nPasses)
+{
+   volatile DSL_TEST_GainFct_t pCall = pFct;
+   volatile DSL_int32_t nSink;
+   DSL_int32_t nSum = 0;
+   DSL_uint32_t i, nPass;
+   uint64_t nStart, nTime;
+
+   nStart = DSL_TEST_NsecGet();
+   for (nPass = 0; nPass < nPasses; nPass++)
+   {
+      for (i = 0; i < 0x10000; i++)
+         nSum += pCall((DSL_int16_t)i);
+   }
+   nTime = DSL_TEST_NsecGet() - nStart;
+   nSink = nSum;
+   (DSL_void_t)nSink;
+
+   printf("%-10s %8.2f ns/conversion" DSL_DRV_CRLF,
+      pName, (double)nTime / (65536.0 * nPasses));
+}
+
+static DSL_void_t DSL_TEST_GainBench(DSL_uint32_t nPasses)
+{
+   DSL_TEST_GainBenchRun("reference:", DSL_TEST_GainRef, nPasses);
+   DSL_TEST_GainBenchRun("table:", DSL_DRV_VRX_G997_Q8_8dB_to_Q3_13Linear,
+      nPasses);
+}
+
+int main(int argc, char *argv[])
+{
+   DSL_uint32_t nPasses = 0;
+   DSL_int_t nRet, c;
+
+   while ((c = getopt(argc, argv, "b:")) != -1)
+   {
+      switch (c)
+      {
+      case 'b':
+         nPasses = (DSL_uint32_t)strtoul(optarg, DSL_NULL, 0);
+         break;
+      default:
+         fprintf(stderr, "usage: %s [-b <passes>]" DSL_DRV_CRLF, argv[0]);
+         return 2;
+      }
+   }
+
+   nRet = DSL_TEST_GainExact();
+
+   if ((nRet == 0) && (nPasses > 0))
+      DSL_TEST_GainBench(nPasses);
+
+   return nRet;
+}
+
+#else
+
+int main(int argc, char *argv[])
+{
+   printf("INCLUDE_DSL_G997_PER_TONE is not enabled" DSL_DRV_CRLF);
+
+   return DSL_TEST_SKIP;
+}
+
+#endif /* INCLUDE_DSL_G997_PER_TONE */
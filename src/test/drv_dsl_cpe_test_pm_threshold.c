@@ -0,0 +1,446 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+/** \file
+   Test of the PM threshold crossing evaluation of the PM module. For each
+   configured counters family (channel, line sec, line init, data path and
+   ReTx) the crossing bitmask of the production evaluation function is
+   checked field by field: every counter of the data structure is set equal
+   to, one above and one below its threshold, only the monitored counters
+   shall set their crossing bit (in the monitored direction). Pseudo random
+   counters and thresholds are checked in addition. With the ADSL MIB the line
+   sec MIB threshold flag mapping is checked for each crossing bit and both
+   directions.
+
+   Usage: dsl_cpe_test_pm_threshold [-b <ticks>]
+
+   With -b the per tick cost of the evaluation of all configured families
+   (15-min and 1-day interval, both directions) is measured over the given
+   number of ticks.
+*/
+
+#define DSL_INTERN
+
+#include "drv_dsl_cpe_api.h"
+#include "drv_dsl_cpe_pm_core.h"
+
+#include <stdint.h>
+#include <getopt.h>
+
+/** Exit code of a skipped test (automake test driver) */
+#define DSL_TEST_SKIP   77
+
+#if defined(INCLUDE_DSL_PM) && \
+   (defined(INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS) || \
+    defined(INCLUDE_DSL_CPE_PM_LINE_COUNTERS) || \
+    defined(INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS) || \
+    defined(INCLUDE_DSL_CPE_PM_RETX_COUNTERS))
+
+/** Number of pseudo random counter sets */
+#define DSL_TEST_ROUNDS 10000
+
+/** Maximum size of a counters data structure */
+#define DSL_TEST_DATA_SIZE 256
+
+/** Expected crossing of one counter */
+typedef struct
+{
+   /** Counter offset within the counters data structure, bytes*/
+   DSL_uint16_t nOffset;
+   /** Crossing is indicated if the counter falls below the threshold*/
+   DSL_boolean_t bLowerLimit;
+   /** Threshold crossing indication bit*/
+   DSL_uint32_t nBit;
+} DSL_TEST_Crossing_t;
+
+/** Production evaluation function of one family */
+typedef DSL_uint32_t (*DSL_TEST_EvalFct_t)(
+   const DSL_void_t *pCounters,
+   const DSL_void_t *pThresholds);
+
+/** Counters family under test */
+typedef struct
+{
+   const DSL_char_t *pName;
+   DSL_TEST_EvalFct_t pEval;
+   DSL_uint32_t nSize;
+   const DSL_TEST_Crossing_t *pCrossing;
+   DSL_uint32_t nCrossing;
+} DSL_TEST_Family_t;
+
+/* Wrapper of the production evaluation function of a family*/
+#define DSL_TEST_EVAL(family, type) \
+   static DSL_uint32_t DSL_TEST_##family##Eval( \
+      const DSL_void_t *pCounters, const DSL_void_t *pThresholds) \
+   { \
+      return DSL_DRV_PM_##family##ThresholdsCrossingEval( \
+                (const type*)pCounters, (const type*)pThresholds); \
+   }
+
+#define DSL_TEST_FAMILY(name, family, type, crossing) \
+   {name, DSL_TEST_##family##Eval, sizeof(type), \
+    crossing, DSL_ARRAY_LENGTH(crossing)}
+
+/* Counters and their crossing bits as defined by the API (see
+   DSL_PM_BF_*ThresholdCrossing_t)*/
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+static const DSL_TEST_Crossing_t aTestChannel[] =
+{
+   {offsetof(DSL_PM_ChannelData_t, nFEC),            DSL_FALSE, DSL_PM_CHANNELTHRESHCROSS_FEC},
+   {offsetof(DSL_PM_ChannelData_t, nCodeViolations), DSL_FALSE, DSL_PM_CHANNELTHRESHCROSS_CV}
+};
+DSL_TEST_EVAL(Channel, DSL_PM_ChannelData_t)
+#endif /* INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+static const DSL_TEST_Crossing_t aTestLineSec[] =
+{
+   {offsetof(DSL_PM_LineSecData_t, nES),   DSL_FALSE, DSL_PM_LINETHRESHCROSS_ES},
+   {offsetof(DSL_PM_LineSecData_t, nSES),  DSL_FALSE, DSL_PM_LINETHRESHCROSS_SES},
+   {offsetof(DSL_PM_LineSecData_t, nLOSS), DSL_FALSE, DSL_PM_LINETHRESHCROSS_LOSS},
+   {offsetof(DSL_PM_LineSecData_t, nUAS),  DSL_FALSE, DSL_PM_LINETHRESHCROSS_UAS},
+   {offsetof(DSL_PM_LineSecData_t, nLOFS), DSL_FALSE, DSL_PM_LINETHRESHCROSS_LOFS},
+   {offsetof(DSL_PM_LineSecData_t, nFECS), DSL_FALSE, DSL_PM_LINETHRESHCROSS_FECS}
+};
+DSL_TEST_EVAL(LineSec, DSL_PM_LineSecData_t)
+
+static const DSL_TEST_Crossing_t aTestLineInit[] =
+{
+   {offsetof(DSL_PM_LineInitData_t, nFullInits),        DSL_FALSE, DSL_PM_LINETHRESHCROSS_FI},
+   {offsetof(DSL_PM_LineInitData_t, nFailedFullInits),  DSL_FALSE, DSL_PM_LINETHRESHCROSS_FIFAIL},
+   {offsetof(DSL_PM_LineInitData_t, nShortInits),       DSL_FALSE, DSL_PM_LINETHRESHCROSS_SI},
+   {offsetof(DSL_PM_LineInitData_t, nFailedShortInits), DSL_FALSE, DSL_PM_LINETHRESHCROSS_SIFAIL}
+};
+DSL_TEST_EVAL(LineInit, DSL_PM_LineInitData_t)
+#endif /* INCLUDE_DSL_CPE_PM_LINE_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+static const DSL_TEST_Crossing_t aTestDataPath[] =
+{
+   {offsetof(DSL_PM_DataPathData_t, nHEC),              DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_HEC},
+   {offsetof(DSL_PM_DataPathData_t, nTotalCells),       DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_TOTALCELL},
+   {offsetof(DSL_PM_DataPathData_t, nUserTotalCells),   DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_USERCELL},
+   {offsetof(DSL_PM_DataPathData_t, nIBE),              DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_IBE},
+   {offsetof(DSL_PM_DataPathData_t, nCRC_P),            DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_CRC_P},
+   {offsetof(DSL_PM_DataPathData_t, nCRCP_P),           DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_CRCP_P},
+   {offsetof(DSL_PM_DataPathData_t, nCV_P),             DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_CV_P},
+   {offsetof(DSL_PM_DataPathData_t, nCVP_P),            DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_CVP_P},
+   {offsetof(DSL_PM_DataPathData_t, nTxUserTotalCells), DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_TX_USER_TOTALCELL},
+   {offsetof(DSL_PM_DataPathData_t, nTxIBE),            DSL_FALSE, DSL_PM_DATAPATHTHRESHCROSS_TX_IBE}
+};
+DSL_TEST_EVAL(DataPath, DSL_PM_DataPathData_t)
+#endif /* INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS*/
+
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+static const DSL_TEST_Crossing_t aTestReTx[] =
+{
+   {offsetof(DSL_PM_ReTxData_t, nEftrMin),       DSL_TRUE,  DSL_PM_RETXTHRESHCROSS_EFTR_MIN},
+   {offsetof(DSL_PM_ReTxData_t, nErrorFreeBits), DSL_FALSE, DSL_PM_RETXTHRESHCROSS_ERROR_FREE_BITS},
+   {offsetof(DSL_PM_ReTxData_t, nLeftr),         DSL_FALSE, DSL_PM_RETXTHRESHCROSS_LEFTR}
+};
+DSL_TEST_EVAL(ReTx, DSL_PM_ReTxData_t)
+#endif /* INCLUDE_DSL_CPE_PM_RETX_COUNTERS*/
+
+static const DSL_TEST_Family_t aTestFamily[] =
+{
+#ifdef INCLUDE_DSL_CPE_PM_CHANNEL_COUNTERS
+   DSL_TEST_FAMILY("channel", Channel,
+      DSL_PM_ChannelData_t, aTestChannel),
+#endif
+#ifdef INCLUDE_DSL_CPE_PM_LINE_COUNTERS
+   DSL_TEST_FAMILY("line sec", LineSec,
+      DSL_PM_LineSecData_t, aTestLineSec),
+   DSL_TEST_FAMILY("line init", LineInit,
+      DSL_PM_LineInitData_t, aTestLineInit),
+#endif
+#ifdef INCLUDE_DSL_CPE_PM_DATA_PATH_COUNTERS
+   DSL_TEST_FAMILY("data path", DataPath,
+      DSL_PM_DataPathData_t, aTestDataPath),
+#endif
+#ifdef INCLUDE_DSL_CPE_PM_RETX_COUNTERS
+   DSL_TEST_FAMILY("ReTx", ReTx,
+      DSL_PM_ReTxData_t, aTestReTx),
+#endif
+};
+
+/* Counters and thresholds of the 15-min and 1-day interval of both
+   directions for each family*/
+static DSL_uint32_t aTestCnt[DSL_ARRAY_LENGTH(aTestFamily)][4]
+   [DSL_TEST_DATA_SIZE / sizeof(DSL_uint32_t)];
+static DSL_uint32_t aTestThr[DSL_ARRAY_LENGTH(aTestFamily)][4]
+   [DSL_TEST_DATA_SIZE / sizeof(DSL_uint32_t)];
+
+static DSL_uint32_t nTestSeed = 1;
+
+static DSL_uint32_t DSL_TEST_Random(DSL_void_t)
+{
+   nTestSeed = nTestSeed * 1103515245 + 12345;
+
+   return (nTestSeed >> 16) & 0x7FFF;
+}
+
+static uint64_t DSL_TEST_NsecGet(DSL_void_t)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Expected crossing bitmask of the given counters*/
+static DSL_uint32_t DSL_TEST_Expected(
+   const DSL_TEST_Family_t *pFamily,
+   const DSL_uint32_t *pCnt,
+   const DSL_uint32_t *pThr)
+{
+   DSL_uint32_t i, k, nInd = 0;
+
+   for (i = 0; i < pFamily->nCrossing; i++)
+   {
+      k = pFamily->pCrossing[i].nOffset / sizeof(DSL_uint32_t);
+      if (pFamily->pCrossing[i].bLowerLimit ?
+            (pCnt[k] < pThr[k]) : (pCnt[k] > pThr[k]))
+      {
+         nInd |= pFamily->pCrossing[i].nBit;
+      }
+   }
+
+   return nInd;
+}
+
+static DSL_uint32_t DSL_TEST_Check(
+   const DSL_TEST_Family_t *pFamily,
+   const DSL_uint32_t *pCnt,
+   const DSL_uint32_t *pThr,
+   DSL_uint32_t nErrors)
+{
+   DSL_uint32_t nRef, nRes;
+
+   nRef = DSL_TEST_Expected(pFamily, pCnt, pThr);
+   nRes = pFamily->pEval(pCnt, pThr);
+   if (nRef != nRes)
+   {
+      if (nErrors < 10)
+      {
+         printf("%s: expected 0x%08X, got 0x%08X" DSL_DRV_CRLF,
+            pFamily->pName, nRef, nRes);
+      }
+      nErrors++;
+   }
+
+   return nErrors;
+}
+
+static DSL_int_t DSL_TEST_ThresholdExact(DSL_void_t)
+{
+   const DSL_TEST_Family_t *pFamily;
+   DSL_uint32_t *pCnt, *pThr;
+   DSL_uint32_t nFamily, nRound, nWords, i, k, nChecks = 0, nErrors = 0;
+
+   for (nFamily = 0; nFamily < DSL_ARRAY_LENGTH(aTestFamily); nFamily++)
+   {
+      pFamily = &aTestFamily[nFamily];
+      nWords  = pFamily->nSize / sizeof(DSL_uint32_t);
+      pCnt    = aTestCnt[nFamily][0];
+      pThr    = aTestThr[nFamily][0];
+
+      if (pFamily->nSize > DSL_TEST_DATA_SIZE)
+      {
+         printf("%s: data structure exceeds %u bytes" DSL_DRV_CRLF,
+            pFamily->pName, DSL_TEST_DATA_SIZE);
+         return 1;
+      }
+
+      /* single counter above and below its threshold, all other counters
+         equal to their thresholds*/
+      for (k = 0; k < nWords; k++)
+      {
+         for (i = 0; i < nWords; i++)
+         {
+            pThr[i] = 1000 + i;
+            pCnt[i] = pThr[i];
+         }
+
+         nErrors = DSL_TEST_Check(pFamily, pCnt, pThr, nErrors);
+         pCnt[k] = pThr[k] + 1;
+         nErrors = DSL_TEST_Check(pFamily, pCnt, pThr, nErrors);
+         pCnt[k] = pThr[k] - 1;
+         nErrors = DSL_TEST_Check(pFamily, pCnt, pThr, nErrors);
+         nChecks += 3;
+      }
+
+      /* counters close to random thresholds, so that all relations occur*/
+      for (nRound = 0; nRound < DSL_TEST_ROUNDS; nRound++)
+      {
+         for (i = 0; i < nWords; i++)
+         {
+            pThr[i] = DSL_TEST_Random() + 1;
+            pCnt[i] = pThr[i] + (DSL_TEST_Random() % 3) - 1;
+         }
+
+         nErrors = DSL_TEST_Check(pFamily, pCnt, pThr, nErrors);
+         nChecks++;
+      }
+
+      printf("%-10s %2u counters monitored" DSL_DRV_CRLF,
+         pFamily->pName, pFamily->nCrossing);
+   }
+
+   printf("threshold crossing: %u of %u evaluations differ" DSL_DRV_CRLF,
+      nErrors, nChecks);
+
+   return nErrors ? 1 : 0;
+}
+
+#if defined(INCLUDE_DSL_CPE_PM_LINE_COUNTERS) && defined(INCLUDE_DSL_ADSL_MIB)
+/* Line sec crossing bits and their ATU-R (near-end) and ATU-C (far-end) MIB
+   threshold flags as defined by the ADSL MIB*/
+static const struct
+{
+   DSL_uint32_t nBit;
+   DSL_MIB_ADSL_Thresholds_t nMibFlagNe;
+   DSL_MIB_ADSL_Thresholds_t nMibFlagFe;
+} aTestLineSecMib[] =
+{
+   {DSL_PM_LINETHRESHCROSS_FECS, DSL_MIB_THRESHOLD_ATUR_FECS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_FECS_FLAG},
+   {DSL_PM_LINETHRESHCROSS_ES,   DSL_MIB_THRESHOLD_ATUR_ESS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_ESS_FLAG},
+   {DSL_PM_LINETHRESHCROSS_SES,  DSL_MIB_THRESHOLD_ATUR_15MIN_SESL_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_15MIN_SESL_FLAG},
+   {DSL_PM_LINETHRESHCROSS_LOSS, DSL_MIB_THRESHOLD_ATUR_LOSS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_LOSS_FLAG},
+   {DSL_PM_LINETHRESHCROSS_UAS,  DSL_MIB_THRESHOLD_ATUR_15MIN_UASL_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_15MIN_UASL_FLAG},
+   {DSL_PM_LINETHRESHCROSS_LOFS, DSL_MIB_THRESHOLD_ATUR_LOFS_FLAG,
+                                 DSL_MIB_THRESHOLD_ATUC_LOFS_FLAG}
+};
+
+static DSL_int_t DSL_TEST_LineSecMib(DSL_void_t)
+{
+   DSL_uint32_t nRef, nRes;
+   DSL_uint32_t nBit, nDir, i, nErrors = 0;
+
+   for (nDir = 0; nDir < 2; nDir++)
+   {
+      /* every single bit (unmapped bits result in no flag) and all bits*/
+      for (nBit = 0; nBit <= 32; nBit++)
+      {
+         nRef = DSL_MIB_TRAPS_NOTHING;
+         for (i = 0; i < DSL_ARRAY_LENGTH(aTestLineSecMib); i++)
+         {
+            if ((nBit == 32) || (aTestLineSecMib[i].nBit == (1U << nBit)))
+            {
+               nRef |= (nDir == 0) ? aTestLineSecMib[i].nMibFlagNe :
+                                     aTestLineSecMib[i].nMibFlagFe;
+            }
+         }
+
+         nRes = DSL_DRV_PM_LineSecMibThresholdsGet(
+                   (nDir == 0) ? DSL_NEAR_END : DSL_FAR_END,
+                   (nBit == 32) ? 0xFFFFFFFF : (1U << nBit));
+         if (nRef != nRes)
+         {
+            printf("line sec MIB: bit %u dir %u expected 0x%08X, got 0x%08X"
+               DSL_DRV_CRLF, nBit, nDir, nRef, nRes);
+            nErrors++;
+         }
+      }
+   }
+
+   printf("line sec MIB flags: %u of 66 mappings differ" DSL_DRV_CRLF,
+      nErrors);
+
+   return nErrors ? 1 : 0;
+}
+#endif /* defined(INCLUDE_DSL_CPE_PM_LINE_COUNTERS) && defined(INCLUDE_DSL_ADSL_MIB)*/
+
+static DSL_void_t DSL_TEST_ThresholdBench(DSL_uint32_t nTicks)
+{
+   volatile DSL_uint32_t nSink;
+   DSL_uint32_t nInd = 0, nTick, nFamily, i, k;
+   uint64_t nStart, nTime;
+
+   for (nFamily = 0; nFamily < DSL_ARRAY_LENGTH(aTestFamily); nFamily++)
+   {
+      for (i = 0; i < 4; i++)
+      {
+         for (k = 0; k < aTestFamily[nFamily].nSize / sizeof(DSL_uint32_t); k++)
+         {
+            aTestThr[nFamily][i][k] = DSL_TEST_Random() + 1;
+            aTestCnt[nFamily][i][k] = aTestThr[nFamily][i][k] - 1;
+         }
+      }
+   }
+
+   nStart = DSL_TEST_NsecGet();
+   for (nTick = 0; nTick < nTicks; nTick++)
+   {
+      /* one counter changes per tick*/
+      aTestCnt[0][nTick & 3][0]++;
+
+      for (nFamily = 0; nFamily < DSL_ARRAY_LENGTH(aTestFamily); nFamily++)
+      {
+         for (i = 0; i < 4; i++)
+         {
+            nInd ^= aTestFamily[nFamily].pEval(
+                       aTestCnt[nFamily][i], aTestThr[nFamily][i]);
+         }
+      }
+   }
+   nTime = DSL_TEST_NsecGet() - nStart;
+   nSink = nInd;
+   (DSL_void_t)nSink;
+
+   printf("%u families: %8.2f ns/tick" DSL_DRV_CRLF,
+      (DSL_uint32_t)DSL_ARRAY_LENGTH(aTestFamily), (double)nTime / nTicks);
+}
+
+int main(int argc, char *argv[])
+{
+   DSL_uint32_t nTicks = 0;
+   DSL_int_t nRet, c;
+
+   while ((c = getopt(argc, argv, "b:")) != -1)
+   {
+      switch (c)
+      {
+      case 'b':
+         nTicks = (DSL_uint32_t)strtoul(optarg, DSL_NULL, 0);
+         break;
+      default:
+         fprintf(stderr, "usage: %s [-b <ticks>]" DSL_DRV_CRLF, argv[0]);
+         return 2;
+      }
+   }
+
+   nRet = DSL_TEST_ThresholdExact();
+
+#if defined(INCLUDE_DSL_CPE_PM_LINE_COUNTERS) && defined(INCLUDE_DSL_ADSL_MIB)
+   nRet |= DSL_TEST_LineSecMib();
+#endif
+
+   if ((nRet == 0) && (nTicks > 0))
+      DSL_TEST_ThresholdBench(nTicks);
+
+   return nRet;
+}
+
+#else
+
+int main(int argc, char *argv[])
+{
+   printf("PM counters are not enabled" DSL_DRV_CRLF);
+
+   return DSL_TEST_SKIP;
+}
+
+#endif /* INCLUDE_DSL_PM ...*/
@@ -0,0 +1,427 @@
+/******************************************************************************
+
+                          Copyright (c) 2007-2015
+                     Lantiq Beteiligungs-GmbH & Co. KG
+
+  For licensing information, see the file 'LICENSE' in the root folder of
+  this software module.
+
+******************************************************************************/
+
+/** \file
+   Test of the per tone kernels of the VRx device layer. The results are
+   compared bit by bit with scalar reference loops, which are the former per
+   tone loops of the message layer for the unpacking, SNR conversion and group
+   averaging. All inputs are used for the conversions, pseudo random tables
+   with invalid values for the others.
+
+   Usage: dsl_cpe_test_tone_vrx [-b <passes>]
+
+   With -b the throughput of the kernels and of the references is measured
+   over the given number of passes of a table of DSL_MAX_NSC tones.
+*/
+
+#define DSL_INTERN
+
+#include "drv_dsl_cpe_api.h"
+#include "drv_dsl_cpe_device_vrx.h"
+#include "drv_dsl_cpe_msg_vrx.h"
+
+#include <stdint.h>
+#include <getopt.h>
+
+/** Exit code of a skipped test (automake test driver) */
+#define DSL_TEST_SKIP   77
+
+/** Number of pseudo random tables per kernel */
+#define DSL_TEST_ROUNDS 64
+
+static DSL_uint32_t nTestSeed = 1;
+
+static DSL_uint8_t  aTestSrc8[DSL_MAX_NSC];
+static DSL_uint16_t aTestSrc16[DSL_MAX_NSC];
+static DSL_uint8_t  aTestRef8[DSL_MAX_NSC];
+static DSL_uint8_t  aTestRes8[DSL_MAX_NSC];
+static DSL_int16_t  aTestRef16[DSL_MAX_NSC];
+static DSL_int16_t  aTestRes16[DSL_MAX_NSC];
+static VRX_SNR_t    aTestPairs[DSL_MAX_NSC/2];
+
+static DSL_uint32_t DSL_TEST_Random(DSL_void_t)
+{
+   nTestSeed = nTestSeed * 1103515245 + 12345;
+
+   return (nTestSeed >> 16) & 0x7FFF;
+}
+
+/* Fills the 8 bit source table, about every 16th value is invalid (255)*/
+static DSL_void_t DSL_TEST_Src8Fill(DSL_void_t)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < DSL_MAX_NSC; i++)
+   {
+      aTestSrc8[i] = (DSL_TEST_Random() & 0xF) ? (DSL_uint8_t)DSL_TEST_Random() : 255;
+   }
+}
+
+static uint64_t DSL_TEST_NsecGet(DSL_void_t)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static DSL_uint32_t DSL_TEST_Compare(
+   const DSL_char_t *pName,
+   const DSL_void_t *pRef,
+   const DSL_void_t *pRes,
+   DSL_uint32_t nSize)
+{
+   if (memcmp(pRef, pRes, nSize) != 0)
+   {
+      printf("%s: result differs from the reference" DSL_DRV_CRLF, pName);
+      return 1;
+   }
+
+   return 0;
+}
+
+/* Former pair copy of the SNR, QLN and BAT messages*/
+static DSL_void_t DSL_TEST_PairsUnpackRef(DSL_void_t)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < DSL_MAX_NSC/2; i++)
+   {
+      aTestRef8[2 * i]     = aTestPairs[i].snr_00;
+      aTestRef8[2 * i + 1] = aTestPairs[i].snr_01;
+   }
+}
+
+static DSL_void_t DSL_TEST_PairsUnpackRes(DSL_void_t)
+{
+   DSL_DRV_VRX_ToneDataPairsUnpack(aTestRes8, (DSL_uint8_t*)aTestPairs,
+      DSL_MAX_NSC/2);
+}
+
+/* Former sum of the bits per symbol*/
+static DSL_uint32_t nTestSumRef, nTestSumRes;
+
+static DSL_void_t DSL_TEST_SumRef(DSL_void_t)
+{
+   DSL_uint32_t i;
+
+   nTestSumRef = 0;
+   for (i = 0; i < DSL_MAX_NSC/2; i++)
+   {
+      nTestSumRef += aTestPairs[i].snr_00;
+      nTestSumRef += aTestPairs[i].snr_01;
+   }
+}
+
+static DSL_void_t DSL_TEST_SumRes(DSL_void_t)
+{
+   nTestSumRes = DSL_DRV_VRX_ToneDataSum((DSL_uint8_t*)aTestPairs, DSL_MAX_NSC);
+}
+
+/* Former Q8.8 SNR conversion of DSL_DRV_VRX_SnrAllocationTableNeGet*/
+static DSL_void_t DSL_TEST_SnrQ88Ref(DSL_void_t)
+{
+   DSL_uint32_t i;
+   DSL_uint16_t snrQ88, intPart;
+
+   for (i = 0; i < DSL_MAX_NSC; i++)
+   {
+      if (aTestSrc16[i] == Q88_NOVALUE)
+      {
+         aTestRef8[i] = 255;
+      }
+      else
+      {
+         snrQ88  = (DSL_uint16_t)(((aTestSrc16[i]) + (32 << 8)) * 2);
+         intPart = (snrQ88 >> 8) & 0xFF;
+
+         aTestRef8[i] =
+            (DSL_uint8_t)((snrQ88 & 0xFF) < 128 ? intPart : intPart + 1);
+      }
+   }
+}
+
+static DSL_void_t DSL_TEST_SnrQ88Res(DSL_void_t)
+{
+   DSL_DRV_VRX_ToneSnrQ88Convert(aTestRes8, (DSL_uint8_t*)aTestSrc16,
+      DSL_MAX_NSC);
+}
+
+/* Former DSL_DRV_VRX_SnrPerGroupCalculate*/
+static DSL_uint8_t nTestGroupSize = 8;
+
+static DSL_void_t DSL_TEST_GroupAverageRef(DSL_void_t)
+{
+   DSL_uint8_t *pDest = aTestRef8;
+   DSL_uint32_t nAvrg = 0, i = 0;
+
+   memcpy(aTestRef8, aTestSrc8, DSL_MAX_NSC);
+   while (i < DSL_MAX_NSC)
+   {
+      if (aTestRef8[i] == 255)
+      {
+         nAvrg += (nTestGroupSize * 255);
+      }
+      else
+      {
+         nAvrg += aTestRef8[i];
+      }
+
+      if ((i % nTestGroupSize) == (DSL_uint8_t)(nTestGroupSize - 1))
+      {
+         *pDest = (DSL_uint8_t)DSL_MIN(255, (nAvrg / nTestGroupSize));
+         nAvrg = 0;
+         pDest++;
+      }
+      i++;
+   }
+}
+
+static DSL_void_t DSL_TEST_GroupAverageRes(DSL_void_t)
+{
+   /* in place as in DSL_DRV_VRX_SnrPerGroupCalculate*/
+   memcpy(aTestRes8, aTestSrc8, DSL_MAX_NSC);
+   DSL_DRV_VRX_ToneGroupAverage(aTestRes8, aTestRes8,
+      (DSL_uint16_t)(DSL_MAX_NSC / nTestGroupSize), nTestGroupSize);
+}
+
+/* Minimum, maximum and mean of the valid values*/
+static DSL_uint16_t nTestStatsNum = DSL_MAX_NSC;
+
+static DSL_void_t DSL_TEST_StatsRef(DSL_void_t)
+{
+   DSL_uint32_t i, nSum = 0, nCount = 0;
+   DSL_uint8_t nMin = 255, nMax = 0;
+
+   for (i = 0; i < nTestStatsNum; i++)
+   {
+      if (aTestSrc8[i] == 255)
+         continue;
+
+      if (aTestSrc8[i] < nMin)
+         nMin = aTestSrc8[i];
+      if (aTestSrc8[i] > nMax)
+         nMax = aTestSrc8[i];
+      nSum += aTestSrc8[i];
+      nCount++;
+   }
+
+   aTestRef8[0] = nMin;
+   aTestRef8[1] = nCount ? nMax : 255;
+   aTestRef8[2] = nCount ? (DSL_uint8_t)(nSum / nCount) : 255;
+   aTestRef8[3] = (DSL_uint8_t)nCount;
+   aTestRef8[4] = (DSL_uint8_t)(nCount >> 8);
+}
+
+static DSL_void_t DSL_TEST_StatsRes(DSL_void_t)
+{
+   DSL_uint16_t nCount;
+
+   nCount = DSL_DRV_VRX_ToneStatsGet(aTestSrc8, nTestStatsNum,
+      &aTestRes8[0], &aTestRes8[1], &aTestRes8[2]);
+   aTestRes8[3] = (DSL_uint8_t)nCount;
+   aTestRes8[4] = (DSL_uint8_t)(nCount >> 8);
+}
+
+/* Hlog and QLN dB conversion, following the G.997.1 formulas*/
+static DSL_void_t DSL_TEST_HlogRef(DSL_void_t)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < DSL_MAX_NSC; i++)
+   {
+      if (aTestSrc16[i] == 1023)
+         aTestRef16[i] = DSL_VRX_TONE_DB_INVALID;
+      else
+         aTestRef16[i] = (DSL_int16_t)(10 * 6 - aTestSrc16[i]);
+   }
+}
+
+static DSL_void_t DSL_TEST_HlogRes(DSL_void_t)
+{
+   DSL_DRV_VRX_ToneHlogToDb(aTestRes16, aTestSrc16, DSL_MAX_NSC);
+}
+
+static DSL_void_t DSL_TEST_QlnRef(DSL_void_t)
+{
+   DSL_uint32_t i;
+
+   for (i = 0; i < DSL_MAX_NSC; i++)
+   {
+      if (aTestSrc8[i] == 255)
+         aTestRef16[i] = DSL_VRX_TONE_DB_INVALID;
+      else
+         aTestRef16[i] = (DSL_int16_t)(10 * (-23) - (10 * aTestSrc8[i]) / 2);
+   }
+}
+
+static DSL_void_t DSL_TEST_QlnRes(DSL_void_t)
+{
+   DSL_DRV_VRX_ToneQlnToDb(aTestRes16, aTestSrc8, DSL_MAX_NSC);
+}
+
+static DSL_int_t DSL_TEST_ToneExact(DSL_void_t)
+{
+   DSL_uint32_t nRound, i, nErrors = 0;
+
+   for (nRound = 0; nRound < DSL_TEST_ROUNDS; nRound++)
+   {
+      DSL_TEST_Src8Fill();
+      memcpy(aTestPairs, aTestSrc8, sizeof(aTestPairs));
+
+      DSL_TEST_PairsUnpackRef();
+      DSL_TEST_PairsUnpackRes();
+      nErrors += DSL_TEST_Compare("pairs unpack", aTestRef8, aTestRes8,
+         DSL_MAX_NSC);
+
+      DSL_TEST_SumRef();
+      DSL_TEST_SumRes();
+      nErrors += DSL_TEST_Compare("data sum", &nTestSumRef, &nTestSumRes,
+         sizeof(nTestSumRef));
+
+      for (nTestGroupSize = 1; nTestGroupSize <= 16; nTestGroupSize++)
+      {
+         DSL_TEST_GroupAverageRef();
+         DSL_TEST_GroupAverageRes();
+         nErrors += DSL_TEST_Compare("group average", aTestRef8, aTestRes8,
+            DSL_MAX_NSC / nTestGroupSize);
+      }
+
+      /* short tables, also without any valid value */
+      for (nTestStatsNum = 0; nTestStatsNum < 8; nTestStatsNum++)
+      {
+         DSL_TEST_StatsRef();
+         DSL_TEST_StatsRes();
+         nErrors += DSL_TEST_Compare("tone stats", aTestRef8, aTestRes8, 5);
+      }
+      nTestStatsNum = DSL_MAX_NSC;
+      DSL_TEST_StatsRef();
+      DSL_TEST_StatsRes();
+      nErrors += DSL_TEST_Compare("tone stats", aTestRef8, aTestRes8, 5);
+
+      /* all 256 inputs in every table */
+      for (i = 0; i < 256; i++)
+         aTestSrc8[(i * 7 + nRound) % DSL_MAX_NSC] = (DSL_uint8_t)i;
+      DSL_TEST_QlnRef();
+      DSL_TEST_QlnRes();
+      nErrors += DSL_TEST_Compare("QLN dB", aTestRef16, aTestRes16,
+         sizeof(aTestRef16));
+   }
+
+   /* all 65536 inputs of the 16 bit conversions */
+   for (nRound = 0; nRound < 0x10000 / DSL_MAX_NSC; nRound++)
+   {
+      for (i = 0; i < DSL_MAX_NSC; i++)
+         aTestSrc16[i] = (DSL_uint16_t)(nRound * DSL_MAX_NSC + i);
+
+      DSL_TEST_SnrQ88Ref();
+      DSL_TEST_SnrQ88Res();
+      nErrors += DSL_TEST_Compare("SNR Q8.8", aTestRef8, aTestRes8,
+         DSL_MAX_NSC);
+
+      DSL_TEST_HlogRef();
+      DSL_TEST_HlogRes();
+      nErrors += DSL_TEST_Compare("Hlog dB", aTestRef16, aTestRes16,
+         sizeof(aTestRef16));
+   }
+
+   printf("tone kernels: %u comparisons differ" DSL_DRV_CRLF, nErrors);
+
+   return nErrors ? 1 : 0;
+}
+
+/** Kernel and reference, called through pointers so that both are measured
+    as out of line calls */
+typedef DSL_void_t (*DSL_TEST_ToneFct_t)(DSL_void_t);
+
+typedef struct
+{
+   const DSL_char_t *pName;
+   DSL_TEST_ToneFct_t pRef;
+   DSL_TEST_ToneFct_t pRes;
+} DSL_TEST_ToneBench_t;
+
+static const DSL_TEST_ToneBench_t aTestBench[] =
+{
+   { "pairs unpack",  DSL_TEST_PairsUnpackRef,  DSL_TEST_PairsUnpackRes },
+   { "data sum",      DSL_TEST_SumRef,          DSL_TEST_SumRes },
+   { "SNR Q8.8",      DSL_TEST_SnrQ88Ref,       DSL_TEST_SnrQ88Res },
+   { "group average", DSL_TEST_GroupAverageRef, DSL_TEST_GroupAverageRes },
+   { "tone stats",    DSL_TEST_StatsRef,        DSL_TEST_StatsRes },
+   { "Hlog dB",       DSL_TEST_HlogRef,         DSL_TEST_HlogRes },
+   { "QLN dB",        DSL_TEST_QlnRef,          DSL_TEST_QlnRes }
+};
+
+static uint64_t DSL_TEST_ToneBenchRun(
+   DSL_TEST_ToneFct_t pFct,
+   DSL_uint32_t nPasses)
+{
+   volatile DSL_TEST_ToneFct_t pCall = pFct;
+   DSL_uint32_t nPass;
+   uint64_t nStart;
+
+   nStart = DSL_TEST_NsecGet();
+   for (nPass = 0; nPass < nPasses; nPass++)
+      pCall();
+
+   return DSL_TEST_NsecGet() - nStart;
+}
+
+static DSL_void_t DSL_TEST_ToneBench(DSL_uint32_t nPasses)
+{
+   DSL_uint32_t i;
+   uint64_t nRef, nRes;
+
+   DSL_TEST_Src8Fill();
+   memcpy(aTestPairs, aTestSrc8, sizeof(aTestPairs));
+   for (i = 0; i < DSL_MAX_NSC; i++)
+      aTestSrc16[i] = (DSL_uint16_t)(DSL_TEST_Random() & 0x3FF);
+   nTestGroupSize = 8;
+   nTestStatsNum = DSL_MAX_NSC;
+
+   printf("%-14s %14s %14s" DSL_DRV_CRLF, "kernel", "reference", "kernel");
+   for (i = 0; i < DSL_ARRAY_LENGTH(aTestBench); i++)
+   {
+      nRef = DSL_TEST_ToneBenchRun(aTestBench[i].pRef, nPasses);
+      nRes = DSL_TEST_ToneBenchRun(aTestBench[i].pRes, nPasses);
+
+      printf("%-14s %8.3f ns/tone %8.3f ns/tone" DSL_DRV_CRLF,
+         aTestBench[i].pName,
+         (double)nRef / ((double)DSL_MAX_NSC * nPasses),
+         (double)nRes / ((double)DSL_MAX_NSC * nPasses));
+   }
+}
+
+int main(int argc, char *argv[])
+{
+   DSL_uint32_t nPasses = 0;
+   DSL_int_t nRet, c;
+
+   while ((c = getopt(argc, argv, "b:")) != -1)
+   {
+      switch (c)
+      {
+      case 'b':
+         nPasses = (DSL_uint32_t)strtoul(optarg, DSL_NULL, 0);
+         break;
+      default:
+         fprintf(stderr, "usage: %s [-b <passes>]" DSL_DRV_CRLF, argv[0]);
+         return 2;
+      }
+   }
+
+   nRet = DSL_TEST_ToneExact();
+
+   if ((nRet == 0) && (nPasses > 0))
+      DSL_TEST_ToneBench(nPasses);
+
+   return nRet;
+}